@@ -0,0 +1,61 @@
+/**
+ * @file bench_support.h
+ * @brief Helpers shared by the benchmark programs
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#ifndef BENCH_BENCH_SUPPORT_H
+#define BENCH_BENCH_SUPPORT_H
+
+#include <iostream>
+#include <streambuf>
+
+namespace Bench
+{
+    /**
+     * @class NullBuffer
+     * @brief Stream buffer that swallows everything written to it
+     */
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override
+        {
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            return count;
+        }
+    };
+
+    /**
+     * @class RedirectConsole
+     * @brief Sends std::cout and std::cerr to another buffer while alive
+     *
+     * The code under test prints notes and warnings; they are discarded while
+     * it is timed and captured when a run has to be diagnosed.
+     */
+    class RedirectConsole
+    {
+    public:
+        explicit RedirectConsole(std::streambuf* sink) : out_(std::cout.rdbuf(sink)), err_(std::cerr.rdbuf(sink)) {}
+
+        ~RedirectConsole()
+        {
+            std::cout.rdbuf(out_);
+            std::cerr.rdbuf(err_);
+        }
+
+        RedirectConsole(const RedirectConsole&)            = delete;
+        RedirectConsole& operator=(const RedirectConsole&) = delete;
+
+    private:
+        std::streambuf* out_;
+        std::streambuf* err_;
+    };
+}  // namespace Bench
+
+#endif  // BENCH_BENCH_SUPPORT_H
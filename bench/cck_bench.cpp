@@ -0,0 +1,647 @@
+/**
+ * @file cck_bench.cpp
+ * @brief Throughput benchmark of the parsers, thermochemistry, symmetry detection and job checker
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * cck_bench writes a synthetic corpus (see corpus_generator.h), checks once
+ * that every file loads with the expected atoms and modes, and then times each
+ * stage over the whole corpus of every program:
+ * - extract:  extract(), the engine behind `cck extract`
+ * - load:     the LoadFile loader `cck thermo` uses for the program
+ * - thermo:   calc::calcthermo on the loaded systems
+ * - symmetry: symmetry::SymmetryDetector on the loaded geometries
+ * - check:    JobChecker::check_job_status, the tail read of `cck done`
+ *
+ * Every stage runs --repeat times on one thread; the best and mean wall times
+ * are reported as files/s and MB/s (per core) in a table and in a JSON file
+ * that later runs can be compared against. Console output of the code under
+ * test is discarded while it is timed.
+ */
+
+#include "bench_support.h"
+#include "corpus_generator.h"
+// The thermo headers go first: chemsys.h defines the constant R that
+// qc_extractor.h declares extern, and only in this order does it stay local
+#include "thermo/atommass.h"
+#include "thermo/calc.h"
+#include "thermo/chemsys.h"
+#include "thermo/loadfile.h"
+#include "thermo/symmetry.h"
+#include "thermo/util.h"
+#include "extraction/qc_extractor.h"
+#include "job_management/job_checker.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/version.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Defined in main.cpp for cck; extract() polls it
+std::atomic<bool> g_shutdown_requested{false};
+
+namespace
+{
+    enum class Stage
+    {
+        Extract,
+        Load,
+        Thermo,
+        Symmetry,
+        Check
+    };
+
+    const char* const STAGE_NAMES[] = {"extract", "load", "thermo", "symmetry", "check"};
+
+    struct BenchOptions
+    {
+        Bench::CorpusOptions        corpus;
+        std::vector<Bench::Program> programs = Bench::all_programs();
+        std::vector<Stage>          stages   = {Stage::Extract, Stage::Load, Stage::Thermo, Stage::Symmetry, Stage::Check};
+        int                         repeat   = 3;
+        std::string                 directory   = "cck_bench_corpus";
+        bool                        keep        = false;
+        ExtractionEngine            engine      = ExtractionEngine::SCANNER;
+        std::string                 engine_name = "scanner";
+        std::string                 output      = "cck_bench.json";
+    };
+
+    struct StageResult
+    {
+        Bench::Program program;
+        Stage          stage;
+        size_t         files        = 0;
+        std::uint64_t  bytes        = 0;  ///< 0 for stages that do not read the files
+        int            repeat       = 0;
+        double         best_seconds = 0.0;
+        double         mean_seconds = 0.0;
+        size_t         failures     = 0;
+    };
+
+    /// Results of the timed work go here so the compiler cannot drop it
+    volatile double g_sink = 0.0;
+
+    void print_usage()
+    {
+        std::cout << "Usage: cck_bench [options]\n\n"
+                  << "Writes a synthetic corpus of output files and reports the throughput of the parsers.\n\n"
+                  << "Corpus:\n"
+                  << "  --programs LIST   Programs to generate (default: all)\n"
+                  << "                    gaussian,orca,nwchem,qchem,gamess,cp2k,vasp\n"
+                  << "  --atoms N         Atoms per molecule (default: 24)\n"
+                  << "  --cycles N        Optimisation cycles before the frequency job (default: 10)\n"
+                  << "  --freqs N         Vibrational modes per file (default: 3N-6)\n"
+                  << "  --files N         Files per program (default: 20)\n"
+                  << "  --seed N          Seed of the generator (default: 2026)\n"
+                  << "  --dir PATH        Directory of the corpus (default: cck_bench_corpus)\n"
+                  << "  --keep            Keep the corpus after the run\n\n"
+                  << "Benchmark:\n"
+                  << "  --stages LIST     Stages to time (default: extract,load,thermo,symmetry,check)\n"
+                  << "  --repeat N        Timed passes per stage (default: 3)\n"
+                  << "  --engine NAME     Gaussian engine of extract: scanner|legacy|reverse|archive\n"
+                  << "  --out FILE        JSON results (default: cck_bench.json, '-' to skip)\n"
+                  << "  -h, --help        Show this help\n";
+    }
+
+    std::vector<std::string> split_list(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream        stream(list);
+        std::string              item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+            {
+                items.push_back(item);
+            }
+        }
+        return items;
+    }
+
+    int parse_count(const std::string& option, const std::string& value, int minimum)
+    {
+        size_t used   = 0;
+        int    number = 0;
+        try
+        {
+            number = std::stoi(value, &used);
+        }
+        catch (const std::exception&)
+        {
+            used = 0;
+        }
+        if (used != value.size() || number < minimum)
+        {
+            throw std::invalid_argument(option + " needs an integer >= " + std::to_string(minimum) + ", got '" +
+                                        value + "'");
+        }
+        return number;
+    }
+
+    BenchOptions parse_arguments(int argc, char* argv[])
+    {
+        BenchOptions options;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                print_usage();
+                std::exit(0);
+            }
+            if (arg == "--keep")
+            {
+                options.keep = true;
+                continue;
+            }
+            if (i + 1 >= argc)
+            {
+                throw std::invalid_argument("Unknown option or missing value: " + arg);
+            }
+            std::string value = argv[++i];
+            if (arg == "--programs")
+            {
+                options.programs.clear();
+                for (const auto& name : split_list(value))
+                {
+                    Bench::Program program;
+                    if (!Bench::parse_program(name, program))
+                    {
+                        throw std::invalid_argument("Unknown program: " + name);
+                    }
+                    options.programs.push_back(program);
+                }
+            }
+            else if (arg == "--stages")
+            {
+                options.stages.clear();
+                for (const auto& name : split_list(value))
+                {
+                    auto found = std::find(std::begin(STAGE_NAMES), std::end(STAGE_NAMES), name);
+                    if (found == std::end(STAGE_NAMES))
+                    {
+                        throw std::invalid_argument("Unknown stage: " + name);
+                    }
+                    options.stages.push_back(static_cast<Stage>(found - std::begin(STAGE_NAMES)));
+                }
+            }
+            else if (arg == "--atoms")
+            {
+                options.corpus.atoms = parse_count(arg, value, 3);
+            }
+            else if (arg == "--cycles")
+            {
+                options.corpus.opt_cycles = parse_count(arg, value, 0);
+            }
+            else if (arg == "--freqs")
+            {
+                options.corpus.frequencies = parse_count(arg, value, 1);
+            }
+            else if (arg == "--files")
+            {
+                options.corpus.files = parse_count(arg, value, 1);
+            }
+            else if (arg == "--seed")
+            {
+                options.corpus.seed = static_cast<std::uint64_t>(parse_count(arg, value, 0));
+            }
+            else if (arg == "--repeat")
+            {
+                options.repeat = parse_count(arg, value, 1);
+            }
+            else if (arg == "--dir")
+            {
+                options.directory = value;
+            }
+            else if (arg == "--engine")
+            {
+                static const std::pair<const char*, ExtractionEngine> engines[] = {
+                    {"scanner", ExtractionEngine::SCANNER},
+                    {"legacy", ExtractionEngine::LEGACY},
+                    {"reverse", ExtractionEngine::REVERSE},
+                    {"archive", ExtractionEngine::ARCHIVE}};
+                auto found = std::find_if(std::begin(engines), std::end(engines),
+                                          [&value](const auto& engine) { return value == engine.first; });
+                if (found == std::end(engines))
+                {
+                    throw std::invalid_argument("Unknown engine: " + value);
+                }
+                options.engine      = found->second;
+                options.engine_name = value;
+            }
+            else if (arg == "--out")
+            {
+                options.output = value;
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown option: " + arg);
+            }
+        }
+        if (options.programs.empty() || options.stages.empty())
+        {
+            throw std::invalid_argument("--programs and --stages need at least one entry");
+        }
+        return options;
+    }
+
+    /// Loader of `cck thermo` for the program of sys.inputfile, without settings.ini and printing
+    void load_system(SystemData& sys)
+    {
+        switch (util::deterprog(sys))
+        {
+            case util::QuantumChemistryProgram::Gaussian:
+                LoadFile::loadgau(sys);
+                break;
+            case util::QuantumChemistryProgram::Orca:
+                LoadFile::loadorca(sys);
+                break;
+            case util::QuantumChemistryProgram::Gamess:
+                LoadFile::loadgms(sys);
+                break;
+            case util::QuantumChemistryProgram::Nwchem:
+                LoadFile::loadnw(sys);
+                break;
+            case util::QuantumChemistryProgram::Cp2k:
+                LoadFile::loadCP2K(sys);
+                break;
+            case util::QuantumChemistryProgram::Vasp:
+                LoadFile::loadvasp(sys);
+                break;
+            case util::QuantumChemistryProgram::QChem:
+                LoadFile::loadqchem(sys);
+                break;
+            default:
+                throw std::runtime_error("program not recognised");
+        }
+    }
+
+    SystemData fresh_system(const std::string& path)
+    {
+        SystemData sys;
+        sys.inputfile = path;
+        sys.prtlevel  = 0;
+        sys.massmod   = 3;
+        return sys;
+    }
+
+    /// Rotational symmetry number of the geometry, as ThermoInterface computes it
+    int detect_rotsym(const SystemData& sys)
+    {
+        symmetry::SymmetryDetector detector;
+        detector.PGnameinit = sys.PGnameinit;
+        detector.ncenter    = static_cast<int>(sys.a.size());
+        detector.a          = sys.a;
+        detector.a_index.resize(sys.a.size());
+        std::iota(detector.a_index.begin(), detector.a_index.end(), 0);
+        detector.detectPG(0);
+        return detector.rotsym;
+    }
+
+    /// Remaining steps of ThermoInterface between loading and calcthermo
+    void prepare_thermo(SystemData& sys)
+    {
+        sys.nelevel = 1;
+        sys.elevel  = {0.0};
+        sys.edegen  = {std::max(1, sys.spinmult)};
+        sys.totmass = 0.0;
+        for (const auto& atom : sys.a)
+        {
+            sys.totmass += atom.mass;
+        }
+        calc::calcinertia(sys);
+        sys.ilinear = 0;
+        for (double inertia : sys.inert)
+        {
+            if (inertia < 0.001)
+            {
+                sys.ilinear = 1;
+                break;
+            }
+        }
+        sys.ncenter = static_cast<int>(sys.a.size());
+        sys.rotsym  = detect_rotsym(sys);
+        sys.freq.resize(static_cast<size_t>(sys.nfreq));
+        for (int i = 0; i < sys.nfreq; ++i)
+        {
+            sys.freq[static_cast<size_t>(i)] = sys.wavenum[static_cast<size_t>(i)] * wave2freq;
+        }
+    }
+
+    /**
+     * @brief Load every file once (untimed) and check it against the generator
+     * @return The loaded systems, ready for calcthermo
+     * @throws std::runtime_error with the captured loader output if a file does not match
+     */
+    std::vector<SystemData> validate_corpus(const std::vector<Bench::CorpusFile>& files,
+                                            const BenchOptions&                   options,
+                                            const ProcessingContext&              context)
+    {
+        std::vector<SystemData> systems;
+        systems.reserve(files.size());
+        size_t expected_atoms = static_cast<size_t>(options.corpus.atoms);
+        int    expected_modes = Bench::vibrational_modes(options.corpus);
+
+        for (const auto& file : files)
+        {
+            std::ostringstream captured;
+            std::string        problem;
+            SystemData         sys = fresh_system(file.path);
+            {
+                Bench::RedirectConsole redirect(captured.rdbuf());
+                try
+                {
+                    load_system(sys);
+                    if (sys.a.size() != expected_atoms || sys.nfreq != expected_modes)
+                    {
+                        problem = "loaded " + std::to_string(sys.a.size()) + " atoms and " +
+                                  std::to_string(sys.nfreq) + " modes, expected " + std::to_string(expected_atoms) +
+                                  " and " + std::to_string(expected_modes);
+                    }
+                    else if (extract(file.path, context).status != "DONE")
+                    {
+                        problem = "extract() did not report a finished job";
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    problem = e.what();
+                }
+            }
+            if (!problem.empty())
+            {
+                throw std::runtime_error(file.path + ": " + problem + "\n" + captured.str());
+            }
+            prepare_thermo(sys);
+            systems.push_back(std::move(sys));
+        }
+        return systems;
+    }
+
+    /**
+     * @brief Run @p work over @p count items options.repeat times
+     * @param work Returns false for an item that failed
+     */
+    template <typename Work>
+    StageResult time_stage(Bench::Program program, Stage stage, size_t count, std::uint64_t bytes, int repeat, Work work)
+    {
+        StageResult result;
+        result.program      = program;
+        result.stage        = stage;
+        result.files        = count;
+        result.bytes        = bytes;
+        result.repeat       = repeat;
+        result.best_seconds = 0.0;
+
+        Bench::NullBuffer      null_buffer;
+        Bench::RedirectConsole redirect(&null_buffer);
+        double                 total = 0.0;
+        for (int pass = 0; pass < repeat; ++pass)
+        {
+            size_t failures = 0;
+            auto   start    = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!work(i))
+                {
+                    ++failures;
+                }
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            total += seconds;
+            result.best_seconds = pass == 0 ? seconds : std::min(result.best_seconds, seconds);
+            result.failures     = failures;
+        }
+        result.mean_seconds = total / repeat;
+        return result;
+    }
+
+    std::vector<StageResult> run_program(Bench::Program                         program,
+                                         const std::vector<Bench::CorpusFile>&  files,
+                                         const BenchOptions&                    options,
+                                         const std::shared_ptr<ProcessingContext>& context)
+    {
+        std::vector<SystemData> systems = validate_corpus(files, options, *context);
+        std::uint64_t           bytes   = 0;
+        for (const auto& file : files)
+        {
+            bytes += file.bytes;
+        }
+
+        std::vector<StageResult> results;
+        for (Stage stage : options.stages)
+        {
+            switch (stage)
+            {
+                case Stage::Extract:
+                    results.push_back(time_stage(program, stage, files.size(), bytes, options.repeat, [&](size_t i) {
+                        try
+                        {
+                            Result result = extract(files[i].path, *context);
+                            g_sink        = g_sink + result.etgkj;
+                            return result.status == "DONE";
+                        }
+                        catch (const std::exception&)
+                        {
+                            return false;
+                        }
+                    }));
+                    break;
+                case Stage::Load:
+                    results.push_back(time_stage(program, stage, files.size(), bytes, options.repeat, [&](size_t i) {
+                        SystemData sys = fresh_system(files[i].path);
+                        try
+                        {
+                            load_system(sys);
+                        }
+                        catch (const std::exception&)
+                        {
+                            return false;
+                        }
+                        g_sink = g_sink + sys.E;
+                        return !sys.a.empty();
+                    }));
+                    break;
+                case Stage::Thermo:
+                    results.push_back(time_stage(program, stage, systems.size(), 0, options.repeat, [&](size_t i) {
+                        calc::ThermoResult thermo = calc::calcthermo(systems[i], 298.15, 1.0);
+                        g_sink                    = g_sink + thermo.corrG;
+                        return true;
+                    }));
+                    break;
+                case Stage::Symmetry:
+                    results.push_back(time_stage(program, stage, systems.size(), 0, options.repeat, [&](size_t i) {
+                        int rotsym = detect_rotsym(systems[i]);
+                        g_sink     = g_sink + rotsym;
+                        return rotsym > 0;
+                    }));
+                    break;
+                case Stage::Check:
+                {
+                    JobChecker checker(context, true);
+                    results.push_back(time_stage(program, stage, files.size(), bytes, options.repeat, [&](size_t i) {
+                        try
+                        {
+                            return checker.check_job_status(files[i].path).status != JobStatus::UNKNOWN;
+                        }
+                        catch (const std::exception&)
+                        {
+                            return false;
+                        }
+                    }));
+                    break;
+                }
+            }
+        }
+        return results;
+    }
+
+    void print_results(const std::vector<StageResult>& results)
+    {
+        std::cout << std::fixed;
+        std::cout << "\n"
+                  << std::left << std::setw(10) << "Program" << std::setw(10) << "Stage" << std::right << std::setw(7)
+                  << "Files" << std::setw(10) << "MB" << std::setw(11) << "Best s" << std::setw(11) << "Mean s"
+                  << std::setw(12) << "Files/s" << std::setw(10) << "MB/s" << std::setw(6) << "Fail" << "\n";
+        for (const auto& r : results)
+        {
+            double mb = static_cast<double>(r.bytes) / (1024.0 * 1024.0);
+            std::cout << std::left << std::setw(10) << Bench::program_name(r.program) << std::setw(10)
+                      << STAGE_NAMES[static_cast<size_t>(r.stage)] << std::right << std::setw(7) << r.files;
+            if (r.bytes > 0)
+            {
+                std::cout << std::setw(10) << std::setprecision(2) << mb;
+            }
+            else
+            {
+                std::cout << std::setw(10) << "-";
+            }
+            std::cout << std::setprecision(4) << std::setw(11) << r.best_seconds << std::setw(11) << r.mean_seconds
+                      << std::setprecision(1) << std::setw(12)
+                      << (r.best_seconds > 0.0 ? static_cast<double>(r.files) / r.best_seconds : 0.0);
+            if (r.bytes > 0 && r.best_seconds > 0.0)
+            {
+                std::cout << std::setw(10) << mb / r.best_seconds;
+            }
+            else
+            {
+                std::cout << std::setw(10) << "-";
+            }
+            std::cout << std::setw(6) << r.failures << "\n";
+        }
+        std::cout << "Single thread; files/s and MB/s use the best pass.\n";
+    }
+
+    void write_json(std::ostream& out, const BenchOptions& options, const std::vector<StageResult>& results)
+    {
+        out << std::setprecision(9);
+        out << "{\n  \"tool\": \"cck_bench\",\n  \"version\": ";
+        write_json_string(out, ComChemKit::get_version());
+        out << ",\n  \"options\": {\"atoms\": " << options.corpus.atoms << ", \"opt_cycles\": "
+            << options.corpus.opt_cycles << ", \"frequencies\": " << Bench::vibrational_modes(options.corpus)
+            << ", \"files\": " << options.corpus.files << ", \"seed\": " << options.corpus.seed
+            << ", \"repeat\": " << options.repeat << ", \"engine\": ";
+        write_json_string(out, options.engine_name);
+        out << ", \"threads\": 1},\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const StageResult& r    = results[i];
+            double             best = r.best_seconds;
+            out << (i == 0 ? "\n" : ",\n") << "    {\"program\": \"" << Bench::program_name(r.program)
+                << "\", \"stage\": \"" << STAGE_NAMES[static_cast<size_t>(r.stage)] << "\", \"files\": " << r.files
+                << ", \"bytes\": " << r.bytes << ", \"repeat\": " << r.repeat << ", \"best_seconds\": " << best
+                << ", \"mean_seconds\": " << r.mean_seconds
+                << ", \"files_per_second\": " << (best > 0.0 ? static_cast<double>(r.files) / best : 0.0)
+                << ", \"bytes_per_second\": " << (best > 0.0 ? static_cast<double>(r.bytes) / best : 0.0)
+                << ", \"failures\": " << r.failures << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    /// Remove what write_corpus() created, leaving anything else in the directory alone
+    void remove_corpus(const BenchOptions& options)
+    {
+        std::error_code error;
+        for (Bench::Program program : options.programs)
+        {
+            std::filesystem::remove_all(std::filesystem::path(options.directory) / Bench::program_name(program), error);
+        }
+        std::filesystem::remove(options.directory, error);  // Only succeeds if now empty
+    }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    try
+    {
+        options = parse_arguments(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n\n";
+        print_usage();
+        return 1;
+    }
+
+    SystemData mass_tables;
+    atommass::initmass(mass_tables);
+
+    auto context               = std::make_shared<ProcessingContext>(298.15, 1.0, 1000, false, false, 1);
+    context->extraction_engine = options.engine;
+
+    std::cout << "cck_bench " << ComChemKit::get_version() << ": " << options.corpus.files << " files x "
+              << options.programs.size() << " programs, " << options.corpus.atoms << " atoms, "
+              << options.corpus.opt_cycles << " cycles, " << Bench::vibrational_modes(options.corpus) << " modes, "
+              << options.repeat << " passes\n";
+
+    std::vector<StageResult> results;
+    int                      status = 0;
+    try
+    {
+        for (Bench::Program program : options.programs)
+        {
+            std::vector<Bench::CorpusFile> files = Bench::write_corpus(program, options.corpus, options.directory);
+            std::cout << "  " << Bench::program_name(program) << "..." << std::flush;
+            std::vector<StageResult> program_results = run_program(program, files, options, context);
+            results.insert(results.end(), program_results.begin(), program_results.end());
+            std::cout << " done\n";
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "\nError: " << e.what() << "\n";
+        status = 1;
+    }
+
+    if (!options.keep)
+    {
+        remove_corpus(options);
+    }
+    if (status != 0)
+    {
+        return status;
+    }
+
+    print_results(results);
+    if (options.output != "-")
+    {
+        std::ofstream out(options.output);
+        write_json(out, options, results);
+        if (!out)
+        {
+            std::cerr << "Error: cannot write " << options.output << "\n";
+            return 1;
+        }
+        std::cout << "Results written to " << options.output << "\n";
+    }
+    return 0;
+}
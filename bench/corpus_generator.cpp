@@ -0,0 +1,1203 @@
+/**
+ * @file corpus_generator.cpp
+ * @brief Implementation of the synthetic output files of cck_bench
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Every writer below follows the sections the matching LoadFile loader and
+ * the extract engine look for (see the real outputs under tests/); the text
+ * in between is only there so that the parsers skip as much as they would in
+ * a real file.
+ */
+
+#include "corpus_generator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__GNUC__)
+    #define BENCH_PRINTF(format_index, first_arg) __attribute__((format(printf, format_index, first_arg)))
+#else
+    #define BENCH_PRINTF(format_index, first_arg)
+#endif
+
+namespace Bench
+{
+    namespace
+    {
+        const double BOHR_PER_ANGSTROM = 1.0 / 0.52917720859;
+        const double HARTREE_TO_CM     = 219474.6363;
+        const double HARTREE_TO_KJ     = 2625.49961709828;
+        const double HARTREE_TO_EV     = 27.2113838;
+        const double CM_TO_THZ         = 0.0299792458;
+        const double CM_TO_MEV         = 0.1239841984;
+        const double BOND_LENGTH       = 1.45;  ///< Grid spacing of the generated molecules (Angstrom)
+
+        struct Element
+        {
+            const char* symbol;
+            int         number;
+            double      mass;    ///< Most abundant isotope (amu)
+            double      zeff;    ///< Valence charge written by CP2K and VASP
+            double      energy;  ///< Rough atomic contribution to the total energy (Hartree)
+        };
+
+        const Element ELEMENTS[] = {{"C", 6, 12.00000, 4.0, -37.846},
+                                    {"H", 1, 1.00783, 1.0, -0.500},
+                                    {"N", 7, 14.00307, 5.0, -54.584},
+                                    {"O", 8, 15.99491, 6.0, -75.065}};
+
+        /// Element of atom i is COMPOSITION[i % size]: roughly C4H7NO
+        const int COMPOSITION[] = {0, 1, 1, 0, 1, 3, 0, 1, 2, 1, 0, 1, 1};
+
+        /// splitmix64: a fixed sequence on every platform, unlike the <random> distributions
+        class Random
+        {
+        public:
+            explicit Random(std::uint64_t seed) : state_(seed) {}
+
+            std::uint64_t next()
+            {
+                std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+                z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z               = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                return z ^ (z >> 31);
+            }
+
+            double uniform(double low, double high)
+            {
+                return low + (high - low) * static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+        private:
+            std::uint64_t state_;
+        };
+
+        /// Output text built with printf formats (the fixed-width columns of the programs)
+        class Text
+        {
+        public:
+            BENCH_PRINTF(2, 3) void add(const char* format, ...)
+            {
+                char    buffer[512];
+                va_list args;
+                va_start(args, format);
+                int size = std::vsnprintf(buffer, sizeof(buffer), format, args);
+                va_end(args);
+                if (size > 0)
+                {
+                    out_.append(buffer, std::min(static_cast<size_t>(size), sizeof(buffer) - 1));
+                }
+            }
+
+            std::string take()
+            {
+                return std::move(out_);
+            }
+
+        private:
+            std::string out_;
+        };
+
+        struct Point
+        {
+            double x, y, z;
+        };
+
+        struct GenAtom
+        {
+            const Element* element;
+            Point          final;  ///< Converged geometry (Angstrom)
+            Point          shift;  ///< Offset of the first optimisation step
+        };
+
+        /**
+         * @brief One made-up molecule: geometry path, energies and frequencies
+         */
+        struct Molecule
+        {
+            std::vector<GenAtom> atoms;
+            std::vector<double>  modes;     ///< Vibrational wavenumbers (cm^-1), ascending
+            std::vector<double>  energies;  ///< Energy of every optimisation step (Hartree)
+            double               energy    = 0.0;  ///< Converged energy (Hartree)
+            double               zpe       = 0.0;  ///< Zero-point energy (Hartree)
+            double               repulsion = 0.0;  ///< Nuclear repulsion of the converged geometry (Hartree)
+
+            int steps() const
+            {
+                return static_cast<int>(energies.size());
+            }
+
+            /// 1 at the first optimisation step, 0 once converged
+            double lag(int step) const
+            {
+                return steps() > 1 ? static_cast<double>(steps() - 1 - step) / (steps() - 1) : 0.0;
+            }
+
+            Point at(size_t atom, double lag) const
+            {
+                const GenAtom& a = atoms[atom];
+                return {a.final.x + lag * a.shift.x, a.final.y + lag * a.shift.y, a.final.z + lag * a.shift.z};
+            }
+
+            double total_mass() const
+            {
+                double mass = 0.0;
+                for (const auto& atom : atoms)
+                {
+                    mass += atom.element->mass;
+                }
+                return mass;
+            }
+        };
+
+        int atom_count(const CorpusOptions& options)
+        {
+            return std::max(3, options.atoms);
+        }
+
+        /// Seed of file @p index; @p stream separates the molecule from the noise of each program
+        std::uint64_t file_seed(const CorpusOptions& options, int index, std::uint64_t stream)
+        {
+            return options.seed ^ (0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(index + 1)) ^
+                   (0xD1B54A32D192ED03ULL * stream);
+        }
+
+        Molecule build_molecule(const CorpusOptions& options, int index)
+        {
+            Random   random(file_seed(options, index, 0));
+            Molecule molecule;
+            int      count = atom_count(options);
+
+            // Atoms on a jittered cubic grid: no two atoms overlap and there is no symmetry to find
+            int side = 1;
+            while (side * side * side < count)
+            {
+                ++side;
+            }
+            double centre = 0.5 * (side - 1) * BOND_LENGTH;
+            double energy = 0.0;
+            molecule.atoms.reserve(static_cast<size_t>(count));
+            for (int i = 0; i < count; ++i)
+            {
+                GenAtom atom;
+                atom.element = &ELEMENTS[COMPOSITION[i % (sizeof(COMPOSITION) / sizeof(COMPOSITION[0]))]];
+                atom.final   = {(i % side) * BOND_LENGTH - centre + random.uniform(-0.12, 0.12),
+                                ((i / side) % side) * BOND_LENGTH - centre + random.uniform(-0.12, 0.12),
+                                (i / (side * side)) * BOND_LENGTH - centre + random.uniform(-0.12, 0.12)};
+                atom.shift   = {random.uniform(-0.08, 0.08), random.uniform(-0.08, 0.08), random.uniform(-0.08, 0.08)};
+                energy += atom.element->energy;
+                molecule.atoms.push_back(atom);
+            }
+            molecule.energy = energy + random.uniform(-0.05, 0.05);
+
+            int modes = vibrational_modes(options);
+            molecule.modes.reserve(static_cast<size_t>(modes));
+            double sum = 0.0;
+            for (int k = 0; k < modes; ++k)
+            {
+                double fraction = (k + 0.5) / modes;
+                double value    = (25.0 + 3475.0 * std::pow(fraction, 1.3)) * random.uniform(0.98, 1.02);
+                molecule.modes.push_back(value);
+                sum += value;
+            }
+            std::sort(molecule.modes.begin(), molecule.modes.end());
+            molecule.zpe = 0.5 * sum / HARTREE_TO_CM;
+
+            int steps = std::max(0, options.opt_cycles);
+            for (int step = 0; step < steps; ++step)
+            {
+                double lag = steps > 1 ? static_cast<double>(steps - 1 - step) / (steps - 1) : 0.0;
+                molecule.energies.push_back(molecule.energy + 0.015 * lag * lag + 1e-6 * lag);
+            }
+
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                for (size_t j = i + 1; j < molecule.atoms.size(); ++j)
+                {
+                    Point  a = molecule.atoms[i].final, b = molecule.atoms[j].final;
+                    double r = std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) +
+                                         (a.z - b.z) * (a.z - b.z)) *
+                               BOHR_PER_ANGSTROM;
+                    molecule.repulsion +=
+                        static_cast<double>(molecule.atoms[i].element->number * molecule.atoms[j].element->number) / r;
+                }
+            }
+            return molecule;
+        }
+
+        /// Fortran D-exponent number as NWChem writes it (7.3978501D-01)
+        std::string fortran_d(double value)
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%14.7E", value);
+            std::string text = buffer;
+            std::replace(text.begin(), text.end(), 'E', 'D');
+            return text;
+        }
+
+        // ---------------------------------------------------------------- Gaussian
+
+        void gaussian_job_header(Text& text, const char* route)
+        {
+            text.add(" \n Copyright (c) 1988-2019, Gaussian, Inc.  All Rights Reserved.\n \n");
+            text.add(" ******************************************\n");
+            text.add(" Gaussian 16:  ES64L-G16RevC.01  3-Jul-2019\n");
+            text.add("                 5-Jan-2026 \n");
+            text.add(" ******************************************\n");
+            text.add(" %%nprocshared=16\n %%mem=32GB\n");
+            text.add(" ----------------------------------\n %s\n ----------------------------------\n", route);
+            text.add(" Symbolic Z-matrix:\n Charge =  0 Multiplicity = 1\n");
+        }
+
+        void gaussian_orientation(Text& text, const Molecule& molecule, const char* label, double lag)
+        {
+            text.add("                          %s                          \n", label);
+            text.add(" ---------------------------------------------------------------------\n");
+            text.add(" Center     Atomic      Atomic             Coordinates (Angstroms)\n");
+            text.add(" Number     Number       Type             X           Y           Z\n");
+            text.add(" ---------------------------------------------------------------------\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                Point p = molecule.at(i, lag);
+                text.add(" %6zu%11d%12d%16.6f%12.6f%12.6f\n", i + 1, molecule.atoms[i].element->number, 0, p.x, p.y,
+                         p.z);
+            }
+            text.add(" ---------------------------------------------------------------------\n");
+        }
+
+        void gaussian_scf(Text& text, const Molecule& molecule, Random& random, double energy, double lag, int cycles)
+        {
+            text.add("       nuclear repulsion energy %20.10f Hartrees.\n", molecule.repulsion + 0.37 * lag);
+            text.add(" SCF Done:  E(RB3LYP) = %17.9f     A.U. after %4d cycles\n", energy, cycles);
+            text.add("            NFock= %3d  Conv=0.64D-08     -V/T= 2.0089\n", cycles);
+            text.add(" **********************************************************************\n\n");
+            text.add("            Population analysis using the SCF Density.\n\n");
+            text.add(" Mulliken charges:\n               1\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                text.add(" %5zu  %-2s %11.6f\n", i + 1, molecule.atoms[i].element->symbol, random.uniform(-0.6, 0.6));
+            }
+            text.add(" Sum of Mulliken charges =   0.00000\n");
+        }
+
+        void gaussian_forces(Text& text, const Molecule& molecule, Random& random, double lag)
+        {
+            text.add(" -------------------------------------------------------------------\n");
+            text.add(" Center     Atomic                   Forces (Hartrees/Bohr)\n");
+            text.add(" Number     Number              X              Y              Z\n");
+            text.add(" -------------------------------------------------------------------\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                double scale = 0.02 * lag + 1e-5;
+                text.add(" %6zu%9d       %15.9f%15.9f%15.9f\n", i + 1, molecule.atoms[i].element->number,
+                         random.uniform(-scale, scale), random.uniform(-scale, scale), random.uniform(-scale, scale));
+            }
+            text.add(" -------------------------------------------------------------------\n");
+        }
+
+        void gaussian_frequencies(Text& text, const Molecule& molecule, Random& random)
+        {
+            text.add(" Harmonic frequencies (cm**-1), IR intensities (KM/Mole), Raman scattering\n");
+            text.add(" activities (A**4/AMU), depolarization ratios for plane and unpolarized\n");
+            text.add(" incident light, reduced masses (AMU), force constants (mDyne/A),\n");
+            text.add(" and normal coordinates:\n");
+            size_t modes = molecule.modes.size();
+            for (size_t first = 0; first < modes; first += 3)
+            {
+                size_t columns = std::min<size_t>(3, modes - first);
+                text.add("                 ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%6zu                 ", first + c + 1);
+                }
+                text.add("\n                 ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("     A                 ");
+                }
+                text.add("\n Frequencies --");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add(c == 0 ? "%12.4f" : "%23.4f", molecule.modes[first + c]);
+                }
+                const char* rows[] = {" Red. masses --", " Frc consts  --", " IR Inten    --"};
+                for (const char* row : rows)
+                {
+                    text.add("\n%s", row);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add(c == 0 ? "%12.4f" : "%23.4f", random.uniform(0.5, 12.0));
+                    }
+                }
+                text.add("\n  Atom  AN");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("      X      Y      Z  ");
+                }
+                text.add("\n");
+                for (size_t i = 0; i < molecule.atoms.size(); ++i)
+                {
+                    text.add(" %5zu %3d  ", i + 1, molecule.atoms[i].element->number);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add("%7.2f%7.2f%7.2f  ", random.uniform(-0.3, 0.3), random.uniform(-0.3, 0.3),
+                                 random.uniform(-0.3, 0.3));
+                    }
+                    text.add("\n");
+                }
+            }
+        }
+
+        void write_gaussian(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            text.add(" Entering Gaussian System, Link 0=g16\n");
+            text.add(" Input=bench-%04d.gjf\n Output=bench-%04d.log\n", index + 1, index + 1);
+            text.add(" Initial command:\n /apps/gaussian/g16/l1.exe \"/scratch/Gau-%d.inp\" -scrdir=\"/scratch/\"\n",
+                     20000 + index);
+
+            if (molecule.steps() > 0)
+            {
+                gaussian_job_header(text, "#P B3LYP/6-31G(d) Opt");
+                for (int step = 0; step < molecule.steps(); ++step)
+                {
+                    double lag = molecule.lag(step);
+                    text.add(" Berny optimization.\n");
+                    gaussian_orientation(text, molecule, "Input orientation:", lag);
+                    gaussian_orientation(text, molecule, "Standard orientation:", lag);
+                    gaussian_scf(text, molecule, random, molecule.energies[static_cast<size_t>(step)], lag,
+                                 12 + step % 7);
+                    gaussian_forces(text, molecule, random, lag);
+                    text.add(" Step number %3d out of a maximum of  %3d\n", step + 1, 2 * molecule.steps() + 20);
+                }
+                text.add("    -- Stationary point found.\n");
+                text.add(" Normal termination of Gaussian 16 at Mon Jan  5 12:00:00 2026.\n");
+                text.add(" Link1:  Proceeding to internal job step number  2.\n");
+            }
+
+            gaussian_job_header(text, "#P Geom=AllCheck Guess=TCheck B3LYP/6-31G(d) Freq");
+            gaussian_orientation(text, molecule, "Standard orientation:", 0.0);
+            gaussian_scf(text, molecule, random, molecule.energy, 0.0, 1);
+            gaussian_frequencies(text, molecule, random);
+
+            text.add(" \n -------------------\n - Thermochemistry -\n -------------------\n");
+            text.add(" Temperature   298.150 Kelvin.  Pressure   1.00000 Atm.\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                text.add(" Atom %5zu has atomic number %2d and mass %9.5f\n", i + 1, element.number, element.mass);
+            }
+            text.add(" Molecular mass: %12.5f amu.\n", molecule.total_mass());
+            double thermal_e = molecule.zpe + 0.0142;
+            double thermal_h = thermal_e + 0.000944;
+            double thermal_g = thermal_h - 0.0568;
+            text.add(" Zero-point correction=                      %12.6f (Hartree/Particle)\n", molecule.zpe);
+            text.add(" Thermal correction to Energy=               %12.6f\n", thermal_e);
+            text.add(" Thermal correction to Enthalpy=             %12.6f\n", thermal_h);
+            text.add(" Thermal correction to Gibbs Free Energy=    %12.6f\n", thermal_g);
+            text.add(" Sum of electronic and zero-point Energies=     %16.6f\n", molecule.energy + molecule.zpe);
+            text.add(" Sum of electronic and thermal Energies=        %16.6f\n", molecule.energy + thermal_e);
+            text.add(" Sum of electronic and thermal Enthalpies=      %16.6f\n", molecule.energy + thermal_h);
+            text.add(" Sum of electronic and thermal Free Energies=   %16.6f\n", molecule.energy + thermal_g);
+            text.add(" Job cpu time:       0 days  0 hours 14 minutes 21.5 seconds.\n");
+            text.add(" Elapsed time:       0 days  0 hours  0 minutes 54.1 seconds.\n");
+            text.add(" Normal termination of Gaussian 16 at Mon Jan  5 12:01:00 2026.\n");
+        }
+
+        // ---------------------------------------------------------------- ORCA
+
+        void write_orca(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            size_t atoms = molecule.atoms.size();
+            text.add("\n                                 *****************\n");
+            text.add("                                 * O   R   C   A *\n");
+            text.add("                                 *****************\n\n");
+            text.add("                         Program Version 5.0.4 -  RELEASE  -\n\n");
+            text.add("================================================================================\n");
+            text.add("                                       INPUT FILE\n");
+            text.add("================================================================================\n");
+            text.add("NAME = bench-%04d.inp\n|  1> ! B3LYP def2-SVP Opt Freq\n|  2> * xyzfile 0 1 bench.xyz\n\n",
+                     index + 1);
+
+            int steps = std::max(1, molecule.steps());
+            for (int step = 0; step < steps; ++step)
+            {
+                double lag    = molecule.steps() > 0 ? molecule.lag(step) : 0.0;
+                double energy = molecule.steps() > 0 ? molecule.energies[static_cast<size_t>(step)] : molecule.energy;
+                if (molecule.steps() > 0)
+                {
+                    text.add("\n                         *************************************\n");
+                    text.add("                         *    GEOMETRY OPTIMIZATION CYCLE %3d *\n", step + 1);
+                    text.add("                         *************************************\n");
+                }
+                text.add("---------------------------------\nCARTESIAN COORDINATES (ANGSTROEM)\n");
+                text.add("---------------------------------\n");
+                for (size_t i = 0; i < atoms; ++i)
+                {
+                    Point p = molecule.at(i, lag);
+                    text.add("  %-2s %13.6f %11.6f %11.6f\n", molecule.atoms[i].element->symbol, p.x, p.y, p.z);
+                }
+                text.add("\n----------------------------\nCARTESIAN COORDINATES (A.U.)\n");
+                text.add("----------------------------\n");
+                text.add("  NO LB      ZA    FRAG     MASS         X           Y           Z\n");
+                for (size_t i = 0; i < atoms; ++i)
+                {
+                    const Element& element = *molecule.atoms[i].element;
+                    Point          p       = molecule.at(i, lag);
+                    text.add(" %3zu %-2s %8.4f %4d %9.3f %12.6f %11.6f %11.6f\n", i, element.symbol,
+                             static_cast<double>(element.number), 0, element.mass, p.x * BOHR_PER_ANGSTROM,
+                             p.y * BOHR_PER_ANGSTROM, p.z * BOHR_PER_ANGSTROM);
+                }
+                text.add("\n--------------------\nGENERAL SETTINGS\n--------------------\n");
+                text.add("Number of atoms                         .... %5zu\n", atoms);
+                text.add("Total Charge           Charge          ....    0\n");
+                text.add("Multiplicity           Mult            ....    1\n\n");
+                text.add("                       *****************************************************\n");
+                text.add("                       *                     SUCCESS                       *\n");
+                text.add("                       *           SCF CONVERGED AFTER  %2d CYCLES          *\n",
+                         10 + step % 6);
+                text.add("                       *****************************************************\n\n");
+                text.add("Expectation value of <S**2>     :     0.000000\n");
+                text.add("Ideal value S*(S+1) for S=0.0   :     0.000000\n\n");
+                text.add("-------------------------   --------------------\n");
+                text.add("FINAL SINGLE POINT ENERGY %20.9f\n", energy);
+                text.add("-------------------------   --------------------\n\n");
+            }
+            if (molecule.steps() > 0)
+            {
+                text.add("                    ***********************HURRAY********************\n");
+                text.add("                    ***        THE OPTIMIZATION HAS CONVERGED     ***\n");
+                text.add("                    *******************************************************\n\n");
+            }
+
+            text.add("-----------------------\nVIBRATIONAL FREQUENCIES\n-----------------------\n\n");
+            text.add("Scaling factor for frequencies =  1.000000000  (already applied!)\n\n");
+            size_t zero_modes = 3 * atoms - molecule.modes.size();
+            for (size_t m = 0; m < zero_modes; ++m)
+            {
+                text.add("%4zu: %12.2f cm**-1\n", m, 0.0);
+            }
+            for (size_t m = 0; m < molecule.modes.size(); ++m)
+            {
+                text.add("%4zu: %12.2f cm**-1\n", zero_modes + m, molecule.modes[m]);
+            }
+
+            // The 3N x 3N normal mode matrix is most of a real ORCA frequency output
+            text.add("\n\n------------\nNORMAL MODES\n------------\n\n");
+            size_t dimension = 3 * atoms;
+            for (size_t first = 0; first < dimension; first += 6)
+            {
+                size_t columns = std::min<size_t>(6, dimension - first);
+                text.add("       ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%11zu", first + c);
+                }
+                text.add("\n");
+                for (size_t row = 0; row < dimension; ++row)
+                {
+                    text.add("%6zu    ", row);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add("%11.6f", first + c < zero_modes ? 0.0 : random.uniform(-0.4, 0.4));
+                    }
+                    text.add("\n");
+                }
+            }
+
+            text.add("\n-----------\nIR SPECTRUM\n-----------\n\n");
+            text.add(" Mode   freq       eps      Int      T**2         TX        TY        TZ\n");
+            text.add("       cm**-1   L/(mol*cm) km/mol    a.u.\n");
+            text.add("----------------------------------------------------------------------------\n");
+            for (size_t m = 0; m < molecule.modes.size(); ++m)
+            {
+                double intensity = random.uniform(0.0, 80.0);
+                text.add("%4zu: %9.2f %10.6f %8.2f %10.6f  (%9.6f %9.6f %9.6f)\n", zero_modes + m, molecule.modes[m],
+                         intensity * 0.005, intensity, intensity * 0.0002, random.uniform(-0.1, 0.1),
+                         random.uniform(-0.1, 0.1), random.uniform(-0.1, 0.1));
+            }
+
+            text.add("\n--------------------------\nTHERMOCHEMISTRY AT 298.15K\n--------------------------\n\n");
+            text.add("Temperature         ...   298.15 K\nPressure            ...     1.00 atm\n");
+            text.add("Total Mass          ... %8.2f AMU\n\n", molecule.total_mass());
+            text.add("Zero point energy                ... %14.8f Eh %10.2f kcal/mol\n", molecule.zpe,
+                     molecule.zpe * 627.509);
+            text.add("Final Gibbs free energy         ... %16.8f Eh\n\n", molecule.energy + molecule.zpe - 0.0426);
+            text.add("                             ****ORCA TERMINATED NORMALLY****\n");
+            text.add("TOTAL RUN TIME: 0 days 0 hours 1 minutes 12 seconds 345 msec\n");
+        }
+
+        // ---------------------------------------------------------------- NWChem
+
+        void nwchem_geometry(Text& text, const Molecule& molecule, double lag)
+        {
+            text.add("\n                             Geometry \"geometry\" -> \"\"\n");
+            text.add("                             -------------------------\n\n");
+            text.add(" Output coordinates in angstroms (scale by  1.889725989 to convert to a.u.)\n\n");
+            text.add("  No.       Tag          Charge          X              Y              Z\n");
+            text.add(" ---- ---------------- ---------- -------------- -------------- --------------\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                Point          p       = molecule.at(i, lag);
+                text.add(" %4zu %-16s %10.4f %14.8f %14.8f %14.8f\n", i + 1, element.symbol,
+                         static_cast<double>(element.number), p.x, p.y, p.z);
+            }
+            text.add("\n");
+        }
+
+        void write_nwchem(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            size_t atoms = molecule.atoms.size();
+            text.add("              Northwest Computational Chemistry Package (NWChem) 7.0.2\n");
+            text.add("              --------------------------------------------------------\n\n");
+            text.add("                    Environmental Molecular Sciences Laboratory\n");
+            text.add("                       Pacific Northwest National Laboratory\n\n");
+            text.add("           Job information\n           ---------------\n\n");
+            text.add("    hostname        = bench\n    program         = nwchem\n");
+            text.add("    input           = bench-%04d.nw\n    nproc           =       16\n\n", index + 1);
+
+            nwchem_geometry(text, molecule, molecule.steps() > 0 ? 1.0 : 0.0);
+            text.add("                                 NWChem DFT Module\n");
+            text.add("                                 -----------------\n\n");
+            text.add("  General Information\n  -------------------\n");
+            text.add("          SCF calculation type: DFT\n          Wavefunction type:  closed shell.\n");
+            text.add("          No. of atoms     : %5zu\n", atoms);
+            text.add("          Charge           :     0\n");
+            text.add("          Spin multiplicity:     1\n\n");
+
+            for (int step = 0; step < molecule.steps(); ++step)
+            {
+                double lag = molecule.lag(step);
+                nwchem_geometry(text, molecule, lag);
+                text.add("         Total DFT energy = %22.12f\n", molecule.energies[static_cast<size_t>(step)]);
+                text.add("      One electron energy = %22.12f\n", -3.1 * molecule.repulsion);
+                text.add("           Coulomb energy = %22.12f\n", 1.4 * molecule.repulsion);
+                text.add(" Nuclear repulsion energy = %22.12f\n\n", molecule.repulsion + 0.37 * lag);
+                text.add("@ Step       Energy      Delta E   Gmax     Grms     Xrms     Xmax   Walltime\n");
+                text.add("@ ---- ---------------- -------- -------- -------- -------- -------- --------\n");
+                text.add("@ %4d %16.8f %8.1e %8.5f %8.5f %8.5f %8.5f %8.1f\n\n", step,
+                         molecule.energies[static_cast<size_t>(step)], -1e-3 * lag, 0.02 * lag + 1e-5,
+                         0.005 * lag + 1e-6, 0.01 * lag, 0.03 * lag, 10.0 + step);
+            }
+
+            text.add("\n                         NWChem Nuclear Hessian and Frequency Analysis\n");
+            text.add("                         ---------------------------------------------\n\n");
+            text.add("         Total DFT energy = %22.12f\n\n", molecule.energy);
+            text.add(" ---------------------------- Atom information ----------------------------\n");
+            text.add("     atom    #        X              Y              Z            mass\n");
+            text.add(" --------------------------------------------------------------------------\n");
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                Point          p       = molecule.at(i, 0.0);
+                text.add("    %-2s %8zu %s %s %s %s\n", element.symbol, i + 1, fortran_d(p.x * BOHR_PER_ANGSTROM).c_str(),
+                         fortran_d(p.y * BOHR_PER_ANGSTROM).c_str(), fortran_d(p.z * BOHR_PER_ANGSTROM).c_str(),
+                         fortran_d(element.mass).c_str());
+            }
+            text.add(" --------------------------------------------------------------------------\n\n");
+
+            size_t zero_modes = 3 * atoms - molecule.modes.size();
+            text.add(" ----------------------------------------------------------------------------\n");
+            text.add(" Normal Eigenvalue ||    Projected Derivative Dipole Moments (debye/angs)\n");
+            text.add("  Mode   [cm**-1]  ||      [d/dqX]             [d/dqY]           [d/dqZ]\n");
+            text.add(" ------ ---------- || ------------------ ------------------ -----------------\n");
+            for (size_t m = 0; m < zero_modes + molecule.modes.size(); ++m)
+            {
+                double value = m < zero_modes ? 0.0 : molecule.modes[m - zero_modes];
+                text.add(" %5zu %12.3f || %11.3f %19.3f %18.3f\n", m + 1, value, random.uniform(-1.0, 1.0),
+                         random.uniform(-1.0, 1.0), random.uniform(-1.0, 1.0));
+            }
+            text.add(" ----------------------------------------------------------------------------\n\n");
+            text.add(" Total times  cpu:       61.2s     wall:       64.8s\n");
+        }
+
+        // ---------------------------------------------------------------- Q-Chem
+
+        void qchem_orientation(Text& text, const Molecule& molecule, double lag)
+        {
+            text.add("             Standard Nuclear Orientation (Angstroms)\n");
+            text.add("    I     Atom           X                Y                Z\n");
+            text.add(" ----------------------------------------------------------------\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                Point p = molecule.at(i, lag);
+                text.add(" %4zu      %-2s %16.10f %16.10f %16.10f\n", i + 1, molecule.atoms[i].element->symbol, p.x, p.y,
+                         p.z);
+            }
+            text.add(" ----------------------------------------------------------------\n");
+        }
+
+        void write_qchem(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            size_t atoms = molecule.atoms.size();
+            text.add("                  Welcome to Q-Chem\n");
+            text.add("     A Quantum Leap Into The Future Of Chemistry\n\n");
+            text.add(" Q-Chem 6.1, Q-Chem, Inc., Pleasanton, CA (2023)\n\n");
+            text.add(" Q-Chem begins on Mon Jan  5 12:00:00 2026  (bench-%04d)\n\n", index + 1);
+            text.add("--------------------------------------------------------------\nUser input:\n");
+            text.add("--------------------------------------------------------------\n$molecule\n0 1\n");
+            double start = molecule.steps() > 0 ? 1.0 : 0.0;
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                Point p = molecule.at(i, start);
+                text.add("%-2s %12.7f %12.7f %12.7f\n", molecule.atoms[i].element->symbol, p.x, p.y, p.z);
+            }
+            text.add("$end\n\n$rem\n   JOBTYPE  %s\n   METHOD   b3lyp\n   BASIS    6-31G*\n$end\n",
+                     molecule.steps() > 0 ? "opt" : "freq");
+            text.add("--------------------------------------------------------------\n");
+
+            for (int step = 0; step < molecule.steps(); ++step)
+            {
+                double lag = molecule.lag(step);
+                qchem_orientation(text, molecule, lag);
+                text.add(" Nuclear Repulsion Energy = %18.10f hartrees\n", molecule.repulsion + 0.37 * lag);
+                text.add(" SCF   energy = %16.8f\n", molecule.energies[static_cast<size_t>(step)]);
+                text.add(" Total energy = %16.8f\n", molecule.energies[static_cast<size_t>(step)]);
+                text.add("\n ** OPTIMIZATION STEP %d **  Gradient %10.6f\n\n", step + 1, 0.02 * lag + 1e-5);
+            }
+            if (molecule.steps() > 0)
+            {
+                text.add("\t**  OPTIMIZATION CONVERGED  **\n\n");
+                text.add("Running Job 2 of 2 bench-%04d.in\n", index + 1);
+                text.add("--------------------------------------------------------------\nUser input:\n");
+                text.add("--------------------------------------------------------------\n$molecule\nread\n$end\n");
+                text.add("\n$rem\n   JOBTYPE  freq\n   METHOD   b3lyp\n   BASIS    6-31G*\n$end\n");
+                text.add("--------------------------------------------------------------\n");
+            }
+
+            qchem_orientation(text, molecule, 0.0);
+            text.add(" Nuclear Repulsion Energy = %18.10f hartrees\n", molecule.repulsion);
+            text.add(" SCF   energy = %16.8f\n", molecule.energy);
+            text.add(" Total energy = %16.8f\n\n", molecule.energy);
+
+            text.add(" **********************************************************************\n");
+            text.add(" **                                                                  **\n");
+            text.add(" **                       VIBRATIONAL ANALYSIS                       **\n");
+            text.add(" **                       --------------------                       **\n");
+            text.add(" **                                                                  **\n");
+            text.add(" **        VIBRATIONAL FREQUENCIES (CM**-1) AND NORMAL MODES         **\n");
+            text.add(" **********************************************************************\n\n\n");
+            size_t modes = molecule.modes.size();
+            for (size_t first = 0; first < modes; first += 3)
+            {
+                size_t columns = std::min<size_t>(3, modes - first);
+                text.add(" Mode:    ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add(c == 0 ? "%13zu" : "%23zu", first + c + 1);
+                }
+                text.add("\n Frequency:");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add(c == 0 ? "%13.2f" : "%23.2f", molecule.modes[first + c]);
+                }
+                const char* rows[] = {" Force Cnst:", " Red. Mass: ", " IR Intens: "};
+                for (const char* row : rows)
+                {
+                    text.add("\n%s", row);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add(c == 0 ? "%12.4f" : "%23.4f", random.uniform(0.1, 12.0));
+                    }
+                }
+                text.add("\n               ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("X      Y      Z        ");
+                }
+                text.add("\n");
+                for (size_t i = 0; i < atoms; ++i)
+                {
+                    text.add(" %-2s       ", molecule.atoms[i].element->symbol);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add("%7.3f%7.3f%7.3f  ", random.uniform(-0.5, 0.5), random.uniform(-0.5, 0.5),
+                                 random.uniform(-0.5, 0.5));
+                    }
+                    text.add("\n");
+                }
+                text.add("\n");
+            }
+
+            text.add(" STANDARD THERMODYNAMIC QUANTITIES AT   298.15 K  AND     1.00 ATM\n\n");
+            text.add("   This Molecule has  0 Imaginary Frequencies\n");
+            text.add("   Zero point vibrational energy: %12.3f kcal/mol\n\n", molecule.zpe * 627.509);
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                text.add("   Atom %4zu Element %-2s Has Mass %10.5f\n", i + 1, element.symbol, element.mass);
+            }
+            text.add("   Molecular Mass: %12.6f amu\n\n", molecule.total_mass());
+            text.add("        *  Thank you very much for using Q-Chem.  Have a nice day.  *\n");
+        }
+
+        // ---------------------------------------------------------------- GAMESS-US
+
+        void gamess_coordinates(Text& text, const Molecule& molecule, double lag, const char* title)
+        {
+            text.add(" %s\n   ATOM   CHARGE       X              Y              Z\n", title);
+            text.add(" ------------------------------------------------------------\n");
+            for (size_t i = 0; i < molecule.atoms.size(); ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                Point          p       = molecule.at(i, lag);
+                text.add(" %-2s %14.1f %15.10f %15.10f %15.10f\n", element.symbol, static_cast<double>(element.number),
+                         p.x, p.y, p.z);
+            }
+            text.add("\n");
+        }
+
+        void write_gamess(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            size_t atoms = molecule.atoms.size();
+            text.add("\n          ******************************************************\n");
+            text.add("          *         GAMESS VERSION = 30 JUN 2023 (R2)          *\n");
+            text.add("          *             FROM IOWA STATE UNIVERSITY             *\n");
+            text.add("          ******************************************************\n");
+            text.add(" EXECUTION OF GAMESS BEGUN Mon Jan  5 12:00:00 2026\n\n");
+            text.add(" INPUT CARD> $CONTRL SCFTYP=RHF RUNTYP=%s $END\n", molecule.steps() > 0 ? "OPTIMIZE" : "HESSIAN");
+            text.add(" INPUT CARD> $DATA\n INPUT CARD>bench-%04d\n\n", index + 1);
+            text.add(" ATOM      ATOMIC                      COORDINATES (BOHR)\n");
+            text.add("           CHARGE         X                   Y                   Z\n");
+            double start = molecule.steps() > 0 ? 1.0 : 0.0;
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                Point          p       = molecule.at(i, start);
+                text.add(" %-2s %14.1f %19.10f %19.10f %19.10f\n", element.symbol, static_cast<double>(element.number),
+                         p.x * BOHR_PER_ANGSTROM, p.y * BOHR_PER_ANGSTROM, p.z * BOHR_PER_ANGSTROM);
+            }
+            text.add("\n     TOTAL NUMBER OF BASIS SET SHELLS             = %5zu\n", 4 * atoms);
+            text.add("     TOTAL NUMBER OF ATOMS                        = %5zu\n", atoms);
+            text.add("     CHARGE OF MOLECULE                           =     0\n");
+            text.add("     SPIN MULTIPLICITY                            =     1\n\n");
+
+            for (int step = 0; step < molecule.steps(); ++step)
+            {
+                double lag    = molecule.lag(step);
+                double energy = molecule.energies[static_cast<size_t>(step)];
+                text.add("\n          FINAL RHF ENERGY IS %20.10f AFTER  %2d ITERATIONS\n", energy, 11 + step % 5);
+                text.add(" NSERCH: %4d  E= %20.10f  GRAD. MAX=  %.7f  R.M.S.=  %.7f\n", step, energy,
+                         0.02 * lag + 1e-5, 0.005 * lag + 1e-6);
+                gamess_coordinates(text, molecule, lag, "COORDINATES OF ALL ATOMS ARE (ANGS)");
+            }
+            if (molecule.steps() > 0)
+            {
+                text.add("\n     ***** EQUILIBRIUM GEOMETRY LOCATED *****\n");
+                gamess_coordinates(text, molecule, 0.0, "COORDINATES OF SYMMETRY UNIQUE ATOMS (ANGS)");
+            }
+
+            // The line after the last "FINAL" holds the energy GAMESS-US is loaded with
+            text.add("\n          FINAL RHF ENERGY IS %20.10f AFTER   1 ITERATIONS\n", molecule.energy);
+            text.add("                         TOTAL ENERGY = %20.10f\n\n", molecule.energy);
+            text.add(" ATOMIC WEIGHTS (AMU)\n\n");
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                text.add(" %5zu     %-2s %20.5f\n", i + 1, element.symbol, element.mass);
+            }
+            size_t zero_modes = 3 * atoms - molecule.modes.size();
+            text.add("\n     MODES 1 TO %zu ARE TAKEN AS ROTATIONS AND TRANSLATIONS.\n\n", zero_modes);
+            text.add(" MODE FREQ(CM**-1)  SYMMETRY  RED. MASS  IR INTENS.\n");
+            for (size_t m = 0; m < zero_modes + molecule.modes.size(); ++m)
+            {
+                double value = m < zero_modes ? 0.0 : molecule.modes[m - zero_modes];
+                text.add(" %4zu %11.3f    A    %10.6f %10.5f\n", m + 1, value, random.uniform(1.0, 12.0),
+                         random.uniform(0.0, 2.0));
+            }
+            text.add("\n     THERMOCHEMISTRY AT T=  298.15 K\n\n");
+            text.add(" %5zu TO %4zu VIBRATIONAL MODES ARE USED IN THERMOCHEMISTRY.\n", zero_modes + 1,
+                     zero_modes + molecule.modes.size());
+            text.add(" THE HARMONIC ZERO POINT ENERGY IS (SCALED BY   1.000)\n");
+            text.add("       %.6f HARTREE/MOLECULE %12.3f KCAL/MOL\n\n", molecule.zpe, molecule.zpe * 627.509);
+            text.add(" EXECUTION OF GAMESS TERMINATED NORMALLY Mon Jan  5 12:01:00 2026\n");
+        }
+
+        // ---------------------------------------------------------------- CP2K
+
+        void write_cp2k(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            size_t atoms = molecule.atoms.size();
+            text.add(" DBCSR| CPU Multiplication driver                                           XSMM\n");
+            text.add(" **** **** ******  **  PROGRAM STARTED AT               2026-01-05 12:00:00.000\n");
+            text.add(" CP2K| version string:                                          CP2K version 2023.1\n");
+            text.add(" CP2K| source code revision number:                                  git:bench%02d\n",
+                     index % 100);
+            text.add(" GLOBAL| Run type                                                      %s\n",
+                     molecule.steps() > 0 ? "GEO_OPT" : "VIBRATIONAL_ANALYSIS");
+            text.add(" DFT| Spin restricted Kohn-Sham (RKS) calculation                            RKS\n");
+            text.add(" DFT| Multiplicity                                                             1\n");
+            text.add(" DFT| Number of spin states                                                    1\n\n");
+            text.add(" TOTAL NUMBERS AND MAXIMUM NUMBERS\n\n");
+            text.add("  Total number of            - Atomic kinds:                                   4\n");
+            text.add("                             - Atoms:                                  %7zu\n\n", atoms);
+            text.add(" MODULE QUICKSTEP:  ATOMIC COORDINATES IN angstrom\n\n");
+            text.add("  Atom  Kind  Element       X           Y           Z          Z(eff)       Mass\n\n");
+            for (size_t i = 0; i < atoms; ++i)
+            {
+                const Element& element = *molecule.atoms[i].element;
+                Point          p       = molecule.at(i, molecule.steps() > 0 ? 1.0 : 0.0);
+                text.add(" %6zu %5d %-2s %4d %11.6f %11.6f %11.6f %11.4f %12.4f\n", i + 1,
+                         static_cast<int>(&element - ELEMENTS) + 1, element.symbol, element.number, p.x, p.y, p.z,
+                         element.zeff, element.mass);
+            }
+            text.add("\n");
+
+            for (int step = 0; step < molecule.steps(); ++step)
+            {
+                double lag = molecule.lag(step);
+                text.add(" ENERGY| Total FORCE_EVAL ( QS ) energy [a.u.]:         %24.12f\n",
+                         molecule.energies[static_cast<size_t>(step)]);
+                text.add("\n ATOMIC FORCES in [a.u.]\n\n # Atom   Kind   Element          X              Y              Z\n");
+                for (size_t i = 0; i < atoms; ++i)
+                {
+                    double scale = 0.02 * lag + 1e-5;
+                    text.add(" %6zu %6d %6s %14.8f %14.8f %14.8f\n", i + 1,
+                             static_cast<int>(molecule.atoms[i].element - ELEMENTS) + 1,
+                             molecule.atoms[i].element->symbol, random.uniform(-scale, scale),
+                             random.uniform(-scale, scale), random.uniform(-scale, scale));
+                }
+                text.add("\n --------  Informations at step = %5d ------------\n", step + 1);
+                text.add("  Optimization Method        =                 BFGS\n");
+                text.add("  Total Energy               = %20.10f\n\n", molecule.energies[static_cast<size_t>(step)]);
+            }
+
+            text.add(" VIB| Vibrational Analysis Info\n");
+            size_t modes = molecule.modes.size();
+            for (size_t first = 0; first < modes; first += 3)
+            {
+                size_t columns = std::min<size_t>(3, modes - first);
+                text.add(" VIB|                 ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%12zu", first + c + 1);
+                }
+                text.add("\n VIB|Frequency (cm^-1) ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%12.6f", molecule.modes[first + c]);
+                }
+                text.add("\n VIB|IR int (KM/Mole)  ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%12.6f", random.uniform(0.0, 80.0));
+                }
+                text.add("\n VIB|Red.Masses (a.u.) ");
+                for (size_t c = 0; c < columns; ++c)
+                {
+                    text.add("%12.6f", random.uniform(1.0, 12.0));
+                }
+                text.add("\n");
+                for (size_t i = 0; i < atoms; ++i)
+                {
+                    text.add(" MODE %6zu %-2s     ", i + 1, molecule.atoms[i].element->symbol);
+                    for (size_t c = 0; c < columns; ++c)
+                    {
+                        text.add("%7.3f%7.3f%7.3f ", random.uniform(-0.5, 0.5), random.uniform(-0.5, 0.5),
+                                 random.uniform(-0.5, 0.5));
+                    }
+                    text.add("\n");
+                }
+                text.add("\n");
+            }
+            text.add(" VIB|              Temperature [K]:                             298.150\n");
+            text.add(" VIB|              Pressure [Pa]:                            101325.000\n");
+            text.add(" VIB|              Electronic energy (U) [kJ/mol]: %24.8f\n", molecule.energy * HARTREE_TO_KJ);
+            text.add(" VIB|              Zero-point correction [kJ/mol]: %24.8f\n", molecule.zpe * HARTREE_TO_KJ);
+            text.add(" **** **** ******  **  PROGRAM ENDED AT                 2026-01-05 12:03:00.000\n");
+        }
+
+        // ---------------------------------------------------------------- VASP
+
+        /// VASP lists the atoms grouped by species, in the order of the POTCARs
+        std::vector<size_t> vasp_order(const Molecule& molecule)
+        {
+            std::vector<size_t> order(molecule.atoms.size());
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(), [&molecule](size_t a, size_t b) {
+                return molecule.atoms[a].element < molecule.atoms[b].element;
+            });
+            return order;
+        }
+
+        std::vector<const Element*> vasp_species(const Molecule& molecule, const std::vector<size_t>& order)
+        {
+            std::vector<const Element*> species;
+            for (size_t i : order)
+            {
+                if (species.empty() || species.back() != molecule.atoms[i].element)
+                {
+                    species.push_back(molecule.atoms[i].element);
+                }
+            }
+            return species;
+        }
+
+        /// Edge of the cubic cell: the molecule plus 15 Angstrom of vacuum
+        double vasp_cell(const Molecule& molecule)
+        {
+            double extent = 0.0;
+            for (const auto& atom : molecule.atoms)
+            {
+                extent = std::max({extent, std::abs(atom.final.x), std::abs(atom.final.y), std::abs(atom.final.z)});
+            }
+            return std::ceil(2.0 * extent + 15.0);
+        }
+
+        void write_vasp_outcar(Text& text, const Molecule& molecule, Random& random, int index)
+        {
+            std::vector<size_t>         order   = vasp_order(molecule);
+            std::vector<const Element*> species = vasp_species(molecule, order);
+            double                      half    = 0.5 * vasp_cell(molecule);
+
+            text.add(" vasp.6.3.2 27Jun22 (build Jan 05 2026 12:00:00) complex\n\n");
+            text.add(" executed on             LinuxIFC date 2026.01.05  12:00:00\n");
+            text.add(" running on   16 total cores\n distrk:  each k-point on   16 cores,    1 groups\n\n");
+            text.add(" INCAR:\n   SYSTEM = bench-%04d\n   IBRION = 5\n   NFREE = 2\n\n", index + 1);
+            for (const Element* element : species)
+            {
+                text.add(" POTCAR:    PAW_PBE %s 08Apr2002\n", element->symbol);
+            }
+            for (const Element* element : species)
+            {
+                text.add("   VRHFIN =%s: s p\n   LEXCH  = PE\n", element->symbol);
+                text.add("   POMASS = %8.3f; ZVAL   = %8.3f    mass and valenz\n", element->mass, element->zeff);
+            }
+            text.add("\n ions per type =  ");
+            for (const Element* element : species)
+            {
+                size_t count = 0;
+                for (size_t i : order)
+                {
+                    count += molecule.atoms[i].element == element ? 1 : 0;
+                }
+                text.add(" %5zu", count);
+            }
+            text.add("\n\n");
+
+            int steps = std::max(1, molecule.steps());
+            for (int step = 0; step < steps; ++step)
+            {
+                double lag    = molecule.steps() > 0 ? molecule.lag(step) : 0.0;
+                double energy = molecule.steps() > 0 ? molecule.energies[static_cast<size_t>(step)] : molecule.energy;
+                text.add("--------------------------------------- Iteration %6d(  14)  "
+                         "---------------------------------------\n\n",
+                         step + 1);
+                text.add(" POSITION                                       TOTAL-FORCE (eV/Angst)\n");
+                text.add(" -----------------------------------------------------------------------------------\n");
+                for (size_t i : order)
+                {
+                    Point  p     = molecule.at(i, lag);
+                    double scale = 0.5 * lag + 1e-4;
+                    text.add("  %12.5f %12.5f %12.5f %14.6f %13.6f %13.6f\n", p.x + half, p.y + half, p.z + half,
+                             random.uniform(-scale, scale), random.uniform(-scale, scale),
+                             random.uniform(-scale, scale));
+                }
+                text.add(" -----------------------------------------------------------------------------------\n");
+                text.add("    total drift:                                0.000001     -0.000002      0.000003\n\n");
+                text.add("  FREE ENERGIE OF THE ION-ELECTRON SYSTEM (eV)\n");
+                text.add("  ---------------------------------------------------\n");
+                text.add("  free  energy   TOTEN  = %18.8f eV\n\n", energy * HARTREE_TO_EV);
+                text.add("  energy  without entropy= %18.8f  energy(sigma->0) = %18.8f\n\n", energy * HARTREE_TO_EV,
+                         energy * HARTREE_TO_EV);
+            }
+
+            // Translations and rotations are left out: VASP prints them as small f/i modes
+            text.add(" Eigenvectors and eigenvalues of the dynamical matrix\n");
+            text.add(" ----------------------------------------------------\n\n");
+            for (size_t m = molecule.modes.size(); m-- > 0;)
+            {
+                double value = molecule.modes[m];
+                text.add("%4zu f  = %11.6f THz %11.6f 2PiTHz %11.6f cm-1 %12.6f meV\n", molecule.modes.size() - m,
+                         value * CM_TO_THZ, value * CM_TO_THZ * 2.0 * 3.141592653589793, value, value * CM_TO_MEV);
+                text.add("             X         Y         Z           dx          dy          dz\n");
+                for (size_t i : order)
+                {
+                    Point p = molecule.at(i, 0.0);
+                    text.add("   %10.6f %9.6f %9.6f    %9.6f   %9.6f   %9.6f\n", p.x + half, p.y + half, p.z + half,
+                             random.uniform(-0.4, 0.4), random.uniform(-0.4, 0.4), random.uniform(-0.4, 0.4));
+                }
+                text.add("\n");
+            }
+            text.add(" General timing and accounting informations for this job:\n");
+            text.add(" ========================================================\n\n");
+            text.add("                  Total CPU time used (sec):     3612.345\n");
+        }
+
+        std::string vasp_contcar(const Molecule& molecule, int index)
+        {
+            std::vector<size_t>         order   = vasp_order(molecule);
+            std::vector<const Element*> species = vasp_species(molecule, order);
+            double                      cell    = vasp_cell(molecule);
+            Text                        text;
+
+            text.add("bench-%04d\n   1.00000000000000\n", index + 1);
+            text.add("    %20.16f %21.16f %21.16f\n", cell, 0.0, 0.0);
+            text.add("    %20.16f %21.16f %21.16f\n", 0.0, cell, 0.0);
+            text.add("    %20.16f %21.16f %21.16f\n", 0.0, 0.0, cell);
+            for (const Element* element : species)
+            {
+                text.add("   %-2s", element->symbol);
+            }
+            text.add("\n");
+            for (const Element* element : species)
+            {
+                size_t count = 0;
+                for (size_t i : order)
+                {
+                    count += molecule.atoms[i].element == element ? 1 : 0;
+                }
+                text.add(" %5zu", count);
+            }
+            text.add("\nDirect\n");
+            for (size_t i : order)
+            {
+                Point p = molecule.at(i, 0.0);
+                text.add("  %.16f  %.16f  %.16f\n", p.x / cell + 0.5, p.y / cell + 0.5, p.z / cell + 0.5);
+            }
+            return text.take();
+        }
+
+        const char* file_extension(Program program)
+        {
+            return program == Program::Gaussian || program == Program::Gamess ? ".log" : ".out";
+        }
+
+        std::uint64_t write_file(const std::filesystem::path& path, const std::string& content)
+        {
+            std::ofstream out(path, std::ios::binary);
+            out.write(content.data(), static_cast<std::streamsize>(content.size()));
+            if (!out)
+            {
+                throw std::runtime_error("Cannot write " + path.string());
+            }
+            return content.size();
+        }
+    }  // namespace
+
+    const std::vector<Program>& all_programs()
+    {
+        static const std::vector<Program> programs = {Program::Gaussian, Program::Orca,   Program::Nwchem,
+                                                      Program::QChem,    Program::Gamess, Program::Cp2k,
+                                                      Program::Vasp};
+        return programs;
+    }
+
+    const char* program_name(Program program)
+    {
+        switch (program)
+        {
+            case Program::Gaussian:
+                return "gaussian";
+            case Program::Orca:
+                return "orca";
+            case Program::Nwchem:
+                return "nwchem";
+            case Program::QChem:
+                return "qchem";
+            case Program::Gamess:
+                return "gamess";
+            case Program::Cp2k:
+                return "cp2k";
+            case Program::Vasp:
+                return "vasp";
+        }
+        return "unknown";
+    }
+
+    bool parse_program(std::string_view name, Program& program)
+    {
+        for (Program candidate : all_programs())
+        {
+            if (name == program_name(candidate))
+            {
+                program = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int vibrational_modes(const CorpusOptions& options)
+    {
+        if (options.frequencies > 0)
+        {
+            return std::min(options.frequencies, 3 * atom_count(options) - 6);
+        }
+        return 3 * atom_count(options) - 6;
+    }
+
+    std::string generate_output(Program program, const CorpusOptions& options, int index)
+    {
+        Molecule molecule = build_molecule(options, index);
+        Random   random(file_seed(options, index, static_cast<std::uint64_t>(program) + 1));
+        Text     text;
+        switch (program)
+        {
+            case Program::Gaussian:
+                write_gaussian(text, molecule, random, index);
+                break;
+            case Program::Orca:
+                write_orca(text, molecule, random, index);
+                break;
+            case Program::Nwchem:
+                write_nwchem(text, molecule, random, index);
+                break;
+            case Program::QChem:
+                write_qchem(text, molecule, random, index);
+                break;
+            case Program::Gamess:
+                write_gamess(text, molecule, random, index);
+                break;
+            case Program::Cp2k:
+                write_cp2k(text, molecule, random, index);
+                break;
+            case Program::Vasp:
+                write_vasp_outcar(text, molecule, random, index);
+                break;
+        }
+        return text.take();
+    }
+
+    std::vector<CorpusFile> write_corpus(Program                      program,
+                                         const CorpusOptions&         options,
+                                         const std::filesystem::path& directory)
+    {
+        std::filesystem::path root = directory / program_name(program);
+        std::filesystem::create_directories(root);
+
+        std::vector<CorpusFile> files;
+        files.reserve(static_cast<size_t>(std::max(0, options.files)));
+        for (int index = 0; index < options.files; ++index)
+        {
+            char stem[32];
+            std::snprintf(stem, sizeof(stem), "%s-%04d", program_name(program), index + 1);
+
+            CorpusFile file;
+            if (program == Program::Vasp)
+            {
+                // loadvasp reads the elements from the CONTCAR next to the OUTCAR
+                std::filesystem::path job = root / stem;
+                std::filesystem::create_directories(job);
+                file.path = (job / "OUTCAR").string();
+                file.bytes = write_file(job / "OUTCAR", generate_output(program, options, index));
+                file.bytes += write_file(job / "CONTCAR", vasp_contcar(build_molecule(options, index), index));
+            }
+            else
+            {
+                std::filesystem::path path = root / (std::string(stem) + file_extension(program));
+                file.path                  = path.string();
+                file.bytes                 = write_file(path, generate_output(program, options, index));
+            }
+            files.push_back(std::move(file));
+        }
+        return files;
+    }
+}  // namespace Bench
@@ -0,0 +1,106 @@
+/**
+ * @file corpus_generator.h
+ * @brief Deterministic synthetic output files of the supported programs for cck_bench
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Writes an optimisation + frequency job of a made-up molecule in the layout
+ * of Gaussian, ORCA, NWChem, Q-Chem, GAMESS-US, CP2K and VASP, close enough
+ * to the real outputs that the extract engine, the LoadFile loaders and the
+ * job checker take the same paths through them. The size of a file follows
+ * the number of atoms, optimisation cycles and vibrational modes, so a
+ * corpus can be scaled to whatever a benchmark needs.
+ *
+ * The same options and seed always give byte-identical files on every
+ * platform: the random numbers come from a fixed splitmix64 sequence and all
+ * numbers are formatted with snprintf.
+ */
+
+#ifndef BENCH_CORPUS_GENERATOR_H
+#define BENCH_CORPUS_GENERATOR_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bench
+{
+    /**
+     * @brief Programs the generator can write
+     */
+    enum class Program
+    {
+        Gaussian,
+        Orca,
+        Nwchem,
+        QChem,
+        Gamess,
+        Cp2k,
+        Vasp
+    };
+
+    /**
+     * @struct CorpusOptions
+     * @brief Shape of the generated jobs
+     */
+    struct CorpusOptions
+    {
+        int           atoms       = 24;    ///< Atoms per molecule (at least 3)
+        int           opt_cycles  = 10;    ///< Optimisation steps before the frequency job (0 = frequency job only)
+        int           frequencies = 0;     ///< Vibrational modes (0 = 3N-6)
+        int           files       = 20;    ///< Files per program
+        std::uint64_t seed        = 2026;  ///< Seed of the geometries, energies and frequencies
+    };
+
+    /**
+     * @struct CorpusFile
+     * @brief One generated job
+     */
+    struct CorpusFile
+    {
+        std::string   path;       ///< File the parsers are given (OUTCAR for VASP)
+        std::uint64_t bytes = 0;  ///< Bytes of the job on disk (OUTCAR + CONTCAR for VASP)
+    };
+
+    /**
+     * @brief All programs in a fixed order
+     */
+    const std::vector<Program>& all_programs();
+
+    /**
+     * @brief Lower-case name used on the command line and in the results ("gaussian", "orca", ...)
+     */
+    const char* program_name(Program program);
+
+    /**
+     * @brief Parse a name written by program_name()
+     * @return false if @p name is not a known program
+     */
+    bool parse_program(std::string_view name, Program& program);
+
+    /**
+     * @brief Vibrational modes written per file for @p options
+     */
+    int vibrational_modes(const CorpusOptions& options);
+
+    /**
+     * @brief Text of the output file number @p index of @p program
+     *
+     * For VASP this is the OUTCAR; write_corpus() also writes the CONTCAR the
+     * loader reads the elements from.
+     */
+    std::string generate_output(Program program, const CorpusOptions& options, int index);
+
+    /**
+     * @brief Write options.files jobs of @p program below @p directory
+     * @return The generated jobs in order
+     * @throws std::runtime_error if a file cannot be written
+     */
+    std::vector<CorpusFile> write_corpus(Program                      program,
+                                         const CorpusOptions&         options,
+                                         const std::filesystem::path& directory);
+}  // namespace Bench
+
+#endif  // BENCH_CORPUS_GENERATOR_H
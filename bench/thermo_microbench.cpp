@@ -0,0 +1,794 @@
+/**
+ * @file thermo_microbench.cpp
+ * @brief Microbenchmarks of the thermochemistry kernels (cck_microbench)
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Times the kernels of the thermo module in isolation, on systems built in
+ * memory rather than parsed from files:
+ * - calc::calcthermo for 3 to 30000 vibrational modes with every LowVibTreatment
+ * - calc::vibsum with each vibrational kernel the CPU supports, scalar to AVX-512
+ * - calc::calcthermo_grid on T/P grids up to 1000 x 100 points for a 300-atom molecule
+ * - calc::calcthermo_batch on 10000 small molecules, against one calcthermo call per molecule
+ * - calc::calcinertia for 3 to 2000 atoms
+ * - symmetry::SymmetryDetector::detectPG for C1 up to Oh and Ih molecules of
+ *   up to about 2000 atoms (the detected group is reported next to the time)
+ * - util::diagmat on 3x3 inertia tensors
+ *
+ * Each case is warmed up, then a batch size is chosen so one sample lasts at
+ * least --min-time; the minimum, median, mean and standard deviation over
+ * --samples samples are reported per call, and per mode or atom where the
+ * case has a size. A case whose first call takes longer than --budget is
+ * reported as skipped, together with that time, and ends its series: the
+ * cost of detectPG grows steeply with the number of atoms. Results go to a table and to a JSON file so a change to
+ * the kernels can be compared against a saved baseline.
+ */
+
+#include "bench_support.h"
+#include "thermo/calc.h"
+#include "thermo/chemsys.h"
+#include "thermo/symmetry.h"
+#include "thermo/util.h"
+#include "thermo/vib_kernel.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/version.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Defined in main.cpp for cck; the linked extraction code refers to it
+std::atomic<bool> g_shutdown_requested{false};
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Mat3  = std::array<double, 9>;  ///< Row-major 3x3 matrix
+
+    struct MicroOptions
+    {
+        double      warmup_ms   = 50.0;
+        double      min_time_ms = 5.0;
+        int         samples     = 15;
+        int         max_freqs   = 30000;
+        int         max_atoms   = 2000;
+        double      budget_s    = 1.0;  ///< Longest single call a case may take
+        std::string filter;
+        std::string output = "cck_microbench.json";
+    };
+
+    /// Statistics of one case, per call unless stated otherwise
+    struct CaseResult
+    {
+        std::string kernel;
+        std::string variant;
+        int         size      = 0;  ///< Modes or atoms, 0 if the case has no size
+        std::string detected;       ///< Point group found by detectPG
+        size_t      batch     = 0;  ///< Calls per sample
+        int         samples   = 0;
+        double      min_ns    = 0.0;
+        double      median_ns = 0.0;
+        double      mean_ns   = 0.0;
+        double      stddev_ns = 0.0;
+        bool        skipped   = false;  ///< First call exceeded the budget; only min_ns is set
+    };
+
+    /// Results of the timed calls go here so the compiler cannot drop them
+    volatile double g_sink = 0.0;
+
+    /// splitmix64, as in the corpus generator: the same molecules on every platform
+    class Random
+    {
+    public:
+        explicit Random(std::uint64_t seed) : state_(seed) {}
+
+        double uniform(double low, double high)
+        {
+            std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+            z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z               = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z ^= z >> 31;
+            return low + (high - low) * static_cast<double>(z >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+    private:
+        std::uint64_t state_;
+    };
+
+    double elapsed_ns(Clock::time_point since)
+    {
+        return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+    }
+
+    /**
+     * @brief Warm up, calibrate the batch size and collect the samples of one case
+     * @param call Kernel call; its result goes into g_sink
+     */
+    CaseResult measure(const MicroOptions& options, const std::function<double()>& call)
+    {
+        Bench::NullBuffer      null_buffer;
+        Bench::RedirectConsole redirect(&null_buffer);
+        CaseResult             result;
+
+        Clock::time_point warmup_start = Clock::now();
+        g_sink                         = g_sink + call();
+        double first_ns                = elapsed_ns(warmup_start);
+        if (first_ns > options.budget_s * 1e9)
+        {
+            result.skipped = true;
+            result.min_ns  = first_ns;
+            return result;
+        }
+        while (elapsed_ns(warmup_start) < options.warmup_ms * 1e6)
+        {
+            g_sink = g_sink + call();
+        }
+
+        // Double the batch until one sample takes at least min_time
+        size_t batch = 1;
+        while (true)
+        {
+            Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < batch; ++i)
+            {
+                g_sink = g_sink + call();
+            }
+            if (elapsed_ns(start) >= options.min_time_ms * 1e6 || batch >= (size_t{1} << 30))
+            {
+                break;
+            }
+            batch *= 2;
+        }
+
+        std::vector<double> per_call;
+        per_call.reserve(static_cast<size_t>(options.samples));
+        for (int s = 0; s < options.samples; ++s)
+        {
+            Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < batch; ++i)
+            {
+                g_sink = g_sink + call();
+            }
+            per_call.push_back(elapsed_ns(start) / static_cast<double>(batch));
+        }
+
+        result.batch   = batch;
+        result.samples = options.samples;
+        std::sort(per_call.begin(), per_call.end());
+        size_t n         = per_call.size();
+        result.min_ns    = per_call.front();
+        result.median_ns = n % 2 == 1 ? per_call[n / 2] : 0.5 * (per_call[n / 2 - 1] + per_call[n / 2]);
+        result.mean_ns   = std::accumulate(per_call.begin(), per_call.end(), 0.0) / static_cast<double>(n);
+        double squares   = 0.0;
+        for (double value : per_call)
+        {
+            squares += (value - result.mean_ns) * (value - result.mean_ns);
+        }
+        result.stddev_ns = n > 1 ? std::sqrt(squares / static_cast<double>(n - 1)) : 0.0;
+        return result;
+    }
+
+    // ------------------------------------------------------------------ molecules
+
+    Mat3 multiply(const Mat3& a, const Mat3& b)
+    {
+        Mat3 c{};
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    c[i * 3 + j] += a[i * 3 + k] * b[k * 3 + j];
+                }
+            }
+        }
+        return c;
+    }
+
+    bool same_matrix(const Mat3& a, const Mat3& b)
+    {
+        for (size_t i = 0; i < 9; ++i)
+        {
+            if (std::abs(a[i] - b[i]) > 1e-6)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Rotation by @p angle about the unit vector (x, y, z)
+    Mat3 rotation(double x, double y, double z, double angle)
+    {
+        double norm = std::sqrt(x * x + y * y + z * z);
+        x /= norm;
+        y /= norm;
+        z /= norm;
+        double c = std::cos(angle), s = std::sin(angle), t = 1.0 - c;
+        return {t * x * x + c,     t * x * y - s * z, t * x * z + s * y, t * x * y + s * z, t * y * y + c,
+                t * y * z - s * x, t * x * z - s * y, t * y * z + s * x, t * z * z + c};
+    }
+
+    /// All products of @p generators: the operations of the point group
+    std::vector<Mat3> close_group(const std::vector<Mat3>& generators)
+    {
+        std::vector<Mat3> group = {{1, 0, 0, 0, 1, 0, 0, 0, 1}};
+        for (size_t i = 0; i < group.size() && group.size() <= 120; ++i)
+        {
+            for (const Mat3& generator : generators)
+            {
+                Mat3 product = multiply(generator, group[i]);
+                bool known   = std::any_of(group.begin(), group.end(),
+                                           [&product](const Mat3& op) { return same_matrix(op, product); });
+                if (!known)
+                {
+                    group.push_back(product);
+                }
+            }
+        }
+        return group;
+    }
+
+    struct PointGroupCase
+    {
+        const char*       name;
+        std::vector<Mat3> operations;
+    };
+
+    std::vector<PointGroupCase> point_groups()
+    {
+        const double pi     = 3.141592653589793;
+        const double golden = 0.5 * (1.0 + std::sqrt(5.0));
+        const Mat3   sigma_h{1, 0, 0, 0, 1, 0, 0, 0, -1};
+        const Mat3   sigma_xz{1, 0, 0, 0, -1, 0, 0, 0, 1};
+        const Mat3   c2x{1, 0, 0, 0, -1, 0, 0, 0, -1};
+        const Mat3   c2z{-1, 0, 0, 0, -1, 0, 0, 0, 1};
+        const Mat3   inversion{-1, 0, 0, 0, -1, 0, 0, 0, -1};
+        const Mat3   c3_body{0, 0, 1, 1, 0, 0, 0, 1, 0};  // C3 about (1,1,1)
+        const Mat3   s4z{0, 1, 0, -1, 0, 0, 0, 0, -1};
+        const Mat3   c4z{0, -1, 0, 1, 0, 0, 0, 0, 1};
+
+        return {{"C1", close_group({})},
+                {"Cs", close_group({sigma_h})},
+                {"C2v", close_group({c2z, sigma_xz})},
+                {"C3v", close_group({rotation(0, 0, 1, 2 * pi / 3), sigma_xz})},
+                {"D2h", close_group({c2z, c2x, inversion})},
+                {"D3h", close_group({rotation(0, 0, 1, 2 * pi / 3), sigma_h, c2x})},
+                {"D6h", close_group({rotation(0, 0, 1, pi / 3), sigma_h, c2x})},
+                {"Td", close_group({c3_body, s4z})},
+                {"Oh", close_group({c3_body, c4z, inversion})},
+                {"Ih", close_group({c3_body, rotation(0, 1, golden, 2 * pi / 5), inversion})}};
+    }
+
+    /**
+     * @brief Molecule of about @p target atoms with the symmetry of @p operations
+     *
+     * Every atom is one of the images of a random general position, so the
+     * molecule has exactly the group of the operations; images closer than
+     * 0.8 Angstrom to an existing atom are rejected.
+     */
+    std::vector<Atom> symmetric_molecule(const std::vector<Mat3>& operations, int target, std::uint64_t seed)
+    {
+        static const int    numbers[] = {6, 1, 7, 8};
+        static const double masses[]  = {12.0, 1.00783, 14.00307, 15.99491};
+
+        Random            random(seed);
+        std::vector<Atom> atoms;
+        size_t            order  = operations.size();
+        size_t            seeds  = std::max<size_t>(1, static_cast<size_t>(std::lround(double(target) / order)));
+        double            radius = 1.2 * std::cbrt(static_cast<double>(seeds * order)) + 1.5;
+
+        for (size_t attempt = 0; atoms.size() < seeds * order && attempt < 100 * seeds; ++attempt)
+        {
+            double x = random.uniform(-radius, radius), y = random.uniform(-radius, radius),
+                   z = random.uniform(-radius, radius);
+            if (x * x + y * y + z * z < 1.0)
+            {
+                continue;
+            }
+            size_t            kind = static_cast<size_t>(random.uniform(0.0, 4.0)) % 4;
+            std::vector<Atom> images;
+            for (const Mat3& op : operations)
+            {
+                images.push_back({numbers[kind], op[0] * x + op[1] * y + op[2] * z, op[3] * x + op[4] * y + op[5] * z,
+                                  op[6] * x + op[7] * y + op[8] * z, masses[kind]});
+            }
+            auto too_close = [&](const Atom& atom, const std::vector<Atom>& others, size_t count) {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    double dx = atom.x - others[i].x, dy = atom.y - others[i].y, dz = atom.z - others[i].z;
+                    if (dx * dx + dy * dy + dz * dz < 0.64)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            bool rejected = false;
+            for (size_t i = 0; i < images.size() && !rejected; ++i)
+            {
+                rejected = too_close(images[i], images, i) || too_close(images[i], atoms, atoms.size());
+            }
+            if (!rejected)
+            {
+                atoms.insert(atoms.end(), images.begin(), images.end());
+            }
+        }
+        return atoms;
+    }
+
+    /// Non-linear system with @p modes frequencies, ready for calcthermo
+    SystemData thermo_system(int modes, LowVibTreatment treatment)
+    {
+        SystemData sys;
+        sys.a               = symmetric_molecule(close_group({}), 12, 7);
+        sys.ncenter         = static_cast<int>(sys.a.size());
+        sys.lowVibTreatment = treatment;
+        sys.spinmult        = 1;
+        sys.nelevel         = 1;
+        sys.elevel          = {0.0};
+        sys.edegen          = {1};
+        sys.rotsym          = 1;
+        for (const auto& atom : sys.a)
+        {
+            sys.totmass += atom.mass;
+        }
+        calc::calcinertia(sys);
+
+        // Log-spaced from 10 to 3500 cm^-1: the low modes exercise the treatments
+        sys.nfreq = modes;
+        sys.wavenum.resize(static_cast<size_t>(modes));
+        sys.freq.resize(static_cast<size_t>(modes));
+        for (int i = 0; i < modes; ++i)
+        {
+            double fraction = modes > 1 ? static_cast<double>(i) / (modes - 1) : 0.0;
+            sys.wavenum[static_cast<size_t>(i)] = 10.0 * std::pow(350.0, fraction);
+            sys.freq[static_cast<size_t>(i)]    = sys.wavenum[static_cast<size_t>(i)] * wave2freq;
+        }
+        return sys;
+    }
+
+    std::string trim(std::string text)
+    {
+        text.erase(text.find_last_not_of(' ') + 1);
+        text.erase(0, text.find_first_not_of(' '));
+        return text;
+    }
+
+    // ------------------------------------------------------------------ cases
+
+    class Suite
+    {
+    public:
+        explicit Suite(const MicroOptions& options) : options_(options) {}
+
+        /**
+         * @brief Run @p call as kernel/variant unless --filter excludes it
+         * @param describe Outcome of the calls shown next to the time (the detected point group)
+         * @return false if the case was skipped for exceeding the budget
+         */
+        bool run(const std::string&                  kernel,
+                 const std::string&                  variant,
+                 int                                 size,
+                 const std::function<double()>&      call,
+                 const std::function<std::string()>& describe = nullptr)
+        {
+            std::string name = kernel + "/" + variant;
+            if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos)
+            {
+                return true;
+            }
+            std::cout << "  " << std::left << std::setw(34) << name << std::flush;
+            CaseResult  result   = measure(options_, call);
+            std::string detected = describe ? describe() : std::string();
+            result.kernel        = kernel;
+            result.variant       = variant;
+            result.size          = size;
+            result.detected      = detected;
+            results_.push_back(result);
+            if (result.skipped)
+            {
+                std::cout << "skipped: one call took " << std::fixed << std::setprecision(2) << result.min_ns * 1e-9
+                          << " s (--budget " << options_.budget_s << " s)\n";
+                return false;
+            }
+            std::cout << std::right << std::fixed << std::setprecision(1) << std::setw(14) << result.median_ns
+                      << " ns" << std::setw(8) << std::setprecision(1)
+                      << (result.mean_ns > 0.0 ? 100.0 * result.stddev_ns / result.mean_ns : 0.0) << " %";
+            if (size > 0)
+            {
+                std::cout << std::setw(12) << std::setprecision(2) << result.median_ns / size << " ns/item";
+            }
+            if (!detected.empty())
+            {
+                std::cout << "  (" << detected << ")";
+            }
+            std::cout << "\n";
+            return true;
+        }
+
+        const std::vector<CaseResult>& results() const
+        {
+            return results_;
+        }
+
+    private:
+        const MicroOptions&     options_;
+        std::vector<CaseResult> results_;
+    };
+
+    void run_calcthermo(Suite& suite, const MicroOptions& options)
+    {
+        static const std::pair<const char*, LowVibTreatment> treatments[] = {
+            {"harmonic", LowVibTreatment::Harmonic},
+            {"truhlar", LowVibTreatment::Truhlar},
+            {"grimme", LowVibTreatment::Grimme},
+            {"minenkov", LowVibTreatment::Minenkov},
+            {"headgordon", LowVibTreatment::HeadGordon}};
+        for (int modes : {3, 30, 300, 3000, 30000})
+        {
+            if (modes > options.max_freqs)
+            {
+                continue;
+            }
+            for (const auto& treatment : treatments)
+            {
+                SystemData sys = thermo_system(modes, treatment.second);
+                suite.run("calcthermo", std::string(treatment.first) + "/nfreq=" + std::to_string(modes), modes,
+                          [&sys]() { return calc::calcthermo(sys, 298.15, 1.0).corrG; });
+            }
+        }
+    }
+
+    void run_vibsum(Suite& suite, const MicroOptions& options)
+    {
+        // Every vibrational kernel this CPU can run, on the treatment with the most work per mode
+        static const calc::VibKernel kernels[] = {calc::VibKernel::Scalar, calc::VibKernel::SSE2,
+                                                  calc::VibKernel::AVX2, calc::VibKernel::AVX512};
+        for (int modes : {30, 3000, 30000})
+        {
+            if (modes > options.max_freqs)
+            {
+                continue;
+            }
+            SystemData sys = thermo_system(modes, LowVibTreatment::HeadGordon);
+            for (calc::VibKernel kernel : kernels)
+            {
+                if (static_cast<int>(kernel) > static_cast<int>(calc::best_vib_kernel()))
+                {
+                    continue;
+                }
+                suite.run("vibsum", std::string(calc::vib_kernel_name(kernel)) + "/nfreq=" + std::to_string(modes),
+                          modes, [&sys, kernel]() { return calc::vibsum(sys, 298.15, kernel).S_vib; });
+            }
+        }
+    }
+
+    void run_tpgrid(Suite& suite, const MicroOptions& options)
+    {
+        // A 300-atom molecule (894 modes) on T/P grids, against the cost of one calcthermo call
+        const int  modes = std::min(894, options.max_freqs);
+        SystemData sys   = thermo_system(modes, LowVibTreatment::Grimme);
+        suite.run("calcthermo_grid", "1x1/nfreq=" + std::to_string(modes), 1,
+                  [&sys]() { return calc::calcthermo(sys, 298.15, 1.0).corrG; });
+        for (const auto& shape : {std::make_pair(1, 100), std::make_pair(1000, 1), std::make_pair(1000, 100)})
+        {
+            std::vector<double> temps, pressures;
+            for (int i = 0; i < shape.first; ++i)
+            {
+                temps.push_back(100.0 + i);
+            }
+            for (int j = 0; j < shape.second; ++j)
+            {
+                pressures.push_back(0.1 + 0.1 * j);
+            }
+            suite.run("calcthermo_grid",
+                      std::to_string(shape.first) + "x" + std::to_string(shape.second) + "/nfreq=" + std::to_string(modes),
+                      shape.first * shape.second,
+                      [&]() { return calc::calcthermo_grid(sys, temps, pressures).back().corrG; });
+        }
+    }
+
+    void run_batch(Suite& suite)
+    {
+        // Screening-sized molecules (3 to 60 modes), one calcthermo call each against one batch sweep
+        const int               molecules = 10000;
+        std::vector<SystemData> systems;
+        systems.reserve(molecules);
+        calc::MoleculeBatch batch;
+        batch.reserve(molecules, 32);
+        for (int m = 0; m < molecules; ++m)
+        {
+            systems.push_back(thermo_system(3 + (m * 7) % 58, LowVibTreatment::Grimme));
+            batch.add(systems.back());
+        }
+        for (int ntemps : {1, 10})
+        {
+            std::vector<double> temps;
+            for (int i = 0; i < ntemps; ++i)
+            {
+                temps.push_back(298.15 + 10.0 * i);
+            }
+            const std::string shape = "mol=" + std::to_string(molecules) + "/T=" + std::to_string(ntemps);
+            suite.run("calcthermo_batch", "loop/" + shape, molecules * ntemps, [&]() {
+                double sum = 0.0;
+                for (const SystemData& sys : systems)
+                {
+                    for (double T : temps)
+                    {
+                        sum += calc::calcthermo(sys, T, 1.0).corrG;
+                    }
+                }
+                return sum;
+            });
+            suite.run("calcthermo_batch", "batch/" + shape, molecules * ntemps, [&]() {
+                return calc::calcthermo_batch(batch, systems.front(), temps, 1.0).corrG.back();
+            });
+        }
+    }
+
+    void run_calcinertia(Suite& suite, const MicroOptions& options)
+    {
+        for (int atoms : {3, 30, 300, 2000})
+        {
+            if (atoms > options.max_atoms)
+            {
+                continue;
+            }
+            SystemData sys;
+            sys.a = symmetric_molecule(close_group({}), atoms, 11);
+            for (const auto& atom : sys.a)
+            {
+                sys.totmass += atom.mass;
+            }
+            suite.run("calcinertia", "atoms=" + std::to_string(atoms), static_cast<int>(sys.a.size()), [&sys]() {
+                calc::calcinertia(sys);
+                return sys.inert[0];
+            });
+        }
+    }
+
+    void run_detectpg(Suite& suite, const MicroOptions& options)
+    {
+        for (const auto& group : point_groups())
+        {
+            int previous = -1;
+            for (int target : {3, 30, 100, 300, 1000, 2000})
+            {
+                if (target > options.max_atoms)
+                {
+                    continue;
+                }
+                std::vector<Atom> atoms = symmetric_molecule(group.operations, target, 2026 + target);
+                int               count = static_cast<int>(atoms.size());
+                if (count == previous)
+                {
+                    continue;  // Large groups reach the same size from several targets
+                }
+                previous = count;
+
+                symmetry::SymmetryDetector detector;
+                detector.ncenter = count;
+                detector.a       = atoms;
+                detector.a_index.resize(atoms.size());
+                std::iota(detector.a_index.begin(), detector.a_index.end(), 0);
+                bool measured = suite.run(
+                    "detectPG", std::string(group.name) + "/atoms=" + std::to_string(count), count,
+                    [&detector]() {
+                        detector.detectPG(0);
+                        return static_cast<double>(detector.rotsym);
+                    },
+                    [&detector]() { return trim(detector.PGname); });
+                if (!measured)
+                {
+                    break;  // Larger molecules of this group would take even longer
+                }
+            }
+        }
+    }
+
+    void run_diagmat(Suite& suite)
+    {
+        // A pool of inertia tensors, copied before each call because diagmat works in place
+        Random                                        random(5);
+        std::vector<std::vector<std::vector<double>>> pool;
+        for (int m = 0; m < 64; ++m)
+        {
+            std::vector<std::vector<double>> mat(3, std::vector<double>(3));
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int j = i; j < 3; ++j)
+                {
+                    mat[i][j] = mat[j][i] = i == j ? random.uniform(50.0, 500.0) : random.uniform(-40.0, 40.0);
+                }
+            }
+            pool.push_back(mat);
+        }
+        size_t                           next = 0;
+        std::vector<std::vector<double>> work(3, std::vector<double>(3));
+        std::vector<std::vector<double>> vectors(3, std::vector<double>(3));
+        std::array<double, 3>            values{};
+        suite.run("diagmat", "3x3", 0, [&]() {
+            const auto& source = pool[next++ % pool.size()];
+            for (int i = 0; i < 3; ++i)
+            {
+                std::copy(source[i].begin(), source[i].end(), work[i].begin());
+            }
+            util::diagmat(work, vectors, values);
+            return values[0];
+        });
+    }
+
+    void write_json(std::ostream& out, const MicroOptions& options, const std::vector<CaseResult>& results)
+    {
+        out << std::setprecision(9);
+        out << "{\n  \"tool\": \"cck_microbench\",\n  \"version\": ";
+        write_json_string(out, ComChemKit::get_version());
+        out << ",\n  \"settings\": {\"warmup_ms\": " << options.warmup_ms << ", \"min_time_ms\": " << options.min_time_ms
+            << ", \"samples\": " << options.samples << "},\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const CaseResult& r = results[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"kernel\": \"" << r.kernel << "\", \"variant\": ";
+            write_json_string(out, r.variant);
+            out << ", \"size\": " << r.size;
+            if (!r.detected.empty())
+            {
+                out << ", \"detected\": ";
+                write_json_string(out, r.detected);
+            }
+            if (r.skipped)
+            {
+                out << ", \"skipped\": true, \"first_call_ns\": " << r.min_ns << "}";
+                continue;
+            }
+            out << ", \"batch\": " << r.batch << ", \"samples\": " << r.samples << ", \"min_ns\": " << r.min_ns
+                << ", \"median_ns\": " << r.median_ns << ", \"mean_ns\": " << r.mean_ns
+                << ", \"stddev_ns\": " << r.stddev_ns << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    void print_usage()
+    {
+        std::cout << "Usage: cck_microbench [options]\n\n"
+                  << "Times calcthermo, vibsum, calcthermo_grid, calcthermo_batch, calcinertia, detectPG and diagmat on systems built in memory.\n\n"
+                  << "  --filter TEXT     Only cases whose name contains TEXT (e.g. calcthermo/grimme)\n"
+                  << "  --samples N       Samples per case (default: 15)\n"
+                  << "  --min-time MS     Minimum duration of one sample (default: 5)\n"
+                  << "  --warmup MS       Warmup per case (default: 50)\n"
+                  << "  --max-freqs N     Largest calcthermo case (default: 30000)\n"
+                  << "  --max-atoms N     Largest calcinertia and detectPG case (default: 2000)\n"
+                  << "  --budget S        Skip a case whose first call takes longer (default: 1)\n"
+                  << "  --out FILE        JSON results (default: cck_microbench.json, '-' to skip)\n"
+                  << "  -h, --help        Show this help\n";
+    }
+
+    double parse_number(const std::string& option, const std::string& value, double minimum)
+    {
+        size_t used   = 0;
+        double number = 0.0;
+        try
+        {
+            number = std::stod(value, &used);
+        }
+        catch (const std::exception&)
+        {
+            used = 0;
+        }
+        if (used != value.size() || number < minimum)
+        {
+            throw std::invalid_argument(option + " needs a number >= " + std::to_string(minimum) + ", got '" + value +
+                                        "'");
+        }
+        return number;
+    }
+
+    MicroOptions parse_arguments(int argc, char* argv[])
+    {
+        MicroOptions options;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+            {
+                print_usage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc)
+            {
+                throw std::invalid_argument("Unknown option or missing value: " + arg);
+            }
+            std::string value = argv[++i];
+            if (arg == "--filter")
+            {
+                options.filter = value;
+            }
+            else if (arg == "--samples")
+            {
+                options.samples = static_cast<int>(parse_number(arg, value, 1));
+            }
+            else if (arg == "--min-time")
+            {
+                options.min_time_ms = parse_number(arg, value, 0.0);
+            }
+            else if (arg == "--warmup")
+            {
+                options.warmup_ms = parse_number(arg, value, 0.0);
+            }
+            else if (arg == "--max-freqs")
+            {
+                options.max_freqs = static_cast<int>(parse_number(arg, value, 3));
+            }
+            else if (arg == "--max-atoms")
+            {
+                options.max_atoms = static_cast<int>(parse_number(arg, value, 3));
+            }
+            else if (arg == "--budget")
+            {
+                options.budget_s = parse_number(arg, value, 0.0);
+            }
+            else if (arg == "--out")
+            {
+                options.output = value;
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown option: " + arg);
+            }
+        }
+        return options;
+    }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    MicroOptions options;
+    try
+    {
+        options = parse_arguments(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n\n";
+        print_usage();
+        return 1;
+    }
+
+    std::cout << "cck_microbench " << ComChemKit::get_version() << ": " << options.samples << " samples of >= "
+              << options.min_time_ms << " ms after " << options.warmup_ms << " ms warmup; median per call, CV\n";
+
+    Suite suite(options);
+    run_calcthermo(suite, options);
+    run_vibsum(suite, options);
+    run_tpgrid(suite, options);
+    run_batch(suite);
+    run_calcinertia(suite, options);
+    run_detectpg(suite, options);
+    run_diagmat(suite);
+
+    if (options.output != "-")
+    {
+        std::ofstream out(options.output);
+        write_json(out, options, suite.results());
+        if (!out)
+        {
+            std::cerr << "Error: cannot write " << options.output << "\n";
+            return 1;
+        }
+        std::cout << "Results written to " << options.output << "\n";
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include "commands/checker_command.h"
 #include "commands/signal_handler.h"
 #include "job_management/job_checker.h"
+#include "utilities/ndjson_writer.h"
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -13,6 +14,30 @@
 
 extern std::atomic<bool> g_shutdown_requested;
 
+namespace {
+    /// Stream per-file rows of @p checker to stdout when the format is ndjson
+    std::unique_ptr<NdjsonStream> attach_row_stream(JobChecker& checker, const std::string& format) {
+        std::unique_ptr<NdjsonStream> rows;
+        if (format == "ndjson") {
+            rows = std::make_unique<NdjsonStream>(std::cout);
+            checker.set_row_stream(rows.get());
+        }
+        return rows;
+    }
+
+    void write_check_summary(NdjsonStream& rows, const CheckSummary& summary) {
+        JsonLine line;
+        line.field("files", static_cast<std::uint64_t>(summary.total_files))
+            .field("processed", static_cast<std::uint64_t>(summary.processed_files))
+            .field("matched", static_cast<std::uint64_t>(summary.matched_files))
+            .field("moved", static_cast<std::uint64_t>(summary.moved_files))
+            .field("failed_moves", static_cast<std::uint64_t>(summary.failed_moves))
+            .field("errors", static_cast<std::uint64_t>(summary.errors.size()))
+            .field("seconds", summary.execution_time);
+        rows.write_summary(line);
+    }
+}
+
 CheckerCommand::CheckerCommand(CommandType type, std::string name, std::string desc)
     : type(type), name(name), desc(desc) {}
 
@@ -49,10 +74,41 @@ void CheckerCommand::parse_args(int argc, char* argv[], int& i, CommandContext&
             context.warnings.push_back("Error: Directory suffix required after --dir-suffix.");
         }
     }
+    else if (arg == "--resource-info")
+    {
+        show_resource_info = true;
+    }
     else if (arg == "--show-details")
     {
         show_error_details = true;
     }
+    else if (arg == "-f" || arg == "--format")
+    {
+        if (++i < argc)
+        {
+            std::string fmt = argv[i];
+            if (fmt == "text" || fmt == "ndjson")
+            {
+                output_format = fmt;
+            }
+            else
+            {
+                context.warnings.push_back("Error: Format must be 'text' or 'ndjson'. Using default 'text'.");
+            }
+        }
+        else
+        {
+            context.warnings.push_back("Error: Format value required after -f/--format.");
+        }
+    }
+    else if (arg == "--no-cache" && uses_result_cache())
+    {
+        cache_mode = ResultCacheMode::DISABLED;
+    }
+    else if (arg == "--rebuild-cache" && uses_result_cache())
+    {
+        cache_mode = ResultCacheMode::REBUILD;
+    }
     else if (!arg.empty() && arg.front() == '-')
     {
         context.warnings.push_back("Warning: Unknown argument '" + arg + "' ignored.");
@@ -62,6 +118,9 @@ void CheckerCommand::parse_args(int argc, char* argv[], int& i, CommandContext&
 int CheckerCommand::execute(const CommandContext& context) {
     CommandContext ctx = context;
     ctx.command = type; // Ensure the correct command type is set
+    if (output_format == "ndjson") {
+        ctx.quiet = true;  // stdout carries the JSON lines only
+    }
     
     switch(type) {
         case CommandType::CHECK_DONE: return execute_check_done(ctx);
@@ -79,7 +138,7 @@ int CheckerCommand::execute_check_done(const CommandContext& context)
     try
     {
         // Find log files using batch processing if specified
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_files;
 
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_ext = (context.extension.length() == 4 && std::tolower(context.extension[1]) == 'l' &&
@@ -87,25 +146,11 @@ int CheckerCommand::execute_check_done(const CommandContext& context)
         if (is_log_ext)
         {
             std::vector<std::string> extensions = {".log", ".out"};
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries(extensions, context.max_file_size_mb);
         }
         else
         {
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries({context.extension}, context.max_file_size_mb);
         }
 
         if (log_files.empty())
@@ -144,6 +189,8 @@ int CheckerCommand::execute_check_done(const CommandContext& context)
 
         // Create job checker
         JobChecker checker(processing_context, context.quiet, false);
+        checker.set_cache_mode(cache_mode);
+        std::unique_ptr<NdjsonStream> rows = attach_row_stream(checker, output_format);
 
         // Determine target directory suffix
         std::string current_dir_suffix = dir_suffix;
@@ -155,6 +202,10 @@ int CheckerCommand::execute_check_done(const CommandContext& context)
 
         // Check completed jobs
         CheckSummary summary = checker.check_completed_jobs(log_files, current_dir_suffix);
+        if (rows)
+        {
+            write_check_summary(*rows, summary);
+        }
 
         // Print summary if not quiet
         if (!context.quiet)
@@ -166,6 +217,10 @@ int CheckerCommand::execute_check_done(const CommandContext& context)
         if (!context.quiet)
         {
             printResourceUsage(*processing_context, context.quiet);
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+            }
         }
 
         return (summary.errors.empty()) ? 0 : 1;
@@ -188,7 +243,7 @@ int CheckerCommand::execute_check_errors(const CommandContext& context)
     try
     {
         // Find log files using batch processing if specified
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_files;
 
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_ext = (context.extension.length() == 4 && std::tolower(context.extension[1]) == 'l' &&
@@ -196,25 +251,11 @@ int CheckerCommand::execute_check_errors(const CommandContext& context)
         if (is_log_ext)
         {
             std::vector<std::string> extensions = {".log", ".out", ".LOG", ".OUT", ".Log", ".Out"};
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries(extensions, context.max_file_size_mb);
         }
         else
         {
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries({context.extension}, context.max_file_size_mb);
         }
 
         if (log_files.empty())
@@ -253,6 +294,7 @@ int CheckerCommand::execute_check_errors(const CommandContext& context)
 
         // Create job checker
         JobChecker checker(processing_context, context.quiet, show_error_details);
+        std::unique_ptr<NdjsonStream> rows = attach_row_stream(checker, output_format);
 
         // Determine target directory
         std::string current_target_dir = "errorJobs";
@@ -263,6 +305,10 @@ int CheckerCommand::execute_check_errors(const CommandContext& context)
 
         // Check error jobs
         CheckSummary summary = checker.check_error_jobs(log_files, current_target_dir);
+        if (rows)
+        {
+            write_check_summary(*rows, summary);
+        }
 
         // Print summary if not quiet
         if (!context.quiet)
@@ -274,6 +320,10 @@ int CheckerCommand::execute_check_errors(const CommandContext& context)
         if (!context.quiet)
         {
             printResourceUsage(*processing_context, context.quiet);
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+            }
         }
 
         return (summary.errors.empty()) ? 0 : 1;
@@ -296,7 +346,7 @@ int CheckerCommand::execute_check_pcm(const CommandContext& context)
     try
     {
         // Find log files using batch processing if specified
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_files;
 
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_ext = (context.extension.length() == 4 && std::tolower(context.extension[1]) == 'l' &&
@@ -304,25 +354,11 @@ int CheckerCommand::execute_check_pcm(const CommandContext& context)
         if (is_log_ext)
         {
             std::vector<std::string> extensions = {".log", ".out", ".LOG", ".OUT", ".Log", ".Out"};
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries(extensions, context.max_file_size_mb);
         }
         else
         {
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries({context.extension}, context.max_file_size_mb);
         }
 
         if (log_files.empty())
@@ -361,6 +397,7 @@ int CheckerCommand::execute_check_pcm(const CommandContext& context)
 
         // Create job checker
         JobChecker checker(processing_context, context.quiet, false);
+        std::unique_ptr<NdjsonStream> rows = attach_row_stream(checker, output_format);
 
         // Determine target directory
         std::string current_target_dir = "PCMMkU";
@@ -371,6 +408,10 @@ int CheckerCommand::execute_check_pcm(const CommandContext& context)
 
         // Check PCM failed jobs
         CheckSummary summary = checker.check_pcm_failures(log_files, current_target_dir);
+        if (rows)
+        {
+            write_check_summary(*rows, summary);
+        }
 
         // Print summary if not quiet
         if (!context.quiet)
@@ -382,6 +423,10 @@ int CheckerCommand::execute_check_pcm(const CommandContext& context)
         if (!context.quiet)
         {
             printResourceUsage(*processing_context, context.quiet);
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+            }
         }
 
         return (summary.errors.empty()) ? 0 : 1;
@@ -404,7 +449,7 @@ int CheckerCommand::execute_check_all(const CommandContext& context)
     try
     {
         // Find log files using batch processing if specified
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_files;
 
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_ext = (context.extension.length() == 4 && std::tolower(context.extension[1]) == 'l' &&
@@ -412,25 +457,11 @@ int CheckerCommand::execute_check_all(const CommandContext& context)
         if (is_log_ext)
         {
             std::vector<std::string> extensions = {".log", ".out", ".LOG", ".OUT", ".Log", ".Out"};
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries(extensions, context.max_file_size_mb);
         }
         else
         {
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries({context.extension}, context.max_file_size_mb);
         }
 
         if (log_files.empty())
@@ -469,14 +500,24 @@ int CheckerCommand::execute_check_all(const CommandContext& context)
 
         // Create job checker
         JobChecker checker(processing_context, context.quiet, show_error_details);
+        checker.set_cache_mode(cache_mode);
+        std::unique_ptr<NdjsonStream> rows = attach_row_stream(checker, output_format);
 
         // Run all checks
         CheckSummary summary = checker.check_all_job_types(log_files);
+        if (rows)
+        {
+            write_check_summary(*rows, summary);
+        }
 
         // Print any resource usage information
         if (!context.quiet)
         {
             printResourceUsage(*processing_context, context.quiet);
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+            }
         }
 
         return (summary.errors.empty()) ? 0 : 1;
@@ -498,7 +539,7 @@ int CheckerCommand::execute_check_imaginary(const CommandContext& context)
 
     try
     {
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_files;
 
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_ext = (context.extension.length() == 4 && std::tolower(context.extension[1]) == 'l' &&
@@ -506,25 +547,11 @@ int CheckerCommand::execute_check_imaginary(const CommandContext& context)
         if (is_log_ext)
         {
             std::vector<std::string> extensions = {".log", ".out"};
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries(extensions, context.max_file_size_mb);
         }
         else
         {
-            if (context.batch_size > 0)
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(context.extension, context.max_file_size_mb);
-            }
+            log_files = findLogFileEntries({context.extension}, context.max_file_size_mb);
         }
 
         if (log_files.empty())
@@ -560,6 +587,8 @@ int CheckerCommand::execute_check_imaginary(const CommandContext& context)
 
         JobChecker checker(processing_context, context.quiet, false);
 
+        std::unique_ptr<NdjsonStream> rows = attach_row_stream(checker, output_format);
+
         std::string target_dir_suffix = "imaginary_freqs";
         if (!target_dir.empty())
         {
@@ -568,6 +597,14 @@ int CheckerCommand::execute_check_imaginary(const CommandContext& context)
 
         CheckSummary summary = checker.check_imaginary_frequencies(log_files, target_dir_suffix);
 
+        if (rows)
+
+        {
+
+            write_check_summary(*rows, summary);
+
+        }
+
         if (!context.quiet)
         {
             checker.print_summary(summary, "Imaginary frequency check");
@@ -576,6 +613,10 @@ int CheckerCommand::execute_check_imaginary(const CommandContext& context)
         if (!context.quiet)
         {
             printResourceUsage(*processing_context, context.quiet);
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+            }
         }
 
         return (summary.errors.empty()) ? 0 : 1;
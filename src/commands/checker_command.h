@@ -15,6 +15,7 @@
 
 #include "commands/icommand.h"
 #include "commands/command_system.h" 
+#include "extraction/qc_extractor.h"
 
 /**
  * @class CheckerCommand
@@ -50,9 +51,15 @@ public:
     int execute_check_all(const CommandContext& context);
 
 private:
+    /// Only done and all classify running jobs, whose search offsets live in .cck_cache
+    bool uses_result_cache() const { return type == CommandType::CHECK_DONE || type == CommandType::CHECK_ALL; }
+
     std::string target_dir = "";
     bool        show_error_details = false;
     std::string dir_suffix = "done";
+    std::string output_format = "text";  ///< text, or ndjson (one JSON line per checked file)
+    bool        show_resource_info = false;  ///< Print the work distribution (--resource-info)
+    ResultCacheMode cache_mode = ResultCacheMode::USE;  ///< Search offsets of running jobs (--no-cache, --rebuild-cache)
 };
 
 #endif // CHECKER_COMMAND_H
@@ -237,12 +237,10 @@ CommandContext CommandParser::parse(int argc, char* argv[])
             }
         }
 
-        // Parse common options first
-        int original_i = i;
-        parse_common_options(context, i, argc, argv);
-
-        // Delegate parsing of command-specific options to the appropriate ICommand implementation
-        if (i == original_i)
+        // Parse common options first. Flags such as -q leave i unchanged, so the return
+        // value tells whether the argument was taken; anything else is delegated to the
+        // appropriate ICommand implementation
+        if (!parse_common_options(context, i, argc, argv))
         {
             std::string cmd_name = CommandParser::get_command_name(context.command);
             ICommand* cmd = CommandRegistry::get_instance().get_command(cmd_name);
@@ -289,6 +287,8 @@ CommandType CommandParser::parse_command(const std::string& cmd)
         return CommandType::THERMO;
     if (cmd == "ivcoord")
         return CommandType::IVCOORD;
+    if (cmd == "query")
+        return CommandType::QUERY;
 
     // If it starts with '-', it's probably an option, not a command
     if (!cmd.empty() && cmd.front() == '-')
@@ -324,6 +324,8 @@ std::string CommandParser::get_command_name(CommandType command)
             return std::string("ci");
         case CommandType::IVCOORD:
             return std::string("ivcoord");
+        case CommandType::QUERY:
+            return std::string("query");
         case CommandType::THERMO:
             return std::string("thermo");
         default:
@@ -331,7 +333,7 @@ std::string CommandParser::get_command_name(CommandType command)
     }
 }
 
-void CommandParser::parse_common_options(CommandContext& context, int& i, int argc, char* argv[])
+bool CommandParser::parse_common_options(CommandContext& context, int& i, int argc, char* argv[])
 {
     std::string arg = argv[i];
 
@@ -444,6 +446,12 @@ void CommandParser::parse_common_options(CommandContext& context, int& i, int ar
                 {
                     add_warning(context, "Error: Batch size must be positive. Using default (auto-detect).");
                 }
+                else if (context.command != CommandType::EXTRACT && context.command != CommandType::CREATE_INPUT)
+                {
+                    // Only extract streams in batches and ci converts in batches; the other
+                    // commands list the directory once and process every file
+                    add_warning(context, "Warning: --batch-size only applies to extract and ci. Ignored.");
+                }
                 else
                 {
                     context.batch_size = static_cast<size_t>(size);
@@ -459,6 +467,42 @@ void CommandParser::parse_common_options(CommandContext& context, int& i, int ar
             add_warning(context, "Error: Batch size value required after --batch-size.");
         }
     }
+    else if (arg == "--profile")
+    {
+        context.profile = true;
+    }
+    else if (arg == "--profile-out")
+    {
+        if (++i < argc)
+        {
+            context.profile     = true;
+            context.profile_out = argv[i];
+        }
+        else
+        {
+            add_warning(context, "Error: File name required after --profile-out.");
+        }
+    }
+    else if (arg == "--trace")
+    {
+        if (++i < argc)
+        {
+            context.trace_out = argv[i];
+        }
+        else
+        {
+            add_warning(context, "Error: File name required after --trace.");
+        }
+    }
+    else if (arg == "--stats")
+    {
+        context.stats = true;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
 }
 
 
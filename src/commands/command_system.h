@@ -63,7 +63,8 @@ enum class CommandType
     EXTRACT_COORDS,   ///< Extract coordinates from log files and organize XYZ files
     CREATE_INPUT,     ///< Create Gaussian input files from XYZ files
     THERMO,           ///< Advanced thermodynamic analysis for multiple quantum chemistry programs
-    IVCOORD           ///< Displace geometry along imaginary normal modes and write XYZ files
+    IVCOORD,          ///< Displace geometry along imaginary normal modes and write XYZ files
+    QUERY             ///< Filter and sort rows of a binary result file (.cckb)
 };
 ;
 
@@ -94,6 +95,10 @@ struct CommandContext
     std::vector<std::string> files;              ///< List of input files to process
     std::vector<std::string> warnings;           ///< Collected warnings from parsing
     JobResources             job_resources;      ///< Job scheduler resource information
+    bool                     profile;            ///< Time the stages of the run (--profile)
+    std::string              profile_out;        ///< JSON file for the profile report; empty = text on stderr
+    std::string              trace_out;          ///< Chrome trace-event file (--trace); empty = no trace
+    bool                     stats;              ///< Count bytes, lines, regex evaluations and marker hits (--stats)
 
     // End of common parameters
 
@@ -114,7 +119,9 @@ struct CommandContext
           max_file_size_mb(100),                                               // 100MB max file size
           batch_size(0),                                                       // Auto-detect batch size (0 = disabled)
           extension(".log"),                                                   // Process .log files
-          valid_extensions({".log", ".out", ".LOG", ".OUT", ".Log", ".Out"})  // Valid output extensions
+          valid_extensions({".log", ".out", ".LOG", ".OUT", ".Log", ".Out"}),  // Valid output extensions
+          profile(false),                                                       // No stage timings
+          stats(false)                                                          // No parser counters
     {}
 
     /**
@@ -241,11 +248,12 @@ private:
      * @param i Current argument index (modified by reference)
      * @param argc Total number of arguments
      * @param argv Argument array
+     * @return true if argv[i] was a common option (flags leave @p i unchanged)
      *
      * Handles options like --quiet, --threads, --max-size that are
      * available for all commands.
      */
-    static void parse_common_options(CommandContext& context, int& i, int argc, char* argv[]);
+    static bool parse_common_options(CommandContext& context, int& i, int argc, char* argv[]);
 
     /**
      * @brief Add a warning message to the command context
@@ -218,6 +218,10 @@ void CreateInputCommand::parse_args(int argc, char* argv[], int& i, CommandConte
             context.warnings.push_back("Error: tddft-extra requires a value");
         }
     }
+    else if (arg == "--resource-info")
+    {
+        show_resource_info = true;
+    }
     else if (arg == "--fix-pcm")
     {
         ci_fix_pcm = true;
@@ -930,6 +934,7 @@ int CreateInputCommand::execute(const CommandContext& context)
                 total_summary.failed_files += batch_summary.failed_files;
                 total_summary.skipped_files += batch_summary.skipped_files;
                 total_summary.execution_time += batch_summary.execution_time;
+                total_summary.work_stats.add(batch_summary.work_stats);
 
                 processed_batches++;
 
@@ -959,6 +964,10 @@ int CreateInputCommand::execute(const CommandContext& context)
         if (!context.quiet)
         {
             creator.print_summary(total_summary, "Input file creation");
+            if (show_resource_info)
+            {
+                std::cout << "Work distribution: " << total_summary.work_stats.summary() << std::endl;
+            }
         }
 
         // Check for errors
@@ -61,6 +61,7 @@ private:
     std::string ci_tddft_extra = "";
     bool        ci_fix_pcm = false;
     double      ci_temperature = -1.0;
+    bool        show_resource_info = false;  ///< Print the work distribution (--resource-info)
 };
 
 #endif // CREATE_INPUT_COMMAND_H
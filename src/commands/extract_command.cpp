@@ -154,13 +154,14 @@ void ExtractCommand::parse_args(int argc, char* argv[], int& i, CommandContext&
         if (++i < argc)
         {
             std::string fmt = argv[i];
-            if (fmt == "text" || fmt == "csv")
+            if (fmt == "text" || fmt == "csv" || fmt == "cckb" || fmt == "ndjson")
             {
                 output_format = fmt;
             }
             else
             {
-                context.warnings.push_back("Error: Format must be 'text' or 'csv'. Using default 'text'.");
+                context.warnings.push_back(
+                    "Error: Format must be 'text', 'csv', 'cckb' or 'ndjson'. Using default 'text'.");
                 output_format = "text";
             }
         }
@@ -199,6 +200,18 @@ void ExtractCommand::parse_args(int argc, char* argv[], int& i, CommandContext&
     {
         show_resource_info = true;
     }
+    else if (arg == "-r" || arg == "--recursive")
+    {
+        recursive = true;
+    }
+    else if (arg == "--no-cache")
+    {
+        cache_mode = ResultCacheMode::DISABLED;
+    }
+    else if (arg == "--rebuild-cache")
+    {
+        cache_mode = ResultCacheMode::REBUILD;
+    }
     else if (arg == "-lowvibmeth")
     {
         if (++i < argc)
@@ -250,6 +263,39 @@ void ExtractCommand::parse_args(int argc, char* argv[], int& i, CommandContext&
             context.warnings.push_back("Error: Frequency value required after -ravib.");
         }
     }
+    else if (arg == "--engine")
+    {
+        if (++i < argc)
+        {
+            std::string name = argv[i];
+            if (name == "scanner")
+            {
+                engine = ExtractionEngine::SCANNER;
+            }
+            else if (name == "legacy")
+            {
+                engine = ExtractionEngine::LEGACY;
+            }
+            else if (name == "reverse")
+            {
+                engine = ExtractionEngine::REVERSE;
+            }
+            else if (name == "archive")
+            {
+                engine = ExtractionEngine::ARCHIVE;
+            }
+            else
+            {
+                context.warnings.push_back("Warning: Unknown engine '" + name +
+                                           "'. Valid options: scanner|legacy|reverse|archive. Using default 'scanner'.");
+                engine = ExtractionEngine::SCANNER;
+            }
+        }
+        else
+        {
+            context.warnings.push_back("Error: Engine name required after --engine.");
+        }
+    }
     else if (!arg.empty() && arg.front() == '-')
     {
         context.warnings.push_back("Warning: Unknown argument '" + arg + "' ignored.");
@@ -341,7 +387,11 @@ int ExtractCommand::execute(const CommandContext& context)
                                 context.job_resources,
                                 context.batch_size,
                                 low_vib_method,
-                                ravib);
+                                ravib,
+                                engine,
+                                show_resource_info,
+                                recursive,
+                                cache_mode);
 
         return 0;
     }
@@ -13,6 +13,7 @@
 #define EXTRACT_COMMAND_H
 
 #include "commands/icommand.h"
+#include "extraction/qc_extractor.h"
 
 /**
  * @class ExtractCommand
@@ -45,6 +46,9 @@ private:
     bool        show_resource_info = false;
     std::string low_vib_method = "grimme";  ///< Low-frequency vibrational treatment method
     double      ravib = 100.0;              ///< Crossover frequency for low-vib treatment (cm-1)
+    ExtractionEngine engine = ExtractionEngine::SCANNER;  ///< Parser for native Gaussian logs
+    bool        recursive = false;          ///< Also search subdirectories for output files
+    ResultCacheMode cache_mode = ResultCacheMode::USE;  ///< Persistent result cache (--no-cache, --rebuild-cache)
 };
 
 #endif // EXTRACT_COMMAND_H
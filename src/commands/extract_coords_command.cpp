@@ -25,7 +25,11 @@ std::string ExtractCoordsCommand::get_description() const {
 void ExtractCoordsCommand::parse_args(int argc, char* argv[], int& i, CommandContext& context) {
     std::string arg = argv[i];
 
-    if (arg == "-f" || arg == "--files")
+    if (arg == "--resource-info")
+    {
+        show_resource_info = true;
+    }
+    else if (arg == "-f" || arg == "--files")
     {
         bool files_found = false;
         // Keep consuming arguments until we hit another option or the end
@@ -98,11 +102,11 @@ int ExtractCoordsCommand::execute(const CommandContext& context)
 
     try
     {
-        std::vector<std::string> log_files;
+        std::vector<FileEntry> log_entries;
         if (!specific_files.empty())
         {
             // Use specified files
-            log_files = specific_files;
+            std::vector<std::string> log_files = specific_files;
             // Filter out invalid files and ensure they exist
             log_files.erase(std::remove_if(log_files.begin(),
                                            log_files.end(),
@@ -116,6 +120,12 @@ int ExtractCoordsCommand::execute(const CommandContext& context)
                                                                      file, context.max_file_size_mb);
                                            }),
                             log_files.end());
+            for (const auto& file : log_files)
+            {
+                FileEntry entry;
+                entry.path = file;  // size is looked up when the work queue is built
+                log_entries.push_back(entry);
+            }
         }
         else
         {
@@ -126,29 +136,15 @@ int ExtractCoordsCommand::execute(const CommandContext& context)
             if (is_log_ext)
             {
                 std::vector<std::string> extensions = {".log", ".out", ".LOG", ".OUT", ".Log", ".Out"};
-                if (context.batch_size > 0)
-                {
-                    log_files = findLogFiles(extensions, context.max_file_size_mb, context.batch_size);
-                }
-                else
-                {
-                    log_files = findLogFiles(extensions, context.max_file_size_mb);
-                }
+                log_entries = findLogFileEntries(extensions, context.max_file_size_mb);
             }
             else
             {
-                if (context.batch_size > 0)
-                {
-                    log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-                }
-                else
-                {
-                    log_files = findLogFiles(context.extension, context.max_file_size_mb);
-                }
+                log_entries = findLogFileEntries({context.extension}, context.max_file_size_mb);
             }
         }
 
-        if (log_files.empty())
+        if (log_entries.empty())
         {
             if (!context.quiet)
             {
@@ -174,9 +170,13 @@ int ExtractCoordsCommand::execute(const CommandContext& context)
 
         CoordExtractor extractor(processing_context, context.quiet);
 
-        ExtractSummary summary = extractor.extract_coordinates(log_files);
+        ExtractSummary summary = extractor.extract_coordinates(log_entries);
 
         extractor.print_summary(summary, "Coordinate extraction");
+        if (show_resource_info && !context.quiet)
+        {
+            std::cout << "Work distribution: " << summary.work_stats.summary() << std::endl;
+        }
 
         if (!context.quiet)
         {
@@ -30,6 +30,7 @@ public:
 
 private:
     std::vector<std::string> specific_files;
+    bool                     show_resource_info = false;  ///< Print the work distribution (--resource-info)
 };
 
 #endif // EXTRACT_COORDS_COMMAND_H
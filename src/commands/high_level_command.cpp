@@ -2,6 +2,8 @@
 #include "commands/signal_handler.h"
 #include "utilities/config_manager.h"
 #include "high_level/high_level_energy.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/profiler.h"
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -155,13 +157,13 @@ void HighLevelCommand::parse_args(int argc, char* argv[], int& i, CommandContext
         if (++i < argc)
         {
             std::string fmt = argv[i];
-            if (fmt == "text" || fmt == "csv")
+            if (fmt == "text" || fmt == "csv" || fmt == "ndjson")
             {
                 output_format = fmt;
             }
             else
             {
-                context.warnings.push_back("Error: Format must be 'text' or 'csv'. Using default 'text'.");
+                context.warnings.push_back("Error: Format must be 'text', 'csv' or 'ndjson'. Using default 'text'.");
                 output_format = "text";
             }
         }
@@ -200,6 +202,10 @@ void HighLevelCommand::parse_args(int argc, char* argv[], int& i, CommandContext
     {
         show_resource_info = true;
     }
+    else if (arg == "--archive")
+    {
+        use_archive = true;
+    }
     else if (arg == "-lowvibmeth" && i + 1 < argc)
     {
         ++i;
@@ -257,7 +263,11 @@ void HighLevelCommand::parse_args(int argc, char* argv[], int& i, CommandContext
 int HighLevelCommand::execute(const CommandContext& context) {
     CommandContext ctx = context;
     ctx.command = type; 
-    
+    // stdout carries the JSON lines only
+    if (output_format == "ndjson") {
+        ctx.quiet = true;
+    }
+
     if (type == CommandType::HIGH_LEVEL_KJ) {
         return execute_kj(ctx);
     } else {
@@ -279,16 +289,9 @@ int HighLevelCommand::execute_kj(const CommandContext& context)
             return 1;
         }
 
-        // Find and count log files using batch processing if specified
+        // Find and count log files
         std::vector<std::string> log_files;
-        if (context.batch_size > 0)
-        {
-            log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-        }
-        else
-        {
-            log_files = findLogFiles(context.extension, context.max_file_size_mb);
-        }
+        log_files = findLogFiles(context.extension, context.max_file_size_mb);
         std::vector<std::string> filtered_files;
         std::copy_if(log_files.begin(),
                      log_files.end(),
@@ -375,6 +378,14 @@ int HighLevelCommand::execute_kj(const CommandContext& context)
         calculator.set_use_input_concentration(use_input_concentration);
         calculator.set_low_vib_method(low_vib_method);
         calculator.set_ravib(ravib);
+        calculator.set_use_archive(use_archive);
+
+        std::unique_ptr<NdjsonStream> rows;
+        if (output_format == "ndjson")
+        {
+            rows = std::make_unique<NdjsonStream>(std::cout);
+            calculator.set_row_stream(rows.get());
+        }
 
         // Use parallel processing for better performance
         std::vector<HighLevelEnergyData> results;
@@ -387,6 +398,17 @@ int HighLevelCommand::execute_kj(const CommandContext& context)
             results = calculator.process_directory(context.extension);
         }
 
+        // Rows went out while the files were processed; no table and no results file
+        if (rows)
+        {
+            JsonLine summary;
+            summary.field("files", static_cast<std::uint64_t>(filtered_files.size()))
+                .field("processed", static_cast<std::uint64_t>(results.size()))
+                .field("errors", static_cast<std::uint64_t>(processing_context->error_collector->get_errors().size()));
+            rows->write_summary(summary);
+            return processing_context->error_collector->has_errors() ? 1 : 0;
+        }
+
         // Check for errors during processing
         if (processing_context->error_collector->has_errors())
         {
@@ -428,6 +450,7 @@ int HighLevelCommand::execute_kj(const CommandContext& context)
         }
 
         // Print results based on output format
+        ProfileScope write_profile(ProfileStage::WRITE);
         if (output_format == "csv")
         {
             calculator.print_gibbs_csv_format(results, context.quiet);
@@ -498,16 +521,9 @@ int HighLevelCommand::execute_au(const CommandContext& context)
             return 1;
         }
 
-        // Find and count log files using batch processing if specified
+        // Find and count log files
         std::vector<std::string> log_files;
-        if (context.batch_size > 0)
-        {
-            log_files = findLogFiles(context.extension, context.max_file_size_mb, context.batch_size);
-        }
-        else
-        {
-            log_files = findLogFiles(context.extension, context.max_file_size_mb);
-        }
+        log_files = findLogFiles(context.extension, context.max_file_size_mb);
         std::vector<std::string> filtered_files;
         std::copy_if(log_files.begin(),
                      log_files.end(),
@@ -590,6 +606,14 @@ int HighLevelCommand::execute_au(const CommandContext& context)
         calculator.set_use_input_concentration(use_input_concentration);
         calculator.set_low_vib_method(low_vib_method);
         calculator.set_ravib(ravib);
+        calculator.set_use_archive(use_archive);
+
+        std::unique_ptr<NdjsonStream> rows;
+        if (output_format == "ndjson")
+        {
+            rows = std::make_unique<NdjsonStream>(std::cout);
+            calculator.set_row_stream(rows.get());
+        }
 
         // Use parallel processing for better performance
         std::vector<HighLevelEnergyData> results;
@@ -602,6 +626,17 @@ int HighLevelCommand::execute_au(const CommandContext& context)
             results = calculator.process_directory(context.extension);
         }
 
+        // Rows went out while the files were processed; no table and no results file
+        if (rows)
+        {
+            JsonLine summary;
+            summary.field("files", static_cast<std::uint64_t>(filtered_files.size()))
+                .field("processed", static_cast<std::uint64_t>(results.size()))
+                .field("errors", static_cast<std::uint64_t>(processing_context->error_collector->get_errors().size()));
+            rows->write_summary(summary);
+            return processing_context->error_collector->has_errors() ? 1 : 0;
+        }
+
         // Check for errors during processing
         if (processing_context->error_collector->has_errors())
         {
@@ -643,6 +678,7 @@ int HighLevelCommand::execute_au(const CommandContext& context)
         }
 
         // Print results based on output format
+        ProfileScope write_profile(ProfileStage::WRITE);
         if (output_format == "csv")
         {
             calculator.print_components_csv_format(results, context.quiet);
@@ -59,6 +59,7 @@ private:
     double      ravib = 100.0;              ///< Crossover frequency for quasi-RRHO methods (cm-1)
     size_t      memory_limit_mb = 0;
     bool        show_resource_info = false;
+    bool        use_archive = false;            ///< Read high-level energies from the Gaussian archive entry
 };
 
 #endif // HIGH_LEVEL_COMMAND_H
@@ -0,0 +1,323 @@
+/**
+ * @file query_command.cpp
+ * @brief Implementation of the query command
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "commands/query_command.h"
+#include "extraction/binary_results.h"
+#include "utilities/numeric_parse.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+    const char* const COLUMN_NAMES[] = {"name", "etgkj", "lf",    "gibbs",  "nucleare",
+                                        "scf",  "zpe",   "round", "status", "pcorr"};
+    constexpr int     COLUMN_COUNT   = sizeof(COLUMN_NAMES) / sizeof(COLUMN_NAMES[0]);
+
+    int column_index(const std::string& name)
+    {
+        for (int c = 0; c < COLUMN_COUNT; ++c)
+        {
+            if (name == COLUMN_NAMES[c])
+                return c;
+        }
+        return -1;
+    }
+
+    bool is_text_column(int column)
+    {
+        return column == 0 || column == 8 || column == 9;
+    }
+
+    double number_of(const ResultRow& row, int column)
+    {
+        switch (column)
+        {
+            case 1:
+                return row.etgkj;
+            case 2:
+                return row.lf;
+            case 3:
+                return row.GibbsFreeHartree;
+            case 4:
+                return row.nucleare;
+            case 5:
+                return row.scf;
+            case 6:
+                return row.zpe;
+            case 7:
+                return row.copyright_count;
+            default:
+                return 0.0;
+        }
+    }
+
+    std::string_view text_of(const ResultRow& row, int column)
+    {
+        switch (column)
+        {
+            case 0:
+                return row.file_name;
+            case 8:
+                return row.status;
+            default:
+                return row.phaseCorr;
+        }
+    }
+
+    template <typename T>
+    bool compare(const T& left, const std::string& op, const T& right)
+    {
+        if (op == "=" || op == "==")
+            return left == right;
+        if (op == "!=")
+            return left != right;
+        if (op == "<")
+            return left < right;
+        if (op == "<=")
+            return left <= right;
+        if (op == ">")
+            return left > right;
+        return left >= right;
+    }
+}  // namespace
+
+std::string QueryCommand::get_name() const
+{
+    return "query";
+}
+
+std::string QueryCommand::get_description() const
+{
+    return "Filter, sort and print rows of a binary result file (.cckb)";
+}
+
+void QueryCommand::parse_args(int argc, char* argv[], int& i, CommandContext& context)
+{
+    std::string arg = argv[i];
+
+    if (arg == "--where")
+    {
+        if (++i >= argc)
+        {
+            arg_error = "--where requires a condition such as 'gibbs<-100'";
+            return;
+        }
+
+        // The column name ends at the first operator character
+        std::string expression = argv[i];
+        size_t      op_begin   = expression.find_first_of("=!<>");
+        size_t      op_end     = expression.find_first_not_of("=!<>", op_begin);
+        if (op_begin == std::string::npos || op_begin == 0 || op_end == std::string::npos)
+        {
+            arg_error = "Invalid --where condition '" + expression + "'";
+            return;
+        }
+
+        Condition condition;
+        condition.column = column_index(expression.substr(0, op_begin));
+        condition.op     = expression.substr(op_begin, op_end - op_begin);
+        condition.text   = expression.substr(op_end);
+        static const char* const ops[] = {"=", "==", "!=", "<", "<=", ">", ">="};
+        if (condition.column < 0 || std::find(std::begin(ops), std::end(ops), condition.op) == std::end(ops))
+        {
+            arg_error = "Invalid --where condition '" + expression + "'";
+            return;
+        }
+        if (!is_text_column(condition.column) && !NumParse::to_double(condition.text, condition.number))
+        {
+            arg_error = "--where value '" + condition.text + "' is not a number (column '" +
+                        COLUMN_NAMES[condition.column] + "')";
+            return;
+        }
+        conditions.push_back(std::move(condition));
+    }
+    else if (arg == "--sort")
+    {
+        if (++i < argc)
+        {
+            sort_column = column_index(argv[i]);
+            if (sort_column < 0)
+            {
+                arg_error = "Unknown sort column '" + std::string(argv[i]) + "'";
+            }
+        }
+        else
+        {
+            arg_error = "--sort requires a column name";
+        }
+    }
+    else if (arg == "--desc")
+    {
+        descending = true;
+    }
+    else if (arg == "--top")
+    {
+        if (++i < argc)
+        {
+            try
+            {
+                long value = std::stol(argv[i]);
+                if (value <= 0)
+                {
+                    throw std::out_of_range("top");
+                }
+                top = static_cast<size_t>(value);
+            }
+            catch (const std::exception&)
+            {
+                context.warnings.push_back("Error: --top requires a positive number. Printing all rows.");
+            }
+        }
+        else
+        {
+            context.warnings.push_back("Error: --top requires a value");
+        }
+    }
+    else if (arg == "-f" || arg == "--format")
+    {
+        if (++i < argc)
+        {
+            std::string fmt = argv[i];
+            if (fmt == "text" || fmt == "csv")
+            {
+                format = fmt;
+            }
+            else
+            {
+                context.warnings.push_back("Error: Format must be 'text' or 'csv'. Using default 'text'.");
+            }
+        }
+        else
+        {
+            context.warnings.push_back("Error: Format value required after -f/--format.");
+        }
+    }
+    else if (arg == "--info")
+    {
+        info = true;
+    }
+    else if (!arg.empty() && arg[0] != '-' && input_file.empty())
+    {
+        input_file = arg;
+    }
+    else
+    {
+        context.warnings.push_back("Warning: Unknown query option '" + arg + "' ignored.");
+    }
+}
+
+int QueryCommand::execute(const CommandContext& context)
+{
+    (void)context;
+    if (!arg_error.empty())
+    {
+        std::cerr << "Error: " << arg_error << " (see 'cck query --help')" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        std::string path = input_file;
+        if (path.empty())
+        {
+            path = std::filesystem::current_path().filename().string() + ".cckb";
+        }
+
+        BinaryResultReader reader(path);
+
+        if (info)
+        {
+            std::cout << "File: " << path << "\n";
+            std::cout << "Rows: " << reader.size() << "\n\n";
+            std::cout << reader.metadata();
+            return 0;
+        }
+
+        std::vector<size_t> selected;
+        for (size_t index = 0; index < reader.size(); ++index)
+        {
+            ResultRow row  = reader.row(index);
+            bool      keep = true;
+            for (const auto& condition : conditions)
+            {
+                keep = is_text_column(condition.column)
+                           ? compare(text_of(row, condition.column), condition.op, std::string_view(condition.text))
+                           : compare(number_of(row, condition.column), condition.op, condition.number);
+                if (!keep)
+                    break;
+            }
+            if (keep)
+            {
+                selected.push_back(index);
+            }
+        }
+
+        size_t shown = top > 0 ? std::min(top, selected.size()) : selected.size();
+        if (sort_column >= 0)
+        {
+            // Keys are read once per row and sorted by position in `selected`, which is in
+            // file order: ties keep file order, so the first k rows match a full sort
+            std::vector<size_t> order(selected.size());
+            std::iota(order.begin(), order.end(), size_t{0});
+            if (is_text_column(sort_column))
+            {
+                std::vector<std::string> keys;
+                keys.reserve(selected.size());
+                for (size_t index : selected)
+                {
+                    keys.emplace_back(text_of(reader.row(index), sort_column));
+                }
+                std::partial_sort(order.begin(), order.begin() + shown, order.end(), [&](size_t a, size_t b) {
+                    if (keys[a] != keys[b])
+                        return descending ? keys[b] < keys[a] : keys[a] < keys[b];
+                    return a < b;
+                });
+            }
+            else
+            {
+                std::vector<double> keys;
+                keys.reserve(selected.size());
+                for (size_t index : selected)
+                {
+                    keys.push_back(number_of(reader.row(index), sort_column));
+                }
+                // NaN (missing values) sorts last in both directions
+                std::partial_sort(order.begin(), order.begin() + shown, order.end(), [&](size_t a, size_t b) {
+                    bool nan_a = std::isnan(keys[a]);
+                    bool nan_b = std::isnan(keys[b]);
+                    if (nan_a != nan_b)
+                        return nan_b;
+                    if (!nan_a && keys[a] != keys[b])
+                        return descending ? keys[b] < keys[a] : keys[a] < keys[b];
+                    return a < b;
+                });
+            }
+            for (size_t n = 0; n < shown; ++n)
+            {
+                order[n] = selected[order[n]];
+            }
+            order.resize(shown);
+            selected = std::move(order);
+        }
+
+        write_result_header(std::cout, format);
+        for (size_t n = 0; n < shown; ++n)
+        {
+            write_result_row(std::cout, reader.row(selected[n]), format);
+        }
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file query_command.h
+ * @brief Defines the QueryCommand class for filtering and sorting .cckb result files
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Invocation:
+ *   cck query [file.cckb] [options]
+ *
+ * Without a file, <current_dir>.cckb (as written by `extract -f cckb`) is read.
+ * The file is memory-mapped; only the matching rows are formatted.
+ *
+ * Options:
+ *   --where <col><op><value>  Keep rows where the condition holds (repeatable, all must hold)
+ *                             op: = == != < <= > >=
+ *   --sort <col>              Sort by a column (ascending)
+ *   --desc                    Sort descending
+ *   --top <k>                 Print only the first k rows after sorting
+ *   -f, --format <fmt>        text|csv (default: text)
+ *   --info                    Print the row count and the stored run parameters
+ *
+ * Columns: name, etgkj, lf, gibbs, nucleare, scf, zpe, round, status, pcorr.
+ */
+
+#ifndef QUERY_COMMAND_H
+#define QUERY_COMMAND_H
+
+#include "commands/icommand.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class QueryCommand
+ * @brief Command that filters, sorts and prints rows of a binary result file
+ */
+class QueryCommand : public ICommand
+{
+public:
+    std::string get_name() const override;
+    std::string get_description() const override;
+    void        parse_args(int argc, char* argv[], int& i, CommandContext& context) override;
+    int         execute(const CommandContext& context) override;
+
+private:
+    /// One --where condition
+    struct Condition
+    {
+        int         column;
+        std::string op;
+        double      number = 0.0;  ///< Value of numeric columns
+        std::string text;          ///< Value of text columns
+    };
+
+    std::string            input_file;
+    std::vector<Condition> conditions;
+    int                    sort_column = -1;  ///< -1: file order
+    bool                   descending  = false;
+    size_t                 top         = 0;  ///< 0: all rows
+    std::string            format      = "text";
+    bool                   info        = false;
+    std::string            arg_error;  ///< First invalid --where/--sort argument; execute() fails with it
+};
+
+#endif  // QUERY_COMMAND_H
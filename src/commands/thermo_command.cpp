@@ -298,6 +298,47 @@ void ThermoCommand::parse_args(int argc, char* argv[], int& i, CommandContext& c
             settings.cli_args.push_back(argv[i]);
         }
     }
+    else if (arg == "-f" || arg == "--format")
+    {
+        if (++i < argc)
+        {
+            std::string fmt = argv[i];
+            if (fmt == "text" || fmt == "ndjson")
+            {
+                settings.output_format = fmt;
+            }
+            else
+            {
+                context.warnings.push_back("Error: Format must be 'text' or 'ndjson'. Using default 'text'.");
+            }
+        }
+        else
+        {
+            context.warnings.push_back("Error: Format value required after -f/--format.");
+        }
+    }
+    else if (arg == "--summary")
+    {
+        if (++i < argc)
+        {
+            settings.summary_file = argv[i];
+        }
+        else
+        {
+            context.warnings.push_back("Error: File name required after --summary.");
+        }
+    }
+    else if (arg == "--ensemble-out")
+    {
+        if (++i < argc)
+        {
+            settings.ensemble_file = argv[i];
+        }
+        else
+        {
+            context.warnings.push_back("Error: File name required after --ensemble-out.");
+        }
+    }
     else if (arg == "--help-input")
     {
         thermo_help_topic = "input";
@@ -336,7 +377,9 @@ int ThermoCommand::execute(const CommandContext& context)
 
     try
     {
-        if (!context.quiet)
+        // With ndjson, stdout carries the JSON lines only
+        bool quiet = context.quiet || settings.output_format == "ndjson";
+        if (!quiet)
         {
             std::cout << "Starting thermodynamic analysis using OpenThermo module..." << std::endl;
         }
@@ -380,7 +423,7 @@ int ThermoCommand::execute(const CommandContext& context)
                 return 1;
             }
 
-            if (!context.quiet)
+            if (!quiet)
             {
                 std::cout << "Found " << auto_files.size() << " input files for processing." << std::endl;
             }
@@ -390,7 +433,7 @@ int ThermoCommand::execute(const CommandContext& context)
         // Report results
         if (result.success)
         {
-            if (!context.quiet)
+            if (!quiet)
             {
                 std::cout << "Thermodynamic analysis completed successfully." << std::endl;
                 if (!result.output_files.empty())
@@ -0,0 +1,372 @@
+/**
+ * @file binary_results.cpp
+ * @brief Implementation of the .cckb writer and reader
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "extraction/binary_results.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    using namespace BinaryResults;
+
+    // Column order of the files written by this version
+    enum ColumnIndex : size_t
+    {
+        COL_NAME_END,
+        COL_ETGKJ,
+        COL_LF,
+        COL_GIBBS,
+        COL_NUCLEARE,
+        COL_SCF,
+        COL_ZPE,
+        COL_COPYRIGHT,
+        COL_STATUS,
+        COL_PHASE_CORR,
+        COL_METADATA,
+        COL_NAMES,
+        COLUMN_COUNT
+    };
+
+    std::uint64_t align8(std::uint64_t offset)
+    {
+        return (offset + 7) & ~std::uint64_t(7);
+    }
+
+    // Byte-by-byte stores and loads, independent of the host byte order
+    void put_u64(unsigned char* out, std::uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            out[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+
+    void put_u32(unsigned char* out, std::uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            out[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+
+    std::uint64_t get_u64(const char* in)
+    {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i)
+        {
+            value = (value << 8) | static_cast<unsigned char>(in[i]);
+        }
+        return value;
+    }
+
+    std::uint32_t get_u32(const char* in)
+    {
+        std::uint32_t value = 0;
+        for (int i = 3; i >= 0; --i)
+        {
+            value = (value << 8) | static_cast<unsigned char>(in[i]);
+        }
+        return value;
+    }
+
+    void append_u64(std::vector<unsigned char>& buffer, std::uint64_t value)
+    {
+        size_t at = buffer.size();
+        buffer.resize(at + 8);
+        put_u64(buffer.data() + at, value);
+    }
+
+    void append_f64(std::vector<unsigned char>& buffer, double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_u64(buffer, bits);
+    }
+
+    void append_i32(std::vector<unsigned char>& buffer, std::int32_t value)
+    {
+        size_t at = buffer.size();
+        buffer.resize(at + 4);
+        put_u32(buffer.data() + at, static_cast<std::uint32_t>(value));
+    }
+
+    bool little_endian_host()
+    {
+        const std::uint16_t one = 1;
+        unsigned char       first;
+        std::memcpy(&first, &one, 1);
+        return first == 1;
+    }
+}  // namespace
+
+BinaryResultWriter::BinaryResultWriter(const std::string& file_path, std::uint64_t row_count,
+                                       std::string_view metadata)
+    : out(file_path, std::ios::binary | std::ios::trunc), path(file_path), rows(row_count)
+{
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Cannot create binary result file: " + file_path);
+    }
+
+    const struct
+    {
+        const char*   name;
+        ColumnType    type;
+        std::uint32_t width;
+    } layout[] = {{"name_end", U64, 8},        {"etgkj", F64, 8},      {"lf", F64, 8},
+                  {"GibbsFreeHartree", F64, 8}, {"nucleare", F64, 8},   {"scf", F64, 8},
+                  {"zpe", F64, 8},              {"copyright_count", I32, 4},
+                  {"status", U8, 1},            {"phase_corr", U8, 1},  {"metadata", BYTES, 1},
+                  {"names", BYTES, 1}};
+    for (const auto& column : layout)
+    {
+        columns.push_back(Column{column.name, column.type, column.width, 0, 0, {}});
+    }
+
+    std::uint64_t offset = align8(HEADER_BYTES + DIRECTORY_ENTRY * columns.size());
+    for (size_t c = 0; c < COL_METADATA; ++c)
+    {
+        columns[c].offset = offset;
+        offset            = align8(offset + rows * columns[c].width);
+    }
+    columns[COL_METADATA].offset  = offset;
+    columns[COL_METADATA].written = metadata.size();
+    columns[COL_NAMES].offset     = align8(offset + metadata.size());
+
+    // Header and directory are rewritten by finish(); until then the magic is zero
+    std::vector<char> zeros(static_cast<size_t>(columns[COL_METADATA].offset), '\0');
+    out.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+    out.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write binary result file: " + path);
+    }
+
+    for (size_t c = 0; c < columns.size(); ++c)
+    {
+        if (c != COL_METADATA)
+        {
+            columns[c].buffer.reserve(FLUSH_ROWS * columns[c].width);
+        }
+    }
+}
+
+void BinaryResultWriter::flush(Column& column)
+{
+    if (column.buffer.empty())
+    {
+        return;
+    }
+    out.seekp(static_cast<std::streamoff>(column.offset + column.written));
+    out.write(reinterpret_cast<const char*>(column.buffer.data()), static_cast<std::streamsize>(column.buffer.size()));
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write binary result file: " + path);
+    }
+    column.written += column.buffer.size();
+    column.buffer.clear();
+}
+
+void BinaryResultWriter::add(const ResultRow& row)
+{
+    if (added >= rows)
+    {
+        throw std::runtime_error("Binary result file " + path + ": more rows than announced");
+    }
+
+    name_bytes += row.file_name.size();
+    append_u64(columns[COL_NAME_END].buffer, name_bytes);
+    append_f64(columns[COL_ETGKJ].buffer, row.etgkj);
+    append_f64(columns[COL_LF].buffer, row.lf);
+    append_f64(columns[COL_GIBBS].buffer, row.GibbsFreeHartree);
+    append_f64(columns[COL_NUCLEARE].buffer, row.nucleare);
+    append_f64(columns[COL_SCF].buffer, row.scf);
+    append_f64(columns[COL_ZPE].buffer, row.zpe);
+    append_i32(columns[COL_COPYRIGHT].buffer, row.copyright_count);
+    columns[COL_STATUS].buffer.push_back(static_cast<unsigned char>(ResultTable::status_code(row.status)));
+    columns[COL_PHASE_CORR].buffer.push_back(row.phaseCorr == "YES" ? 1 : 0);
+    columns[COL_NAMES].buffer.insert(columns[COL_NAMES].buffer.end(), row.file_name.begin(), row.file_name.end());
+    added++;
+
+    if (added % FLUSH_ROWS == 0)
+    {
+        for (size_t c = 0; c < COL_METADATA; ++c)
+        {
+            flush(columns[c]);
+        }
+    }
+    if (columns[COL_NAMES].buffer.size() >= FLUSH_ROWS * 64)
+    {
+        flush(columns[COL_NAMES]);
+    }
+}
+
+void BinaryResultWriter::write_header()
+{
+    std::vector<unsigned char> header(HEADER_BYTES + DIRECTORY_ENTRY * columns.size(), 0);
+    std::memcpy(header.data(), MAGIC, sizeof(MAGIC));
+    put_u32(header.data() + 4, FORMAT_VERSION);
+    put_u64(header.data() + 8, rows);
+    put_u32(header.data() + 16, static_cast<std::uint32_t>(columns.size()));
+    put_u64(header.data() + 24, HEADER_BYTES);
+    put_u64(header.data() + 32, columns[COL_NAMES].offset + columns[COL_NAMES].written);
+
+    unsigned char* entry = header.data() + HEADER_BYTES;
+    for (const auto& column : columns)
+    {
+        std::memcpy(entry, column.name.data(), std::min(column.name.size(), COLUMN_NAME_SIZE - 1));
+        put_u32(entry + 24, column.type);
+        put_u32(entry + 28, column.width);
+        put_u64(entry + 32, column.offset);
+        put_u64(entry + 40, column.written);
+        entry += DIRECTORY_ENTRY;
+    }
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+}
+
+void BinaryResultWriter::finish()
+{
+    if (added != rows)
+    {
+        throw std::runtime_error("Binary result file " + path + ": " + std::to_string(added) + " of " +
+                                 std::to_string(rows) + " rows written");
+    }
+    for (size_t c = 0; c < columns.size(); ++c)
+    {
+        if (c != COL_METADATA)
+        {
+            flush(columns[c]);
+        }
+    }
+    write_header();
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write binary result file: " + path);
+    }
+}
+
+BinaryResultReader::BinaryResultReader(const std::string& path) : file(path)
+{
+    auto invalid = [&path](const std::string& reason) {
+        return std::runtime_error("Invalid binary result file " + path + ": " + reason);
+    };
+
+    if (!little_endian_host())
+    {
+        throw std::runtime_error("Binary result files can only be read on little-endian hosts");
+    }
+
+    const char*   data = file.data();
+    std::uint64_t size = file.size();
+    if (size < HEADER_BYTES || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        throw invalid("not a .cckb file or incomplete");
+    }
+    if (get_u32(data + 4) != FORMAT_VERSION)
+    {
+        throw invalid("unsupported format version " + std::to_string(get_u32(data + 4)));
+    }
+
+    rows                         = get_u64(data + 8);
+    std::uint32_t column_count   = get_u32(data + 16);
+    std::uint64_t directory      = get_u64(data + 24);
+    if (directory > size || column_count > (size - directory) / DIRECTORY_ENTRY)
+    {
+        throw invalid("column directory out of bounds");
+    }
+
+    for (std::uint32_t c = 0; c < column_count; ++c)
+    {
+        const char*   entry  = data + directory + c * DIRECTORY_ENTRY;
+        std::string   name(entry, strnlen(entry, COLUMN_NAME_SIZE));
+        std::uint32_t type   = get_u32(entry + 24);
+        std::uint32_t width  = get_u32(entry + 28);
+        std::uint64_t offset = get_u64(entry + 32);
+        std::uint64_t bytes  = get_u64(entry + 40);
+        if (offset > size || bytes > size - offset)
+        {
+            throw invalid("column " + name + " out of bounds");
+        }
+        const char* column = data + offset;
+
+        // Fixed-width columns must hold exactly one element per row and be aligned for direct access
+        auto fixed = [&](ColumnType expected, std::uint32_t expected_width) {
+            if (type != expected || width != expected_width || offset % 8 != 0 || bytes / width != rows ||
+                bytes % width != 0)
+            {
+                throw invalid("column " + name + " has an unexpected type or size");
+            }
+            return column;
+        };
+
+        if (name == "name_end")
+            name_end = reinterpret_cast<const std::uint64_t*>(fixed(U64, 8));
+        else if (name == "etgkj")
+            etgkj = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "lf")
+            lf = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "GibbsFreeHartree")
+            gibbs = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "nucleare")
+            nucleare = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "scf")
+            scf = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "zpe")
+            zpe = reinterpret_cast<const double*>(fixed(F64, 8));
+        else if (name == "copyright_count")
+            copyright_count = reinterpret_cast<const std::int32_t*>(fixed(I32, 4));
+        else if (name == "status")
+            status = reinterpret_cast<const std::uint8_t*>(fixed(U8, 1));
+        else if (name == "phase_corr")
+            phase_corr = reinterpret_cast<const std::uint8_t*>(fixed(U8, 1));
+        else if (name == "metadata")
+            metadata_text = std::string_view(column, static_cast<size_t>(bytes));
+        else if (name == "names")
+        {
+            names      = column;
+            names_size = bytes;
+        }
+        // Columns added by later writers are skipped
+    }
+
+    if (name_end == nullptr || names == nullptr || etgkj == nullptr || lf == nullptr || gibbs == nullptr ||
+        nucleare == nullptr || scf == nullptr || zpe == nullptr || copyright_count == nullptr ||
+        status == nullptr || phase_corr == nullptr)
+    {
+        throw invalid("required column missing");
+    }
+
+    // Name offsets are trusted by row(), so check them once
+    std::uint64_t previous = 0;
+    for (std::uint64_t i = 0; i < rows; ++i)
+    {
+        if (name_end[i] < previous || name_end[i] > names_size)
+        {
+            throw invalid("corrupt name offsets");
+        }
+        previous = name_end[i];
+    }
+}
+
+ResultRow BinaryResultReader::row(size_t index) const
+{
+    std::uint64_t begin = index == 0 ? 0 : name_end[index - 1];
+    return ResultRow{std::string_view(names + begin, static_cast<size_t>(name_end[index] - begin)),
+                     etgkj[index],
+                     lf[index],
+                     gibbs[index],
+                     nucleare[index],
+                     scf[index],
+                     zpe[index],
+                     ResultTable::status_text(static_cast<ResultStatus>(status[index])),
+                     phase_corr[index] ? "YES" : "NO",
+                     copyright_count[index]};
+}
@@ -0,0 +1,178 @@
+/**
+ * @file binary_results.h
+ * @brief Columnar binary result file (.cckb) writer and zero-copy reader
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * `extract -f cckb` writes the result table as a self-describing binary file
+ * that downstream tools (and `cck query`) can map and read without parsing
+ * text.
+ *
+ * @section Layout
+ * All integers and doubles are little-endian.
+ * - Header (64 bytes): magic "CCKB", format version, row count, column count,
+ *   offset of the column directory and total file size.
+ * - Column directory: one 48-byte entry per column with its name (24 bytes,
+ *   NUL padded), element type, element width, offset and size in bytes.
+ * - Column data, each column starting at a multiple of 8 bytes:
+ *   name_end (u64, end offset of each name in "names"), etgkj, lf,
+ *   GibbsFreeHartree, nucleare, scf, zpe (f64), copyright_count (i32),
+ *   status (u8: 0 DONE, 1 UNDONE, 2 ERROR), phase_corr (u8: 1 for YES),
+ *   metadata (bytes, the run parameters as printed in .results) and
+ *   names (bytes, the string heap of file names).
+ *
+ * Readers look columns up by name and must ignore columns they do not know,
+ * so columns can be added without a version change.
+ *
+ * @section Streaming
+ * The row count is known before the first row is written (the table size, or
+ * the spill size in streaming mode), so every fixed-width column has a fixed
+ * place in the file. The writer keeps a small buffer per column and flushes
+ * it to the column's position; the string heap is last and grows to the end
+ * of the file. Memory use does not depend on the number of rows.
+ */
+
+#ifndef BINARY_RESULTS_H
+#define BINARY_RESULTS_H
+
+#include "extraction/result_table.h"
+#include "utilities/mapped_file.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace BinaryResults
+ * @brief Constants of the .cckb format
+ */
+namespace BinaryResults
+{
+    constexpr char          MAGIC[4]         = {'C', 'C', 'K', 'B'};
+    constexpr std::uint32_t FORMAT_VERSION   = 1;
+    constexpr size_t        HEADER_BYTES     = 64;
+    constexpr size_t        DIRECTORY_ENTRY  = 48;
+    constexpr size_t        COLUMN_NAME_SIZE = 24;
+
+    /// Element type stored in a directory entry
+    enum ColumnType : std::uint32_t
+    {
+        F64   = 1,
+        I32   = 2,
+        U8    = 3,
+        U64   = 4,
+        BYTES = 5
+    };
+}  // namespace BinaryResults
+
+/**
+ * @class BinaryResultWriter
+ * @brief Streaming writer of .cckb files
+ */
+class BinaryResultWriter
+{
+private:
+    /// Rows buffered per column before they are written out
+    static constexpr size_t FLUSH_ROWS = 4096;
+
+    struct Column
+    {
+        std::string                name;
+        BinaryResults::ColumnType  type;
+        std::uint32_t              width;   ///< Bytes per element (1 for BYTES)
+        std::uint64_t              offset;  ///< Position in the file
+        std::uint64_t              written = 0;
+        std::vector<unsigned char> buffer;
+    };
+
+    std::ofstream       out;
+    std::string         path;
+    std::uint64_t       rows;
+    std::uint64_t       added = 0;
+    std::uint64_t       name_bytes = 0;
+    std::vector<Column> columns;
+
+    void flush(Column& column);
+    void write_header();
+
+public:
+    /**
+     * @brief Create @p file_path and lay out a file for @p row_count rows
+     * @param file_path Output file
+     * @param row_count Exact number of rows that will be added
+     * @param metadata Free text stored in the "metadata" column
+     * @throws std::runtime_error if the file cannot be created
+     */
+    BinaryResultWriter(const std::string& file_path, std::uint64_t row_count, std::string_view metadata);
+
+    BinaryResultWriter(const BinaryResultWriter&)            = delete;
+    BinaryResultWriter& operator=(const BinaryResultWriter&) = delete;
+
+    /**
+     * @brief Append one row
+     * @throws std::runtime_error if more rows are added than announced or on write errors
+     */
+    void add(const ResultRow& row);
+
+    /**
+     * @brief Flush all columns and complete the header
+     * @throws std::runtime_error if fewer rows were added than announced or on write errors
+     */
+    void finish();
+};
+
+/**
+ * @class BinaryResultReader
+ * @brief Memory-mapped, zero-copy reader of .cckb files
+ *
+ * Numeric columns are exposed as pointers into the mapping; nothing is copied
+ * or parsed. Only little-endian hosts are supported.
+ */
+class BinaryResultReader
+{
+private:
+    MappedFile           file;
+    std::uint64_t        rows = 0;
+    const std::uint64_t* name_end        = nullptr;
+    const char*          names           = nullptr;
+    std::uint64_t        names_size      = 0;
+    const double*        etgkj           = nullptr;
+    const double*        lf              = nullptr;
+    const double*        gibbs           = nullptr;
+    const double*        nucleare        = nullptr;
+    const double*        scf             = nullptr;
+    const double*        zpe             = nullptr;
+    const std::int32_t*  copyright_count = nullptr;
+    const std::uint8_t*  status          = nullptr;
+    const std::uint8_t*  phase_corr      = nullptr;
+    std::string_view     metadata_text;
+
+public:
+    /**
+     * @brief Map and validate @p path
+     * @throws std::runtime_error if the file is not a valid .cckb file of a known version
+     */
+    explicit BinaryResultReader(const std::string& path);
+
+    size_t size() const
+    {
+        return static_cast<size_t>(rows);
+    }
+
+    /**
+     * @brief View of row @p index; the strings point into the mapping
+     */
+    ResultRow row(size_t index) const;
+
+    /**
+     * @brief Run parameters stored by extract
+     */
+    std::string_view metadata() const
+    {
+        return metadata_text;
+    }
+};
+
+#endif  // BINARY_RESULTS_H
@@ -1,5 +1,9 @@
 #include "extraction/coord_extractor.h"
 #include "job_management/job_checker.h"
+#include "job_management/work_queue.h"
+#include "job_management/worker_buffers.h"
+#include "utilities/numeric_parse.h"
+#include "utilities/parse_stats.h"
 #include "utilities/utils.h"
 #include <atomic>
 #include <chrono>
@@ -19,8 +23,9 @@ extern std::atomic<bool> g_shutdown_requested;
 
 CoordExtractor::CoordExtractor(std::shared_ptr<ProcessingContext> ctx, bool quiet) : context(ctx), quiet_mode(quiet) {}
 
-ExtractSummary CoordExtractor::extract_coordinates(const std::vector<std::string>& log_files)
+ExtractSummary CoordExtractor::extract_coordinates(const std::vector<FileEntry>& log_entries)
 {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     ExtractSummary summary;
     summary.total_files = log_files.size();
 
@@ -52,11 +57,6 @@ ExtractSummary CoordExtractor::extract_coordinates(const std::vector<std::string
         }
     }
 
-    // Thread-safe containers
-    std::vector<std::pair<std::string, JobStatus>> successful_extractions;  // xyz_file, status
-    std::mutex                                     results_mutex;
-    std::atomic<size_t>                            file_index{0};
-
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(
         context->requested_threads ? context->requested_threads : 0, log_files.size(), context->job_resources);
@@ -67,12 +67,24 @@ ExtractSummary CoordExtractor::extract_coordinates(const std::vector<std::string
     }
 
     // Process files in parallel
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+
+    // Per-thread counters and results, merged into summary after the join
+    struct WorkerBuffer
+    {
+        ExtractSummary                                 counts;
+        std::vector<std::pair<std::string, JobStatus>> extractions;  // xyz_file, status
+    };
+    PerWorker<WorkerBuffer> buffers(num_threads);
+    ProgressCounter         progress;
+
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i)
     {
-        threads.emplace_back([&]() {
-            size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size())
+        threads.emplace_back([&, i]() {
+            WorkerBuffer& local = buffers[i];
+            size_t        index;
+            while (work_queue.next(i, index))
             {
                 if (g_shutdown_requested.load())
                     break;
@@ -86,35 +98,32 @@ ExtractSummary CoordExtractor::extract_coordinates(const std::vector<std::string
                     std::string error_msg;
                     auto [success, status] = extract_from_file(log_files[index], conflicting_base_names, error_msg);
 
+                    local.counts.processed_files++;
+                    if (success)
                     {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        summary.processed_files++;
-                        if (success)
-                        {
-                            std::string xyz_file = generate_xyz_filename(log_files[index], conflicting_base_names);
-                            successful_extractions.emplace_back(xyz_file, status);
-                            summary.extracted_files++;
-                        }
-                        else
+                        std::string xyz_file = generate_xyz_filename(log_files[index], conflicting_base_names);
+                        local.extractions.emplace_back(xyz_file, status);
+                        local.counts.extracted_files++;
+                    }
+                    else
+                    {
+                        local.counts.failed_files++;
+                        if (!error_msg.empty())
                         {
-                            summary.failed_files++;
-                            if (!error_msg.empty())
-                            {
-                                summary.errors.push_back("Error extracting " + log_files[index] + ": " + error_msg);
-                            }
+                            local.counts.errors.push_back("Error extracting " + log_files[index] + ": " + error_msg);
                         }
                     }
 
                     // Report progress
-                    if (!quiet_mode && summary.processed_files % 50 == 0)
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0)
                     {
-                        report_progress(summary.processed_files, summary.total_files);
+                        report_progress(done, summary.total_files);
                     }
                 }
                 catch (const std::exception& e)
                 {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.errors.push_back("Exception extracting " + log_files[index] + ": " + e.what());
+                    local.counts.errors.push_back("Exception extracting " + log_files[index] + ": " + e.what());
                 }
             }
         });
@@ -125,6 +134,17 @@ ExtractSummary CoordExtractor::extract_coordinates(const std::vector<std::string
     {
         thread.join();
     }
+    summary.work_stats = work_queue.stats();
+
+    std::vector<std::pair<std::string, JobStatus>> successful_extractions;
+    buffers.for_each([&](WorkerBuffer& local) {
+        summary.processed_files += local.counts.processed_files;
+        summary.extracted_files += local.counts.extracted_files;
+        summary.failed_files += local.counts.failed_files;
+        summary.errors.insert(summary.errors.end(), local.counts.errors.begin(), local.counts.errors.end());
+        successful_extractions.insert(
+            successful_extractions.end(), local.extractions.begin(), local.extractions.end());
+    });
 
     if (!quiet_mode && summary.processed_files > 0)
     {
@@ -176,6 +196,7 @@ CoordExtractor::extract_from_file(const std::string&                     log_fil
                                   const std::unordered_set<std::string>& conflicting_base_names,
                                   std::string&                           error_msg)
 {
+    CCK_STAT_FILE(log_file);
     try
     {
         // Use SMART mode to read file, looking for orientation section
@@ -249,10 +270,11 @@ CoordExtractor::extract_from_file(const std::string&                     log_fil
         // Parse and write each atom line
         for (int l = start + 5; l < end; ++l)
         {
-            std::istringstream ss(lines[l]);
-            int                center, atomic_num, type;
-            double             x, y, z;
-            if (!(ss >> center >> atomic_num >> type >> x >> y >> z))
+            std::string_view fields = lines[l];
+            int              center, atomic_num, type;
+            double           xyz[3];
+            if (!NumParse::parse_int(fields, center) || !NumParse::parse_int(fields, atomic_num) ||
+                !NumParse::parse_int(fields, type) || NumParse::parse_doubles(fields, xyz, 3) != 3)
             {
                 error_msg = "Failed to parse coordinate line: " + lines[l];
                 out.close();
@@ -263,8 +285,8 @@ CoordExtractor::extract_from_file(const std::string&                     log_fil
             std::string symbol = get_atomic_symbol(atomic_num);
 
             out << std::left << std::setw(10) << symbol << std::right << std::setw(20) << std::fixed
-                << std::setprecision(10) << x << std::setw(20) << std::fixed << std::setprecision(10) << y
-                << std::setw(20) << std::fixed << std::setprecision(10) << z << std::endl;
+                << std::setprecision(10) << xyz[0] << std::setw(20) << std::fixed << std::setprecision(10) << xyz[1]
+                << std::setw(20) << std::fixed << std::setprecision(10) << xyz[2] << std::endl;
         }
 
         out.close();
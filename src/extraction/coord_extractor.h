@@ -30,6 +30,7 @@ struct ExtractSummary
     size_t                   moved_to_running;  ///< Number of XYZ files moved to running_coord dir
     std::vector<std::string> errors;            ///< Collection of error messages encountered
     double                   execution_time;    ///< Total execution time in seconds
+    WorkQueueStats           work_stats;        ///< Load distribution over the worker threads (--resource-info)
 
     ExtractSummary()
         : total_files(0), processed_files(0), extracted_files(0), failed_files(0), moved_to_final(0),
@@ -142,13 +143,13 @@ public:
 
     /**
      * @brief Extract coordinates from multiple log files
-     * @param log_files Vector of log file paths
+     * @param log_entries Log files, with the sizes known from discovery
      * @return ExtractSummary with results
      *
      * Processes files in parallel, extracts coordinates, writes XYZ files,
      * and moves them to appropriate directories based on job status.
      */
-    ExtractSummary extract_coordinates(const std::vector<std::string>& log_files);
+    ExtractSummary extract_coordinates(const std::vector<FileEntry>& log_entries);
 
     /**
      * @brief Print extraction summary
@@ -0,0 +1,616 @@
+/**
+ * @file gaussian_archive.cpp
+ * @brief Implementation of the Gaussian archive entry parser
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "extraction/gaussian_archive.h"
+#include "thermo/atommass.h"
+#include "utilities/numeric_parse.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+
+namespace
+{
+    /// Archive entries start on a line beginning with " 1\1\"
+    constexpr std::string_view ENTRY_START = "\n 1\\1\\";
+    constexpr std::string_view ENTRY_END   = "\\\\@";
+
+    std::vector<std::string_view> split(std::string_view text, std::string_view separator)
+    {
+        std::vector<std::string_view> parts;
+        size_t                        pos = 0;
+        while (true)
+        {
+            size_t next = text.find(separator, pos);
+            if (next == std::string_view::npos)
+            {
+                parts.push_back(text.substr(pos));
+                return parts;
+            }
+            parts.push_back(text.substr(pos, next - pos));
+            pos = next + separator.size();
+        }
+    }
+
+    /**
+     * @brief Join the wrapped archive lines starting at @p pos into one string
+     * @return true if the entry terminator was reached
+     */
+    bool join_entry(std::string_view text, size_t pos, std::string& joined)
+    {
+        joined.clear();
+        while (pos < text.size())
+        {
+            size_t           eol  = text.find('\n', pos);
+            std::string_view line = text.substr(pos, eol == std::string_view::npos ? std::string_view::npos : eol - pos);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            // Archive lines are wrapped at 70 columns with one leading blank
+            if (line.empty() || line.front() != ' ')
+            {
+                return false;
+            }
+            line.remove_prefix(1);
+
+            size_t search_from = joined.size() >= 2 ? joined.size() - 2 : 0;
+            joined.append(line.data(), line.size());
+            size_t end = joined.find(ENTRY_END, search_from);
+            if (end != std::string::npos)
+            {
+                joined.resize(end);
+                return true;
+            }
+
+            if (eol == std::string_view::npos)
+            {
+                return false;
+            }
+            pos = eol + 1;
+        }
+        return false;
+    }
+
+    bool is_word_char(char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) != 0;
+    }
+
+    /// Bohr radius in Angstrom (CODATA 2010, as used by Gaussian 16)
+    constexpr double BOHR_ANGSTROM = 0.52917721092;
+
+    /// sqrt(Hartree / (Bohr^2 amu)) in cm^-1 (CODATA 2010)
+    constexpr double HESSIAN_TO_WAVENUMBER = 5140.4871436;
+
+    /// Atomic number of a plain element symbol ("C", "Cu"); 0 for "Bq" and anything else
+    int element_number(std::string_view symbol)
+    {
+        for (int z = 1; z <= 118; ++z)
+        {
+            const std::string& name = ind2name[z];
+            if (name.size() == symbol.size() &&
+                std::equal(name.begin(), name.end(), symbol.begin(), [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                }))
+            {
+                return z;
+            }
+        }
+        return 0;
+    }
+
+    /// Mass of the most abundant isotope of element @p z (amu); 0 if it has no stable isotope
+    double isotope_mass(int z)
+    {
+        static std::once_flag once;
+        std::call_once(once, [] {
+            SystemData sys;
+            atommass::initmass(sys);
+        });
+
+        double mass = 0.0, weight = 0.0;
+        for (int iso = 1; iso <= maxiso; ++iso)
+        {
+            if (isowei[z][iso] > weight)
+            {
+                weight = isowei[z][iso];
+                mass   = isomass[z][iso];
+            }
+        }
+        return mass;
+    }
+
+    void parse_geometry(std::string_view section, std::vector<ArchiveAtom>& atoms)
+    {
+        std::vector<std::string_view> fields = split(section, "\\");
+        // fields[0] is "charge,multiplicity"; atoms are "El,x,y,z" (older versions: "El,0,x,y,z")
+        for (size_t i = 1; i < fields.size(); ++i)
+        {
+            std::vector<std::string_view> parts = split(fields[i], ",");
+            ArchiveAtom                   atom;
+            if (parts.size() < 4 || !NumParse::to_double(parts[parts.size() - 3], atom.x) ||
+                !NumParse::to_double(parts[parts.size() - 2], atom.y) ||
+                !NumParse::to_double(parts[parts.size() - 1], atom.z))
+            {
+                atoms.clear();
+                return;
+            }
+            atom.number = element_number(parts[0]);
+            atoms.push_back(atom);
+        }
+    }
+
+    /// Comma-separated numbers of @p section; empty if any field is not a number
+    std::vector<double> parse_numbers(std::string_view section)
+    {
+        std::vector<double> values;
+        for (std::string_view field : split(section, ","))
+        {
+            double value;
+            if (!NumParse::to_double(field, value))
+            {
+                return {};
+            }
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    /**
+     * @brief Eigenvalues of the symmetric n x n matrix @p a (row-major, destroyed)
+     *
+     * Householder reduction to tridiagonal form followed by the implicit QL
+     * algorithm; only the lower triangle of @p a is referenced.
+     */
+    bool symmetric_eigenvalues(std::vector<double>& a, size_t n, std::vector<double>& d)
+    {
+        std::vector<double> e(n, 0.0);
+        d.assign(n, 0.0);
+        auto at = [&a, n](size_t i, size_t j) -> double& {
+            return a[i * n + j];
+        };
+
+        for (size_t i = n - 1; i > 0; --i)
+        {
+            const size_t l = i - 1;
+            double       h = 0.0;
+            if (l > 0)
+            {
+                double scale = 0.0;
+                for (size_t k = 0; k <= l; ++k)
+                    scale += std::abs(at(i, k));
+                if (scale == 0.0)
+                {
+                    e[i] = at(i, l);
+                    continue;
+                }
+                for (size_t k = 0; k <= l; ++k)
+                {
+                    at(i, k) /= scale;
+                    h += at(i, k) * at(i, k);
+                }
+                double f = at(i, l);
+                double g = f >= 0.0 ? -std::sqrt(h) : std::sqrt(h);
+                e[i]     = scale * g;
+                h -= f * g;
+                at(i, l) = f - g;
+                f        = 0.0;
+                for (size_t j = 0; j <= l; ++j)
+                {
+                    g = 0.0;
+                    for (size_t k = 0; k <= j; ++k)
+                        g += at(j, k) * at(i, k);
+                    for (size_t k = j + 1; k <= l; ++k)
+                        g += at(k, j) * at(i, k);
+                    e[j] = g / h;
+                    f += e[j] * at(i, j);
+                }
+                const double hh = f / (h + h);
+                for (size_t j = 0; j <= l; ++j)
+                {
+                    f    = at(i, j);
+                    g    = e[j] - hh * f;
+                    e[j] = g;
+                    for (size_t k = 0; k <= j; ++k)
+                        at(j, k) -= f * e[k] + g * at(i, k);
+                }
+            }
+            else
+            {
+                e[i] = at(i, l);
+            }
+        }
+        for (size_t i = 0; i < n; ++i)
+            d[i] = at(i, i);
+
+        for (size_t i = 1; i < n; ++i)
+            e[i - 1] = e[i];
+        e[n - 1] = 0.0;
+
+        for (size_t l = 0; l < n; ++l)
+        {
+            for (int iter = 0;; ++iter)
+            {
+                size_t m = l;
+                for (; m + 1 < n; ++m)
+                {
+                    const double dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                    if (std::abs(e[m]) <= 1e-15 * dd)
+                        break;
+                }
+                if (m == l)
+                    break;
+                if (iter == 60)
+                    return false;
+
+                double g = (d[l + 1] - d[l]) / (2.0 * e[l]);
+                double r = std::hypot(g, 1.0);
+                g        = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+                double s = 1.0, c = 1.0, p = 0.0;
+                bool   deflated = false;
+                for (size_t i = m; i-- > l;)
+                {
+                    const double f = s * e[i];
+                    const double b = c * e[i];
+                    r              = std::hypot(f, g);
+                    e[i + 1]       = r;
+                    if (r == 0.0)
+                    {
+                        d[i + 1] -= p;
+                        e[m]     = 0.0;
+                        deflated = true;
+                        break;
+                    }
+                    s        = f / r;
+                    c        = g / r;
+                    g        = d[i + 1] - p;
+                    r        = (d[i] - g) * s + 2.0 * c * b;
+                    p        = s * r;
+                    d[i + 1] = g + p;
+                    g        = c * r - b;
+                }
+                if (deflated)
+                    continue;
+                d[l] -= p;
+                e[l] = g;
+                e[m] = 0.0;
+            }
+        }
+        return true;
+    }
+}  // namespace
+
+bool GaussianArchive::get(const std::string& key, double& value) const
+{
+    for (auto it = properties.rbegin(); it != properties.rend(); ++it)
+    {
+        if (it->first != key)
+        {
+            continue;
+        }
+        std::string_view raw   = it->second;
+        size_t           comma = raw.rfind(',');
+        std::string_view last  = comma == std::string_view::npos ? raw : raw.substr(comma + 1);
+        return !last.empty() && NumParse::to_double(last, value);
+    }
+    return false;
+}
+
+bool GaussianArchive::route_has(std::string_view keyword) const
+{
+    auto lower = [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    };
+
+    for (size_t pos = 0; pos + keyword.size() <= route.size(); ++pos)
+    {
+        bool match = true;
+        for (size_t k = 0; k < keyword.size() && match; ++k)
+        {
+            match = lower(route[pos + k]) == lower(keyword[k]);
+        }
+        if (!match)
+        {
+            continue;
+        }
+        bool starts_word = pos == 0 || !is_word_char(route[pos - 1]);
+        bool ends_word   = pos + keyword.size() == route.size() || !is_word_char(route[pos + keyword.size()]);
+        if (starts_word && ends_word)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GaussianArchive::needs_full_parse() const
+{
+    // ONIOM and composite methods archive an extrapolated HF= that no "SCF Done" line matches
+    for (std::string_view keyword : {"td", "cis", "externaliteration", "clr", "oniom", "g1", "g2", "g2mp2", "g3",
+                                     "g3mp2", "g3b3", "g3mp2b3", "g4", "g4mp2", "cbs-4m", "cbs-qb3", "cbs-apno",
+                                     "w1u", "w1bd", "w1ro"})
+    {
+        if (route_has(keyword))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GaussianArchive::route_value(std::string_view keyword, double& value) const
+{
+    auto lower = [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    };
+
+    for (size_t pos = 0; pos + keyword.size() < route.size(); ++pos)
+    {
+        if (route[pos + keyword.size()] != '=' || (pos > 0 && is_word_char(route[pos - 1])))
+        {
+            continue;
+        }
+        bool match = true;
+        for (size_t k = 0; k < keyword.size() && match; ++k)
+        {
+            match = lower(route[pos + k]) == lower(keyword[k]);
+        }
+        if (match)
+        {
+            std::string_view rest = std::string_view(route).substr(pos + keyword.size() + 1);
+            return NumParse::parse_double(rest, value);
+        }
+    }
+    return false;
+}
+
+bool GaussianArchive::nuclear_repulsion(double& energy) const
+{
+    if (atoms.empty())
+    {
+        return false;
+    }
+
+    // Effective core potentials replace the nuclear charge; no supported ECP starts before Na
+    std::string upper_basis = basis;
+    std::transform(upper_basis.begin(), upper_basis.end(), upper_basis.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    int max_number = 36;
+    for (const char* ecp_basis : {"LANL", "SDD", "CEP", "ECP", "GEN", "STUTTGART", "CRENB"})
+    {
+        if (upper_basis.find(ecp_basis) != std::string::npos)
+        {
+            max_number = 10;
+        }
+    }
+
+    energy = 0.0;
+    for (size_t i = 0; i < atoms.size(); ++i)
+    {
+        if (atoms[i].number == 0 || atoms[i].number > max_number)
+        {
+            return false;
+        }
+        for (size_t j = 0; j < i; ++j)
+        {
+            const double dx = atoms[i].x - atoms[j].x;
+            const double dy = atoms[i].y - atoms[j].y;
+            const double dz = atoms[i].z - atoms[j].z;
+            energy += atoms[i].number * atoms[j].number * BOHR_ANGSTROM / std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+    }
+    return true;
+}
+
+bool GaussianArchive::frequencies(std::vector<double>& frequencies) const
+{
+    const size_t natoms = atoms.size();
+    const size_t n      = 3 * natoms;
+    if (natoms < 2 || force_constants.size() != n * (n + 1) / 2 || route_has("readisotopes") ||
+        route_has("readiso"))
+    {
+        return false;
+    }
+
+    std::vector<double> sqrt_mass(natoms);
+    double              total_mass = 0.0, com[3] = {0.0, 0.0, 0.0};
+    for (size_t a = 0; a < natoms; ++a)
+    {
+        const double mass = atoms[a].number > 0 ? isotope_mass(atoms[a].number) : 0.0;
+        if (mass <= 0.0)
+        {
+            return false;
+        }
+        sqrt_mass[a] = std::sqrt(mass);
+        total_mass += mass;
+        com[0] += mass * atoms[a].x;
+        com[1] += mass * atoms[a].y;
+        com[2] += mass * atoms[a].z;
+    }
+    for (double& c : com)
+        c /= total_mass;
+
+    // Mass-weighted Hessian, full square
+    std::vector<double> h(n * n);
+    for (size_t i = 0, k = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j <= i; ++j, ++k)
+        {
+            const double value = force_constants[k] / (sqrt_mass[i / 3] * sqrt_mass[j / 3]);
+            h[i * n + j]       = value;
+            h[j * n + i]       = value;
+        }
+    }
+
+    // Orthonormal translations and rotations in mass-weighted coordinates
+    std::vector<std::vector<double>> modes;
+    for (int axis = 0; axis < 6; ++axis)
+    {
+        std::vector<double> v(n, 0.0);
+        for (size_t a = 0; a < natoms; ++a)
+        {
+            const double r[3] = {atoms[a].x - com[0], atoms[a].y - com[1], atoms[a].z - com[2]};
+            if (axis < 3)
+            {
+                v[3 * a + axis] = sqrt_mass[a];
+            }
+            else
+            {
+                // Rotation about axis (axis-3): e x r
+                const int p = (axis - 3 + 1) % 3, q = (axis - 3 + 2) % 3;
+                v[3 * a + q] = sqrt_mass[a] * r[p];
+                v[3 * a + p] = -sqrt_mass[a] * r[q];
+            }
+        }
+        const double original = std::sqrt(std::inner_product(v.begin(), v.end(), v.begin(), 0.0));
+        for (const auto& u : modes)
+        {
+            const double dot = std::inner_product(v.begin(), v.end(), u.begin(), 0.0);
+            for (size_t i = 0; i < n; ++i)
+                v[i] -= dot * u[i];
+        }
+        const double norm = std::sqrt(std::inner_product(v.begin(), v.end(), v.begin(), 0.0));
+        if (norm > 1e-6 * std::max(original, 1.0))  // the rotation about a linear molecule's axis vanishes
+        {
+            for (double& x : v)
+                x /= norm;
+            modes.push_back(std::move(v));
+        }
+    }
+
+    // P H P with P = 1 - sum(u u^T): H - U W^T - W U^T + U (U^T W) U^T, W = H U
+    const size_t                     nmodes = modes.size();
+    std::vector<std::vector<double>> w(nmodes, std::vector<double>(n, 0.0));
+    for (size_t m = 0; m < nmodes; ++m)
+    {
+        for (size_t i = 0; i < n; ++i)
+            w[m][i] = std::inner_product(h.begin() + static_cast<std::ptrdiff_t>(i * n),
+                                         h.begin() + static_cast<std::ptrdiff_t>((i + 1) * n), modes[m].begin(), 0.0);
+    }
+    std::vector<double> uw(nmodes * nmodes);
+    for (size_t m = 0; m < nmodes; ++m)
+    {
+        for (size_t l = 0; l < nmodes; ++l)
+            uw[m * nmodes + l] = std::inner_product(modes[m].begin(), modes[m].end(), w[l].begin(), 0.0);
+    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j <= i; ++j)
+        {
+            double value = h[i * n + j];
+            for (size_t m = 0; m < nmodes; ++m)
+            {
+                value -= modes[m][i] * w[m][j] + w[m][i] * modes[m][j];
+                for (size_t l = 0; l < nmodes; ++l)
+                    value += modes[m][i] * uw[m * nmodes + l] * modes[l][j];
+            }
+            h[i * n + j] = value;
+        }
+    }
+
+    std::vector<double> eigenvalues;
+    if (!symmetric_eigenvalues(h, n, eigenvalues))
+    {
+        return false;
+    }
+
+    // The projected modes have zero eigenvalues; the remaining 3N-6 (3N-5) are vibrations
+    std::sort(eigenvalues.begin(), eigenvalues.end(),
+              [](double a, double b) { return std::abs(a) < std::abs(b); });
+    eigenvalues.erase(eigenvalues.begin(), eigenvalues.begin() + static_cast<std::ptrdiff_t>(nmodes));
+    std::sort(eigenvalues.begin(), eigenvalues.end());
+
+    frequencies.clear();
+    size_t imaginary = 0;
+    for (double value : eigenvalues)
+    {
+        const double frequency = std::copysign(std::sqrt(std::abs(value)) * HESSIAN_TO_WAVENUMBER, value);
+        imaginary += frequency < 0.0 ? 1 : 0;
+        frequencies.push_back(frequency);
+    }
+
+    double nimag = 0.0;
+    return !get("NImag", nimag) || static_cast<size_t>(nimag) == imaginary;
+}
+
+bool parse_gaussian_archive(std::string_view text, GaussianArchive& archive)
+{
+    archive = GaussianArchive{};
+
+    std::vector<size_t> starts;
+    for (size_t pos = text.find(ENTRY_START); pos != std::string_view::npos; pos = text.find(ENTRY_START, pos + 1))
+    {
+        starts.push_back(pos + 1);
+    }
+
+    std::string joined;
+    for (auto it = starts.rbegin(); it != starts.rend(); ++it)
+    {
+        if (!join_entry(text, *it, joined))
+        {
+            continue;  // truncated entry (job killed while printing): try the previous one
+        }
+
+        std::vector<std::string_view> sections = split(joined, "\\\\");
+        if (sections.size() < 5)
+        {
+            continue;
+        }
+
+        std::vector<std::string_view> header = split(sections[0], "\\");
+        if (header.size() > 6)
+        {
+            archive.job_type = std::string(header[3]);
+            archive.method   = std::string(header[4]);
+            archive.basis    = std::string(header[5]);
+            archive.formula  = std::string(header[6]);
+        }
+        archive.route = std::string(sections[1]);
+        archive.title = std::string(sections[2]);
+        parse_geometry(sections[3], archive.atoms);
+
+        for (std::string_view field : split(sections[4], "\\"))
+        {
+            size_t eq = field.find('=');
+            if (eq != std::string_view::npos)
+            {
+                archive.properties.emplace_back(std::string(field.substr(0, eq)), std::string(field.substr(eq + 1)));
+            }
+        }
+
+        if (sections.size() > 5)
+        {
+            archive.force_constants = parse_numbers(sections[5]);
+        }
+
+        archive.entries = starts.size();
+        archive.offset  = *it;
+        return true;
+    }
+    return false;
+}
+
+bool find_gaussian_archive(std::string_view text, GaussianArchive& archive)
+{
+    size_t window = ARCHIVE_TAIL_BYTES;
+    while (true)
+    {
+        window = std::min(window, text.size());
+        if (parse_gaussian_archive(text.substr(text.size() - window), archive))
+        {
+            archive.offset += text.size() - window;
+            return true;
+        }
+        if (window == text.size() || window >= ARCHIVE_MAX_TAIL_BYTES)
+        {
+            return false;
+        }
+        window *= 4;
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file gaussian_archive.h
+ * @brief Parser for the archive entry printed at the end of Gaussian jobs
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Every successfully completed Gaussian job step prints a compact archive
+ * entry ("1\1\GINC-...\\@") just before the closing quotation. It holds the
+ * route, the final geometry and a property section with HF=, ZeroPoint=,
+ * Thermal=, HTot=, GTot=, NImag= and friends. Because the entry sits in the
+ * last few kilobytes of the log, it can be located and parsed without reading
+ * the rest of the file.
+ *
+ * @section Archive Layout
+ * Sections are separated by "\\" and fields inside a section by "\":
+ * - 0: 1\1\GINC-host\JobType\Method\Basis\Formula\User\Date\0
+ * - 1: route, 2: title, 3: charge,multiplicity and geometry
+ * - 4: properties (Version=...\HF=...\ZeroPoint=...\NImag=...)
+ * - further sections: force constants and other arrays, then "@"
+ *
+ * Frequency jobs archive the Cartesian force constants (lower triangle, in
+ * Hartree/Bohr^2) right after the properties, so the harmonic frequencies
+ * can be recomputed from the entry alone.
+ */
+
+#ifndef GAUSSIAN_ARCHIVE_H
+#define GAUSSIAN_ARCHIVE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct ArchiveAtom
+ * @brief One atom of the archived geometry
+ */
+struct ArchiveAtom
+{
+    int    number = 0;    ///< Atomic number; 0 for ghost atoms and symbols that are not plain elements
+    double x      = 0.0;  ///< Cartesian coordinates in Angstrom
+    double y      = 0.0;
+    double z      = 0.0;
+};
+
+/**
+ * @struct GaussianArchive
+ * @brief Fields of the last complete archive entry of a Gaussian log
+ */
+struct GaussianArchive
+{
+    std::string job_type;  ///< e.g. "SP", "FOpt", "Freq"
+    std::string method;    ///< e.g. "RB3LYP"
+    std::string basis;     ///< e.g. "6-31G(d)"
+    std::string formula;   ///< Stoichiometry
+    std::string route;     ///< Route section as archived
+    std::string title;     ///< Title card
+
+    std::vector<std::pair<std::string, std::string>> properties;  ///< key=value pairs of the property section
+
+    std::vector<ArchiveAtom> atoms;            ///< Final geometry
+    std::vector<double>      force_constants;  ///< Lower triangle of the Cartesian Hessian; empty if not archived
+
+    size_t entries = 0;  ///< Number of complete archive entries in the text that was searched
+    size_t offset  = 0;  ///< Byte offset of the first line of the entry in the text that was searched
+
+    /**
+     * @brief Look up a numeric property such as "HF" or "ZeroPoint"
+     * @param key Property name without '='
+     * @param value [out] Parsed value; for comma-separated lists (scans) the last element
+     * @return true if the property exists and is numeric
+     */
+    bool get(const std::string& key, double& value) const;
+
+    /**
+     * @brief Check whether the route contains a keyword (case-insensitive, whole word)
+     */
+    bool route_has(std::string_view keyword) const;
+
+    /**
+     * @brief true if energies in the archive differ from what the full log parser reports
+     *
+     * CIS/TD excited-state energies, external-iteration PCM and cLR corrections
+     * are only printed in the log body, so such jobs have to be parsed in full.
+     */
+    bool needs_full_parse() const;
+
+    /**
+     * @brief Look up a numeric "Keyword=value" option of the route, e.g. Temperature=300
+     * @return true if the option is present with a numeric value
+     */
+    bool route_value(std::string_view keyword, double& value) const;
+
+    /**
+     * @brief Nuclear repulsion energy of the archived geometry (Hartree)
+     * @return false if an atom is not a plain element or may carry an ECP,
+     *         whose reduced core charge the archive does not record
+     */
+    bool nuclear_repulsion(double& energy) const;
+
+    /**
+     * @brief Harmonic frequencies from the archived force constants
+     * @param frequencies [out] The 3N-6 (3N-5 for linear molecules) frequencies in cm^-1,
+     *                    ascending, imaginary ones negative
+     * @return false without a complete force-constant section, for atoms that are
+     *         not plain elements, or when the count of imaginary frequencies
+     *         disagrees with NImag=
+     *
+     * Uses the mass of the most abundant isotope of each element and projects
+     * translations and rotations out of the mass-weighted Hessian, as Gaussian
+     * does, so the values agree with the printed ones to about 0.001 cm^-1.
+     */
+    bool frequencies(std::vector<double>& frequencies) const;
+};
+
+/// Initial tail window searched for the archive entry
+constexpr size_t ARCHIVE_TAIL_BYTES = 64 * 1024;
+
+/// Largest tail window searched before giving up (large force-constant sections)
+constexpr size_t ARCHIVE_MAX_TAIL_BYTES = 8 * 1024 * 1024;
+
+/**
+ * @brief Parse the last complete archive entry contained in @p text
+ * @param text Log content (usually only the tail of the file)
+ * @param archive [out] Parsed entry
+ * @return true if a complete entry (terminated by "\\@") was found
+ */
+bool parse_gaussian_archive(std::string_view text, GaussianArchive& archive);
+
+/**
+ * @brief Search growing tail windows of @p text for the archive entry
+ * @param text Complete log content (e.g. a MappedFile view; only the tail is touched)
+ * @param archive [out] Parsed entry; its offset is relative to the start of @p text
+ * @return true if an entry was found within ARCHIVE_MAX_TAIL_BYTES of the end
+ *
+ * The window starts at ARCHIVE_TAIL_BYTES and grows 4x, so only the tail that
+ * holds the entry is read, however large the file.
+ */
+bool find_gaussian_archive(std::string_view text, GaussianArchive& archive);
+
+#endif  // GAUSSIAN_ARCHIVE_H
@@ -0,0 +1,864 @@
+/**
+ * @file gaussian_scanner.cpp
+ * @brief Implementation of the single-pass Gaussian log scanner
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * The scanner reproduces the field semantics of the original line-by-line
+ * parser in extract(): on every line, termination and copyright markers are
+ * counted independently, and the remaining markers are tried in the same
+ * precedence order as the original if/else-if chain. Only lines that contain
+ * at least one marker are ever looked at.
+ */
+
+#include "extraction/gaussian_scanner.h"
+#include "extraction/gaussian_archive.h"
+#include "utilities/numeric_parse.h"
+#include "utilities/parse_stats.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    /// Texts are processed in chunks of this size so cancellation is noticed promptly
+    constexpr size_t SCAN_CHUNK_BYTES = 8 * 1024 * 1024;
+
+    /// Marker texts, indexed by GaussianScanner::Marker
+    const char* const MARKER_PATTERNS[] = {"Normal termination",
+                                           "Error termination",
+                                           "Copyright",
+                                           "SCF Done",
+                                           "Total Energy, E(CIS",
+                                           "After PCM corrections, the energy is",
+                                           "Zero-point correction",
+                                           "Thermal correction to Gibbs Free Energy",
+                                           "Sum of electronic and thermal Free Energies",
+                                           "Sum of electronic and zero-point Energies",
+                                           "nuclear repulsion energy",
+                                           "Frequencies",
+                                           "Kelvin.  Pressure",
+                                           "scrf",
+                                           "Proceeding to internal job step number"};
+
+    bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+    }
+
+    std::string_view trim(std::string_view s)
+    {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+            s.remove_prefix(1);
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+            s.remove_suffix(1);
+        return s;
+    }
+
+    /// Leading number, trailing text ignored (matches the ignored return value of safe_stod)
+    bool parse_prefix(std::string_view s, double& value)
+    {
+        size_t consumed = 0;
+        return NumParse::parse_leading(s, value, consumed);
+    }
+
+    /// Whole string must be a number (matches safe_stod returning true)
+    bool parse_strict(std::string_view s, double& value)
+    {
+        return NumParse::to_double(s, value);
+    }
+
+    /// Match -?\d+\.\d+ at the start of @p s and convert it
+    bool parse_fixed_decimal(std::string_view s, double& value)
+    {
+        size_t i = 0;
+        if (i < s.size() && s[i] == '-')
+            ++i;
+        size_t int_start = i;
+        while (i < s.size() && s[i] >= '0' && s[i] <= '9')
+            ++i;
+        if (i == int_start || i >= s.size() || s[i] != '.')
+            return false;
+        ++i;
+        size_t frac_start = i;
+        while (i < s.size() && s[i] >= '0' && s[i] <= '9')
+            ++i;
+        if (i == frac_start)
+            return false;
+        return parse_prefix(s.substr(0, i), value);
+    }
+
+    std::string_view after_first(std::string_view line, std::string_view token)
+    {
+        size_t pos = line.find(token);
+        return pos == std::string_view::npos ? std::string_view() : line.substr(pos + token.size());
+    }
+
+    /// Lower-case @p s without blanks, so that routes wrapped at different columns compare equal
+    std::string compact(std::string_view s)
+    {
+        std::string out;
+        for (char c : s)
+        {
+            if (!is_space(c))
+                out += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return out;
+    }
+
+    /**
+     * @brief Route and title of the first job step in @p head
+     *
+     * After the "Copyright" banner, the route is the block of lines starting
+     * with " #" up to a dashed line and the title the next block framed by
+     * dashed lines. @p end receives the offset just past the title block.
+     */
+    bool read_first_route(std::string_view head, std::string& route, std::string& title, size_t& end)
+    {
+        size_t pos = head.find("Copyright");
+        if (pos == std::string_view::npos)
+            return false;
+
+        enum { BEFORE_ROUTE, ROUTE, BEFORE_TITLE, TITLE } state = BEFORE_ROUTE;
+        route.clear();
+        title.clear();
+        while ((pos = head.find('\n', pos)) != std::string_view::npos)
+        {
+            const size_t     start = pos + 1;
+            const size_t     eol   = head.find('\n', start);
+            std::string_view line  = head.substr(start, eol == std::string_view::npos ? eol : eol - start);
+            if (eol == std::string_view::npos)
+                return false;  // the title block is not complete within the head
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+            const bool dashes = line.size() > 2 && line[0] == ' ' && line[1] == '-';
+
+            if (state == BEFORE_ROUTE && line.size() > 1 && line[0] == ' ' && line[1] == '#')
+                state = ROUTE;
+            else if (state == ROUTE && dashes)
+                state = BEFORE_TITLE;
+            else if (state == BEFORE_TITLE && dashes)
+                state = TITLE;
+            else if (state == TITLE && dashes)
+            {
+                end = eol + 1;
+                return true;
+            }
+
+            if (state == ROUTE)
+                route.append(line.substr(1));
+            else if (state == TITLE && !dashes)
+                title.append(line.substr(1));
+            pos = start;
+        }
+        return false;
+    }
+}  // namespace
+
+void GaussianScanner::merge_earlier_line(GaussianScanData& data, const GaussianScanData& line)
+{
+    auto take = [&](Marker m) {
+        return (line.seen & (1u << m)) != 0 && (data.seen & (1u << m)) == 0;
+    };
+
+    data.normal_count += line.normal_count;
+    data.error_count += line.error_count;
+    data.copyright_count += line.copyright_count;
+
+    if (take(SCF_DONE))
+    {
+        data.scf     = line.scf;
+        data.has_scf = true;
+    }
+    if (take(CIS_TOTAL_ENERGY))
+        data.scftd = line.scftd;
+    if (take(PCM_CORRECTED_ENERGY))
+        data.scfEqui = line.scfEqui;
+    if (take(ZERO_POINT_CORRECTION))
+        data.zpe = line.zpe;
+    if (take(THERMAL_CORRECTION_G))
+        data.tcg = line.tcg;
+    if (take(SUM_THERMAL_FREE))
+        data.etg = line.etg;
+    if (take(SUM_ZERO_POINT))
+        data.ezpe = line.ezpe;
+    if (take(NUCLEAR_REPULSION))
+        data.nucleare = line.nucleare;
+    if (take(KELVIN_PRESSURE))
+    {
+        data.temp     = line.temp;
+        data.pressure = line.pressure;
+    }
+
+    // The last imaginary mode of the file is the first one met going backwards
+    if (line.has_negative_freq && !data.has_negative_freq)
+    {
+        data.has_negative_freq  = true;
+        data.last_negative_freq = line.last_negative_freq;
+    }
+    if (line.has_positive_freq && (!data.has_positive_freq || line.min_positive_freq < data.min_positive_freq))
+    {
+        data.has_positive_freq = true;
+        data.min_positive_freq = line.min_positive_freq;
+    }
+    data.scrf_seen = data.scrf_seen || line.scrf_seen;
+    data.seen |= line.seen;
+    data.warnings.insert(data.warnings.begin(), line.warnings.begin(), line.warnings.end());
+}
+
+MultiPatternMatcher::MultiPatternMatcher(std::vector<std::string> pats) : patterns(std::move(pats)), min_length(0)
+{
+    if (patterns.empty())
+    {
+        throw std::invalid_argument("MultiPatternMatcher requires at least one pattern");
+    }
+
+    min_length = patterns.front().size();
+    for (const auto& p : patterns)
+    {
+        if (p.size() < 2)
+        {
+            throw std::invalid_argument("MultiPatternMatcher patterns must be at least two bytes: '" + p + "'");
+        }
+        min_length = std::min(min_length, p.size());
+    }
+    // Shifts are stored in one byte
+    min_length = std::min<size_t>(min_length, 256);
+
+    shift.fill(static_cast<std::uint8_t>(min_length - 1));
+    for (size_t id = 0; id < patterns.size(); ++id)
+    {
+        const std::string& p = patterns[id];
+        for (size_t q = 1; q < min_length; ++q)
+        {
+            std::uint8_t& s = shift[block(p.data() + q - 1)];
+            s               = std::min<std::uint8_t>(s, static_cast<std::uint8_t>(min_length - 1 - q));
+        }
+        candidates[static_cast<unsigned char>(p[min_length - 1])].push_back(static_cast<std::uint16_t>(id));
+    }
+}
+
+GaussianScanner::GaussianScanner()
+    : matcher(std::vector<std::string>(std::begin(MARKER_PATTERNS), std::end(MARKER_PATTERNS)))
+{
+    static_assert(std::size(MARKER_PATTERNS) == MARKER_COUNT, "one pattern per marker");
+}
+
+const GaussianScanner& GaussianScanner::instance()
+{
+    static const GaussianScanner scanner;
+    return scanner;
+}
+
+template <typename LineCallback>
+void GaussianScanner::for_each_marker_line(const char* begin, const char* end, LineCallback&& on_line) const
+{
+    // Current line holding at least one hit; line_end points at its '\n' (or at end)
+    const char*   line_begin = nullptr;
+    const char*   line_end   = nullptr;
+    std::uint32_t hit_mask   = 0;
+
+    auto flush = [&]() {
+        if (hit_mask != 0)
+        {
+            on_line(std::string_view(line_begin, static_cast<size_t>(line_end - line_begin)), hit_mask);
+            hit_mask = 0;
+        }
+    };
+
+    matcher.scan(begin, end, [&](size_t id, const char* pos) {
+        if (line_begin == nullptr || pos >= line_end)
+        {
+            flush();
+            const char* floor = line_end ? line_end : begin;
+            const char* lb    = pos;
+            while (lb > floor && lb[-1] != '\n')
+                --lb;
+            const void* nl = std::memchr(pos, '\n', static_cast<size_t>(end - pos));
+            line_begin     = lb;
+            line_end       = nl ? static_cast<const char*>(nl) : end;
+        }
+        hit_mask |= (1u << id);
+    });
+    flush();
+}
+
+void GaussianScanner::scan_range(const char*              begin,
+                                 const char*              end,
+                                 const std::string&       file_name,
+                                 GaussianScanData&        data,
+                                 const std::atomic<bool>* cancel) const
+{
+    CCK_STAT_BYTES(static_cast<std::uint64_t>(end - begin));
+    auto on_line = [&](std::string_view line, std::uint32_t hit_mask) {
+        process_line(line, hit_mask, file_name, data);
+    };
+
+    // Chunks end right after a newline; no marker spans a newline, so no hit is lost at a boundary
+    const char* chunk = begin;
+    while (chunk < end)
+    {
+        if (cancel && cancel->load())
+        {
+            throw std::runtime_error("Processing interrupted by shutdown signal");
+        }
+
+        const char* chunk_end = end;
+        if (static_cast<size_t>(end - chunk) > SCAN_CHUNK_BYTES)
+        {
+            const void* nl = std::memchr(chunk + SCAN_CHUNK_BYTES, '\n', static_cast<size_t>(end - chunk) - SCAN_CHUNK_BYTES);
+            chunk_end      = nl ? static_cast<const char*>(nl) + 1 : end;
+        }
+        for_each_marker_line(chunk, chunk_end, on_line);
+        chunk = chunk_end;
+    }
+}
+
+void GaussianScanner::scan(std::string_view         text,
+                           const std::string&       file_name,
+                           GaussianScanData&        data,
+                           const std::atomic<bool>* cancel) const
+{
+    scan_range(text.data(), text.data() + text.size(), file_name, data, cancel);
+
+    data.tail_normal_termination = text.substr(text.size() - std::min(text.size(), TAIL_CHECK_BYTES))
+                                       .find("Normal termination") != std::string_view::npos;
+}
+
+std::uint64_t GaussianScanner::checkpoint_fingerprint(std::string_view text, size_t offset)
+{
+    // FNV-1a; only has to notice that the start of the file was rewritten
+    std::uint64_t hash  = 14695981039346656037ULL;
+    size_t        start = offset - std::min(offset, CHECKPOINT_FINGERPRINT_BYTES);
+    for (size_t i = start; i < offset && i < text.size(); ++i)
+    {
+        hash ^= static_cast<unsigned char>(text[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool GaussianScanner::scan_resume(std::string_view         text,
+                                  const std::string&       file_name,
+                                  GaussianScanData&        data,
+                                  GaussianScanCheckpoint&  checkpoint,
+                                  const std::atomic<bool>* cancel) const
+{
+    size_t offset  = 0;
+    bool   resumed = checkpoint.offset > 0 && checkpoint.offset <= text.size() &&
+                   text[checkpoint.offset - 1] == '\n' &&
+                   checkpoint_fingerprint(text, checkpoint.offset) == checkpoint.fingerprint;
+    if (resumed)
+    {
+        offset = checkpoint.offset;
+        data   = checkpoint.data;
+    }
+
+    // A line still being written must not be part of the checkpoint, or it
+    // would be counted again once it is complete
+    size_t complete = text.rfind('\n');
+    complete        = (complete == std::string_view::npos || complete < offset) ? offset : complete + 1;
+
+    const char* const begin = text.data();
+    scan_range(begin + offset, begin + complete, file_name, data, cancel);
+
+    checkpoint.offset      = complete;
+    checkpoint.fingerprint = checkpoint_fingerprint(text, complete);
+    checkpoint.data        = data;
+    checkpoint.data.warnings.clear();
+
+    scan_range(begin + complete, begin + text.size(), file_name, data, cancel);
+    data.tail_normal_termination = text.substr(text.size() - std::min(text.size(), TAIL_CHECK_BYTES))
+                                       .find("Normal termination") != std::string_view::npos;
+    return resumed;
+}
+
+void GaussianScanner::scan_reverse(const std::string&       path,
+                                   const std::string&       file_name,
+                                   GaussianScanData&        data,
+                                   const std::atomic<bool>* cancel) const
+{
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    struct FdCloser
+    {
+        int fd;
+        ~FdCloser() { ::close(fd); }
+    } closer{fd};
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        throw std::runtime_error("Could not stat file: " + path);
+    }
+    const std::uint64_t file_size = static_cast<std::uint64_t>(st.st_size);
+
+    auto read_at = [&](std::uint64_t offset, char* dst, size_t len) {
+        size_t done = 0;
+        while (done < len)
+        {
+            ssize_t r = ::pread(fd, dst + done, len - done, static_cast<off_t>(offset + done));
+            if (r < 0 && errno == EINTR)
+                continue;
+            if (r <= 0)
+                throw std::runtime_error("I/O error reading file: " + path);
+            done += static_cast<size_t>(r);
+        }
+    };
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in.is_open())
+    {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    const std::uint64_t file_size = static_cast<std::uint64_t>(in.tellg());
+
+    auto read_at = [&](std::uint64_t offset, char* dst, size_t len) {
+        in.seekg(static_cast<std::streamoff>(offset));
+        in.read(dst, static_cast<std::streamsize>(len));
+        if (static_cast<size_t>(in.gcount()) != len)
+            throw std::runtime_error("I/O error reading file: " + path);
+    };
+#endif
+
+    // Values that make up a Result; once all are known, reading stops at the next job-step header
+    std::uint32_t required = (1u << SCF_DONE) | (1u << NUCLEAR_REPULSION) | (1u << ZERO_POINT_CORRECTION) |
+                             (1u << SUM_THERMAL_FREE) | (1u << FREQUENCIES);
+    if (data.read_temp || data.read_pressure)
+    {
+        required |= (1u << KELVIN_PRESSURE);
+    }
+    const std::uint32_t step_header = (1u << COPYRIGHT) | (1u << INTERNAL_STEP);
+
+    const double default_temp     = data.temp;
+    const double default_pressure = data.pressure;
+    auto         fresh_data       = [&]() {
+        GaussianScanData fresh;
+        fresh.temp          = default_temp;
+        fresh.pressure      = default_pressure;
+        fresh.read_temp     = data.read_temp;
+        fresh.read_pressure = data.read_pressure;
+        return fresh;
+    };
+
+    std::vector<char>                                        buffer;
+    std::vector<char>                                        carry;  // Leading partial line of the previous block
+    std::vector<std::pair<std::string_view, std::uint32_t>> lines;
+    std::uint64_t                                            offset = file_size;
+    std::uint64_t                                            prefix = 0;  // Bytes before the step header reading stopped at
+    bool                                                     done   = false;
+
+    while (offset > 0 && !done)
+    {
+        if (cancel && cancel->load())
+        {
+            throw std::runtime_error("Processing interrupted by shutdown signal");
+        }
+
+        const size_t len = static_cast<size_t>(std::min<std::uint64_t>(REVERSE_BLOCK_BYTES, offset));
+        offset -= len;
+        buffer.resize(len + carry.size());
+        read_at(offset, buffer.data(), len);
+        CCK_STAT_BYTES(len);
+        std::copy(carry.begin(), carry.end(), buffer.begin() + static_cast<std::ptrdiff_t>(len));
+
+        const char* begin = buffer.data();
+        const char* end   = begin + buffer.size();
+        if (offset + len == file_size)
+        {
+            std::string_view tail(begin + buffer.size() - std::min(buffer.size(), TAIL_CHECK_BYTES),
+                                  std::min(buffer.size(), TAIL_CHECK_BYTES));
+            data.tail_normal_termination = tail.find("Normal termination") != std::string_view::npos;
+        }
+
+        // Only complete lines are parsed; the partial first line is completed by the next (earlier) block
+        const char* start = begin;
+        if (offset > 0)
+        {
+            const void* nl = std::memchr(begin, '\n', buffer.size());
+            if (nl == nullptr)
+            {
+                carry.assign(begin, end);
+                continue;
+            }
+            start = static_cast<const char*>(nl) + 1;
+        }
+
+        lines.clear();
+        for_each_marker_line(start, end, [&](std::string_view line, std::uint32_t hit_mask) {
+            lines.emplace_back(line, hit_mask);
+        });
+
+        for (auto it = lines.rbegin(); it != lines.rend(); ++it)
+        {
+            GaussianScanData line_data = fresh_data();
+            process_line(it->first, it->second, file_name, line_data);
+            merge_earlier_line(data, line_data);
+
+            const bool complete = (data.seen & required) == required && (data.normal_count + data.error_count) > 0;
+            if (complete && (it->second & step_header))
+            {
+                const char* line_start = it->first.data();
+                while (line_start > begin && line_start[-1] != '\n')
+                    --line_start;
+                prefix = offset + static_cast<std::uint64_t>(line_start - begin);
+                done   = true;
+                break;
+            }
+        }
+
+        carry.assign(begin, start);
+        if (!carry.empty() && carry.back() == '\n')
+        {
+            carry.pop_back();
+        }
+    }
+
+    // The earlier job steps still add their terminations and banners, the lowest
+    // frequency and any value the last step lacks, so they are scanned forwards
+    GaussianScanData earlier = fresh_data();
+    for (std::uint64_t pos = 0; pos < prefix;)
+    {
+        const size_t len = static_cast<size_t>(std::min<std::uint64_t>(SCAN_CHUNK_BYTES, prefix - pos));
+        buffer.resize(len);
+        read_at(pos, buffer.data(), len);
+
+        // Chunks end after a newline so no line is split; the prefix itself ends at one
+        size_t used = len;
+        if (pos + len < prefix)
+        {
+            size_t nl = std::string_view(buffer.data(), len).rfind('\n');
+            used      = nl == std::string_view::npos ? len : nl + 1;
+        }
+        scan_range(buffer.data(), buffer.data() + used, file_name, earlier, cancel);
+        pos += used;
+    }
+    if (prefix > 0)
+    {
+        merge_earlier_line(data, earlier);
+    }
+}
+
+bool GaussianScanner::scan_archive_tail(std::string_view         text,
+                                        const std::string&       file_name,
+                                        GaussianScanData&        data,
+                                        const std::atomic<bool>* cancel) const
+{
+    GaussianArchive archive;
+    double          hf = 0.0;
+    if (!find_gaussian_archive(text, archive) || archive.needs_full_parse() || !archive.get("HF", hf))
+    {
+        return false;
+    }
+
+    std::string route, title;
+    size_t      head_end = 0;
+    if (!read_first_route(text.substr(0, std::min({text.size(), ARCHIVE_HEAD_BYTES, archive.offset})), route, title,
+                          head_end) ||
+        compact(route) != compact(archive.route) || compact(title) != compact(archive.title))
+    {
+        return false;  // the last step differs from the first one: the log holds several steps
+    }
+
+    GaussianScanData result = data;
+    scan_range(text.data(), text.data() + head_end, file_name, result, cancel);
+    scan_range(text.data() + archive.offset, text.data() + text.size(), file_name, result, cancel);
+    if (result.copyright_count != 1 || (result.seen & (1u << INTERNAL_STEP)))
+    {
+        return false;
+    }
+    result.tail_normal_termination = text.substr(text.size() - std::min(text.size(), TAIL_CHECK_BYTES))
+                                         .find("Normal termination") != std::string_view::npos;
+
+    if (!archive.nuclear_repulsion(result.nucleare))
+    {
+        return false;
+    }
+    result.scf     = hf;
+    result.has_scf = true;
+    result.seen |= (1u << SCF_DONE) | (1u << NUCLEAR_REPULSION);
+
+    double zpe = 0.0, gtot = 0.0;
+    if (archive.get("ZeroPoint", zpe))
+    {
+        std::vector<double> frequencies;
+        if (!archive.get("GTot", gtot) || !archive.frequencies(frequencies))
+        {
+            return false;
+        }
+        // Rounded like the 6-decimal lines of the thermochemistry block
+        auto printed = [](double value) {
+            return std::round(value * 1e6) / 1e6;
+        };
+        result.zpe  = printed(zpe);
+        result.etg  = printed(gtot);
+        result.tcg  = printed(gtot - hf);
+        result.ezpe = printed(hf + zpe);
+        for (double frequency : frequencies)
+        {
+            if (frequency < 0)
+            {
+                result.has_negative_freq  = true;
+                result.last_negative_freq = frequency;
+            }
+            else if (!result.has_positive_freq || frequency < result.min_positive_freq)
+            {
+                result.has_positive_freq = true;
+                result.min_positive_freq = frequency;
+            }
+        }
+        // Gaussian prints the thermochemistry at 298.15 K and 1 atm unless the route says otherwise
+        if (result.read_temp && !archive.route_value("Temperature", result.temp))
+        {
+            result.temp = 298.15;
+        }
+        if (result.read_pressure && !archive.route_value("Pressure", result.pressure))
+        {
+            result.pressure = 1.0;
+        }
+        result.seen |= (1u << ZERO_POINT_CORRECTION) | (1u << THERMAL_CORRECTION_G) | (1u << SUM_THERMAL_FREE) |
+                       (1u << SUM_ZERO_POINT) | (1u << FREQUENCIES);
+        if (result.read_temp || result.read_pressure)
+        {
+            result.seen |= 1u << KELVIN_PRESSURE;
+        }
+    }
+
+    data = std::move(result);
+    return true;
+}
+
+void GaussianScanner::process_line(std::string_view   line,
+                                   std::uint32_t      hit_mask,
+                                   const std::string& file_name,
+                                   GaussianScanData&  data) const
+{
+    auto has = [hit_mask](Marker m) {
+        return (hit_mask & (1u << m)) != 0;
+    };
+
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+
+    // Only lines with a marker reach here, so "lines" of the scanner are marker lines
+    CCK_STAT_LINES(1);
+    if (CCK_STATS_ON())
+    {
+        for (std::uint32_t bits = hit_mask; bits != 0; bits &= bits - 1)
+        {
+            int id = 0;
+            while (((bits >> id) & 1u) == 0)
+                ++id;
+            CCK_STAT_HIT(MARKER_PATTERNS[id], 1);
+        }
+    }
+
+    if (has(NORMAL_TERMINATION))
+    {
+        data.normal_count++;
+    }
+    else if (has(ERROR_TERMINATION))
+    {
+        data.error_count++;
+    }
+    if (has(COPYRIGHT))
+    {
+        ++data.copyright_count;
+    }
+
+    // Value markers: the first one (in precedence order) whose full condition holds wins the line
+    for (std::uint16_t id = SCF_DONE; id < MARKER_COUNT; ++id)
+    {
+        if (!has(static_cast<Marker>(id)))
+        {
+            continue;
+        }
+
+        const std::uint32_t bit = 1u << id;
+        switch (id)
+        {
+            case SCF_DONE:
+            {
+                // SCF Done.*?=\s+(-?\d+\.\d+)
+                std::string_view rest = after_first(line, "SCF Done");
+                for (size_t eq = rest.find('='); eq != std::string_view::npos; eq = rest.find('=', eq + 1))
+                {
+                    std::string_view after = rest.substr(eq + 1);
+                    size_t           ws    = 0;
+                    while (ws < after.size() && is_space(after[ws]))
+                        ++ws;
+                    double value;
+                    if (ws > 0 && parse_fixed_decimal(after.substr(ws), value))
+                    {
+                        data.scf     = value;
+                        data.has_scf = true;
+                        data.seen |= bit;
+                        return;
+                    }
+                }
+                break;  // no energy on this line: fall through to the next marker
+            }
+            case CIS_TOTAL_ENERGY:
+            {
+                size_t eq = line.find('=');
+                if (eq != std::string_view::npos)
+                {
+                    parse_prefix(line.substr(eq + 1), data.scftd);
+                }
+                data.seen |= bit;
+                return;
+            }
+            case PCM_CORRECTED_ENERGY:
+            {
+                size_t is_pos = line.find("is");
+                if (is_pos != std::string_view::npos)
+                {
+                    parse_prefix(line.substr(is_pos + 2), data.scfEqui);
+                }
+                data.seen |= bit;
+                return;
+            }
+            case ZERO_POINT_CORRECTION:
+            case THERMAL_CORRECTION_G:
+            case SUM_THERMAL_FREE:
+            case SUM_ZERO_POINT:
+            {
+                double& target = (id == ZERO_POINT_CORRECTION) ? data.zpe
+                                 : (id == THERMAL_CORRECTION_G) ? data.tcg
+                                 : (id == SUM_THERMAL_FREE)     ? data.etg
+                                                                : data.ezpe;
+                size_t  eq     = line.find('=');
+                if (eq != std::string_view::npos)
+                {
+                    parse_prefix(line.substr(eq + 1), target);
+                }
+                data.seen |= bit;
+                return;
+            }
+            case NUCLEAR_REPULSION:
+            {
+                size_t pos = line.find("nuclear repulsion energy") + 25;
+                if (pos < line.size())
+                {
+                    std::string_view num = line.substr(pos);
+                    num                  = num.substr(std::min(num.size(), num.find_first_not_of(" \t")));
+                    size_t hartrees      = num.find("Hartrees");
+                    if (hartrees != std::string_view::npos)
+                    {
+                        num = num.substr(0, hartrees);
+                    }
+                    num = trim(num);
+                    if (!num.empty() && !parse_strict(num, data.nucleare))
+                    {
+                        data.warnings.push_back("Could not parse nuclear repulsion energy from '" + std::string(line) +
+                                                "' in file '" + file_name + "'");
+                    }
+                }
+                data.seen |= bit;
+                return;
+            }
+            case FREQUENCIES:
+            {
+                // Frequencies\s+--\s+(.*)
+                for (size_t f = line.find("Frequencies"); f != std::string_view::npos;
+                     f        = line.find("Frequencies", f + 1))
+                {
+                    std::string_view rest = line.substr(f + 11);
+                    size_t           i    = 0;
+                    while (i < rest.size() && is_space(rest[i]))
+                        ++i;
+                    if (i == 0 || rest.substr(i, 2) != "--")
+                        continue;
+                    size_t j = i + 2;
+                    while (j < rest.size() && is_space(rest[j]))
+                        ++j;
+                    if (j == i + 2)
+                        continue;
+
+                    std::string_view values = rest.substr(j);
+                    double           freq;
+                    while (NumParse::parse_double(values, freq))
+                    {
+                        if (freq < 0)
+                        {
+                            data.has_negative_freq  = true;
+                            data.last_negative_freq = freq;
+                        }
+                        else if (!data.has_positive_freq || freq < data.min_positive_freq)
+                        {
+                            data.has_positive_freq = true;
+                            data.min_positive_freq = freq;
+                        }
+                    }
+                    data.seen |= bit;
+                    return;
+                }
+                break;
+            }
+            case KELVIN_PRESSURE:
+            {
+                if (!data.read_temp && !data.read_pressure)
+                {
+                    break;
+                }
+                if (data.read_temp)
+                {
+                    size_t start_pos = line.find("Temperature");
+                    size_t end_pos   = line.find("Kelvin");
+                    if (start_pos != std::string_view::npos && end_pos != std::string_view::npos &&
+                        start_pos < end_pos)
+                    {
+                        std::string_view temp_str = trim(line.substr(start_pos + 11, end_pos - start_pos - 11));
+                        if (!temp_str.empty() && !parse_strict(temp_str, data.temp))
+                        {
+                            data.warnings.push_back("Could not parse temperature from '" + std::string(line) +
+                                                    "' in file '" + file_name + "'. Using default 298.15 K");
+                            data.temp = 298.15;
+                        }
+                    }
+                }
+                if (data.read_pressure)
+                {
+                    size_t start_pos = line.find("Pressure");
+                    size_t end_pos   = line.find("Atm.");
+                    if (start_pos != std::string_view::npos && end_pos != std::string_view::npos &&
+                        start_pos < end_pos)
+                    {
+                        std::string_view press_str = trim(line.substr(start_pos + 8, end_pos - start_pos - 8));
+                        if (!press_str.empty() && !parse_strict(press_str, data.pressure))
+                        {
+                            data.warnings.push_back("Could not parse pressure from '" + std::string(line) +
+                                                    "' in file '" + file_name + "'. Using default 1.0 atm");
+                            data.pressure = 1.0;
+                        }
+                    }
+                }
+                data.seen |= bit;
+                return;
+            }
+            case SCRF:
+                data.scrf_seen = true;
+                data.seen |= bit;
+                return;
+            default:
+                break;
+        }
+    }
+}
@@ -0,0 +1,335 @@
+/**
+ * @file gaussian_scanner.h
+ * @brief Single-pass, allocation-free scanner for Gaussian log files
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * This header declares the scanning engine used by extract() for native
+ * Gaussian outputs. Instead of reading the log line by line and running one
+ * substring search per marker, the scanner walks the raw (memory-mapped)
+ * bytes once with a Wu-Manber multi-pattern matcher and only inspects the
+ * lines that contain a marker.
+ *
+ * @section Scanned Markers
+ * - "SCF Done", "Total Energy, E(CIS", "After PCM corrections"
+ * - "Zero-point correction", "Thermal correction to Gibbs Free Energy"
+ * - "Sum of electronic and thermal Free Energies", "Sum of electronic and zero-point Energies"
+ * - "nuclear repulsion energy", "Frequencies --", "Kelvin.  Pressure", "scrf"
+ * - "Normal termination", "Error termination", "Copyright"
+ * - "Proceeding to internal job step number" (job-step boundary, used by scan_reverse())
+ */
+
+#ifndef GAUSSIAN_SCANNER_H
+#define GAUSSIAN_SCANNER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class MultiPatternMatcher
+ * @brief Wu-Manber matcher that finds several literal patterns in one pass
+ *
+ * The matcher hashes two-byte blocks of the text into a shift table built
+ * from all patterns, so most text positions are skipped without any
+ * comparison. Candidate windows are verified against the patterns that end
+ * with the same block.
+ *
+ * @note Patterns must be at least two bytes long. Matching is case-sensitive.
+ */
+class MultiPatternMatcher
+{
+private:
+    std::vector<std::string>                    patterns;    ///< Literal patterns, indexed by id
+    size_t                                      min_length;  ///< Shortest pattern length (window size)
+    std::array<std::uint8_t, 65536>             shift;       ///< Shift table indexed by two-byte block
+    std::array<std::vector<std::uint16_t>, 256> candidates;  ///< Pattern ids keyed by the last byte of their prefix
+
+    static std::uint16_t block(const char* p)
+    {
+        return static_cast<std::uint16_t>((static_cast<unsigned char>(p[0]) << 8) | static_cast<unsigned char>(p[1]));
+    }
+
+public:
+    /**
+     * @brief Build the shift and candidate tables
+     * @param pats Patterns to search for; the position in the vector is the pattern id
+     * @throws std::invalid_argument if a pattern is shorter than two bytes
+     */
+    explicit MultiPatternMatcher(std::vector<std::string> pats);
+
+    /**
+     * @brief Number of registered patterns
+     */
+    size_t size() const
+    {
+        return patterns.size();
+    }
+
+    /**
+     * @brief Length of a registered pattern
+     */
+    size_t length(size_t id) const
+    {
+        return patterns[id].size();
+    }
+
+    /**
+     * @brief Report every occurrence of every pattern in [begin, end)
+     * @param begin First byte of the text
+     * @param end One past the last byte of the text
+     * @param on_hit Callable invoked as on_hit(pattern_id, position) in increasing position order
+     */
+    template <typename Callback>
+    void scan(const char* begin, const char* end, Callback&& on_hit) const
+    {
+        const size_t n = static_cast<size_t>(end - begin);
+        if (n < min_length)
+        {
+            return;
+        }
+
+        size_t pos = min_length - 1;  // index of the last byte of the current window
+        while (pos < n)
+        {
+            std::uint8_t s = shift[block(begin + pos - 1)];
+            if (s != 0)
+            {
+                pos += s;
+                continue;
+            }
+
+            const size_t start = pos + 1 - min_length;
+            for (std::uint16_t id : candidates[static_cast<unsigned char>(begin[pos])])
+            {
+                const std::string& pat = patterns[id];
+                if (start + pat.size() <= n && std::string_view(begin + start, pat.size()) == pat)
+                {
+                    on_hit(static_cast<size_t>(id), begin + start);
+                }
+            }
+            ++pos;
+        }
+    }
+};
+
+/**
+ * @struct GaussianScanData
+ * @brief Raw values collected from one Gaussian log before they are turned into a Result
+ *
+ * Every value follows the "last occurrence wins" rule of the original line
+ * parser, except the counters and the frequency summary which accumulate over
+ * the whole file. All extraction engines fill this structure so that the
+ * post-processing in extract() is shared.
+ */
+struct GaussianScanData
+{
+    int    copyright_count = 0;  ///< Lines containing "Copyright" (one per job step)
+    int    normal_count    = 0;  ///< Lines containing "Normal termination"
+    int    error_count     = 0;  ///< Lines containing "Error termination"
+    bool   has_scf         = false;
+    double scf             = 0.0;  ///< Last "SCF Done" energy (Hartree)
+    double scftd           = 0.0;  ///< Last CIS/TD total energy (Hartree)
+    double scfEqui         = 0.0;  ///< Last PCM-corrected (equilibrium solvation) energy (Hartree)
+    double zpe             = 0.0;  ///< Zero-point correction (Hartree)
+    double tcg             = 0.0;  ///< Thermal correction to Gibbs free energy (Hartree)
+    double etg             = 0.0;  ///< Sum of electronic and thermal free energies (Hartree)
+    double ezpe            = 0.0;  ///< Sum of electronic and zero-point energies (Hartree)
+    double nucleare        = 0.0;  ///< Nuclear repulsion energy (Hartree)
+    double temp            = 298.15;  ///< Temperature from the thermochemistry block (K), caller sets default
+    double pressure        = 1.0;     ///< Pressure from the thermochemistry block (atm), caller sets default
+    bool   read_temp       = true;    ///< Whether the temperature should be read from the file
+    bool   read_pressure   = true;    ///< Whether the pressure should be read from the file
+    bool   scrf_seen       = false;   ///< true if "scrf" appears anywhere (implicit solvation)
+
+    bool   has_negative_freq  = false;
+    double last_negative_freq = 0.0;  ///< Last imaginary frequency printed (cm^-1)
+    bool   has_positive_freq  = false;
+    double min_positive_freq  = 0.0;  ///< Smallest real frequency printed (cm^-1)
+
+    bool          tail_normal_termination = false;  ///< "Normal termination" found in the last 2 KB
+    std::uint32_t seen                    = 0;      ///< Bit per GaussianScanner::Marker whose value was read
+
+    std::vector<std::string> warnings;  ///< Non-fatal parse problems, forwarded to the error collector
+};
+
+/**
+ * @struct GaussianScanCheckpoint
+ * @brief Scanner state of a log that may still grow, to continue parsing later
+ *
+ * scan() folds each line into GaussianScanData independently of the lines
+ * around it, so the data after the last complete line is the whole parser
+ * state (counters, last energies, the frequency summary so far). A later scan
+ * of the same log can start from it and read only the appended bytes.
+ */
+struct GaussianScanCheckpoint
+{
+    std::uint64_t    offset      = 0;  ///< Bytes folded into data; always just after a '\n' (0 = no checkpoint)
+    std::uint64_t    fingerprint = 0;  ///< Hash of the bytes before offset, to detect rewritten files
+    GaussianScanData data;             ///< State after the first offset bytes (warnings are not kept)
+};
+
+/**
+ * @class GaussianScanner
+ * @brief Multi-pattern scanner producing GaussianScanData from raw bytes
+ *
+ * The scanner is stateless apart from the shared, immutable matcher tables,
+ * so one instance can be used concurrently from every worker thread.
+ */
+class GaussianScanner
+{
+public:
+    /// Pattern ids, in the precedence order of the original if/else-if parser
+    enum Marker : std::uint16_t
+    {
+        NORMAL_TERMINATION = 0,
+        ERROR_TERMINATION,
+        COPYRIGHT,
+        SCF_DONE,
+        CIS_TOTAL_ENERGY,
+        PCM_CORRECTED_ENERGY,
+        ZERO_POINT_CORRECTION,
+        THERMAL_CORRECTION_G,
+        SUM_THERMAL_FREE,
+        SUM_ZERO_POINT,
+        NUCLEAR_REPULSION,
+        FREQUENCIES,
+        KELVIN_PRESSURE,
+        SCRF,
+        INTERNAL_STEP,
+        MARKER_COUNT
+    };
+
+    /// Number of trailing bytes inspected for the final "Normal termination"
+    static constexpr size_t TAIL_CHECK_BYTES = 2048;
+
+    /// Bytes before the checkpoint offset that GaussianScanCheckpoint::fingerprint covers
+    static constexpr size_t CHECKPOINT_FINGERPRINT_BYTES = 4096;
+
+    /// Block size used by scan_reverse() when reading towards the start of the file
+    static constexpr size_t REVERSE_BLOCK_BYTES = 256 * 1024;
+
+    /// Bytes at the start of the file searched by scan_archive_tail() for the first route and title
+    static constexpr size_t ARCHIVE_HEAD_BYTES = 64 * 1024;
+
+    /**
+     * @brief Access the process-wide scanner instance
+     */
+    static const GaussianScanner& instance();
+
+    /**
+     * @brief Scan a complete Gaussian log held in memory
+     * @param text Raw file content
+     * @param file_name File name used in warning messages
+     * @param data [in,out] Receives the scanned values; temp/pressure/read_* must be preset by the caller
+     * @param cancel Optional flag polled periodically; scanning throws when it becomes true
+     * @throws std::runtime_error if @p cancel is raised during the scan
+     */
+    void scan(std::string_view         text,
+              const std::string&       file_name,
+              GaussianScanData&        data,
+              const std::atomic<bool>* cancel = nullptr) const;
+
+    /**
+     * @brief Scan a Gaussian log, continuing from a checkpoint when it still matches
+     * @param text Raw file content
+     * @param file_name File name used in warning messages
+     * @param data [in,out] Receives the scanned values; temp/pressure/read_* must be preset by the caller
+     * @param checkpoint [in,out] State of an earlier scan of this file; replaced by the state at the
+     *                   end of the last complete line of @p text
+     * @param cancel Optional flag polled periodically; scanning throws when it becomes true
+     * @return true if the earlier state was reused and only the bytes after it were scanned
+     * @throws std::runtime_error if @p cancel is raised during the scan
+     *
+     * The checkpoint is ignored (and @p text scanned from the start) when the
+     * file is shorter than its offset or the bytes before the offset changed.
+     * The result is identical to scan(), apart from warnings of lines that were
+     * read by the earlier scan.
+     */
+    bool scan_resume(std::string_view         text,
+                     const std::string&       file_name,
+                     GaussianScanData&        data,
+                     GaussianScanCheckpoint&  checkpoint,
+                     const std::atomic<bool>* cancel = nullptr) const;
+
+    /**
+     * @brief Hash of the CHECKPOINT_FINGERPRINT_BYTES before @p offset in @p text
+     */
+    static std::uint64_t checkpoint_fingerprint(std::string_view text, size_t offset);
+
+    /**
+     * @brief Scan a Gaussian log backwards from the end of the file
+     * @param path Path to the log file
+     * @param file_name File name used in warning messages
+     * @param data [in,out] Receives the scanned values; temp/pressure/read_* must be preset by the caller
+     * @param cancel Optional flag polled between blocks; scanning throws when it becomes true
+     * @throws std::runtime_error if the file cannot be read or @p cancel is raised
+     *
+     * The file is read with pread() in REVERSE_BLOCK_BYTES blocks starting at
+     * EOF, and the first value met for each marker is kept, which is the last
+     * occurrence in the file. Backward reading stops at the first job-step
+     * header ("Copyright" banner or "Proceeding to internal job step number N")
+     * met once the SCF and nuclear repulsion energies, the thermochemistry
+     * block, the frequencies and a termination line are known. The bytes before
+     * that header are then scanned forwards like scan(), since earlier steps
+     * still add terminations, banners, frequencies and values the last step
+     * lacks. The result equals scan() on the same file.
+     */
+    void scan_reverse(const std::string&       path,
+                      const std::string&       file_name,
+                      GaussianScanData&        data,
+                      const std::atomic<bool>* cancel = nullptr) const;
+
+    /**
+     * @brief Fill @p data from the archive entry of a completed single-step log
+     * @param text Complete log content (a MappedFile view; only the head and the tail are touched)
+     * @param file_name File name used in warning messages
+     * @param data [in,out] Receives the values on success; left untouched otherwise
+     * @param cancel Optional flag polled while the head and the tail are scanned
+     * @return false if the log needs a full parse, in which case the caller runs scan()
+     *
+     * Only the smallest tail window holding the archive entry (see
+     * find_gaussian_archive()) and the banner, route and title at the start of
+     * the file are read. The route and title of the entry must equal the first
+     * ones in the file, and neither part may hold a second banner or an
+     * internal job step header; any other outcome means the unread middle
+     * holds more job steps, and the function returns false. The SCF energy
+     * (HF=, 7 decimals), the thermochemistry (ZeroPoint=, GTot=, rounded to
+     * the 6 decimals of the log) and the Temperature=/Pressure= route options
+     * come from the entry, the nuclear repulsion energy from its geometry and
+     * the lowest frequency from its force constants; the terminations are
+     * counted in the tail. Entries
+     * needs_full_parse() rejects, geometries with ECP atoms and frequency
+     * jobs without a usable force-constant section return false. A log made
+     * of --link1-- jobs with identical routes and titles cannot be told from
+     * its last job without reading the middle, and is reported as that job.
+     */
+    bool scan_archive_tail(std::string_view         text,
+                           const std::string&       file_name,
+                           GaussianScanData&        data,
+                           const std::atomic<bool>* cancel = nullptr) const;
+
+private:
+    GaussianScanner();
+
+    MultiPatternMatcher matcher;
+
+    void process_line(std::string_view line, std::uint32_t hit_mask, const std::string& file_name,
+                      GaussianScanData& data) const;
+
+    /// Fold every marker line of [begin, end) into @p data, in cancellable chunks
+    void scan_range(const char* begin, const char* end, const std::string& file_name, GaussianScanData& data,
+                    const std::atomic<bool>* cancel) const;
+
+    /// Call on_line(line, hit_mask) for every line of [begin, end) that contains a marker
+    template <typename LineCallback>
+    void for_each_marker_line(const char* begin, const char* end, LineCallback&& on_line) const;
+
+    /// Fold the values of an earlier line (or range) into @p data, keeping values already seen (backward scanning)
+    static void merge_earlier_line(GaussianScanData& data, const GaussianScanData& line);
+};
+
+#endif  // GAUSSIAN_SCANNER_H
@@ -37,8 +37,23 @@
  */
 
 #include "extraction/qc_extractor.h"
+#include "extraction/binary_results.h"
+#include "extraction/gaussian_scanner.h"
+#include "extraction/result_cache.h"
+#include "extraction/result_spill.h"
+#include "extraction/result_table.h"
+#include "job_management/bounded_queue.h"
 #include "job_management/job_scheduler.h"
+#include "job_management/work_queue.h"
+#include "job_management/worker_buffers.h"
+#include "utilities/file_discovery.h"
+#include "utilities/file_view.h"
 #include "utilities/metadata.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/numeric_parse.h"
+#include "utilities/parse_stats.h"
+#include "utilities/profiler.h"
+#include "utilities/trace_recorder.h"
 #include "thermo/thermo.h"
 #include <algorithm>
 #include <atomic>
@@ -49,10 +64,13 @@
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <future>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <mutex>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <thread>
@@ -105,7 +123,9 @@ extern std::atomic<bool> g_shutdown_requested;
  * Converts megabyte limit to internal byte representation for efficient
  * atomic operations. The limit should account for other system processes.
  */
-MemoryMonitor::MemoryMonitor(size_t max_memory_mb) : max_bytes(max_memory_mb * 1024 * 1024) {}
+MemoryMonitor::MemoryMonitor(size_t max_memory_mb)
+    : max_bytes(max_memory_mb * 1024 * 1024), baseline_rss_bytes(get_process_rss_bytes())
+{}
 
 /**
  * @brief Check if allocation would exceed memory limit
@@ -129,11 +149,15 @@ bool MemoryMonitor::can_allocate(size_t bytes)
  */
 void MemoryMonitor::add_usage(size_t bytes)
 {
-    size_t new_usage    = current_usage_bytes.fetch_add(bytes) + bytes;
+    update_peak(current_usage_bytes.fetch_add(bytes) + bytes);
+}
+
+void MemoryMonitor::update_peak(size_t usage)
+{
     size_t current_peak = peak_usage_bytes.load();
-    while (new_usage > current_peak)
+    while (usage > current_peak)
     {
-        if (peak_usage_bytes.compare_exchange_weak(current_peak, new_usage))
+        if (peak_usage_bytes.compare_exchange_weak(current_peak, usage))
         {
             break;
         }
@@ -150,6 +174,109 @@ void MemoryMonitor::add_usage(size_t bytes)
 void MemoryMonitor::remove_usage(size_t bytes)
 {
     current_usage_bytes.fetch_sub(bytes);
+    released.notify_all();
+}
+
+/**
+ * @brief Refresh the sampled MemAvailable and fold the RSS growth into the peak
+ *
+ * Reading /proc costs a few microseconds, so only one caller per
+ * RSS_SAMPLE_INTERVAL_MS refreshes the sample; everyone else uses the last one.
+ */
+void MemoryMonitor::sample_system_usage()
+{
+    long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count();
+    long long last = last_sample_ms.load(std::memory_order_relaxed);
+    if (last >= 0 && now - last < RSS_SAMPLE_INTERVAL_MS)
+    {
+        return;
+    }
+    if (!last_sample_ms.compare_exchange_strong(last, now, std::memory_order_relaxed))
+    {
+        return;  // Another thread is sampling
+    }
+
+    size_t rss    = get_process_rss_bytes();
+    size_t growth = rss > baseline_rss_bytes ? rss - baseline_rss_bytes : 0;
+    sampled_available.store(get_available_memory_bytes(), std::memory_order_relaxed);
+    update_peak(growth);
+}
+
+/**
+ * @brief Charge @p bytes if the budget has room for them now
+ * @return true if the bytes were charged
+ *
+ * The check and the charge are one compare-and-swap on current_usage_bytes,
+ * so concurrent callers cannot all pass the check and overshoot the limit
+ * together. Only charged buffers count against the limit; the sampled RSS
+ * growth feeds the peak report, and MemAvailable guards against the rest of
+ * the system.
+ */
+bool MemoryMonitor::try_charge(size_t bytes)
+{
+    sample_system_usage();
+    size_t available = sampled_available.load(std::memory_order_relaxed);
+
+    size_t current = current_usage_bytes.load();
+    while (true)
+    {
+        // Never block the only active request, however large
+        bool fits = current == 0 || (current + bytes < max_bytes && (available == 0 || bytes < available));
+        if (!fits)
+        {
+            return false;
+        }
+        if (current_usage_bytes.compare_exchange_weak(current, current + bytes))
+        {
+            break;
+        }
+    }
+    update_peak(current + bytes);
+
+    if (current == 0 && bytes >= max_bytes)
+    {
+        std::cerr << "Warning: a single " << formatMemorySize(bytes) << " request exceeds the memory limit of "
+                  << formatMemorySize(max_bytes) << "; it is processed alone" << std::endl;
+    }
+    return true;
+}
+
+/**
+ * @brief Charge memory, waiting for other reservations to be released if needed
+ * @param bytes Number of bytes to charge
+ *
+ * The fast path does not lock. Waiters retry under a mutex whenever a
+ * reservation is released, and at least every MEMORY_WAIT_POLL_MS so that
+ * changes in MemAvailable and g_shutdown_requested are noticed. A waiter
+ * released by shutdown still charges its bytes, so the caller's
+ * remove_usage() stays balanced.
+ */
+void MemoryMonitor::acquire(size_t bytes)
+{
+    if (try_charge(bytes))
+    {
+        return;
+    }
+
+    wait_count.fetch_add(1, std::memory_order_relaxed);
+    TraceSpan                    wait("wait", "wait memory");
+    std::unique_lock<std::mutex> lock(wait_mutex);
+    while (!try_charge(bytes))
+    {
+        if (g_shutdown_requested.load())
+        {
+            add_usage(bytes);
+            return;
+        }
+        released.wait_for(lock, std::chrono::milliseconds(MEMORY_WAIT_POLL_MS));
+    }
+}
+
+size_t MemoryMonitor::get_wait_count() const
+{
+    return wait_count.load(std::memory_order_relaxed);
 }
 
 /**
@@ -215,26 +342,133 @@ size_t MemoryMonitor::get_system_memory_mb()
     return DEFAULT_MEMORY_MB;  // Fallback
 #else
     // Try multiple methods for Unix-like systems
+    size_t physical_mb = 0;
 
     // Method 1: sysconf (POSIX)
     long pages     = sysconf(_SC_PHYS_PAGES);
     long page_size = sysconf(_SC_PAGE_SIZE);
     if (pages > 0 && page_size > 0)
     {
-        return static_cast<size_t>((pages * page_size) / (1024 * 1024));
+        physical_mb = static_cast<size_t>((pages * page_size) / (1024 * 1024));
     }
 
     // Method 2: Linux-specific sysinfo (fallback)
     #if defined(__linux__) && defined(__GLIBC__)
     struct sysinfo si;
-    if (sysinfo(&si) == 0)
+    if (physical_mb == 0 && sysinfo(&si) == 0)
     {
-        return static_cast<size_t>((si.totalram * si.mem_unit) / (1024 * 1024));
+        physical_mb = static_cast<size_t>((si.totalram * si.mem_unit) / (1024 * 1024));
     }
     #endif
 
-    return DEFAULT_MEMORY_MB;  // Final fallback
+    if (physical_mb == 0)
+    {
+        physical_mb = DEFAULT_MEMORY_MB;  // Final fallback
+    }
+
+    // A container or batch job slice may be limited well below the machine
+    size_t cgroup_mb = get_cgroup_memory_limit_mb();
+    if (cgroup_mb > 0)
+    {
+        physical_mb = std::min(physical_mb, cgroup_mb);
+    }
+    return physical_mb;
+#endif
+}
+
+namespace
+{
+    /// Read the first whitespace-delimited token of a small /proc or /sys file
+    std::string read_first_token(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string   token;
+        file >> token;
+        return token;
+    }
+
+    /// Interpret a cgroup limit file ("max" or a byte count) as megabytes, 0 if unlimited
+    size_t cgroup_limit_mb(const std::string& path)
+    {
+        std::string   token = read_first_token(path);
+        unsigned long bytes = 0;
+        if (token.empty() || token == "max" || !NumParse::to_ulong(token, bytes))
+        {
+            return 0;
+        }
+        // cgroup v1 reports "unlimited" as a page-rounded LONG_MAX
+        if (bytes >= (1UL << 60))
+        {
+            return 0;
+        }
+        return static_cast<size_t>(bytes / (1024 * 1024));
+    }
+}  // namespace
+
+size_t MemoryMonitor::get_cgroup_memory_limit_mb()
+{
+#ifdef __linux__
+    // cgroup v2: the "0::<path>" line of /proc/self/cgroup names our group
+    std::ifstream cgroup_file("/proc/self/cgroup");
+    std::string   line;
+    while (std::getline(cgroup_file, line))
+    {
+        if (line.rfind("0::", 0) == 0)
+        {
+            std::string group = line.substr(3);
+            if (size_t limit = cgroup_limit_mb("/sys/fs/cgroup" + group + "/memory.max"))
+            {
+                return limit;
+            }
+        }
+    }
+    if (size_t limit = cgroup_limit_mb("/sys/fs/cgroup/memory.max"))
+    {
+        return limit;
+    }
+
+    // cgroup v1 memory controller
+    return cgroup_limit_mb("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+#else
+    return 0;
+#endif
+}
+
+size_t MemoryMonitor::get_available_memory_bytes()
+{
+#ifdef __linux__
+    std::ifstream meminfo("/proc/meminfo");
+    std::string   key;
+    size_t        value = 0;
+    std::string   unit;
+    while (meminfo >> key >> value >> unit)
+    {
+        if (key == "MemAvailable:")
+        {
+            return value * 1024;  // Reported in kB
+        }
+    }
+#endif
+    return 0;
+}
+
+size_t MemoryMonitor::get_process_rss_bytes()
+{
+#ifdef __linux__
+    // Fields: size resident shared text lib data dt (pages). Resident includes
+    // the file-backed pages of mapped log files, which reservations charge too
+    std::ifstream statm("/proc/self/statm");
+    size_t        size = 0, resident = 0;
+    if (statm >> size >> resident)
+    {
+        long page_size = sysconf(_SC_PAGE_SIZE);
+        if (page_size > 0)
+        {
+            return resident * static_cast<size_t>(page_size);
+        }
+    }
 #endif
+    return 0;
 }
 
 size_t MemoryMonitor::calculate_optimal_memory_limit(unsigned int thread_count, size_t system_memory_mb)
@@ -276,6 +510,13 @@ size_t MemoryMonitor::calculate_optimal_memory_limit(unsigned int thread_count,
 
     size_t calculated_memory = static_cast<size_t>(system_memory_mb * memory_percentage);
 
+    // Do not plan on memory that other processes are already using
+    size_t available_mb = get_available_memory_bytes() / (1024 * 1024);
+    if (available_mb > 0)
+    {
+        calculated_memory = std::min(calculated_memory, available_mb * 8 / 10);
+    }
+
     // Apply bounds
     calculated_memory = std::max(calculated_memory, MIN_MEMORY_MB);
     calculated_memory = std::min(calculated_memory, MAX_MEMORY_MB);
@@ -288,6 +529,7 @@ FileHandleManager::FileGuard::FileGuard(FileHandleManager* mgr) : manager(mgr),
 {
     if (manager)
     {
+        TraceSpan wait("wait", "wait file handle");
 #if __cpp_lib_semaphore >= 201907L
         manager->semaphore.acquire();
 #else
@@ -406,44 +648,19 @@ void ThreadSafeErrorCollector::clear()
 // Utility functions implementation
 bool safe_stod(const std::string& str, double& result)
 {
-    try
-    {
-        size_t pos;
-        result = std::stod(str, &pos);
-        return pos == str.length();  // Ensure entire string was consumed
-    }
-    catch (const std::exception&)
-    {
-        return false;
-    }
+    // Like std::stod, a leading number is stored even if trailing text makes the field invalid
+    size_t consumed = 0;
+    return NumParse::parse_leading(str, result, consumed) && consumed == str.length();
 }
 
 bool safe_stoi(const std::string& str, int& result)
 {
-    try
-    {
-        size_t pos;
-        result = std::stoi(str, &pos);
-        return pos == str.length();
-    }
-    catch (const std::exception&)
-    {
-        return false;
-    }
+    return NumParse::to_int(str, result);
 }
 
 bool safe_stoul(const std::string& str, unsigned long& result)
 {
-    try
-    {
-        size_t pos;
-        result = std::stoul(str, &pos);
-        return pos == str.length();
-    }
-    catch (const std::exception&)
-    {
-        return false;
-    }
+    return NumParse::to_ulong(str, result);
 }
 
 std::string formatMemorySize(size_t bytes)
@@ -516,173 +733,37 @@ bool validateFileSize(const std::string& filename, size_t max_size_mb)
 //    return log_files;
 //}
 
-// Function to find log files with multiple extensions
-std::vector<std::string> findLogFiles(const std::vector<std::string>& extensions, size_t max_file_size_mb)
+static DiscoveryOptions logDiscoveryOptions(const std::vector<std::string>& extensions,
+                                            size_t                          max_file_size_mb,
+                                            bool                            recursive,
+                                            unsigned int                    threads)
 {
-    std::vector<std::string> all_log_files;
-
-    for (const auto& extension : extensions)
-    {
-        auto files = findLogFiles(extension, max_file_size_mb);
-        all_log_files.insert(all_log_files.end(), files.begin(), files.end());
-    }
-
-    // Remove duplicates and sort
-    std::sort(all_log_files.begin(), all_log_files.end());
-    auto last = std::unique(all_log_files.begin(), all_log_files.end());
-    all_log_files.erase(last, all_log_files.end());
-
-    return all_log_files;
+    DiscoveryOptions options;
+    options.extensions     = extensions;
+    options.max_size_bytes = static_cast<std::uint64_t>(max_file_size_mb) * 1024 * 1024;
+    options.recursive      = recursive;
+    options.threads        = std::max(1u, threads);
+    options.cancel         = &g_shutdown_requested;
+    return options;
 }
 
-// Batch processing version for multiple extensions
-std::vector<std::string>
-findLogFiles(const std::vector<std::string>& extensions, size_t max_file_size_mb, size_t batch_size)
+std::vector<FileEntry> findLogFileEntries(const std::vector<std::string>& extensions,
+                                          size_t                          max_file_size_mb,
+                                          bool                            recursive,
+                                          unsigned int                    threads)
 {
-    std::vector<std::string> all_log_files;
-
-    for (const auto& extension : extensions)
-    {
-        auto files = findLogFiles(extension, max_file_size_mb, batch_size);
-        all_log_files.insert(all_log_files.end(), files.begin(), files.end());
-    }
-
-    // Remove duplicates and sort
-    std::sort(all_log_files.begin(), all_log_files.end());
-    auto last = std::unique(all_log_files.begin(), all_log_files.end());
-    all_log_files.erase(last, all_log_files.end());
-
-    return all_log_files;
+    return discover_files(".", logDiscoveryOptions(extensions, max_file_size_mb, recursive, threads));
 }
 
-// A better version of findLogfiles
-// Helper to collect all files using batches
-std::vector<std::string> findLogFiles(const std::string& extension, size_t max_file_size_mb)
+// Function to find log files with multiple extensions (one directory pass for all of them)
+std::vector<std::string> findLogFiles(const std::vector<std::string>& extensions, size_t max_file_size_mb)
 {
-    std::vector<std::string> log_files;
-
-    try
-    {
-        // Use single directory iteration with direct push_back for better performance
-        for (const auto& entry : std::filesystem::directory_iterator("."))
-        {
-            if (g_shutdown_requested.load())
-            {
-                break;
-            }
-
-            if (entry.is_regular_file())
-            {
-                std::string file_ext = entry.path().extension().string();
-                // Case-insensitive extension comparison
-                bool extension_match = false;
-                if (file_ext.length() == extension.length())
-                {
-                    extension_match = true;
-                    for (size_t i = 0; i < file_ext.length(); ++i)
-                    {
-                        if (std::tolower(file_ext[i]) != std::tolower(extension[i]))
-                        {
-                            extension_match = false;
-                            break;
-                        }
-                    }
-                }
-                if (extension_match)
-                {
-                    auto file_size = entry.file_size();
-                    if (file_size <= max_file_size_mb * 1024 * 1024)
-                    {
-                        log_files.push_back(entry.path().filename().string());
-                    }
-                }
-            }
-        }
-
-        // Sort the files for consistent processing order
-        std::sort(log_files.begin(), log_files.end());
-    }
-    catch (const std::filesystem::filesystem_error& e)
-    {
-        throw std::runtime_error("Error accessing directory: " + std::string(e.what()));
-    }
-
-    return log_files;
+    return file_paths(findLogFileEntries(extensions, max_file_size_mb));
 }
 
-// Batch processing version for handling millions of files with controlled memory usage
-std::vector<std::string> findLogFiles(const std::string& extension, size_t max_file_size_mb, size_t batch_size)
+std::vector<std::string> findLogFiles(const std::string& extension, size_t max_file_size_mb)
 {
-    std::vector<std::string> all_log_files;
-    std::vector<std::string> batch_files;
-    batch_files.reserve(batch_size);
-
-    try
-    {
-        // Process files in batches to control memory usage
-        for (const auto& entry : std::filesystem::directory_iterator("."))
-        {
-            if (g_shutdown_requested.load())
-            {
-                break;
-            }
-
-            if (entry.is_regular_file())
-            {
-                std::string file_ext = entry.path().extension().string();
-                // Case-insensitive extension comparison
-                bool extension_match = false;
-                if (file_ext.length() == extension.length())
-                {
-                    extension_match = true;
-                    for (size_t i = 0; i < file_ext.length(); ++i)
-                    {
-                        if (std::tolower(file_ext[i]) != std::tolower(extension[i]))
-                        {
-                            extension_match = false;
-                            break;
-                        }
-                    }
-                }
-                if (extension_match)
-                {
-                    auto file_size = entry.file_size();
-                    if (file_size <= max_file_size_mb * 1024 * 1024)
-                    {
-                        batch_files.push_back(entry.path().filename().string());
-
-                        // When batch is full, sort and move to main vector
-                        if (batch_files.size() >= batch_size)
-                        {
-                            std::sort(batch_files.begin(), batch_files.end());
-                            all_log_files.insert(all_log_files.end(),
-                                                 std::make_move_iterator(batch_files.begin()),
-                                                 std::make_move_iterator(batch_files.end()));
-                            batch_files.clear();
-                        }
-                    }
-                }
-            }
-        }
-
-        // Handle remaining files in last batch
-        if (!batch_files.empty())
-        {
-            std::sort(batch_files.begin(), batch_files.end());
-            all_log_files.insert(all_log_files.end(),
-                                 std::make_move_iterator(batch_files.begin()),
-                                 std::make_move_iterator(batch_files.end()));
-        }
-
-        // Final sort of all batches together to maintain global order
-        std::sort(all_log_files.begin(), all_log_files.end());
-    }
-    catch (const std::filesystem::filesystem_error& e)
-    {
-        throw std::runtime_error("Error accessing directory: " + std::string(e.what()));
-    }
-
-    return all_log_files;
+    return findLogFiles(std::vector<std::string>{extension}, max_file_size_mb);
 }
 
 
@@ -839,394 +920,464 @@ bool compareResults(const Result& a, const Result& b, int column)
     }
 }
 
-Result extract(const std::string& file_name_param, const ProcessingContext& context)
+/**
+ * @brief Original line-by-line parser for native Gaussian logs
+ *
+ * Kept behind ExtractionEngine::LEGACY as a reference for the scanner. Fills
+ * @p data exactly like GaussianScanner::scan() does, including the final
+ * check for "Normal termination" near the end of the file.
+ */
+static void scan_gaussian_legacy(const std::string&       file_name_param,
+                                 const std::string&       file_name,
+                                 const ProcessingContext& context,
+                                 GaussianScanData&        data)
 {
-    // Check for shutdown signal
-    if (g_shutdown_requested.load())
-    {
-        throw std::runtime_error("Processing interrupted by shutdown signal");
-    }
-
-    // Acquire file handle
-    auto file_guard = context.file_manager->acquire();
-    if (!file_guard.is_acquired())
-    {
-        throw std::runtime_error("Could not acquire file handle for: " + file_name_param);
-    }
-
-    // Estimate memory usage for this file (simplified without content buffer overhead)
-    size_t estimated_memory = 0;
-    try
-    {
-        auto file_size   = std::filesystem::file_size(file_name_param);
-        estimated_memory = file_size / 10;  // Rough estimate for processing overhead only
-    }
-    catch (const std::filesystem::filesystem_error&)
+    std::ifstream file(file_name_param);
+    if (!file.is_open())
     {
-        estimated_memory = 102400;  // 100KB default estimate
+        throw std::runtime_error("Could not open file: " + file_name_param);
     }
 
-    if (!context.memory_monitor->can_allocate(estimated_memory))
-    {
-        throw std::runtime_error("Insufficient memory to process file: " + file_name_param);
-    }
+    // Pre-compile regex patterns for better performance
+    static const std::regex scf_pattern(R"(SCF Done.*?=\s+(-?\d+\.\d+))");
+    static const std::regex freq_pattern(R"(Frequencies\s+--\s+(.*))");
 
-    context.memory_monitor->add_usage(estimated_memory);
+    std::string line;
+    size_t      line_count = 0;
 
-    // RAII class for memory cleanup
-    struct MemoryGuard
+    try
     {
-        std::shared_ptr<MemoryMonitor> monitor;
-        size_t                         bytes;
-
-        MemoryGuard(std::shared_ptr<MemoryMonitor> m, size_t b) : monitor(m), bytes(b) {}
-        ~MemoryGuard()
+        while (std::getline(file, line) && !g_shutdown_requested.load())
         {
-            if (monitor)
-                monitor->remove_usage(bytes);
-        }
-    };
-    MemoryGuard memory_guard(context.memory_monitor, estimated_memory);
-
-    std::string file_name = file_name_param;
-    if (file_name.substr(0, 2) == "./")
-    {
-        file_name = file_name.substr(2);
-    }
-
-    std::string prog_name = ThermoInterface::identify_program(file_name_param);
+            line_count++;
+            CCK_STAT_BYTES(line.size() + 1);
+            CCK_STAT_LINES(1);
 
-    std::string         line;
-    int                 copyright_count = 0;
-    int                 normal_count    = 0;  // Count of "Normal termination" messages
-    int                 error_count     = 0;  // Count of "Error termination" messages
-    double              scf = 0, zpe = 0, tcg = 0, etg = 0, ezpe = 0, nucleare = 0;
-    double              scfEqui = 0, scftd = 0;
-    double              temp = context.base_temp;  // Local copy for this file
-    double              pressure = context.base_pressure; // Local copy for this file
-    std::vector<double> negative_freqs, positive_freqs;
-    std::string         status    = "UNDONE";
-    std::string         phaseCorr = context.use_input_concentration ? "YES" : "NO";
-    double              lf = 0;
+            // Count termination status messages
+            if (line.find("Normal termination") != std::string::npos)
+            {
+                data.normal_count++;
+            }
+            else if (line.find("Error termination") != std::string::npos)
+            {
+                data.error_count++;
+            }
 
-    if (prog_name == "Unknown") {
-        // Cannot identify the quantum chemistry program – skip parsing.
-        status = "UNDONE";
-    } else if (prog_name != "Gaussian"
-               || context.use_input_temp
-               || context.use_input_pressure
-               || context.use_input_concentration) {
-        // Rule B: thermo module – all non-Gaussian programs, and Gaussian with any argument flag.
-        int nfreq = 0;
-        double corrG_au = 0.0, corrH_au = 0.0, zpe_au = 0.0, lf_cm = 0.0;
-        if (ThermoInterface::extract_basic_properties(file_name_param, temp, pressure, scf, corrG_au, corrH_au, zpe_au, lf_cm, nfreq, prog_name, context.low_vib_method, context.ravib)) {
-            lf = lf_cm;
-            if (nfreq > 0) {
-                zpe = zpe_au;
-                etg = scf + corrG_au;
-            } else {
-                etg = scf;
+            // Process line content
+            if (line.find("Copyright") != std::string::npos)
+            {
+                ++data.copyright_count;
             }
 
-            // Determine the program-specific termination signal.
-            // Add more programs here as support expands.
-            std::string termination_signal;
-            if      (prog_name == "ORCA")     { termination_signal = "****ORCA TERMINATED NORMALLY****"; }
-            else if (prog_name == "Gaussian") { termination_signal = "Normal termination"; }
-            // Q-Chem, NWChem, GAMESS-US, CP2K, xTB, VASP etc. – to be added later
-
-            if (termination_signal.empty()) {
-                // No termination-signal check defined for this program yet;
-                // trust the parser's success as a best-effort indicator.
-                status = "DONE";
-            } else {
-                // Scan the tail of the file for the termination signal.
-                // Open in binary mode so that seekg arithmetic is reliable on all platforms
-                // (text-mode seek arithmetic is undefined when CRLF translation is active on Windows).
-                std::ifstream tail_file(file_name_param, std::ios::binary);
-                if (!tail_file.is_open()) {
-                    context.error_collector->add_warning(
-                        "Could not reopen file for termination check: " + file_name_param);
-                    status = "UNDONE";
-                } else {
-                    tail_file.seekg(0, std::ios::end);
-                    std::streampos file_size = tail_file.tellg();
-
-                    constexpr std::streamoff TAIL_BYTES = 4096;
-                    std::streampos read_pos =
-                        (file_size > std::streampos(TAIL_BYTES))
-                            ? file_size - TAIL_BYTES
-                            : std::streampos(0);
-                    tail_file.seekg(read_pos);
-
-                    std::string tail_content;
-                    tail_content.reserve(static_cast<std::size_t>(TAIL_BYTES) + 64);
-                    std::string tail_line;
-                    while (std::getline(tail_file, tail_line)) {
-                        // Strip CR so the pattern match works on both CRLF and LF files
-                        if (!tail_line.empty() && tail_line.back() == '\r') {
-                            tail_line.pop_back();
-                        }
-                        tail_content += tail_line + "\n";
+            std::smatch match;
+            try
+            {
+                if (line.find("SCF Done") != std::string::npos &&
+                    (CCK_STAT_REGEX(1), std::regex_search(line, match, scf_pattern)))
+                {
+                    double value;
+                    if (safe_stod(match[1], value))
+                    {
+                        data.scf     = value;
+                        data.has_scf = true;
                     }
-                    tail_file.close();
-
-                    status = (tail_content.find(termination_signal) != std::string::npos)
-                                 ? "DONE"
-                                 : "UNDONE";
                 }
-            }
-        } else {
-            status = "ERROR";
-        }
-    } else {
-        std::ifstream file(file_name_param);
-        if (!file.is_open())
-        {
-            throw std::runtime_error("Could not open file: " + file_name_param);
-        }
-
-        // Pre-compile regex patterns for better performance
-        static const std::regex scf_pattern(R"(SCF Done.*?=\s+(-?\d+\.\d+))");
-        static const std::regex freq_pattern(R"(Frequencies\s+--\s+(.*))");
-
-        std::vector<double> scf_values;
-        size_t              line_count = 0;
-
-        try
-        {
-            while (std::getline(file, line) && !g_shutdown_requested.load())
-            {
-                line_count++;
-
-                // Count termination status messages
-                if (line.find("Normal termination") != std::string::npos)
+                else if (line.find("Total Energy, E(CIS") != std::string::npos)
                 {
-                    normal_count++;
+                    size_t eq_pos = line.find("=");
+                    if (eq_pos != std::string::npos)
+                    {
+                        std::string value_str = line.substr(eq_pos + 1);
+                        safe_stod(value_str, data.scftd);
+                    }
                 }
-                else if (line.find("Error termination") != std::string::npos)
+                else if (line.find("After PCM corrections, the energy is") != std::string::npos)
                 {
-                    error_count++;
+                    size_t is_pos = line.find("is");
+                    if (is_pos != std::string::npos)
+                    {
+                        std::string value_str = line.substr(is_pos + 2);
+                        safe_stod(value_str, data.scfEqui);
+                    }
                 }
-
-                // Process line content
-                if (line.find("Copyright") != std::string::npos)
+                else if (line.find("Zero-point correction") != std::string::npos)
                 {
-                    ++copyright_count;
+                    size_t eq_pos = line.find("=");
+                    if (eq_pos != std::string::npos)
+                    {
+                        std::string value_str = line.substr(eq_pos + 1);
+                        safe_stod(value_str, data.zpe);
+                    }
                 }
-
-                std::smatch match;
-                try
+                else if (line.find("Thermal correction to Gibbs Free Energy") != std::string::npos)
                 {
-                    if (line.find("SCF Done") != std::string::npos && std::regex_search(line, match, scf_pattern))
+                    size_t eq_pos = line.find("=");
+                    if (eq_pos != std::string::npos)
                     {
-                        double value;
-                        if (safe_stod(match[1], value))
-                        {
-                            scf_values.push_back(value);
-                        }
+                        std::string value_str = line.substr(eq_pos + 1);
+                        safe_stod(value_str, data.tcg);
                     }
-                    else if (line.find("Total Energy, E(CIS") != std::string::npos)
+                }
+                else if (line.find("Sum of electronic and thermal Free Energies") != std::string::npos)
+                {
+                    size_t eq_pos = line.find("=");
+                    if (eq_pos != std::string::npos)
                     {
-                        size_t eq_pos = line.find("=");
-                        if (eq_pos != std::string::npos)
-                        {
-                            std::string value_str = line.substr(eq_pos + 1);
-                            safe_stod(value_str, scftd);
-                        }
+                        std::string value_str = line.substr(eq_pos + 1);
+                        safe_stod(value_str, data.etg);
                     }
-                    else if (line.find("After PCM corrections, the energy is") != std::string::npos)
+                }
+                else if (line.find("Sum of electronic and zero-point Energies") != std::string::npos)
+                {
+                    size_t eq_pos = line.find("=");
+                    if (eq_pos != std::string::npos)
                     {
-                        size_t is_pos = line.find("is");
-                        if (is_pos != std::string::npos)
-                        {
-                            std::string value_str = line.substr(is_pos + 2);
-                            safe_stod(value_str, scfEqui);
-                        }
+                        std::string value_str = line.substr(eq_pos + 1);
+                        safe_stod(value_str, data.ezpe);
                     }
-                    else if (line.find("Zero-point correction") != std::string::npos)
+                }
+                else if (line.find("nuclear repulsion energy") != std::string::npos)
+                {
+                    size_t pos = line.find("nuclear repulsion energy") + 25;
+                    if (pos < line.length())
                     {
-                        size_t eq_pos = line.find("=");
-                        if (eq_pos != std::string::npos)
+                        std::string num_str = line.substr(pos);
+
+                        // Clean up the string
+                        num_str.erase(0, num_str.find_first_not_of(" \t"));
+                        size_t end_pos = num_str.find("Hartrees");
+                        if (end_pos != std::string::npos)
                         {
-                            std::string value_str = line.substr(eq_pos + 1);
-                            safe_stod(value_str, zpe);
+                            num_str = num_str.substr(0, end_pos);
                         }
-                    }
-                    else if (line.find("Thermal correction to Gibbs Free Energy") != std::string::npos)
-                    {
-                        size_t eq_pos = line.find("=");
-                        if (eq_pos != std::string::npos)
+                        num_str.erase(num_str.find_last_not_of(" \t") + 1);
+
+                        if (!num_str.empty() && !safe_stod(num_str, data.nucleare))
                         {
-                            std::string value_str = line.substr(eq_pos + 1);
-                            safe_stod(value_str, tcg);
+                            data.warnings.push_back("Could not parse nuclear repulsion energy from '" +
+                                                                 line + "' in file '" + file_name + "'");
                         }
                     }
-                    else if (line.find("Sum of electronic and thermal Free Energies") != std::string::npos)
+                }
+                else if (line.find("Frequencies") != std::string::npos &&
+                         (CCK_STAT_REGEX(1), std::regex_search(line, match, freq_pattern)))
+                {
+                    std::istringstream iss(match[1]);
+                    double             freq;
+                    while (iss >> freq)
                     {
-                        size_t eq_pos = line.find("=");
-                        if (eq_pos != std::string::npos)
+                        if (freq < 0)
                         {
-                            std::string value_str = line.substr(eq_pos + 1);
-                            safe_stod(value_str, etg);
+                            data.has_negative_freq  = true;
+                            data.last_negative_freq = freq;
                         }
-                    }
-                    else if (line.find("Sum of electronic and zero-point Energies") != std::string::npos)
-                    {
-                        size_t eq_pos = line.find("=");
-                        if (eq_pos != std::string::npos)
+                        else if (!data.has_positive_freq || freq < data.min_positive_freq)
                         {
-                            std::string value_str = line.substr(eq_pos + 1);
-                            safe_stod(value_str, ezpe);
+                            data.has_positive_freq = true;
+                            data.min_positive_freq = freq;
                         }
                     }
-                    else if (line.find("nuclear repulsion energy") != std::string::npos)
+                }
+                else if ((data.read_temp || data.read_pressure) && line.find("Kelvin.  Pressure") != std::string::npos)
+                {
+                    if (data.read_temp)
                     {
-                        size_t pos = line.find("nuclear repulsion energy") + 25;
-                        if (pos < line.length())
+                        size_t start_pos = line.find("Temperature");
+                        size_t end_pos   = line.find("Kelvin");
+
+                        if (start_pos != std::string::npos && end_pos != std::string::npos && start_pos < end_pos)
                         {
-                            std::string num_str = line.substr(pos);
+                            start_pos += 11;  // Length of "Temperature"
+                            std::string temp_str = line.substr(start_pos, end_pos - start_pos);
 
                             // Clean up the string
-                            num_str.erase(0, num_str.find_first_not_of(" \t"));
-                            size_t end_pos = num_str.find("Hartrees");
-                            if (end_pos != std::string::npos)
-                            {
-                                num_str = num_str.substr(0, end_pos);
-                            }
-                            num_str.erase(num_str.find_last_not_of(" \t") + 1);
+                            temp_str.erase(0, temp_str.find_first_not_of(" \t"));
+                            temp_str.erase(temp_str.find_last_not_of(" \t") + 1);
 
-                            if (!num_str.empty() && !safe_stod(num_str, nucleare))
+                            if (!temp_str.empty())
                             {
-                                context.error_collector->add_warning("Could not parse nuclear repulsion energy from '" +
-                                                                     line + "' in file '" + file_name + "'");
-                            }
-                        }
-                    }
-                    else if (line.find("Frequencies") != std::string::npos && std::regex_search(line, match, freq_pattern))
-                    {
-                        std::istringstream iss(match[1]);
-                        double             freq;
-                        while (iss >> freq)
-                        {
-                            if (freq < 0)
-                            {
-                                negative_freqs.push_back(freq);
-                            }
-                            else
-                            {
-                                positive_freqs.push_back(freq);
-                            }
-                        }
-                    }
-                    else if ((!context.use_input_temp || !context.use_input_pressure) && line.find("Kelvin.  Pressure") != std::string::npos)
-                    {
-                        if (!context.use_input_temp)
-                        {
-                            size_t start_pos = line.find("Temperature");
-                            size_t end_pos   = line.find("Kelvin");
-
-                            if (start_pos != std::string::npos && end_pos != std::string::npos && start_pos < end_pos)
-                            {
-                                start_pos += 11;  // Length of "Temperature"
-                                std::string temp_str = line.substr(start_pos, end_pos - start_pos);
-
-                                // Clean up the string
-                                temp_str.erase(0, temp_str.find_first_not_of(" \t"));
-                                temp_str.erase(temp_str.find_last_not_of(" \t") + 1);
-
-                                if (!temp_str.empty())
+                                if (!safe_stod(temp_str, data.temp))
                                 {
-                                    if (!safe_stod(temp_str, temp))
-                                    {
-                                        context.error_collector->add_warning("Could not parse temperature from '" + line +
-                                                                             "' in file '" + file_name +
-                                                                             "'. Using default 298.15 K");
-                                        temp = 298.15;
-                                    }
+                                    data.warnings.push_back("Could not parse temperature from '" + line +
+                                                                         "' in file '" + file_name +
+                                                                         "'. Using default 298.15 K");
+                                    data.temp = 298.15;
                                 }
                             }
                         }
+                    }
 
-                        if (!context.use_input_pressure)
-                        {
-                            size_t start_pos = line.find("Pressure");
-                            size_t end_pos   = line.find("Atm.");
+                    if (data.read_pressure)
+                    {
+                        size_t start_pos = line.find("Pressure");
+                        size_t end_pos   = line.find("Atm.");
 
-                            if (start_pos != std::string::npos && end_pos != std::string::npos && start_pos < end_pos)
-                            {
-                                start_pos += 8;  // Length of "Pressure"
-                                std::string press_str = line.substr(start_pos, end_pos - start_pos);
+                        if (start_pos != std::string::npos && end_pos != std::string::npos && start_pos < end_pos)
+                        {
+                            start_pos += 8;  // Length of "Pressure"
+                            std::string press_str = line.substr(start_pos, end_pos - start_pos);
 
-                                // Clean up the string
-                                press_str.erase(0, press_str.find_first_not_of(" \t"));
-                                press_str.erase(press_str.find_last_not_of(" \t") + 1);
+                            // Clean up the string
+                            press_str.erase(0, press_str.find_first_not_of(" \t"));
+                            press_str.erase(press_str.find_last_not_of(" \t") + 1);
 
-                                if (!press_str.empty())
+                            if (!press_str.empty())
+                            {
+                                if (!safe_stod(press_str, data.pressure))
                                 {
-                                    if (!safe_stod(press_str, pressure))
-                                    {
-                                        context.error_collector->add_warning("Could not parse pressure from '" + line +
-                                                                             "' in file '" + file_name +
-                                                                             "'. Using default 1.0 atm");
-                                        pressure = 1.0;
-                                    }
+                                    data.warnings.push_back("Could not parse pressure from '" + line +
+                                                                         "' in file '" + file_name +
+                                                                         "'. Using default 1.0 atm");
+                                    data.pressure = 1.0;
                                 }
                             }
                         }
                     }
-                    else if (line.find("scrf") != std::string::npos)
-                    {
-                        phaseCorr = "YES";
-                    }
-                }
-                catch (const std::regex_error& e)
-                {
-                    context.error_collector->add_warning("Regex error in file '" + file_name + "': " + e.what());
                 }
-                catch (const std::exception& e)
+                else if (line.find("scrf") != std::string::npos)
                 {
-                    context.error_collector->add_warning("Error processing line in file '" + file_name + "': " + e.what());
+                    data.scrf_seen = true;
                 }
+            }
+            catch (const std::regex_error& e)
+            {
+                data.warnings.push_back("Regex error in file '" + file_name + "': " + e.what());
+            }
+            catch (const std::exception& e)
+            {
+                data.warnings.push_back("Error processing line in file '" + file_name + "': " + e.what());
+            }
 
-                // Periodically check for shutdown
-                if (line_count % 1000 == 0 && g_shutdown_requested.load())
-                {
-                    throw std::runtime_error("Processing interrupted by shutdown signal");
-                }
+            // Periodically check for shutdown
+            if (line_count % 1000 == 0 && g_shutdown_requested.load())
+            {
+                throw std::runtime_error("Processing interrupted by shutdown signal");
             }
         }
-        catch (const std::ios_base::failure& e)
+    }
+    catch (const std::ios_base::failure& e)
+    {
+        throw std::runtime_error("I/O error reading file '" + file_name + "': " + e.what());
+    }
+
+    file.close();
+
+    // The tail is only needed to confirm completion of a job without errors
+    if (data.error_count == 0 && data.normal_count >= data.copyright_count && data.copyright_count > 0)
+    {
+        std::ifstream tail_file(file_name_param);
+        if (!tail_file.is_open())
         {
-            throw std::runtime_error("I/O error reading file '" + file_name + "': " + e.what());
+            context.error_collector->add_error("Could not reopen file for tail check: " + file_name_param);
+            return;
         }
 
-        file.close();
+        tail_file.seekg(0, std::ios::end);
+        std::streampos file_size = tail_file.tellg();
 
-        // Process extracted data
-        if (!scf_values.empty())
+        // Read approximately last 2KB of file
+        std::streampos read_pos;
+        if (file_size > std::streampos(GaussianScanner::TAIL_CHECK_BYTES))
+        {
+            read_pos = file_size - std::streamoff(GaussianScanner::TAIL_CHECK_BYTES);
+        }
+        else
         {
-            scf = scf_values.back();
+            read_pos = std::streampos(0);
         }
+        tail_file.seekg(read_pos);
 
-        if (!negative_freqs.empty())
+        std::string tail_content;
+        std::string tail_line;
+        while (std::getline(tail_file, tail_line))
         {
-            lf = negative_freqs.back();
+            tail_content += tail_line + "\n";
         }
-        else if (!positive_freqs.empty())
+        data.tail_normal_termination = tail_content.find("Normal termination") != std::string::npos;
+    }
+}
+
+// Fault in every page of a mapped range so --profile can tell reading the
+// file apart from parsing it; the volatile sink keeps the loads in place
+static void touch_pages(std::string_view data)
+{
+    constexpr size_t PAGE = 4096;
+    volatile char    sink = 0;
+    for (size_t offset = 0; offset < data.size(); offset += PAGE)
+    {
+        sink = data[offset];
+    }
+    (void)sink;
+}
+
+Result extract(const std::string& file_name_param, const ProcessingContext& context, GaussianScanCheckpoint* checkpoint)
+{
+    // Check for shutdown signal
+    if (g_shutdown_requested.load())
+    {
+        throw std::runtime_error("Processing interrupted by shutdown signal");
+    }
+
+    TraceSpan                   file_span("file", "file", file_name_param);
+    ProfileScope                file_profile(ProfileStage::FILE);
+    std::optional<ProfileScope> stage(std::in_place, ProfileStage::OPEN);
+    CCK_STAT_FILE(file_name_param);
+
+    // Acquire file handle
+    auto file_guard = context.file_manager->acquire();
+    if (!file_guard.is_acquired())
+    {
+        throw std::runtime_error("Could not acquire file handle for: " + file_name_param);
+    }
+
+    // Open the file once; program detection, the parsers and the termination
+    // check below all read from this shared view
+    FileView file_view(file_name_param);
+
+    // Every parser reads the mapped file in place, so the mapping is what this
+    // file costs (only the part after a checkpoint when resuming); waits here
+    // while other workers hold the memory budget
+    size_t touched_bytes = file_view.size();
+    if (checkpoint != nullptr && checkpoint->offset <= touched_bytes)
+    {
+        touched_bytes -= static_cast<size_t>(checkpoint->offset);
+    }
+    file_profile.add_bytes(touched_bytes);
+    file_span.add_bytes(touched_bytes);
+    stage.reset();
+    stage.emplace(ProfileStage::READ, touched_bytes);
+    MemoryReservation memory_reservation(context.memory_monitor, touched_bytes);
+    if (stage->active())
+    {
+        touch_pages(file_view.view().substr(file_view.size() - touched_bytes));
+    }
+    stage.reset();
+    stage.emplace(ProfileStage::PARSE);
+
+    std::string file_name = file_name_param;
+    if (file_name.substr(0, 2) == "./")
+    {
+        file_name = file_name.substr(2);
+    }
+
+    std::string prog_name = ThermoInterface::identify_program(file_view);
+    file_span.set_program(prog_name);
+
+    int                 copyright_count = 0;
+    int                 normal_count    = 0;  // Count of "Normal termination" messages
+    int                 error_count     = 0;  // Count of "Error termination" messages
+    bool                tail_normal_termination = false;  // "Normal termination" near the end of the file
+    double              scf = 0, zpe = 0, etg = 0, nucleare = 0;
+    double              temp = context.base_temp;  // Local copy for this file
+    double              pressure = context.base_pressure; // Local copy for this file
+    std::string         status    = "UNDONE";
+    std::string         phaseCorr = context.use_input_concentration ? "YES" : "NO";
+    double              lf = 0;
+
+    if (prog_name == "Unknown") {
+        // Cannot identify the quantum chemistry program – skip parsing.
+        status = "UNDONE";
+    } else if (prog_name != "Gaussian"
+               || context.use_input_temp
+               || context.use_input_pressure
+               || context.use_input_concentration) {
+        // Rule B: thermo module – all non-Gaussian programs, and Gaussian with any argument flag.
+        int nfreq = 0;
+        double corrG_au = 0.0, corrH_au = 0.0, zpe_au = 0.0, lf_cm = 0.0;
+        if (ThermoInterface::extract_basic_properties(file_name_param, temp, pressure, scf, corrG_au, corrH_au, zpe_au, lf_cm, nfreq, prog_name, context.low_vib_method, context.ravib, file_view)) {
+            lf = lf_cm;
+            if (nfreq > 0) {
+                zpe = zpe_au;
+                etg = scf + corrG_au;
+            } else {
+                etg = scf;
+            }
+
+            // Determine the program-specific termination signal.
+            // Add more programs here as support expands.
+            std::string termination_signal;
+            if      (prog_name == "ORCA")     { termination_signal = "****ORCA TERMINATED NORMALLY****"; }
+            else if (prog_name == "Gaussian") { termination_signal = "Normal termination"; }
+            // Q-Chem, NWChem, GAMESS-US, CP2K, xTB, VASP etc. – to be added later
+
+            if (termination_signal.empty()) {
+                // No termination-signal check defined for this program yet;
+                // trust the parser's success as a best-effort indicator.
+                status = "DONE";
+            } else {
+                // Scan the tail of the file for the termination signal.
+                constexpr size_t TAIL_BYTES = 4096;
+                status = (file_view.tail(TAIL_BYTES).find(termination_signal) != std::string_view::npos)
+                             ? "DONE"
+                             : "UNDONE";
+            }
+        } else {
+            status = "ERROR";
+        }
+    } else {
+        // Rule A: native Gaussian parser
+        GaussianScanData scan_data;
+        scan_data.temp          = temp;
+        scan_data.pressure      = pressure;
+        scan_data.read_temp     = !context.use_input_temp;
+        scan_data.read_pressure = !context.use_input_pressure;
+
+        if (context.extraction_engine == ExtractionEngine::LEGACY)
+        {
+            scan_gaussian_legacy(file_name_param, file_name, context, scan_data);
+        }
+        else if (context.extraction_engine == ExtractionEngine::REVERSE)
         {
-            lf = *std::min_element(positive_freqs.begin(), positive_freqs.end());
+            GaussianScanner::instance().scan_reverse(file_name_param, file_name, scan_data, &g_shutdown_requested);
+        }
+        else if (checkpoint != nullptr && context.extraction_engine == ExtractionEngine::SCANNER)
+        {
+            GaussianScanner::instance().scan_resume(file_view.view(), file_name, scan_data, *checkpoint,
+                                                    &g_shutdown_requested);
+        }
+        else
+        {
+            const GaussianScanner& scanner = GaussianScanner::instance();
+            if (context.extraction_engine != ExtractionEngine::ARCHIVE ||
+                !scanner.scan_archive_tail(file_view.view(), file_name, scan_data, &g_shutdown_requested))
+            {
+                scanner.scan(file_view.view(), file_name, scan_data, &g_shutdown_requested);
+            }
         }
 
-        scf      = scfEqui ? scfEqui : (scftd ? scftd : scf);
-        nucleare = nucleare ? nucleare : 0;
+        for (const auto& warning : scan_data.warnings)
+        {
+            context.error_collector->add_warning(warning);
+        }
+
+        copyright_count         = scan_data.copyright_count;
+        normal_count            = scan_data.normal_count;
+        error_count             = scan_data.error_count;
+        tail_normal_termination = scan_data.tail_normal_termination;
+        temp                    = scan_data.temp;
+        pressure                = scan_data.pressure;
+        zpe                     = scan_data.zpe;
+        etg                     = scan_data.etg;
+        nucleare                = scan_data.nucleare;
+        if (scan_data.scrf_seen)
+        {
+            phaseCorr = "YES";
+        }
+
+        if (scan_data.has_negative_freq)
+        {
+            lf = scan_data.last_negative_freq;
+        }
+        else if (scan_data.has_positive_freq)
+        {
+            lf = scan_data.min_positive_freq;
+        }
+
+        scf = scan_data.scfEqui ? scan_data.scfEqui : (scan_data.scftd ? scan_data.scftd : scan_data.scf);
 
         // NOTE: argument-flag recalculation is now handled exclusively via Rule B
         // (the thermo-module path above). Rule A never runs when argument flags are set.
 
-        etg      = etg ? etg : 0.0;
-        zpe      = zpe ? zpe : 0.0;
-
         // Set status based on termination counts and final job state
         if (error_count > 0)
         {
@@ -1266,50 +1417,9 @@ Result extract(const std::string& file_name_param, const ProcessingContext& cont
         }
         else if (normal_count >= copyright_count && copyright_count > 0)
         {
-            // Reopen the file to read the tail
-            std::ifstream tail_file(file_name_param);
-            if (!tail_file.is_open())
-            {
-                context.error_collector->add_error("Could not reopen file for tail check: " + file_name_param);
-                status = "UNDONE";  // Fallback on error
-            }
-            else
-            {
-                tail_file.seekg(0, std::ios::end);
-                std::streampos file_size = tail_file.tellg();
-
-                // Read approximately last 2KB of file
-                std::streampos read_pos;
-                if (file_size > std::streampos(2048))
-                {
-                    read_pos = file_size - std::streamoff(2048);
-                }
-                else
-                {
-                    read_pos = std::streampos(0);
-                }
-                tail_file.seekg(read_pos);
-
-                std::string tail_content;
-                std::string tail_line;
-                while (std::getline(tail_file, tail_line))
-                {
-                    tail_content += tail_line + "\n";
-                }
-
-                // Check if "Normal termination" appears in the final part of the file
-                // This confirms the job actually completed, not just had intermediate completions
-                if (tail_content.find("Normal termination") != std::string::npos)
-                {
-                    status = "DONE";
-                }
-                else
-                {
-                    status = "UNDONE";
-                }
-
-                tail_file.close();
-            }
+            // "Normal termination" in the final part of the file confirms the job actually
+            // completed, not just had intermediate completions
+            status = tail_normal_termination ? "DONE" : "UNDONE";
         }
         else
         {
@@ -1333,6 +1443,146 @@ unsigned int getSafeThreadCount(unsigned int requested_threads, unsigned int fil
     return calculateSafeThreadCount(requested_threads, file_count, job_resources);
 }
 
+/**
+ * @struct ParsedFile
+ * @brief Per-file slot of processFileBatch() when results go to the persistent cache
+ */
+struct ParsedFile
+{
+    bool                   extracted = false;  ///< extract() succeeded and result is valid
+    Result                 result;
+    GaussianScanCheckpoint checkpoint;  ///< In: state left by the previous run (offset 0 = none); out: new state
+};
+
+/// Called by a worker as soon as a file is done: index in the batch, the result (nullptr on failure)
+/// and the error message
+using FileDoneCallback = std::function<void(size_t, const Result*, const std::string&)>;
+
+/**
+ * @brief Extract one batch of files on a pool of worker threads
+ * @param entries Files of this batch
+ * @param context Processing context shared by all workers
+ * @param num_threads Number of worker threads
+ * @param total_files Total number of files for progress output (0 = unknown, streaming)
+ * @param quiet Suppress progress output
+ * @param completed_files Progress counter shared across batches
+ * @param work_stats [in,out] Work distribution statistics, accumulated over batches
+ * @param parsed Optional slots, one per entry: results are stored there by index (and not
+ *               returned), and checkpoints are passed to extract()
+ * @param on_done Optional callback for every file, called from the worker threads
+ * @return Results of the files that were extracted successfully, in no particular order
+ *
+ * Failures are recorded in context.error_collector.
+ */
+static ResultTable processFileBatch(const std::vector<FileEntry>& entries,
+                                            const ProcessingContext&      context,
+                                            unsigned int                  num_threads,
+                                            size_t                        total_files,
+                                            bool                          quiet,
+                                            ProgressCounter&              completed_files,
+                                            WorkQueueStats&               work_stats,
+                                            std::vector<ParsedFile>*      parsed  = nullptr,
+                                            const FileDoneCallback&       on_done = FileDoneCallback())
+{
+    // Largest files first, idle workers steal from the others
+    WorkQueue work_queue(WorkQueue::file_costs(entries), num_threads);
+
+    // Each worker appends to its own table; the tables are merged after all workers finish
+    PerWorker<ResultTable> worker_results(num_threads);
+
+    // Progress reporting (every 10% or every 100 files, whichever is smaller)
+    size_t progress_interval =
+        total_files > 0 ? std::max(static_cast<size_t>(1), std::min(total_files / 10, static_cast<size_t>(100))) : 100;
+
+    // Worker function with comprehensive error handling
+    auto worker_function = [&](unsigned int worker) {
+        ResultTable& local_results = worker_results[worker];
+        size_t       i             = 0;
+        while (!g_shutdown_requested.load() && work_queue.next(worker, i))
+        {
+
+            const std::string& file = entries[i].path;
+
+            try
+            {
+                if (parsed != nullptr)
+                {
+                    ParsedFile& slot = (*parsed)[i];
+                    slot.result      = extract(file, context, &slot.checkpoint);
+                    slot.extracted   = true;
+                    if (on_done)
+                        on_done(i, &slot.result, std::string());
+                }
+                else
+                {
+                    Result result = extract(file, context);
+                    if (on_done)
+                        on_done(i, &result, std::string());
+                    local_results.append(result);
+                }
+
+                size_t completed = completed_files.increment();
+                if (!quiet && completed % progress_interval == 0)
+                {
+                    if (total_files > 0)
+                    {
+                        std::cout << "Processed " << completed << "/" << total_files << " files ("
+                                  << (completed * 100 / total_files) << "%)" << std::endl;
+                    }
+                    else
+                    {
+                        std::cout << "Processed " << completed << " files" << std::endl;
+                    }
+                }
+            }
+            catch (const std::exception& e)
+            {
+                context.error_collector->add_error("Error processing file '" + file + "': " + e.what());
+                completed_files.increment();
+                if (on_done)
+                    on_done(i, nullptr, e.what());
+            }
+            catch (...)
+            {
+                context.error_collector->add_error("Unknown error processing file: " + file);
+                completed_files.increment();
+                if (on_done)
+                    on_done(i, nullptr, "unknown error");
+            }
+        }
+    };
+
+    // Launch worker threads
+    std::vector<std::future<void>> futures;
+    for (unsigned int i = 0; i < num_threads; ++i)
+    {
+        futures.emplace_back(std::async(std::launch::async, worker_function, i));
+    }
+
+    // Wait for all threads to complete
+    for (auto& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (const std::exception& e)
+        {
+            context.error_collector->add_error("Thread execution error: " + std::string(e.what()));
+        }
+    }
+
+    // Batches run one after another, so busy times add up across batches
+    work_stats.add(work_queue.stats());
+
+    ResultTable results;
+    worker_results.for_each([&results](ResultTable& table) {
+        results.append(table);
+        table.clear();
+    });
+    return results;
+}
+
 void processAndOutputResults(double                          temp,
                              double                          pressure,
                              int                             C,
@@ -1350,11 +1600,22 @@ void processAndOutputResults(double                          temp,
                              const JobResources&             job_resources,
                              size_t                          batch_size,
                              const std::string&              low_vib_method,
-                             double                          ravib)
+                             double                          ravib,
+                             ExtractionEngine                engine,
+                             bool                            show_resource_info,
+                             bool                            recursive,
+                             ResultCacheMode                 cache_mode)
 {
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
+    // NDJSON rows go to stdout as soon as files finish, so nothing meant for people may go there
+    bool ndjson_output = (format == "ndjson");
+    if (ndjson_output)
+    {
+        quiet = true;
+    }
+
     try
     {
         // Detect job scheduler resources if not provided
@@ -1367,37 +1628,27 @@ void processAndOutputResults(double                          temp,
         // Print job information
         printJobResourceInfo(final_job_resources, quiet);
 
-        // Find and validate log files using batch processing if specified
-        std::vector<std::string> log_files;
+        // With --batch-size, discovery hands batches of files to the workers
+        // through a bounded queue and results are spilled to sorted runs on
+        // disk, so memory no longer grows with the number of files
+        bool streaming = batch_size > 0;
 
+        // Find and validate log files in one directory pass; the sizes learned
+        // here feed the work distribution without another stat per file
         // If using default extension (.log), search for both .log and .out files (case-insensitive)
         bool is_log_extension = (extension.length() == 4 && std::tolower(extension[1]) == 'l' &&
                                  std::tolower(extension[2]) == 'o' && std::tolower(extension[3]) == 'g');
-        if (is_log_extension)
-        {
-            std::vector<std::string> extensions = {".log", ".out"};
-            if (batch_size > 0)
-            {
-                log_files = findLogFiles(extensions, max_file_size_mb, batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extensions, max_file_size_mb);
-            }
-        }
-        else
+        std::vector<std::string> extensions = is_log_extension ? std::vector<std::string>{".log", ".out"}
+                                                               : std::vector<std::string>{extension};
+        std::vector<FileEntry> log_entries;
+        if (!streaming)
         {
-            if (batch_size > 0)
-            {
-                log_files = findLogFiles(extension, max_file_size_mb, batch_size);
-            }
-            else
-            {
-                log_files = findLogFiles(extension, max_file_size_mb);
-            }
+            unsigned int discovery_threads =
+                recursive ? std::max(1u, std::min(requested_threads, static_cast<unsigned int>(8))) : 1u;
+            log_entries = findLogFileEntries(extensions, max_file_size_mb, recursive, discovery_threads);
         }
 
-        if (log_files.empty())
+        if (!streaming && log_entries.empty())
         {
             if (is_log_extension)
             {
@@ -1416,22 +1667,28 @@ void processAndOutputResults(double                          temp,
             return;
         }
 
-        // Calculate job-aware safe thread count
-        unsigned int num_threads = calculateSafeThreadCount(
-            requested_threads, static_cast<unsigned int>(log_files.size()), final_job_resources);
+        // Calculate job-aware safe thread count (in streaming mode the file count
+        // is not known up front, so the pool is sized for one batch)
+        size_t       planned_files = streaming ? batch_size : log_entries.size();
+        unsigned int num_threads =
+            calculateSafeThreadCount(requested_threads, static_cast<unsigned int>(planned_files), final_job_resources);
 
         // Calculate job-aware memory limit
         size_t calculated_memory_limit = calculateSafeMemoryLimit(memory_limit_mb, num_threads, final_job_resources);
 
         if (!quiet)
         {
-            if (is_log_extension)
+            if (streaming)
+            {
+                std::cout << "Streaming mode: processing files in batches of " << batch_size << std::endl;
+            }
+            else if (is_log_extension)
             {
-                std::cout << "Found " << log_files.size() << " .log/.out files" << std::endl;
+                std::cout << "Found " << log_entries.size() << " .log/.out files" << std::endl;
             }
             else
             {
-                std::cout << "Found " << log_files.size() << " " << extension << " files" << std::endl;
+                std::cout << "Found " << log_entries.size() << " " << extension << " files" << std::endl;
             }
 
             // Debug thread calculation with detailed reasoning
@@ -1487,13 +1744,19 @@ void processAndOutputResults(double                          temp,
         // Set up output file
         std::filesystem::path cwd              = std::filesystem::current_path();
         std::string           dir_name         = cwd.filename().string();
-        std::string           output_extension = (format == "csv") ? ".csv" : ".results";
+        bool                  binary_output    = (format == "cckb");
+        std::string           output_extension = (format == "csv") ? ".csv" : binary_output ? ".cckb" : ".results";
         std::string           output_filename  = dir_name + output_extension;
 
-        std::ofstream output_file(output_filename);
-        if (!output_file.is_open())
+        // The binary file is created once the row count is known; NDJSON goes to stdout
+        std::ofstream output_file;
+        if (!binary_output && !ndjson_output)
         {
-            throw std::runtime_error("Could not open output file: " + output_filename);
+            output_file.open(output_filename);
+            if (!output_file.is_open())
+            {
+                throw std::runtime_error("Could not open output file: " + output_filename);
+            }
         }
 
         // Create processing context with job-aware memory limit
@@ -1501,6 +1764,7 @@ void processAndOutputResults(double                          temp,
         context.use_input_concentration = use_input_concentration;
         context.low_vib_method = low_vib_method;
         context.ravib = ravib;
+        context.extraction_engine = engine;
 
         // Apply calculated memory limit
         context.memory_monitor->set_memory_limit(calculated_memory_limit);
@@ -1521,86 +1785,220 @@ void processAndOutputResults(double                          temp,
             }
         }
 
-        // Thread-safe result collection
-        std::vector<Result> results;
-        std::mutex          results_mutex;
-        std::atomic<size_t> file_index(0);
-        std::atomic<size_t> completed_files(0);
+        ProgressCounter              completed_files;
+        WorkQueueStats               work_stats;
+        size_t                       total_files = log_entries.size();
+        size_t                       cached_files = 0;
+        size_t                       resumed_files = 0;
+        ResultTable                  results;
+        std::unique_ptr<ResultSpill> spill;
+        std::unique_ptr<ResultCache> cache;
+
+        // seq is the position of the file in discovery order, so consumers can reorder the rows
+        std::unique_ptr<NdjsonStream> ndjson;
+        std::atomic<size_t>           streamed_rows{0};
+        if (ndjson_output)
+        {
+            ndjson = std::make_unique<NdjsonStream>(std::cout);
+        }
+        auto emit_row = [&](size_t seq, const std::string& path, const Result* result, const std::string& error) {
+            JsonLine line;
+            line.field("seq", static_cast<std::uint64_t>(seq)).field("file", path);
+            if (result != nullptr)
+            {
+                write_result_json(line, result_row(*result));
+                streamed_rows++;
+            }
+            else
+            {
+                line.field("error", error);
+            }
+            ndjson->write(line);
+        };
 
-        // Worker function with comprehensive error handling
-        auto worker_function = [&]() {
-            while (!g_shutdown_requested.load())
+        if (!streaming)
+        {
+            // Unchanged files are taken from the persistent cache, only the rest is parsed.
+            // Streaming mode skips the cache: its index would grow with the directory.
+            std::vector<FileEntry>  pending_entries;
+            std::vector<size_t>     pending_seq;
+            std::vector<ParsedFile> parsed_files;
+            if (cache_mode != ResultCacheMode::DISABLED)
             {
-                size_t i = file_index.fetch_add(1);
-                if (i >= log_files.size())
+                cache = std::make_unique<ResultCache>(ResultCache::default_path(),
+                                                      ResultCache::settings_hash_for(context));
+                if (cache_mode == ResultCacheMode::USE)
                 {
-                    break;
+                    cache->load();
                 }
-
-                const std::string& file = log_files[i];
-
-                try
+                for (size_t seq = 0; seq < log_entries.size(); ++seq)
                 {
-                    Result res = extract(file, context);
-
+                    FileEntry& entry = log_entries[seq];
+                    stat_file_entry(entry);
+                    if (const Result* cached = cache->find(entry))
                     {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        results.push_back(res);
+                        results.append(*cached);
+                        if (ndjson)
+                            emit_row(seq, entry.path, cached, std::string());
                     }
-
-                    size_t completed = completed_files.fetch_add(1) + 1;
-
-                    // Progress reporting (every 10% or every 100 files, whichever is smaller)
-                    size_t progress_interval =
-                        std::max(static_cast<size_t>(1), std::min(log_files.size() / 10, static_cast<size_t>(100)));
-                    if (!quiet && completed % progress_interval == 0)
+                    else
                     {
-                        std::cout << "Processed " << completed << "/" << log_files.size() << " files ("
-                                  << (completed * 100 / log_files.size()) << "%)" << std::endl;
+                        // Logs of running jobs that grew are parsed from their checkpoint on
+                        pending_entries.push_back(entry);
+                        pending_seq.push_back(seq);
+                        parsed_files.emplace_back();
+                        resumed_files += cache->find_checkpoint(entry, parsed_files.back().checkpoint) ? 1 : 0;
                     }
                 }
-                catch (const std::exception& e)
+                cached_files = results.size();
+            }
+            const std::vector<FileEntry>& parse_entries = cache ? pending_entries : log_entries;
+
+            FileDoneCallback on_done;
+            if (ndjson)
+            {
+                on_done = [&](size_t i, const Result* result, const std::string& error) {
+                    emit_row(cache ? pending_seq[i] : i, parse_entries[i].path, result, error);
+                };
+            }
+
+            ResultTable parsed =
+                processFileBatch(parse_entries, context, num_threads, parse_entries.size(), quiet, completed_files,
+                                 work_stats, cache ? &parsed_files : nullptr, on_done);
+
+            if (cache)
+            {
+                for (size_t i = 0; i < parsed_files.size(); ++i)
                 {
-                    context.error_collector->add_error("Error processing file '" + file + "': " + e.what());
-                    completed_files.fetch_add(1);
+                    ParsedFile& file = parsed_files[i];
+                    if (!file.extracted)
+                        continue;
+
+                    // Finished jobs do not grow any more, so only unfinished ones keep a checkpoint
+                    bool running = file.result.status == "UNDONE" && file.checkpoint.offset > 0;
+                    cache->store(parse_entries[i], file.result, running ? &file.checkpoint : nullptr);
+                    parsed.append(file.result);
                 }
-                catch (...)
+                if (!cache->save() && !quiet)
                 {
-                    context.error_collector->add_error("Unknown error processing file: " + file);
-                    completed_files.fetch_add(1);
+                    std::cerr << "Warning: could not write result cache " << cache->path().string() << std::endl;
                 }
             }
-        };
-
-        // Launch worker threads
-        std::vector<std::future<void>> futures;
-        for (unsigned int i = 0; i < num_threads; ++i)
+            results.append(parsed);
+        }
+        else
         {
-            futures.emplace_back(std::async(std::launch::async, worker_function));
+            spill = std::make_unique<ResultSpill>(column);
+
+            // Discovery may run at most two batches ahead of the workers
+            BoundedQueue<std::vector<FileEntry>> batches(2);
+            std::exception_ptr                   discovery_error;
+            std::thread                          discovery([&]() {
+                try
+                {
+                    discover_files_batched(".",
+                                           logDiscoveryOptions(extensions, max_file_size_mb, recursive, 1),
+                                           batch_size,
+                                           [&batches](std::vector<FileEntry>& batch) {
+                                               // push() fails once the consumer closed the queue
+                                               return batches.push(std::move(batch));
+                                           });
+                }
+                catch (...)
+                {
+                    discovery_error = std::current_exception();
+                }
+                batches.close();
+            });
+
+            try
+            {
+                std::vector<FileEntry> batch;
+                while (batches.pop(batch))
+                {
+                    size_t           first_seq = total_files;
+                    FileDoneCallback on_done;
+                    if (ndjson)
+                    {
+                        on_done = [&](size_t i, const Result* result, const std::string& error) {
+                            emit_row(first_seq + i, batch[i].path, result, error);
+                        };
+                    }
+
+                    total_files += batch.size();
+                    ResultTable batch_results = processFileBatch(batch, context, num_threads, 0, quiet,
+                                                                 completed_files, work_stats, nullptr, on_done);
+                    // Rows already went out as NDJSON; nothing is left to sort
+                    if (!ndjson)
+                    {
+                        spill->add_run(batch_results);
+                    }
+                }
+            }
+            catch (...)
+            {
+                batches.close();  // Unblocks the discovery thread
+                discovery.join();
+                throw;
+            }
+            discovery.join();
+            if (discovery_error)
+            {
+                std::rethrow_exception(discovery_error);
+            }
         }
+        size_t extracted_files = ndjson ? streamed_rows.load() : streaming ? spill->size() : results.size();
 
-        // Wait for all threads to complete
-        for (auto& future : futures)
+        if (show_resource_info && !quiet)
         {
-            try
+            std::cout << "Work distribution: " << work_stats.summary() << std::endl;
+            if (!streaming)
             {
-                future.get();
+                std::cout << "Result table: " << results.size() << " rows in "
+                          << formatMemorySize(results.memory_bytes()) << std::endl;
             }
-            catch (const std::exception& e)
+            if (streaming)
             {
-                context.error_collector->add_error("Thread execution error: " + std::string(e.what()));
+                std::cout << "Spill: " << spill->size() << " results in " << spill->run_count() << " sorted runs"
+                          << std::endl;
             }
+            if (cache)
+            {
+                std::cout << "Result cache: " << cache->hits() << " reused, " << cache->misses() << " parsed ("
+                          << resumed_files << " with a checkpoint; " << cache->path().string() << ")"
+                          << std::endl;
+            }
+            std::cout << "Memory: peak " << formatMemorySize(context.memory_monitor->get_peak_usage()) << " of "
+                      << formatMemorySize(context.memory_monitor->get_max_usage()) << ", "
+                      << context.memory_monitor->get_wait_count() << " waits for memory" << std::endl;
         }
 
         // Check for shutdown or critical errors
         if (g_shutdown_requested.load())
         {
             std::cerr << "Processing interrupted by shutdown signal." << std::endl;
-            std::cerr << "Processed " << completed_files.load() << "/" << log_files.size()
+            std::cerr << "Processed " << cached_files + completed_files.load() << "/" << total_files
                       << " files before interruption." << std::endl;
         }
 
-        if (results.empty())
+        // Unsorted NDJSON rows are complete once the summary line is out
+        if (ndjson)
+        {
+            JsonLine summary;
+            summary.field("files", static_cast<std::uint64_t>(total_files))
+                .field("extracted", static_cast<std::uint64_t>(extracted_files))
+                .field("cached", static_cast<std::uint64_t>(cached_files))
+                .field("errors", static_cast<std::uint64_t>(context.error_collector->get_errors().size()))
+                .field("interrupted", g_shutdown_requested.load());
+            ndjson->write_summary(summary);
+
+            std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+            std::cerr << "Processed " << extracted_files << "/" << total_files << " files (execution time: "
+                      << std::fixed << std::setprecision(1) << duration.count() << "s)" << std::endl;
+            return;
+        }
+
+        if (extracted_files == 0)
         {
             std::cerr << "No valid results were extracted." << std::endl;
 
@@ -1617,10 +2015,8 @@ void processAndOutputResults(double                          temp,
             return;
         }
 
-        // Sort results
-        std::sort(results.begin(), results.end(), [column](const Result& a, const Result& b) {
-            return compareResults(a, b, column);
-        });
+        // Sort a permutation of the rows (streaming runs are already sorted and merged on output)
+        std::vector<std::uint32_t> order = results.sorted_order(column, num_threads);
 
         // Prepare header information
         std::ostringstream params;
@@ -1650,7 +2046,7 @@ void processAndOutputResults(double                          temp,
             params << "Quasi-RRHO crossover frequency (ravib): " << std::fixed << std::setprecision(1) << ravib << " cm-1\n";
         }
         params << "Using " << num_threads << " threads for processing.\n";
-        params << "Successfully processed " << results.size() << "/" << log_files.size() << " files.\n";
+        params << "Successfully processed " << extracted_files << "/" << total_files << " files.\n";
 
         // Add resource usage info
         params << "Peak memory usage: " << formatMemorySize(context.memory_monitor->get_peak_usage()) << "\n";
@@ -1688,71 +2084,67 @@ void processAndOutputResults(double                          temp,
         }
 
         // Generate output
-        std::ostringstream output_stream;
-
-        if (format == "text")
-        {
-            // Text format output
-            std::ostringstream header;
-            header << std::setw(53) << std::left << "Output name" << std::setw(18) << std::right << "ETG kJ/mol"
-                   << std::setw(10) << std::right << "Low FC" << std::setw(18) << std::right << "ETG a.u"
-                   << std::setw(18) << std::right << "Nuclear E au" << std::setw(18) << std::right << "SCFE"
-                   << std::setw(10) << std::right << "ZPE " << std::setw(8) << std::right << "Status" << std::setw(6)
-                   << std::right << "PCorr" << std::setw(6) << std::right << "Round" << "\n";
-
-            std::ostringstream separator;
-            separator << std::setw(53) << std::left << std::string(53, '-') << std::setw(18) << std::right
-                      << std::string(18, '-') << std::setw(10) << std::right << std::string(10, '-') << std::setw(18)
-                      << std::right << std::string(18, '-') << std::setw(18) << std::right << std::string(18, '-')
-                      << std::setw(18) << std::right << std::string(18, '-') << std::setw(10) << std::right
-                      << std::string(10, '-') << std::setw(8) << std::right << std::string(8, '-') << std::setw(6)
-                      << std::right << std::string(6, '-') << std::setw(6) << std::right << std::string(6, '-') << "\n";
-
-            for (const auto& result : results)
+        std::optional<ProfileScope> write_profile(std::in_place, ProfileStage::WRITE);
+        if (format != "text" && format != "csv" && format != "cckb")
+        {
+            throw std::runtime_error("Invalid format '" + format +
+                                     "'. Supported formats: 'text', 'csv', 'cckb', 'ndjson'.");
+        }
+
+        // The console always gets the text table; the binary file keeps the parameters as metadata
+        std::string        console_format = binary_output ? "text" : format;
+        std::ostringstream table_header;
+        write_result_header(table_header, console_format);
+
+        std::unique_ptr<BinaryResultWriter> binary_writer;
+        if (binary_output)
+        {
+            binary_writer = std::make_unique<BinaryResultWriter>(output_filename, extracted_files, params.str());
+        }
+        else
+        {
+            output_file << params.str() << table_header.str();
+        }
+        if (!quiet)
+        {
+            std::cout << params.str() << table_header.str();
+        }
+
+        auto write_row = [&](const ResultRow& row) {
+            if (binary_writer)
             {
-                output_stream << std::setw(53) << std::left << result.file_name << std::setw(18) << std::right
-                              << std::fixed << std::setprecision(6) << result.etgkj << std::setw(10) << std::right
-                              << std::fixed << std::setprecision(2) << result.lf << std::setw(18) << std::right
-                              << std::fixed << std::setprecision(6) << result.GibbsFreeHartree << std::setw(18)
-                              << std::right << std::fixed << std::setprecision(6) << result.nucleare << std::setw(18)
-                              << std::right << std::fixed << std::setprecision(6) << result.scf << std::setw(10)
-                              << std::right << std::fixed << std::setprecision(6) << result.zpe << std::setw(8)
-                              << std::right << result.status << std::setw(6) << std::right << result.phaseCorr
-                              << std::setw(6) << std::right << result.copyright_count << "\n";
+                binary_writer->add(row);
+            }
+            else
+            {
+                write_result_row(output_file, row, format);
             }
-
-            output_file << params.str() << header.str() << separator.str() << output_stream.str();
             if (!quiet)
             {
-                std::cout << params.str() << header.str() << separator.str() << output_stream.str();
+                write_result_row(std::cout, row, console_format);
             }
+        };
+        if (streaming)
+        {
+            spill->merge([&write_row](const Result& result) { write_row(result_row(result)); });
         }
-        else if (format == "csv")
+        else
         {
-            // CSV format output
-            output_stream << "Output name,ETG kJ/mol,Low FC,ETG a.u,Nuclear E au,SCFE,ZPE,Status,PCorr,Round\n";
-            for (const auto& result : results)
+            for (std::uint32_t index : order)
             {
-                output_stream << "\"" << result.file_name << "\"," << std::fixed << std::setprecision(6) << result.etgkj
-                              << "," << std::fixed << std::setprecision(2) << result.lf << "," << std::fixed
-                              << std::setprecision(6) << result.GibbsFreeHartree << "," << std::fixed
-                              << std::setprecision(6) << result.nucleare << "," << std::fixed << std::setprecision(6)
-                              << result.scf << "," << std::fixed << std::setprecision(6) << result.zpe << ","
-                              << result.status << "," << result.phaseCorr << "," << result.copyright_count << "\n";
+                write_row(results.row(index));
             }
+        }
 
-            output_file << params.str() << output_stream.str();
-            if (!quiet)
-            {
-                std::cout << params.str() << output_stream.str();
-            }
+        if (binary_writer)
+        {
+            binary_writer->finish();
         }
         else
         {
-            throw std::runtime_error("Invalid format '" + format + "'. Supported formats: 'text', 'csv'.");
+            output_file.close();
         }
-
-        output_file.close();
+        write_profile.reset();
 
         // Final summary
         auto                          end_time = std::chrono::high_resolution_clock::now();
@@ -1769,7 +2161,7 @@ void processAndOutputResults(double                          temp,
         }
         else
         {
-            std::cout << "Processed " << results.size() << "/" << log_files.size() << " files. Results written to "
+            std::cout << "Processed " << extracted_files << "/" << total_files << " files. Results written to "
                       << output_filename << " (execution time: " << std::fixed << std::setprecision(1)
                       << duration.count() << "s)" << std::endl;
         }
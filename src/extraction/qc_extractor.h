@@ -50,6 +50,7 @@
     #include <mutex>
 #endif
 #include "job_management/job_scheduler.h"
+#include "utilities/file_discovery.h"
 
 /**
  * @brief Global flag for graceful termination of long-running operations
@@ -104,9 +105,13 @@ const size_t MIN_MEMORY_MB            = 1024;   ///< Minimum safe memory limit:
 const size_t MAX_MEMORY_MB            = 32768;  ///< Maximum memory limit: 32GB
 const size_t MAX_FILE_HANDLES         = 20;     ///< Maximum concurrent file operations
 const size_t DEFAULT_MAX_FILE_SIZE_MB = 100;    ///< Default maximum individual file size: 100MB
+const long   RSS_SAMPLE_INTERVAL_MS   = 50;     ///< Minimum interval between /proc memory samples
+const long   MEMORY_WAIT_POLL_MS      = 100;    ///< Re-check interval while waiting for memory
 
 /** @} */  // end of SafetyLimits group
 
+struct GaussianScanCheckpoint;  // gaussian_scanner.h
+
 /**
  * @struct Result
  * @brief Structure containing extracted thermodynamic data from a single Gaussian log file
@@ -158,12 +163,25 @@ struct Result
  *
  * @section MemoryMonitor Usage Pattern
  * 1. Create MemoryMonitor with desired limit
- * 2. Check can_allocate() before
- * large allocations
- * 3. Call add_usage() when allocating memory
- * 4. Call remove_usage() when freeing memory
- * 5.
- * Monitor current and peak usage for optimization
+ * 2. Wrap each large buffer in a MemoryReservation
+ * (or call acquire() / remove_usage() by hand); acquire() waits while the
+ * budget is exhausted instead of failing
+ * 3. Monitor current and peak usage for optimization
+ *
+ * @section Backpressure
+ * acquire() admits a request when the charged buffers plus the request fit
+ * the limit and MemAvailable still covers the request. Otherwise the caller
+ * sleeps until another reservation is released. The check and the charge
+ * are a single compare-and-swap, so concurrent requests cannot overshoot the
+ * limit together. A request is always admitted (and charged) when nothing
+ * else is charged, so a single file larger than the limit is processed alone
+ * rather than failed, with a warning. Reservations must therefore not nest:
+ * a buffer is charged once, by the outermost scope that holds it.
+ *
+ * Charges are the only accounting model: every large buffer or mapping is
+ * reserved, and caches only keep what a live reservation covers. The
+ * process' resident set (sampled from /proc/self/statm) only feeds the
+ * peak usage report.
  *
  * @note All methods are thread-safe and can be called from multiple threads
  *       simultaneously without external synchronization
@@ -175,6 +193,20 @@ private:
     std::atomic<size_t> peak_usage_bytes{0};
     size_t              max_bytes;
 
+    // Backpressure state
+    std::mutex              wait_mutex;
+    std::condition_variable released;
+    std::atomic<size_t>     wait_count{0};
+    size_t                  baseline_rss_bytes;  ///< RSS when the monitor was created
+
+    // Last /proc sample, refreshed at most every RSS_SAMPLE_INTERVAL_MS
+    std::atomic<long long> last_sample_ms{-1};
+    std::atomic<size_t>    sampled_available{0};
+
+    void update_peak(size_t usage);
+    void sample_system_usage();
+    bool try_charge(size_t bytes);
+
 public:
     /**
      * @brief Constructor with memory limit specification
@@ -213,6 +245,21 @@ public:
      */
     void remove_usage(size_t bytes);
 
+    /**
+     * @brief Charge @p bytes, waiting until the memory budget has room for them
+     * @param bytes Number of bytes about to be allocated or mapped
+     *
+     * Blocks while admitting the request would exceed the limit (see
+     * Backpressure). Returns without waiting when nothing else is charged or
+     * once g_shutdown_requested is set. Pair with remove_usage().
+     */
+    void acquire(size_t bytes);
+
+    /**
+     * @brief Number of acquire() calls that had to wait for memory
+     */
+    size_t get_wait_count() const;
+
     /**
      * @brief Get current memory usage
      * @return Current memory usage in bytes
@@ -249,6 +296,24 @@ public:
      */
     static size_t get_system_memory_mb();
 
+    /**
+     * @brief Memory limit of the enclosing cgroup
+     * @return memory.max (cgroup v2) or memory.limit_in_bytes (cgroup v1) in megabytes, 0 if unlimited or unknown
+     */
+    static size_t get_cgroup_memory_limit_mb();
+
+    /**
+     * @brief Memory the kernel considers available without swapping
+     * @return MemAvailable from /proc/meminfo in bytes, 0 if unknown
+     */
+    static size_t get_available_memory_bytes();
+
+    /**
+     * @brief Resident set of this process, mapped file pages included
+     * @return Resident pages from /proc/self/statm in bytes, 0 if unknown
+     */
+    static size_t get_process_rss_bytes();
+
     /**
      * @brief Calculate optimal memory limit for given thread count
      * @param thread_count Number of threads that will be processing
@@ -264,6 +329,37 @@ public:
     static size_t calculate_optimal_memory_limit(unsigned int thread_count, size_t system_memory_mb = 0);
 };
 
+/**
+ * @class MemoryReservation
+ * @brief RAII charge against a MemoryMonitor
+ *
+ * The constructor calls MemoryMonitor::acquire() (which may wait) and the
+ * destructor releases the charge. A null monitor makes the reservation a no-op.
+ */
+class MemoryReservation
+{
+private:
+    std::shared_ptr<MemoryMonitor> monitor;
+    size_t                         bytes;
+
+public:
+    MemoryReservation(std::shared_ptr<MemoryMonitor> memory_monitor, size_t reserved_bytes)
+        : monitor(std::move(memory_monitor)), bytes(reserved_bytes)
+    {
+        if (monitor)
+            monitor->acquire(bytes);
+    }
+
+    ~MemoryReservation()
+    {
+        if (monitor)
+            monitor->remove_usage(bytes);
+    }
+
+    MemoryReservation(const MemoryReservation&)            = delete;
+    MemoryReservation& operator=(const MemoryReservation&) = delete;
+};
+
 /**
  * @class FileHandleManager
  * @brief Thread-safe file handle resource management system
@@ -507,6 +603,37 @@ public:
     void clear();
 };
 
+/**
+ * @enum ExtractionEngine
+ * @brief Parser used for native Gaussian logs in extract()
+ *
+ * SCANNER and LEGACY produce identical results. SCANNER memory-maps the file
+ * and finds all markers in one multi-pattern pass (see gaussian_scanner.h);
+ * LEGACY keeps the original line-by-line parser for comparison and fallback.
+ * REVERSE reads from the end of the file and stops once every value of the
+ * last job steps is known, which is much cheaper for long optimisation logs.
+ * ARCHIVE takes the energies of completed jobs from the archive entry and
+ * only scans the tail of the file, falling back to SCANNER otherwise.
+ */
+enum class ExtractionEngine
+{
+    SCANNER,  ///< Single-pass memory-mapped multi-pattern scanner (default)
+    LEGACY,   ///< Original getline/regex parser
+    REVERSE,  ///< Tail-first backward scanner (GaussianScanner::scan_reverse)
+    ARCHIVE   ///< Archive entry plus tail window (GaussianScanner::scan_archive_tail)
+};
+
+/**
+ * @enum ResultCacheMode
+ * @brief How extract uses the persistent result cache (see result_cache.h)
+ */
+enum class ResultCacheMode
+{
+    USE,       ///< Reuse cached results of unchanged files and update the cache (default)
+    DISABLED,  ///< Neither read nor write the cache (--no-cache)
+    REBUILD    ///< Ignore the existing cache, parse everything and write a new one (--rebuild-cache)
+};
+
 
 /**
  * @struct ProcessingContext
@@ -549,6 +676,7 @@ struct ProcessingContext
     JobResources                              job_resources;      ///< Job scheduler resource information
     std::string                               low_vib_method = "grimme"; ///< Low-frequency vibrational treatment method
     double                                    ravib = 100.0;             ///< Crossover frequency for low-vib treatment (cm-1)
+    ExtractionEngine                          extraction_engine = ExtractionEngine::SCANNER; ///< Parser for native Gaussian logs
 
     /**
      * @brief Constructor with parameter validation and resource setup
@@ -637,8 +765,16 @@ bool compareResults(const Result& a, const Result& b, int column);
  *
  * @note The function respects global shutdown requests and will terminate
  *       gracefully if g_shutdown_requested becomes true
+ *
+ * @param checkpoint [in,out] Optional scanner checkpoint of a log that may still be
+ *        growing. With the default scanner engine, a native Gaussian log whose
+ *        checkpoint still matches is only parsed from the checkpoint on, and the
+ *        checkpoint is advanced to the end of the last complete line. Other
+ *        programs and engines leave it untouched.
  */
-Result extract(const std::string& file_name_param, const ProcessingContext& context);
+Result extract(const std::string&       file_name_param,
+               const ProcessingContext& context,
+               GaussianScanCheckpoint*  checkpoint = nullptr);
 
 /**
  * @brief Process multiple files and output formatted results
@@ -654,6 +790,11 @@ Result extract(const std::string& file_name_param, const ProcessingContext& cont
  * @param memory_limit_mb Total memory usage limit (MB, 0 = auto)
  * @param warnings Vector of warnings to display before processing
  * @param job_resources Job scheduler resource information
+ * @param batch_size Number of files per processing batch (0 = all at once)
+ * @param low_vib_method Low-frequency vibrational treatment method
+ * @param ravib Crossover frequency for the low-frequency treatment (cm-1)
+ * @param engine Parser used for native Gaussian logs
+ * @param show_resource_info Print the measured work distribution (--resource-info)
  *
  * This is the main orchestration function that coordinates the complete
  * processing workflow:
@@ -697,7 +838,11 @@ void processAndOutputResults(double                          temp,
                              const JobResources&             job_resources = JobResources{},
                              size_t                          batch_size    = 0,
                              const std::string&              low_vib_method = "grimme",
-                             double                          ravib          = 100.0);
+                             double                          ravib          = 100.0,
+                             ExtractionEngine                engine         = ExtractionEngine::SCANNER,
+                             bool                            show_resource_info = false,
+                             bool                            recursive          = false,
+                             ResultCacheMode                 cache_mode         = ResultCacheMode::USE);
 
 /** @} */  // end of CoreFunctions group
 
@@ -711,24 +856,34 @@ void processAndOutputResults(double                          temp,
  * @brief Find all Gaussian log files in the current directory
  * @param extension File extension to search for (e.g., ".log", ".out")
  * @param max_file_size_mb Maximum file size to include (MB)
- * @return Vector of file paths that match the criteria
+ * @return Vector of file paths that match the criteria, sorted
  *
- * Recursively searches the current directory for files matching the specified
- * extension and size constraints. Files exceeding the size limit are skipped
- * with warnings to prevent memory exhaustion.
+ * Searches the current directory (not recursively) for files matching the
+ * specified extension and size constraints. Files exceeding the size limit
+ * are skipped to prevent memory exhaustion. All overloads are thin wrappers
+ * around findLogFileEntries().
  *
  * @note The function filters out files that are too large to process safely
  *       based on available system resources
  */
-// Optimized version that uses direct iteration and sorting for consistent file processing order
 std::vector<std::string> findLogFiles(const std::string& extension, size_t max_file_size_mb = DEFAULT_MAX_FILE_SIZE_MB);
-// Batch processing version for handling millions of files with controlled memory usage
-std::vector<std::string> findLogFiles(const std::string& extension, size_t max_file_size_mb, size_t batch_size);
 // Multiple extensions version
 std::vector<std::string> findLogFiles(const std::vector<std::string>& extensions, size_t max_file_size_mb);
-// Batch processing version for multiple extensions
-std::vector<std::string>
-findLogFiles(const std::vector<std::string>& extensions, size_t max_file_size_mb, size_t batch_size);
+/**
+ * @brief Find output files for all @p extensions in one directory pass
+ * @param extensions Extensions to match, case-insensitive (e.g. {".log", ".out"})
+ * @param max_file_size_mb Maximum file size to include (MB)
+ * @param recursive Also search subdirectories (paths are then relative, e.g. "job1/a.log")
+ * @param threads Directory-walking threads used in recursive mode
+ * @return Matching files, sorted by path, with the sizes learned during discovery
+ *
+ * Stops early when g_shutdown_requested is set.
+ */
+std::vector<FileEntry> findLogFileEntries(const std::vector<std::string>& extensions,
+                                          size_t                          max_file_size_mb,
+                                          bool                            recursive = false,
+                                          unsigned int                    threads   = 1);
+
 /**
  * @brief Validate that a file size is within processing limits
  * @param filename Path to file to check
@@ -0,0 +1,376 @@
+/**
+ * @file result_cache.cpp
+ * @brief Implementation of the persistent extraction result cache
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "extraction/result_cache.h"
+#include "extraction/result_spill.h"
+#include "utilities/version.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+#ifdef _WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME  = 1099511628211ULL;
+
+    void hash_bytes(std::uint64_t& hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    template <typename T>
+    void hash_value(std::uint64_t& hash, const T& value)
+    {
+        hash_bytes(hash, &value, sizeof(T));
+    }
+
+    void hash_string(std::uint64_t& hash, const std::string& text)
+    {
+        hash_value(hash, text.size());
+        hash_bytes(hash, text.data(), text.size());
+    }
+
+    template <typename T>
+    void write_value(std::ostream& out, const T& value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool read_value(std::istream& in, T& value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    void write_string(std::ostream& out, const std::string& text)
+    {
+        write_value(out, static_cast<std::uint32_t>(text.size()));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    bool read_string(std::istream& in, std::string& text)
+    {
+        std::uint32_t length = 0;
+        if (!read_value(in, length))
+            return false;
+        text.resize(length);
+        return length == 0 || static_cast<bool>(in.read(&text[0], length));
+    }
+
+    // Everything of GaussianScanData except the warnings, which are reported once
+    void write_scan_data(std::ostream& out, const GaussianScanData& data)
+    {
+        write_value(out, data.copyright_count);
+        write_value(out, data.normal_count);
+        write_value(out, data.error_count);
+        write_value(out, data.has_scf);
+        write_value(out, data.scf);
+        write_value(out, data.scftd);
+        write_value(out, data.scfEqui);
+        write_value(out, data.zpe);
+        write_value(out, data.tcg);
+        write_value(out, data.etg);
+        write_value(out, data.ezpe);
+        write_value(out, data.nucleare);
+        write_value(out, data.temp);
+        write_value(out, data.pressure);
+        write_value(out, data.read_temp);
+        write_value(out, data.read_pressure);
+        write_value(out, data.scrf_seen);
+        write_value(out, data.has_negative_freq);
+        write_value(out, data.last_negative_freq);
+        write_value(out, data.has_positive_freq);
+        write_value(out, data.min_positive_freq);
+        write_value(out, data.tail_normal_termination);
+        write_value(out, data.seen);
+    }
+
+    bool read_scan_data(std::istream& in, GaussianScanData& data)
+    {
+        return read_value(in, data.copyright_count) && read_value(in, data.normal_count) &&
+               read_value(in, data.error_count) && read_value(in, data.has_scf) && read_value(in, data.scf) &&
+               read_value(in, data.scftd) && read_value(in, data.scfEqui) && read_value(in, data.zpe) &&
+               read_value(in, data.tcg) && read_value(in, data.etg) && read_value(in, data.ezpe) &&
+               read_value(in, data.nucleare) && read_value(in, data.temp) && read_value(in, data.pressure) &&
+               read_value(in, data.read_temp) && read_value(in, data.read_pressure) &&
+               read_value(in, data.scrf_seen) && read_value(in, data.has_negative_freq) &&
+               read_value(in, data.last_negative_freq) && read_value(in, data.has_positive_freq) &&
+               read_value(in, data.min_positive_freq) && read_value(in, data.tail_normal_termination) &&
+               read_value(in, data.seen);
+    }
+
+    long process_id()
+    {
+#ifdef _WIN32
+        return static_cast<long>(_getpid());
+#else
+        return static_cast<long>(getpid());
+#endif
+    }
+}  // namespace
+
+ResultCache::ResultCache(std::filesystem::path path, std::uint64_t settings)
+    : cache_path(std::move(path)), settings_hash(settings)
+{}
+
+std::uint64_t ResultCache::settings_hash_for(const ProcessingContext& context)
+{
+    std::uint64_t hash = FNV_OFFSET;
+    hash_string(hash, COMCHEMKIT_STRING);
+    hash_value(hash, static_cast<int>(context.extraction_engine));
+    hash_value(hash, context.base_temp);
+    hash_value(hash, context.base_pressure);
+    hash_value(hash, context.concentration);
+    hash_value(hash, context.use_input_temp);
+    hash_value(hash, context.use_input_pressure);
+    hash_value(hash, context.use_input_concentration);
+    hash_string(hash, context.low_vib_method);
+    hash_value(hash, context.ravib);
+    return hash;
+}
+
+std::uint64_t ResultCache::settings_hash_for_check()
+{
+    std::uint64_t hash = FNV_OFFSET;
+    hash_string(hash, COMCHEMKIT_STRING);
+    hash_string(hash, "check");
+    return hash;
+}
+
+std::filesystem::path ResultCache::default_path()
+{
+    std::error_code       ec;
+    std::filesystem::path cwd = std::filesystem::current_path(ec);
+#ifndef _WIN32
+    if (!ec && access(cwd.c_str(), W_OK) != 0)
+    {
+        std::filesystem::path base;
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg != nullptr && xdg[0] != '\0')
+        {
+            base = xdg;
+        }
+        else if (const char* home = std::getenv("HOME"); home != nullptr && home[0] != '\0')
+        {
+            base = std::filesystem::path(home) / ".cache";
+        }
+
+        if (!base.empty())
+        {
+            std::uint64_t hash = FNV_OFFSET;
+            hash_string(hash, cwd.string());
+            std::ostringstream name;
+            name << std::hex << hash << ".cache";
+            return base / "comchemkit" / name.str();
+        }
+    }
+#endif
+    return ".cck_cache";
+}
+
+ResultCache::Entry* ResultCache::find_entry(const std::string& path, std::uint64_t settings)
+{
+    auto it = entries.find(path);
+    if (it == entries.end())
+    {
+        return nullptr;
+    }
+    for (auto& entry : it->second)
+    {
+        if (entry.settings == settings)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool ResultCache::load()
+{
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    std::uint64_t magic   = 0;
+    std::uint32_t version = 0;
+    std::uint64_t count   = 0;
+    if (!read_value(in, magic) || magic != MAGIC || !read_value(in, version) || version != FORMAT_VERSION ||
+        !read_value(in, count))
+    {
+        return false;
+    }
+
+    std::unordered_map<std::string, std::vector<Entry>> loaded;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        std::string path;
+        Entry       entry;
+        if (!read_string(in, path) || !read_value(in, entry.inode) || !read_value(in, entry.size) ||
+            !read_value(in, entry.mtime_ns) || !read_value(in, entry.settings) ||
+            !read_result_record(in, entry.result) || !read_value(in, entry.checkpoint.offset))
+        {
+            return false;  // Truncated or corrupt: start over rather than trust part of it
+        }
+        if (entry.checkpoint.offset > 0 &&
+            (!read_value(in, entry.checkpoint.fingerprint) || !read_scan_data(in, entry.checkpoint.data)))
+        {
+            return false;
+        }
+        loaded[path].push_back(std::move(entry));
+    }
+
+    entries      = std::move(loaded);
+    loaded_count = static_cast<size_t>(count);
+    return true;
+}
+
+const Result* ResultCache::find(const FileEntry& file)
+{
+    // Entries of this path under other settings survive as long as the file exists
+    auto it = entries.find(file.path);
+    if (it != entries.end())
+    {
+        for (auto& entry : it->second)
+        {
+            entry.seen = true;
+        }
+    }
+
+    Entry* entry = find_entry(file.path, settings_hash);
+    if (entry == nullptr || !file.size_known || entry->inode != file.inode || entry->size != file.size ||
+        entry->mtime_ns != file.mtime_ns)
+    {
+        miss_count++;
+        return nullptr;
+    }
+    hit_count++;
+    return &entry->result;
+}
+
+bool ResultCache::find_checkpoint(const FileEntry& file, GaussianScanCheckpoint& checkpoint)
+{
+    // A log that only grew keeps its inode; anything else is parsed from the start
+    Entry* entry = find_entry(file.path, settings_hash);
+    if (entry == nullptr || !file.size_known || entry->checkpoint.offset == 0 || entry->inode != file.inode ||
+        file.size <= entry->size)
+    {
+        return false;
+    }
+    checkpoint = entry->checkpoint;
+    return true;
+}
+
+void ResultCache::store(const FileEntry& file, const Result& result, const GaussianScanCheckpoint* checkpoint)
+{
+    if (!file.size_known)
+    {
+        return;  // Without a full identity the entry could never be matched again
+    }
+
+    Entry* entry = find_entry(file.path, settings_hash);
+    if (entry == nullptr)
+    {
+        entries[file.path].emplace_back();
+        entry = &entries[file.path].back();
+    }
+    entry->inode      = file.inode;
+    entry->size       = file.size;
+    entry->mtime_ns   = file.mtime_ns;
+    entry->settings   = settings_hash;
+    entry->result     = result;
+    entry->checkpoint = checkpoint != nullptr ? *checkpoint : GaussianScanCheckpoint{};
+    entry->seen       = true;
+    dirty             = true;
+}
+
+bool ResultCache::save()
+{
+    std::uint64_t count = 0;
+    for (const auto& [path, versions] : entries)
+    {
+        for (const auto& entry : versions)
+        {
+            count += entry.seen ? 1 : 0;
+        }
+    }
+    if (!dirty && count == loaded_count)
+    {
+        return true;
+    }
+
+    std::error_code ec;
+    if (cache_path.has_parent_path())
+    {
+        std::filesystem::create_directories(cache_path.parent_path(), ec);
+    }
+
+    std::filesystem::path temp_path = cache_path;
+    temp_path += ".tmp" + std::to_string(process_id());
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            return false;
+        }
+
+        write_value(out, MAGIC);
+        write_value(out, FORMAT_VERSION);
+        write_value(out, count);
+        for (const auto& [path, versions] : entries)
+        {
+            for (const auto& entry : versions)
+            {
+                if (!entry.seen)
+                    continue;
+                write_string(out, path);
+                write_value(out, entry.inode);
+                write_value(out, entry.size);
+                write_value(out, entry.mtime_ns);
+                write_value(out, entry.settings);
+                write_result_record(out, entry.result);
+                write_value(out, entry.checkpoint.offset);
+                if (entry.checkpoint.offset > 0)
+                {
+                    write_value(out, entry.checkpoint.fingerprint);
+                    write_scan_data(out, entry.checkpoint.data);
+                }
+            }
+        }
+
+        out.close();
+        if (!out)
+        {
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+
+    // rename() replaces the old cache in one step
+    std::filesystem::rename(temp_path, cache_path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    loaded_count = static_cast<size_t>(count);
+    dirty        = false;
+    return true;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file result_cache.h
+ * @brief Persistent cache of extraction results between extract runs
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Project directories are usually extracted many times while only a few new
+ * jobs appear between runs. The cache remembers the Result of every parsed
+ * file so that the next run only parses files that changed.
+ *
+ * @section Keys
+ * An entry is reused when the file path, inode, size and modification time
+ * (ns) all match and the entry was produced with the same settings hash. The
+ * hash covers the program version, the engine and every thermochemistry
+ * setting that changes the extracted values (T, P, C, the use-input flags,
+ * low-frequency method and ravib). Files that failed to parse are never
+ * cached, so their errors are reported again on every run. Parse warnings
+ * are only reported by the run that actually parses the file.
+ *
+ * @section Files
+ * The cache is the file ".cck_cache" in the working directory. When that
+ * directory is not writable, $XDG_CACHE_HOME/comchemkit (or ~/.cache/comchemkit)
+ * holds one file per directory, named after a hash of its path. The file
+ * starts with a magic number and format version; a file with another version,
+ * another byte order or a truncated record is ignored and rebuilt. It is
+ * rewritten through a temporary file and a rename, so readers never see a
+ * partial cache. Only entries of files found by the current run are kept.
+ *
+ * @section Growing Files
+ * For Gaussian logs of jobs that were still running (status UNDONE), the
+ * entry also keeps the scanner checkpoint (GaussianScanCheckpoint). When such
+ * a file has grown, find() misses but find_checkpoint() returns the state at
+ * the end of the previous run, and extract() only parses the appended bytes.
+ * cck check stores its running jobs in the same file under
+ * settings_hash_for_check(): the checkpoint offset marks how far the log was
+ * searched for "failed in PCMMkU", and its data is left empty.
+ */
+
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "extraction/gaussian_scanner.h"
+#include "extraction/qc_extractor.h"
+#include "utilities/file_discovery.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ResultCache
+ * @brief Result records keyed by file identity and extraction settings
+ *
+ * Not thread-safe: lookups and stores happen on the main thread before and
+ * after the parallel extraction.
+ */
+class ResultCache
+{
+private:
+    static constexpr std::uint64_t MAGIC          = 0x454843414b434343ULL;  ///< "CCKCACHE" in little endian
+    static constexpr std::uint32_t FORMAT_VERSION = 2;
+
+    struct Entry
+    {
+        std::uint64_t          inode    = 0;
+        std::uint64_t          size     = 0;
+        std::int64_t           mtime_ns = 0;
+        std::uint64_t          settings = 0;
+        Result                 result;
+        GaussianScanCheckpoint checkpoint;     ///< offset 0 unless the job was still running
+        bool                   seen = false;   ///< The file was found by the current run
+    };
+
+    std::filesystem::path                               cache_path;
+    std::uint64_t                                       settings_hash;
+    std::unordered_map<std::string, std::vector<Entry>> entries;  ///< By path; one entry per settings hash
+    size_t                                              loaded_count = 0;
+    size_t                                              hit_count    = 0;
+    size_t                                              miss_count   = 0;
+    bool                                                dirty        = false;
+
+    Entry* find_entry(const std::string& path, std::uint64_t settings);
+
+public:
+    /**
+     * @brief Create an empty cache bound to @p path
+     * @param path Cache file (see default_path())
+     * @param settings Settings hash of this run (see settings_hash_for())
+     */
+    ResultCache(std::filesystem::path path, std::uint64_t settings);
+
+    /**
+     * @brief Hash of everything besides the file itself that affects extract()
+     */
+    static std::uint64_t settings_hash_for(const ProcessingContext& context);
+
+    /**
+     * @brief Hash under which cck check keeps the search state of running jobs
+     */
+    static std::uint64_t settings_hash_for_check();
+
+    /**
+     * @brief Cache file for the current working directory
+     */
+    static std::filesystem::path default_path();
+
+    /**
+     * @brief Read the cache file
+     * @return false if it is missing or unusable (the cache then starts empty)
+     */
+    bool load();
+
+    /**
+     * @brief Cached result of @p entry, or nullptr if the file must be parsed
+     * @param file Discovered file with size, inode and mtime filled in (stat_file_entry())
+     */
+    const Result* find(const FileEntry& file);
+
+    /**
+     * @brief Scanner checkpoint left by an earlier run for @p file, if it has grown since
+     * @param file Discovered file with size, inode and mtime filled in
+     * @param checkpoint [out] Receives the checkpoint
+     * @return false if there is none (new file, other settings, finished job or not grown)
+     */
+    bool find_checkpoint(const FileEntry& file, GaussianScanCheckpoint& checkpoint);
+
+    /**
+     * @brief Remember the freshly extracted @p result of @p file
+     * @param checkpoint Scanner state to resume from next time, or nullptr
+     */
+    void store(const FileEntry& file, const Result& result, const GaussianScanCheckpoint* checkpoint = nullptr);
+
+    /**
+     * @brief Write the cache back if anything changed, atomically
+     * @return false if the file could not be written (the old cache is left in place)
+     */
+    bool save();
+
+    const std::filesystem::path& path() const
+    {
+        return cache_path;
+    }
+
+    size_t hits() const
+    {
+        return hit_count;
+    }
+
+    size_t misses() const
+    {
+        return miss_count;
+    }
+};
+
+#endif  // RESULT_CACHE_H
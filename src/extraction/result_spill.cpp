@@ -0,0 +1,224 @@
+/**
+ * @file result_spill.cpp
+ * @brief Implementation of the spill-to-disk result sorter
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "extraction/result_spill.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    // Run files hold raw records for this process only, so native byte order is fine
+
+    template <typename T>
+    void write_value(std::ostream& out, const T& value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool read_value(std::istream& in, T& value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    void write_string(std::ostream& out, std::string_view text)
+    {
+        write_value(out, static_cast<std::uint32_t>(text.size()));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    bool read_string(std::istream& in, std::string& text)
+    {
+        std::uint32_t length = 0;
+        if (!read_value(in, length))
+            return false;
+        text.resize(length);
+        return length == 0 || static_cast<bool>(in.read(&text[0], length));
+    }
+
+    long process_id()
+    {
+#ifdef _WIN32
+        return static_cast<long>(_getpid());
+#else
+        return static_cast<long>(getpid());
+#endif
+    }
+}  // namespace
+
+void write_result_record(std::ostream& out, const ResultRow& row)
+{
+    write_string(out, row.file_name);
+    write_value(out, row.etgkj);
+    write_value(out, row.lf);
+    write_value(out, row.GibbsFreeHartree);
+    write_value(out, row.nucleare);
+    write_value(out, row.scf);
+    write_value(out, row.zpe);
+    write_string(out, row.status);
+    write_string(out, row.phaseCorr);
+    write_value(out, row.copyright_count);
+}
+
+void write_result_record(std::ostream& out, const Result& result)
+{
+    write_result_record(out, result_row(result));
+}
+
+bool read_result_record(std::istream& in, Result& result)
+{
+    return read_string(in, result.file_name) && read_value(in, result.etgkj) && read_value(in, result.lf) &&
+           read_value(in, result.GibbsFreeHartree) && read_value(in, result.nucleare) &&
+           read_value(in, result.scf) && read_value(in, result.zpe) && read_string(in, result.status) &&
+           read_string(in, result.phaseCorr) && read_value(in, result.copyright_count);
+}
+
+ResultSpill::ResultSpill(int sort_column) : column(sort_column)
+{
+    static std::atomic<unsigned int> instance{0};
+
+    std::error_code ec;
+    auto            base = std::filesystem::temp_directory_path(ec);
+    if (ec)
+    {
+        base = std::filesystem::current_path();
+    }
+    directory = base / ("cck_spill_" + std::to_string(process_id()) + "_" + std::to_string(instance++));
+
+    std::filesystem::create_directories(directory, ec);
+    if (ec)
+    {
+        throw std::runtime_error("Cannot create spill directory " + directory.string() + ": " + ec.message());
+    }
+}
+
+ResultSpill::~ResultSpill()
+{
+    std::error_code ec;
+    std::filesystem::remove_all(directory, ec);
+}
+
+std::filesystem::path ResultSpill::next_run_path()
+{
+    return directory / ("run_" + std::to_string(next_id++) + ".bin");
+}
+
+void ResultSpill::add_run(ResultTable& results)
+{
+    if (results.empty())
+    {
+        return;
+    }
+
+    auto          path = next_run_path();
+    std::ofstream out(path, std::ios::binary);
+    for (std::uint32_t index : results.sorted_order(column))
+    {
+        write_result_record(out, results.row(index));
+    }
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write spill run " + path.string());
+    }
+
+    runs.push_back(path);
+    total += results.size();
+    results.clear();
+}
+
+void ResultSpill::merge_runs(const std::vector<std::filesystem::path>& inputs,
+                             const std::function<void(const Result&)>& sink) const
+{
+    struct Head
+    {
+        Result result;
+        size_t run;
+    };
+
+    int  sort_column = column;
+    auto later       = [sort_column](const Head& a, const Head& b) {
+        // Min-heap on the sort key; on ties the earlier run comes first
+        if (compareResults(b.result, a.result, sort_column))
+            return true;
+        if (compareResults(a.result, b.result, sort_column))
+            return false;
+        return a.run > b.run;
+    };
+
+    std::vector<std::unique_ptr<std::ifstream>>                 streams;
+    std::priority_queue<Head, std::vector<Head>, decltype(later)> heap(later);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        streams.push_back(std::make_unique<std::ifstream>(inputs[i], std::ios::binary));
+        if (!streams.back()->is_open())
+        {
+            throw std::runtime_error("Cannot open spill run " + inputs[i].string());
+        }
+        Head head{Result{}, i};
+        if (read_result_record(*streams.back(), head.result))
+        {
+            heap.push(std::move(head));
+        }
+    }
+
+    while (!heap.empty())
+    {
+        Head head = heap.top();
+        heap.pop();
+        sink(head.result);
+
+        if (read_result_record(*streams[head.run], head.result))
+        {
+            heap.push(std::move(head));
+        }
+    }
+}
+
+void ResultSpill::merge(const std::function<void(const Result&)>& sink)
+{
+    // Reduce the number of runs until one final merge can keep them all open
+    while (runs.size() > MAX_MERGE_FANIN)
+    {
+        std::vector<std::filesystem::path> merged_runs;
+        for (size_t start = 0; start < runs.size(); start += MAX_MERGE_FANIN)
+        {
+            size_t end = std::min(start + MAX_MERGE_FANIN, runs.size());
+            std::vector<std::filesystem::path> group(runs.begin() + start, runs.begin() + end);
+
+            auto          path = next_run_path();
+            std::ofstream out(path, std::ios::binary);
+            merge_runs(group, [&out](const Result& result) { write_result_record(out, result); });
+            out.close();
+            if (!out)
+            {
+                throw std::runtime_error("Failed to write spill run " + path.string());
+            }
+
+            std::error_code ec;
+            for (const auto& run : group)
+            {
+                std::filesystem::remove(run, ec);
+            }
+            merged_runs.push_back(path);
+        }
+        runs = std::move(merged_runs);
+    }
+
+    merge_runs(runs, sink);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file result_spill.h
+ * @brief Sorted on-disk runs of extraction results and their k-way merge
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * With --batch-size, extract processes a directory one batch of files at a
+ * time. Each batch of results is sorted on the requested column and written
+ * to a temporary run file, then dropped from memory. When all batches are
+ * done the runs are merged (k-way, through a min-heap) straight into the
+ * .results/.csv writer, so peak memory depends on the batch size and not on
+ * the number of files.
+ *
+ * @section Ordering
+ * Runs are sorted with std::stable_sort and ties during the merge go to the
+ * earlier run, so the merged order equals a stable sort of all results in
+ * batch order.
+ *
+ * @section Files
+ * Runs live in a private directory under std::filesystem::temp_directory_path()
+ * (honours TMPDIR), which is removed by the destructor. When more runs exist
+ * than MAX_MERGE_FANIN, groups of runs are first merged into larger runs so
+ * that the number of simultaneously open files stays bounded.
+ */
+
+#ifndef RESULT_SPILL_H
+#define RESULT_SPILL_H
+
+#include "extraction/qc_extractor.h"
+#include "extraction/result_table.h"
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Append @p result to a binary record stream (spill runs, result cache)
+ *
+ * Records use native byte order and are only meant to be read back on the
+ * same machine.
+ */
+void write_result_record(std::ostream& out, const ResultRow& row);
+
+/**
+ * @brief Append @p result to a binary record stream
+ */
+void write_result_record(std::ostream& out, const Result& result);
+
+/**
+ * @brief Read one record written by write_result_record()
+ * @return false at the end of the stream or on a truncated record
+ */
+bool read_result_record(std::istream& in, Result& result);
+
+/**
+ * @class ResultSpill
+ * @brief Spill-to-disk sorter for Result records
+ */
+class ResultSpill
+{
+private:
+    static constexpr size_t MAX_MERGE_FANIN = 64;  ///< Runs merged (and files open) at once
+
+    int                                column;
+    std::filesystem::path              directory;
+    std::vector<std::filesystem::path> runs;
+    size_t                             total   = 0;
+    size_t                             next_id = 0;
+
+    std::filesystem::path next_run_path();
+    void                  merge_runs(const std::vector<std::filesystem::path>& inputs,
+                                     const std::function<void(const Result&)>& sink) const;
+
+public:
+    /**
+     * @brief Create an empty spill for results sorted on @p sort_column
+     * @param sort_column Column as passed to compareResults()
+     * @throws std::runtime_error if the temporary directory cannot be created
+     */
+    explicit ResultSpill(int sort_column);
+
+    /**
+     * @brief Remove all run files
+     */
+    ~ResultSpill();
+
+    ResultSpill(const ResultSpill&)            = delete;
+    ResultSpill& operator=(const ResultSpill&) = delete;
+
+    /**
+     * @brief Write the rows of @p results as one sorted run; @p results is cleared
+     * @throws std::runtime_error on write errors
+     */
+    void add_run(ResultTable& results);
+
+    /**
+     * @brief Number of results written so far
+     */
+    size_t size() const
+    {
+        return total;
+    }
+
+    /**
+     * @brief Number of run files written so far
+     */
+    size_t run_count() const
+    {
+        return runs.size();
+    }
+
+    /**
+     * @brief Deliver all results in sorted order
+     * @param sink Called once per result
+     * @throws std::runtime_error on read errors
+     */
+    void merge(const std::function<void(const Result&)>& sink);
+};
+
+#endif  // RESULT_SPILL_H
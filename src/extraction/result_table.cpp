@@ -0,0 +1,300 @@
+/**
+ * @file result_table.cpp
+ * @brief Implementation of the column-oriented result table
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "extraction/result_table.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/profiler.h"
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+
+ResultRow result_row(const Result& result)
+{
+    return ResultRow{result.file_name, result.etgkj, result.lf,     result.GibbsFreeHartree, result.nucleare,
+                     result.scf,       result.zpe,   result.status, result.phaseCorr,        result.copyright_count};
+}
+
+void ResultTable::append_name(std::string_view name)
+{
+    if (names.size() + name.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::length_error("ResultTable: file name storage exceeds 4 GB");
+    }
+    names.append(name.data(), name.size());
+    name_end.push_back(static_cast<std::uint32_t>(names.size()));
+}
+
+void ResultTable::reserve(size_t rows, size_t name_bytes)
+{
+    names.reserve(name_bytes);
+    name_end.reserve(rows);
+    etgkj.reserve(rows);
+    lf.reserve(rows);
+    gibbs.reserve(rows);
+    nucleare.reserve(rows);
+    scf.reserve(rows);
+    zpe.reserve(rows);
+    copyright_count.reserve(rows);
+    status.reserve(rows);
+    phase_corr.reserve(rows);
+}
+
+void ResultTable::append(const Result& result)
+{
+    append_name(result.file_name);
+    etgkj.push_back(result.etgkj);
+    lf.push_back(result.lf);
+    gibbs.push_back(result.GibbsFreeHartree);
+    nucleare.push_back(result.nucleare);
+    scf.push_back(result.scf);
+    zpe.push_back(result.zpe);
+    copyright_count.push_back(result.copyright_count);
+    status.push_back(status_code(result.status));
+    phase_corr.push_back(result.phaseCorr == "YES" ? 1 : 0);
+}
+
+void ResultTable::append(const ResultTable& other)
+{
+    if (names.size() + other.names.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::length_error("ResultTable: file name storage exceeds 4 GB");
+    }
+
+    auto base = static_cast<std::uint32_t>(names.size());
+    names.append(other.names);
+    for (std::uint32_t end : other.name_end)
+    {
+        name_end.push_back(base + end);
+    }
+
+    etgkj.insert(etgkj.end(), other.etgkj.begin(), other.etgkj.end());
+    lf.insert(lf.end(), other.lf.begin(), other.lf.end());
+    gibbs.insert(gibbs.end(), other.gibbs.begin(), other.gibbs.end());
+    nucleare.insert(nucleare.end(), other.nucleare.begin(), other.nucleare.end());
+    scf.insert(scf.end(), other.scf.begin(), other.scf.end());
+    zpe.insert(zpe.end(), other.zpe.begin(), other.zpe.end());
+    copyright_count.insert(copyright_count.end(), other.copyright_count.begin(), other.copyright_count.end());
+    status.insert(status.end(), other.status.begin(), other.status.end());
+    phase_corr.insert(phase_corr.end(), other.phase_corr.begin(), other.phase_corr.end());
+}
+
+void ResultTable::clear()
+{
+    *this = ResultTable();
+}
+
+ResultRow ResultTable::row(size_t index) const
+{
+    std::uint32_t begin = index == 0 ? 0 : name_end[index - 1];
+    return ResultRow{std::string_view(names).substr(begin, name_end[index] - begin),
+                     etgkj[index],
+                     lf[index],
+                     gibbs[index],
+                     nucleare[index],
+                     scf[index],
+                     zpe[index],
+                     status_text(status[index]),
+                     phase_corr[index] ? "YES" : "NO",
+                     copyright_count[index]};
+}
+
+Result ResultTable::result(size_t index) const
+{
+    ResultRow view = row(index);
+    return Result{std::string(view.file_name),
+                  view.etgkj,
+                  view.lf,
+                  view.GibbsFreeHartree,
+                  view.nucleare,
+                  view.scf,
+                  view.zpe,
+                  std::string(view.status),
+                  std::string(view.phaseCorr),
+                  view.copyright_count};
+}
+
+std::vector<std::uint32_t> ResultTable::sorted_order(int column, unsigned int threads) const
+{
+    ProfileScope               profile(ProfileStage::SORT);
+    std::vector<std::uint32_t> order(size());
+    std::iota(order.begin(), order.end(), 0u);
+
+    // Same keys as compareResults(); other columns have no order
+    std::vector<double> key;
+    switch (column)
+    {
+        case 2:
+            key = etgkj;
+            break;
+        case 3:
+            key = lf;
+            break;
+        case 4:
+            key = gibbs;
+            break;
+        case 5:
+            key = nucleare;
+            break;
+        case 6:
+            key = scf;
+            break;
+        case 7:
+            key = zpe;
+            break;
+        case 10:
+            key.assign(copyright_count.begin(), copyright_count.end());
+            break;
+        default:
+            return order;
+    }
+
+    auto by_key = [&key](std::uint32_t a, std::uint32_t b) { return key[a] < key[b]; };
+
+    size_t chunks = 1;
+    if (threads > 1 && order.size() >= PARALLEL_SORT_ROWS)
+    {
+        chunks = std::min<size_t>(threads, order.size() / (PARALLEL_SORT_ROWS / 4));
+    }
+    if (chunks <= 1)
+    {
+        std::stable_sort(order.begin(), order.end(), by_key);
+        return order;
+    }
+
+    // Sort equal slices in parallel, then merge neighbours pairwise; merging the
+    // left slice first keeps the result stable
+    std::vector<size_t> bounds(chunks + 1);
+    for (size_t c = 0; c <= chunks; ++c)
+    {
+        bounds[c] = order.size() * c / chunks;
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        workers.emplace_back([&, c]() {
+            std::stable_sort(order.begin() + bounds[c], order.begin() + bounds[c + 1], by_key);
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (size_t width = 1; width < chunks; width *= 2)
+    {
+        workers.clear();
+        for (size_t c = 0; c + width < chunks; c += 2 * width)
+        {
+            size_t first  = bounds[c];
+            size_t middle = bounds[c + width];
+            size_t last   = bounds[std::min(c + 2 * width, chunks)];
+            workers.emplace_back([&order, &by_key, first, middle, last]() {
+                std::inplace_merge(order.begin() + first, order.begin() + middle, order.begin() + last, by_key);
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+    return order;
+}
+
+size_t ResultTable::memory_bytes() const
+{
+    return names.capacity() + name_end.capacity() * sizeof(std::uint32_t) +
+           (etgkj.capacity() + lf.capacity() + gibbs.capacity() + nucleare.capacity() + scf.capacity() +
+            zpe.capacity()) * sizeof(double) +
+           copyright_count.capacity() * sizeof(int) + status.capacity() * sizeof(ResultStatus) +
+           phase_corr.capacity();
+}
+
+std::string_view ResultTable::status_text(ResultStatus code)
+{
+    switch (code)
+    {
+        case ResultStatus::DONE:
+            return "DONE";
+        case ResultStatus::ERROR:
+            return "ERROR";
+        default:
+            return "UNDONE";
+    }
+}
+
+ResultStatus ResultTable::status_code(std::string_view text)
+{
+    if (text == "DONE")
+        return ResultStatus::DONE;
+    if (text == "ERROR")
+        return ResultStatus::ERROR;
+    return ResultStatus::UNDONE;
+}
+
+void write_result_header(std::ostream& out, const std::string& format)
+{
+    if (format == "csv")
+    {
+        out << "Output name,ETG kJ/mol,Low FC,ETG a.u,Nuclear E au,SCFE,ZPE,Status,PCorr,Round\n";
+        return;
+    }
+
+    out << std::setw(53) << std::left << "Output name" << std::setw(18) << std::right << "ETG kJ/mol" << std::setw(10)
+        << std::right << "Low FC" << std::setw(18) << std::right << "ETG a.u" << std::setw(18) << std::right
+        << "Nuclear E au" << std::setw(18) << std::right << "SCFE" << std::setw(10) << std::right << "ZPE "
+        << std::setw(8) << std::right << "Status" << std::setw(6) << std::right << "PCorr" << std::setw(6)
+        << std::right << "Round" << "\n";
+
+    out << std::setw(53) << std::left << std::string(53, '-') << std::setw(18) << std::right << std::string(18, '-')
+        << std::setw(10) << std::right << std::string(10, '-') << std::setw(18) << std::right
+        << std::string(18, '-') << std::setw(18) << std::right << std::string(18, '-') << std::setw(18)
+        << std::right << std::string(18, '-') << std::setw(10) << std::right << std::string(10, '-')
+        << std::setw(8) << std::right << std::string(8, '-') << std::setw(6) << std::right << std::string(6, '-')
+        << std::setw(6) << std::right << std::string(6, '-') << "\n";
+}
+
+void write_result_row(std::ostream& out, const ResultRow& result, const std::string& format)
+{
+    if (format == "csv")
+    {
+        out << "\"" << result.file_name << "\"," << std::fixed << std::setprecision(6) << result.etgkj << ","
+            << std::fixed << std::setprecision(2) << result.lf << "," << std::fixed << std::setprecision(6)
+            << result.GibbsFreeHartree << "," << std::fixed << std::setprecision(6) << result.nucleare << ","
+            << std::fixed << std::setprecision(6) << result.scf << "," << std::fixed << std::setprecision(6)
+            << result.zpe << "," << result.status << "," << result.phaseCorr << "," << result.copyright_count
+            << "\n";
+        return;
+    }
+
+    out << std::setw(53) << std::left << result.file_name << std::setw(18) << std::right << std::fixed
+        << std::setprecision(6) << result.etgkj << std::setw(10) << std::right << std::fixed << std::setprecision(2)
+        << result.lf << std::setw(18) << std::right << std::fixed << std::setprecision(6) << result.GibbsFreeHartree
+        << std::setw(18) << std::right << std::fixed << std::setprecision(6) << result.nucleare << std::setw(18)
+        << std::right << std::fixed << std::setprecision(6) << result.scf << std::setw(10) << std::right
+        << std::fixed << std::setprecision(6) << result.zpe << std::setw(8) << std::right << result.status
+        << std::setw(6) << std::right << result.phaseCorr << std::setw(6) << std::right << result.copyright_count
+        << "\n";
+}
+
+void write_result_json(JsonLine& line, const ResultRow& result)
+{
+    line.field("name", result.file_name)
+        .field("etgkj", result.etgkj)
+        .field("lf", result.lf)
+        .field("gibbs", result.GibbsFreeHartree)
+        .field("nucleare", result.nucleare)
+        .field("scf", result.scf)
+        .field("zpe", result.zpe)
+        .field("status", result.status)
+        .field("pcorr", result.phaseCorr)
+        .field("round", result.copyright_count);
+}
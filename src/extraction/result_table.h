@@ -0,0 +1,181 @@
+/**
+ * @file result_table.h
+ * @brief Column-oriented storage for extraction results
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * A Result row owns three std::string objects (file name, status and phase
+ * correction flag), which costs more than the six doubles it carries once a
+ * directory holds hundreds of thousands of logs. ResultTable keeps the same
+ * data as a struct of arrays:
+ * - one contiguous vector per numeric column,
+ * - status and phase correction as one-byte codes,
+ * - all file names back to back in a single character arena.
+ *
+ * Sorting never moves rows: sorted_order() copies the sort column into a key
+ * vector and stable-sorts a permutation of row indices on it, in parallel
+ * chunks for large tables. The writers walk the table in that order.
+ */
+
+#ifndef RESULT_TABLE_H
+#define RESULT_TABLE_H
+
+#include "extraction/qc_extractor.h"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class JsonLine;
+
+/**
+ * @enum ResultStatus
+ * @brief Job status of a result ("DONE", "UNDONE" or "ERROR" in the output)
+ */
+enum class ResultStatus : std::uint8_t
+{
+    DONE,
+    UNDONE,
+    ERROR
+};
+
+/**
+ * @struct ResultRow
+ * @brief Non-owning view of one result, as read by the output writers
+ *
+ * Valid as long as the table (or Result) it was taken from is not modified.
+ */
+struct ResultRow
+{
+    std::string_view file_name;
+    double           etgkj;
+    double           lf;
+    double           GibbsFreeHartree;
+    double           nucleare;
+    double           scf;
+    double           zpe;
+    std::string_view status;
+    std::string_view phaseCorr;
+    int              copyright_count;
+};
+
+/**
+ * @brief View of a Result as a ResultRow
+ */
+ResultRow result_row(const Result& result);
+
+/**
+ * @brief Write the column header of the result table
+ * @param format "csv" for comma-separated values, anything else for the fixed-width text table
+ */
+void write_result_header(std::ostream& out, const std::string& format);
+
+/**
+ * @brief Write one result line in the format of write_result_header()
+ */
+void write_result_row(std::ostream& out, const ResultRow& result, const std::string& format);
+
+/**
+ * @brief Add the columns of @p result to a JSON line, under the column names of `cck query`
+ */
+void write_result_json(JsonLine& line, const ResultRow& result);
+
+/**
+ * @class ResultTable
+ * @brief Struct-of-arrays table of extraction results
+ *
+ * Not thread-safe for writing; workers fill their own tables and the main
+ * thread appends them.
+ */
+class ResultTable
+{
+private:
+    /// Tables with at least this many rows are sorted on several threads
+    static constexpr size_t PARALLEL_SORT_ROWS = 65536;
+
+    std::string                names;     ///< All file names, back to back
+    std::vector<std::uint32_t> name_end;  ///< End of each name in names
+    std::vector<double>        etgkj;
+    std::vector<double>        lf;
+    std::vector<double>        gibbs;
+    std::vector<double>        nucleare;
+    std::vector<double>        scf;
+    std::vector<double>        zpe;
+    std::vector<int>           copyright_count;
+    std::vector<ResultStatus>  status;
+    std::vector<std::uint8_t>  phase_corr;  ///< 1 for "YES"
+
+    void append_name(std::string_view name);
+
+public:
+    /**
+     * @brief Reserve room for @p rows rows and @p name_bytes bytes of file names
+     */
+    void reserve(size_t rows, size_t name_bytes = 0);
+
+    /**
+     * @brief Append one result
+     * @throws std::length_error if the name arena would exceed 4 GB
+     */
+    void append(const Result& result);
+
+    /**
+     * @brief Append all rows of @p other
+     * @throws std::length_error if the name arena would exceed 4 GB
+     */
+    void append(const ResultTable& other);
+
+    /**
+     * @brief Remove all rows and release the memory
+     */
+    void clear();
+
+    size_t size() const
+    {
+        return name_end.size();
+    }
+
+    bool empty() const
+    {
+        return name_end.empty();
+    }
+
+    /**
+     * @brief View of row @p index
+     */
+    ResultRow row(size_t index) const;
+
+    /**
+     * @brief Copy of row @p index as a Result (for the spill and cache formats)
+     */
+    Result result(size_t index) const;
+
+    /**
+     * @brief Row indices in the order of compareResults() on @p column
+     * @param column Sort column as passed to compareResults(); columns without
+     *               a key keep the insertion order
+     * @param threads Threads to use for tables of PARALLEL_SORT_ROWS rows or more
+     *
+     * The sort is stable, so equal keys keep their insertion order.
+     */
+    std::vector<std::uint32_t> sorted_order(int column, unsigned int threads = 1) const;
+
+    /**
+     * @brief Heap bytes held by the table
+     */
+    size_t memory_bytes() const;
+
+    /**
+     * @brief Output text of a status code
+     */
+    static std::string_view status_text(ResultStatus code);
+
+    /**
+     * @brief Status code of an output text; extract() only produces "DONE", "UNDONE" and "ERROR"
+     */
+    static ResultStatus status_code(std::string_view text);
+};
+
+#endif  // RESULT_TABLE_H
@@ -1,7 +1,13 @@
 #include "high_level/high_level_energy.h"
+#include "extraction/gaussian_archive.h"
 #include "extraction/qc_extractor.h"
 #include "thermo/thermo.h"
+#include "utilities/mapped_file.h"
 #include "utilities/metadata.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/parse_stats.h"
+#include "utilities/profiler.h"
+#include "utilities/trace_recorder.h"
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -12,6 +18,7 @@
 #include <iomanip>
 #include <iostream>
 #include <mutex>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <thread>
@@ -195,6 +202,19 @@ public:
         return content;
     }
 
+    /// Drop the content of @p filename once its calculation is done
+    void release(const std::string& filename)
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+
+        auto it = cache_.find(filename);
+        if (it != cache_.end())
+        {
+            current_size_bytes_ -= it->second.size();
+            cache_.erase(it);
+        }
+    }
+
     void clear()
     {
         std::lock_guard<std::mutex> lock(cache_mutex_);
@@ -257,43 +277,57 @@ HighLevelEnergyCalculator::HighLevelEnergyCalculator(std::shared_ptr<ProcessingC
 HighLevelEnergyData HighLevelEnergyCalculator::calculate_high_level_energy(const std::string& high_level_file)
 {
     HighLevelEnergyData data(high_level_file);
+    TraceSpan           file_span("file", "file", high_level_file);
+    ProfileScope        file_profile(ProfileStage::FILE);
+    CCK_STAT_FILE(high_level_file);
+    const std::string   parent_file = get_parent_file(high_level_file);
 
     try
     {
-        // Memory guard for large calculations
-        struct MemoryGuard
+        if (Profiler::instance().enabled() || TraceRecorder::instance().enabled())
         {
-            std::shared_ptr<MemoryMonitor> monitor;
-            size_t                         bytes;
-            MemoryGuard(std::shared_ptr<MemoryMonitor> m, size_t b) : monitor(m), bytes(b)
-            {
-                if (monitor)
-                    monitor->add_usage(bytes);
-            }
-            ~MemoryGuard()
+            std::error_code size_error;
+            std::uintmax_t  file_size = std::filesystem::file_size(high_level_file, size_error);
+            file_profile.add_bytes(size_error ? 0 : static_cast<std::uint64_t>(file_size));
+            file_span.add_bytes(size_error ? 0 : static_cast<std::uint64_t>(file_size));
+        }
+
+        // Both logs are held in g_file_cache, and each read hands out a copy of
+        // the cached content; this single reservation charges all of it and waits
+        // while the memory budget is exhausted
+        std::optional<ProfileScope> stage(std::in_place, ProfileStage::READ);
+        auto                        size_of = [](const std::string& path) -> size_t {
+            std::error_code size_error;
+            std::uintmax_t  bytes = std::filesystem::file_size(path, size_error);
+            return size_error ? 0 : static_cast<size_t>(bytes);
+        };
+        MemoryReservation memory_reservation(has_context_ ? context_->memory_monitor : nullptr,
+                                             2 * (size_of(high_level_file) + size_of(parent_file)));
+        // Cached content must not outlive the reservation that charges it
+        struct CacheRelease
+        {
+            const std::string& high_level;
+            const std::string& parent;
+            ~CacheRelease()
             {
-                if (monitor)
-                    monitor->remove_usage(bytes);
+                g_file_cache.release(high_level);
+                g_file_cache.release(parent);
             }
-        };
+        } cache_release{high_level_file, parent_file};
+        stage.reset();
+        stage.emplace(ProfileStage::PARSE);
 
-        std::unique_ptr<MemoryGuard> memory_guard;
-        if (has_context_ && context_->memory_monitor)
+        // Extract high-level electronic energies from current directory file
+        bool from_archive = use_archive_ && extract_high_level_from_archive(high_level_file, data);
+        if (!from_archive)
         {
-            if (!context_->memory_monitor->can_allocate(10 * 1024 * 1024))
-            {  // 10MB safety check
-                throw std::runtime_error("Insufficient memory to process " + high_level_file);
-            }
-            memory_guard = std::make_unique<MemoryGuard>(context_->memory_monitor, 10 * 1024 * 1024);
+            data.scf_high    = extract_value_from_file(high_level_file, "SCF Done", 5, -1);
+            data.scf_td_high = extract_value_from_file(high_level_file, "Total Energy, E\\(CIS", 5, -1, false);
+            data.scf_equi_high =
+                extract_value_from_file(high_level_file, "After PCM corrections, the energy is", 7, -1, false);
+            data.scf_clr_high = extract_value_from_file(high_level_file, "Total energy after correction", 6, -1, false);
         }
 
-        // Extract high-level electronic energies from current directory file
-        data.scf_high    = extract_value_from_file(high_level_file, "SCF Done", 5, -1);
-        data.scf_td_high = extract_value_from_file(high_level_file, "Total Energy, E\\(CIS", 5, -1, false);
-        data.scf_equi_high =
-            extract_value_from_file(high_level_file, "After PCM corrections, the energy is", 7, -1, false);
-        data.scf_clr_high = extract_value_from_file(high_level_file, "Total energy after correction", 6, -1, false);
-
         // Determine final high-level electronic energy (priority order from bash script)
         if (data.scf_equi_high != 0.0)
         {
@@ -316,7 +350,6 @@ HighLevelEnergyData HighLevelEnergyCalculator::calculate_high_level_energy(const
         // When the user explicitly specified -t or -c, use the thermo module to recalculate
         // thermal corrections (tc_gibbs, tc_enthalpy, zpe) at the user-specified temperature.
         // Without those flags, read pre-calculated values directly from the Gaussian log.
-        std::string parent_file = get_parent_file(high_level_file);
         bool used_thermo_path = (use_input_temp_ || use_input_concentration_);
         if (used_thermo_path)
         {
@@ -342,8 +375,11 @@ HighLevelEnergyData HighLevelEnergyCalculator::calculate_high_level_energy(const
         data.gibbs_hartree    = data.final_scf_high + data.tc_gibbs;
 
         // Check for SCRF and apply phase correction
-        std::string file_content = has_context_ ? safe_read_file(high_level_file) : read_file_content(high_level_file);
-        data.has_scrf            = (file_content.find("scrf") != std::string::npos);
+        if (!from_archive)
+        {
+            std::string file_content = read_file_content(high_level_file);
+            data.has_scrf            = (file_content.find("scrf") != std::string::npos);
+        }
 
         if (data.has_scrf)
         {
@@ -367,7 +403,10 @@ HighLevelEnergyData HighLevelEnergyCalculator::calculate_high_level_energy(const
         {
             data.lowest_frequency = extract_lowest_frequency(parent_file);
         }
-        data.status = determine_job_status(high_level_file);
+        if (!from_archive)
+        {
+            data.status = determine_job_status(high_level_file);
+        }
 
         // Validate final data
         if (has_context_ && !HighLevelEnergyUtils::validate_energy_data(data))
@@ -419,13 +458,15 @@ std::vector<HighLevelEnergyData> HighLevelEnergyCalculator::process_directory(co
             log_files = findLogFiles(effective_extension, effective_max_file_size_mb);
         }
 
-        for (const auto& file : log_files)
+        for (size_t i = 0; i < log_files.size(); ++i)
         {
-            auto data = calculate_high_level_energy(file);
+            auto data = calculate_high_level_energy(log_files[i]);
+            emit_row(i, data);
             results.push_back(data);
         }
 
         // Sort by specified column
+        ProfileScope profile(ProfileStage::SORT);
         std::sort(results.begin(), results.end(), [this](const HighLevelEnergyData& a, const HighLevelEnergyData& b) {
             return compare_results(a, b, sort_column_);
         });
@@ -548,19 +589,21 @@ HighLevelEnergyCalculator::process_files_with_limits(const std::vector<std::stri
     if (thread_count <= 1)
     {
         // Fall back to sequential processing
-        for (const auto& file : files)
+        for (size_t i = 0; i < files.size(); ++i)
         {
             try
             {
-                auto data = calculate_high_level_energy(file);
+                auto data = calculate_high_level_energy(files[i]);
+                emit_row(i, data);
                 results.push_back(data);
             }
             catch (const std::exception& e)
             {
                 if (has_context_ && context_->error_collector)
                 {
-                    context_->error_collector->add_error("Failed to process " + file + ": " + e.what());
+                    context_->error_collector->add_error("Failed to process " + files[i] + ": " + e.what());
                 }
+                emit_row(i, HighLevelEnergyData(files[i]), e.what());
             }
         }
     }
@@ -655,6 +698,7 @@ HighLevelEnergyCalculator::process_files_with_limits(const std::vector<std::stri
     }
 
     // Sort results by specified column
+    ProfileScope profile(ProfileStage::SORT);
     std::sort(results.begin(), results.end(), [this](const HighLevelEnergyData& a, const HighLevelEnergyData& b) {
         return compare_results(a, b, sort_column_);
     });
@@ -839,6 +883,12 @@ double HighLevelEnergyCalculator::extract_value_from_file(const std::string& fil
             }
         }
 
+        // Every call is a full pass over the (cached) content with one regex evaluation per line
+        CCK_STAT_BYTES(file_content.size());
+        CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(file_content.begin(), file_content.end(), '\n')));
+        CCK_STAT_REGEX(static_cast<std::uint64_t>(std::count(file_content.begin(), file_content.end(), '\n')));
+        CCK_STAT_HIT(pattern, matches.size());
+
         if (matches.empty())
         {
             if (warn_if_missing && has_context_ && context_->error_collector)
@@ -1064,41 +1114,91 @@ std::string HighLevelEnergyCalculator::determine_job_status(const std::string& f
 {
     try
     {
-        std::string tail_content = read_file_tail(filename, 10);
+        return determine_job_status_from_tail(read_file_tail(filename, 10));
+    }
+    catch (const std::exception& e)
+    {
+        return "UNKNOWN";
+    }
+}
 
-        if (tail_content.find("Normal") != std::string::npos)
-        {
-            return "DONE";
-        }
+std::string HighLevelEnergyCalculator::determine_job_status_from_tail(const std::string& tail_content)
+{
+    if (tail_content.find("Normal") != std::string::npos)
+    {
+        return "DONE";
+    }
 
-        // Check for error patterns
-        bool has_error    = false;
-        bool has_error_on = false;
+    // Check for error patterns
+    bool has_error    = false;
+    bool has_error_on = false;
 
-        std::istringstream iss(tail_content);
-        std::string        line;
-        while (std::getline(iss, line))
+    std::istringstream iss(tail_content);
+    std::string        line;
+    while (std::getline(iss, line))
+    {
+        if (line.find("Error") != std::string::npos)
         {
-            if (line.find("Error") != std::string::npos)
+            has_error = true;
+            if (line.find("Error on") != std::string::npos)
             {
-                has_error = true;
-                if (line.find("Error on") != std::string::npos)
-                {
-                    has_error_on = true;
-                }
+                has_error_on = true;
             }
         }
+    }
 
-        if (has_error && !has_error_on)
+    if (has_error && !has_error_on)
+    {
+        return "ERROR";
+    }
+
+    return "UNDONE";
+}
+
+bool HighLevelEnergyCalculator::extract_high_level_from_archive(const std::string&   high_level_file,
+                                                                HighLevelEnergyData& data)
+{
+    try
+    {
+        MappedFile      mapped(high_level_file);
+        GaussianArchive archive;
+        double          hf = 0.0;
+        if (!find_gaussian_archive(mapped.view(), archive) || archive.needs_full_parse() || !archive.get("HF", hf))
         {
-            return "ERROR";
+            return false;
         }
 
-        return "UNDONE";
+        data.scf_high      = hf;
+        data.scf_td_high   = 0.0;
+        data.scf_equi_high = 0.0;
+        data.scf_clr_high  = 0.0;
+        data.has_scrf      = archive.route_has("scrf");
+
+        // Last 10 lines, as read_file_tail() returns them
+        std::string_view text = mapped.view();
+        if (!text.empty() && text.back() == '\n')
+        {
+            text.remove_suffix(1);
+        }
+        size_t begin = text.size();
+        for (int lines = 0; lines < 10; ++lines)
+        {
+            size_t nl = begin == 0 ? std::string_view::npos : text.rfind('\n', begin - 1);
+            if (nl == std::string_view::npos)
+            {
+                begin = 0;
+                break;
+            }
+            begin = (lines == 9) ? nl + 1 : nl;
+        }
+        std::string tail(text.substr(begin));
+        tail += '\n';
+        data.status = determine_job_status_from_tail(tail);
+        return true;
     }
-    catch (const std::exception& e)
+    catch (const std::exception&)
     {
-        return "UNKNOWN";
+        return false;
     }
 }
 
@@ -1561,25 +1661,15 @@ void HighLevelEnergyCalculator::process_files_worker(const std::vector<std::stri
     {
         try
         {
-            // Memory check before processing
-            if (has_context_ && context_->memory_monitor)
-            {
-                if (!context_->memory_monitor->can_allocate(50 * 1024 * 1024))
-                {  // 50MB safety margin
-                    if (context_->error_collector)
-                    {
-                        context_->error_collector->add_warning("Memory limit reached, skipping " + files[i]);
-                    }
-                    continue;
-                }
-            }
-
-            // Process the file
+            // Process the file (waits for memory inside instead of skipping it)
             auto data = calculate_high_level_energy(files[i]);
+            emit_row(i, data);
 
             // Thread-safe result storage
             {
+                TraceSpan                   wait("wait", "wait results lock");
                 std::lock_guard<std::mutex> lock(results_mutex);
+                wait.end();
                 if (i < results.size())
                 {
                     results[i] = data;
@@ -1592,10 +1682,13 @@ void HighLevelEnergyCalculator::process_files_worker(const std::vector<std::stri
             {
                 context_->error_collector->add_error("Worker failed to process " + files[i] + ": " + e.what());
             }
+            emit_row(i, HighLevelEnergyData(files[i]), e.what());
 
             // Store empty result to maintain indexing
             {
+                TraceSpan                   wait("wait", "wait results lock");
                 std::lock_guard<std::mutex> lock(results_mutex);
+                wait.end();
                 if (i < results.size())
                 {
                     results[i]        = HighLevelEnergyData(files[i]);
@@ -1767,18 +1860,8 @@ std::string HighLevelEnergyCalculator::safe_read_file(const std::string& filenam
             file_size = max_size_bytes;
         }
 
-        // Memory allocation check
-        if (has_context_ && context_->memory_monitor)
-        {
-            if (!context_->memory_monitor->can_allocate(file_size))
-            {
-                if (context_->error_collector)
-                {
-                    context_->error_collector->add_error("Insufficient memory to read file: " + filename);
-                }
-                return content;
-            }
-        }
+        // Charge the read buffer; waits while other workers hold the memory budget
+        MemoryReservation memory_reservation(has_context_ ? context_->memory_monitor : nullptr, file_size);
 
         // File handle management
         if (has_context_ && context_->file_manager)
@@ -1908,6 +1991,47 @@ bool HighLevelEnergyCalculator::validate_processing_context()
     }
 }
 
+// One JSON line per file, with the columns of the kJ or AU table
+void HighLevelEnergyCalculator::emit_row(size_t seq, const HighLevelEnergyData& data, const std::string& error) const
+{
+    if (row_stream_ == nullptr)
+    {
+        return;
+    }
+
+    JsonLine line;
+    line.field("seq", static_cast<std::uint64_t>(seq)).field("file", data.filename);
+    if (!error.empty())
+    {
+        line.field("status", "ERROR").field("error", error);
+    }
+    else if (is_au_format_)
+    {
+        line.field("status", data.status)
+            .field("e_high", data.final_scf_high)
+            .field("e_low", data.final_scf_low)
+            .field("zpe", data.zpe)
+            .field("tc", data.tc_only)
+            .field("ts", data.ts_value)
+            .field("h", data.enthalpy_hartree)
+            .field("gibbs", data.gibbs_hartree_corrected)
+            .field("lf", data.lowest_frequency)
+            .field("pcorr", data.phase_corr_applied)
+            .field("temperature", data.temperature);
+    }
+    else
+    {
+        line.field("status", data.status)
+            .field("gibbs_kj_mol", data.gibbs_kj_mol)
+            .field("gibbs", data.gibbs_hartree_corrected)
+            .field("gibbs_ev", data.gibbs_ev)
+            .field("lf", data.lowest_frequency)
+            .field("pcorr", data.phase_corr_applied)
+            .field("temperature", data.temperature);
+    }
+    row_stream_->write(line);
+}
+
 // Comparison function for sorting based on visual column numbers
 bool HighLevelEnergyCalculator::compare_results(const HighLevelEnergyData& a, const HighLevelEnergyData& b, int column)
 {
@@ -2216,6 +2340,7 @@ HighLevelEnergyCalculator::process_files_with_thread_pool(const std::vector<std:
             {
                 // Process with cached file reading
                 results[idx] = calculate_high_level_energy(files[idx]);
+                emit_row(idx, results[idx]);
                 progress_counter.fetch_add(1);
             }
             catch (const std::exception& e)
@@ -2226,6 +2351,7 @@ HighLevelEnergyCalculator::process_files_with_thread_pool(const std::vector<std:
                 }
                 results[idx]        = HighLevelEnergyData(files[idx]);
                 results[idx].status = "ERROR";
+                emit_row(idx, results[idx], e.what());
                 progress_counter.fetch_add(1);
             }
         }
@@ -2277,6 +2403,8 @@ HighLevelEnergyCalculator::process_files_with_thread_pool(const std::vector<std:
         monitor_thread.join();
     }
 
+    std::optional<ProfileScope> sort_profile(std::in_place, ProfileStage::SORT);
+
 // Sort results using parallel sort if available
 #ifdef __cpp_lib_execution
     if (results.size() > 100)
@@ -2306,6 +2434,7 @@ HighLevelEnergyCalculator::process_files_with_thread_pool(const std::vector<std:
         return compare_results(a, b, sort_column_);
     });
 #endif
+    sort_profile.reset();
 
     if (!quiet)
     {
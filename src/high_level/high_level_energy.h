@@ -68,6 +68,8 @@
 #include <chrono>
 #include <unordered_map>
 
+class NdjsonStream;
+
 /**
  * @defgroup HighLevelConstants Physical Constants for High-Level Calculations
  * @brief Fundamental constants used in high-level energy calculations and conversions
@@ -617,6 +619,34 @@ public:
         ravib_ = v;
     }
 
+    /**
+     * @brief Read high-level energies from the Gaussian archive entry when present
+     * @param flag true to take HF=, the route and the status from the tail of the high-level file
+     *
+     * Completed high-level single points then cost one small tail read instead
+     * of several passes over the whole log. Files without an archive entry, and
+     * CIS/TD, external-iteration PCM or cLR jobs, are still parsed in full. The
+     * low-level thermal data keep coming from the parent log because the archive
+     * has no temperature or frequencies.
+     */
+    void set_use_archive(bool flag)
+    {
+        use_archive_ = flag;
+    }
+
+    /**
+     * @brief Stream one JSON line per file as soon as it is processed (-f ndjson)
+     * @param stream Row sink, or nullptr to turn streaming off; must outlive processing
+     *
+     * Rows carry "seq" (index of the file in the discovered list), "file",
+     * "status" and the energies of the selected format (kJ or AU). Files that
+     * fail get an "error" field instead of energies.
+     */
+    void set_row_stream(NdjsonStream* stream)
+    {
+        row_stream_ = stream;
+    }
+
     /**
      * @brief Set concentration for phase corrections
      * @param conc_m Concentration in mol/L (molarity)
@@ -690,6 +720,8 @@ private:
     bool        use_input_concentration_ = false;  ///< True when the user explicitly specified -c/--conc
     std::string low_vib_method_ = "grimme";        ///< Low-frequency treatment passed to thermo module
     double      ravib_           = 100.0;           ///< Crossover frequency for quasi-RRHO methods (cm-1)
+    bool        use_archive_     = false;           ///< Take high-level energies from the archive entry
+    NdjsonStream* row_stream_    = nullptr;         ///< Per-file JSON lines, nullptr when not streaming
 
     // Enhanced resource management
     std::shared_ptr<ProcessingContext> context_;      ///< Processing context with resource managers
@@ -790,6 +822,21 @@ private:
      */
     std::string determine_job_status(const std::string& filename);
 
+    /**
+     * @brief Determine job completion status from the last lines of a log file
+     * @param tail_content Last lines of the log, newline-terminated
+     * @return Status string ("DONE", "ERROR", "UNDONE")
+     */
+    std::string determine_job_status_from_tail(const std::string& tail_content);
+
+    /**
+     * @brief Fill the high-level energies, SCRF flag and status from the archive entry
+     * @param high_level_file Path to the high-level log file
+     * @param data [out] Energy data to fill
+     * @return false if the file has no usable archive entry (caller parses the whole log)
+     */
+    bool extract_high_level_from_archive(const std::string& high_level_file, HighLevelEnergyData& data);
+
     /** @} */  // end of CalculationHelpers group
 
     /**
@@ -982,6 +1029,14 @@ private:
      */
     bool compare_results(const HighLevelEnergyData& a, const HighLevelEnergyData& b, int column);
 
+    /**
+     * @brief Write the JSON line of one processed file when a row stream is set
+     * @param seq Index of the file in the processed list
+     * @param data Result of the file
+     * @param error Failure message; empty when @p data holds valid energies
+     */
+    void emit_row(size_t seq, const HighLevelEnergyData& data, const std::string& error = std::string()) const;
+
     /**
      * @brief Worker function for parallel file processing
      * @param files Vector of files to process
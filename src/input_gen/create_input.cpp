@@ -10,6 +10,8 @@
 
 #include "input_gen/create_input.h"
 #include "input_gen/parameter_parser.h"
+#include "job_management/work_queue.h"
+#include "job_management/worker_buffers.h"
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -535,10 +537,6 @@ CreateSummary CreateInput::create_inputs(const std::vector<std::string>& xyz_fil
         std::cout << "Creating Gaussian input files..." << std::endl;
     }
 
-    // Thread-safe containers
-    std::mutex          results_mutex;
-    std::atomic<size_t> file_index{0};
-
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(
         context->requested_threads ? context->requested_threads : 0, xyz_files.size(), context->job_resources);
@@ -549,12 +547,16 @@ CreateSummary CreateInput::create_inputs(const std::vector<std::string>& xyz_fil
     }
 
     // Process files in parallel
+    WorkQueue work_queue(WorkQueue::file_costs(xyz_files), num_threads);
+    PerWorker<CreateSummary> buffers(num_threads);  // per-thread counters, merged after the join
+    ProgressCounter          progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i)
     {
-        threads.emplace_back([&]() {
-            size_t index;
-            while ((index = file_index.fetch_add(1)) < xyz_files.size())
+        threads.emplace_back([&, i]() {
+            CreateSummary& local = buffers[i];
+            size_t         index;
+            while (work_queue.next(i, index))
             {
                 if (g_shutdown_requested.load())
                     break;
@@ -567,38 +569,36 @@ CreateSummary CreateInput::create_inputs(const std::vector<std::string>& xyz_fil
 
                     CreateInput local_creator(*this);
                     FileCreationResult result = local_creator.create_from_file(xyz_files[index]);
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        summary.processed_files++;
+                    local.processed_files++;
 
-                        if (result.success)
-                        {
-                            summary.created_files += result.created_count;
-                            summary.skipped_files += result.skipped_count;
-                        }
-                        else
+                    if (result.success)
+                    {
+                        local.created_files += result.created_count;
+                        local.skipped_files += result.skipped_count;
+                    }
+                    else
+                    {
+                        local.failed_files++;
+                        if (!result.error_msg.empty())
                         {
-                            summary.failed_files++;
-                            if (!result.error_msg.empty())
-                            {
-                                summary.errors.push_back("Error creating input for " + xyz_files[index] + ": " +
-                                                         result.error_msg);
-                            }
+                            local.errors.push_back("Error creating input for " + xyz_files[index] + ": " +
+                                                   result.error_msg);
                         }
                     }
 
                     // Report progress
-                    if (!quiet_mode && summary.processed_files % 50 == 0)
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0)
                     {
-                        report_progress(summary.processed_files, summary.total_files);
+                        report_progress(done, summary.total_files);
                     }
                 }
                 catch (const std::exception& e)
                 {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.processed_files++;
-                    summary.failed_files++;
-                    summary.errors.push_back("Exception creating input for " + xyz_files[index] + ": " + e.what());
+                    local.processed_files++;
+                    local.failed_files++;
+                    local.errors.push_back("Exception creating input for " + xyz_files[index] + ": " + e.what());
+                    progress.increment();
                 }
             }
         });
@@ -609,6 +609,15 @@ CreateSummary CreateInput::create_inputs(const std::vector<std::string>& xyz_fil
     {
         thread.join();
     }
+    summary.work_stats = work_queue.stats();
+
+    buffers.for_each([&summary](CreateSummary& local) {
+        summary.processed_files += local.processed_files;
+        summary.created_files += local.created_files;
+        summary.skipped_files += local.skipped_files;
+        summary.failed_files += local.failed_files;
+        summary.errors.insert(summary.errors.end(), local.errors.begin(), local.errors.end());
+    });
 
     if (!quiet_mode && summary.processed_files > 0)
     {
@@ -12,6 +12,7 @@
 #define CREATE_INPUT_H
 
 #include "extraction/qc_extractor.h"
+#include "job_management/work_queue.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -67,6 +68,7 @@ struct CreateSummary
     size_t                   skipped_files;    ///< Number of files skipped (existing inputs)
     std::vector<std::string> errors;           ///< Collection of error messages encountered
     double                   execution_time;   ///< Total execution time in seconds
+    WorkQueueStats           work_stats;       ///< Load distribution over the worker threads (--resource-info)
 
     CreateSummary()
         : total_files(0), processed_files(0), created_files(0), failed_files(0), skipped_files(0), execution_time(0.0)
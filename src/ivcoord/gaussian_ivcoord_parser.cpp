@@ -1,4 +1,5 @@
 #include "ivcoord/gaussian_ivcoord_parser.h"
+#include "utilities/numeric_parse.h"
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -130,16 +131,17 @@ IVCoordData GaussianIVCoordParser::parse(const std::string& filepath)
     for (int i = geo_start + 5; i < geo_end; ++i)
     {
         const int idx = i - (geo_start + 5);
-        std::istringstream ss(lines[i]);
+        std::string_view fields = lines[i];
         int    center, atomic_num, atom_type;
-        double x, y, z;
-        if (!(ss >> center >> atomic_num >> atom_type >> x >> y >> z))
+        double xyz[3];
+        if (!NumParse::parse_int(fields, center) || !NumParse::parse_int(fields, atomic_num) ||
+            !NumParse::parse_int(fields, atom_type) || NumParse::parse_doubles(fields, xyz, 3) != 3)
         {
             result.error_message = "Failed to parse coordinate line: " + lines[i];
             return result;
         }
         result.elements[idx] = atomic_symbol(atomic_num);
-        result.coords[idx]   = {x, y, z};
+        result.coords[idx]   = {xyz[0], xyz[1], xyz[2]};
     }
 
     // -----------------------------------------------------------------------
@@ -173,12 +175,8 @@ IVCoordData GaussianIVCoordParser::parse(const std::string& filepath)
         // Parse frequency values from this block
         const std::string& fline = lines[i];
         const size_t       arrow = fline.find("Frequencies --");
-        std::istringstream fss(fline.substr(arrow + 14));  // skip "Frequencies --"
-
         std::vector<double> block_freqs;
-        double              v;
-        while (fss >> v)
-            block_freqs.push_back(v);
+        NumParse::parse_doubles(std::string_view(fline).substr(arrow + 14), block_freqs);  // skip "Frequencies --"
 
         // Find the first negative frequency in this block
         int target_col = -1;
@@ -227,27 +225,19 @@ IVCoordData GaussianIVCoordParser::parse(const std::string& filepath)
             if (aline.empty())
                 break;
 
-            std::istringstream ass(aline);
-            std::vector<std::string> tokens;
-            std::string tok;
-            while (ass >> tok)
-                tokens.push_back(tok);
-
-            // Minimum tokens needed: 2 (atom_idx, AN) + 3*(target_col+1) displacements
-            const size_t needed = static_cast<size_t>(2 + target_col * 3 + 3);
-            if (tokens.size() >= needed)
+            // Skip atom_idx, AN and the columns of the modes before the target one
+            std::string_view cols = NumParse::skip_fields(aline, static_cast<size_t>(2 + target_col * 3));
+            double           d[3];
+            size_t           nread = NumParse::parse_doubles(cols, d, 3);
+            if (nread == 3)
+            {
+                result.disps[atoms_read] = {d[0], d[1], d[2]};
+            }
+            else if (NumParse::skip_fields(cols, nread).find_first_not_of(" \t\r") != std::string_view::npos)
             {
-                try
-                {
-                    result.disps[atoms_read][0] = std::stod(tokens[2 + target_col * 3]);
-                    result.disps[atoms_read][1] = std::stod(tokens[3 + target_col * 3]);
-                    result.disps[atoms_read][2] = std::stod(tokens[4 + target_col * 3]);
-                }
-                catch (const std::exception&)
-                {
-                    result.error_message = "Failed to parse displacement value on line: " + aline;
-                    return result;
-                }
+                // A field is present but is not a number (short rows are left at zero)
+                result.error_message = "Failed to parse displacement value on line: " + aline;
+                return result;
             }
 
             ++atoms_read;
@@ -0,0 +1,92 @@
+/**
+ * @file bounded_queue.h
+ * @brief Blocking producer/consumer queue with a fixed capacity
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Used to hand batches of discovered files from the discovery thread to the
+ * extraction workers. The capacity bounds how far discovery can run ahead,
+ * and so how much of a huge directory listing is held in memory at once.
+ */
+
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief FIFO queue whose push() blocks while it is full
+ *
+ * The producer calls close() when it is done; pop() then drains the
+ * remaining items and returns false once the queue is empty.
+ */
+template <typename T>
+class BoundedQueue
+{
+private:
+    std::mutex              mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    std::deque<T>           items;
+    size_t                  capacity;
+    bool                    closed = false;
+
+public:
+    explicit BoundedQueue(size_t max_items) : capacity(max_items > 0 ? max_items : 1) {}
+
+    BoundedQueue(const BoundedQueue&)            = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Add an item, waiting while the queue is full
+     * @return false if the queue was closed (the item is dropped)
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this]() { return closed || items.size() < capacity; });
+        if (closed)
+        {
+            return false;
+        }
+        items.push_back(std::move(item));
+        not_empty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item, waiting while the queue is empty and open
+     * @return false once the queue is closed and drained
+     */
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this]() { return closed || !items.empty(); });
+        if (items.empty())
+        {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        not_full.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Refuse further pushes and wake all waiters
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+};
+
+#endif  // BOUNDED_QUEUE_H
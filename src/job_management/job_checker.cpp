@@ -1,5 +1,14 @@
 #include "job_management/job_checker.h"
+#include "extraction/result_cache.h"
+#include "job_management/work_queue.h"
+#include "job_management/worker_buffers.h"
 #include "utilities/config_manager.h"
+#include "utilities/file_discovery.h"
+#include "utilities/file_view.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/parse_stats.h"
+#include "utilities/profiler.h"
+#include "utilities/trace_recorder.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -8,13 +17,103 @@
 #include <mutex>
 #include <atomic>
 #include <filesystem>
+#include <iterator>
+#include <optional>
+
+namespace {
+    /// Results gathered by one checker thread, merged once all threads have joined
+    struct CheckBuffer {
+        size_t processed = 0;
+        std::vector<std::pair<size_t, JobCheckResult>> matched;  ///< (position in log_files, result)
+        std::vector<std::string> errors;
+    };
+
+    /// Fold the per-thread buffers into @p summary; matched jobs are returned in input order
+    std::vector<JobCheckResult> merge_check_buffers(PerWorker<CheckBuffer>& buffers, CheckSummary& summary) {
+        std::vector<std::pair<size_t, JobCheckResult>> matched;
+        buffers.for_each([&](CheckBuffer& buffer) {
+            summary.processed_files += buffer.processed;
+            summary.errors.insert(summary.errors.end(), buffer.errors.begin(), buffer.errors.end());
+            std::move(buffer.matched.begin(), buffer.matched.end(), std::back_inserter(matched));
+        });
+        std::sort(matched.begin(), matched.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::vector<JobCheckResult> jobs;
+        jobs.reserve(matched.size());
+        for (auto& entry : matched) {
+            jobs.push_back(std::move(entry.second));
+        }
+        return jobs;
+    }
+
+    /**
+     * Search state of running jobs, kept in .cck_cache between check runs.
+     * The main thread loads it before the workers start and saves it after they
+     * joined; each worker only touches the slots of the files it checks.
+     */
+    class RunningJobCache {
+    public:
+        RunningJobCache(const std::vector<FileEntry>& log_entries, ResultCacheMode mode)
+            : checkpoints(log_entries.size()), unchanged(log_entries.size(), 0), running(log_entries.size(), 0) {
+            if (mode == ResultCacheMode::DISABLED) {
+                return;
+            }
+            cache = std::make_unique<ResultCache>(ResultCache::default_path(), ResultCache::settings_hash_for_check());
+            if (mode == ResultCacheMode::USE) {
+                cache->load();
+            }
+            entries = log_entries;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                stat_file_entry(entries[i]);  // no-op for sizes known from discovery
+                if (const Result* cached = cache->find(entries[i])) {
+                    unchanged[i] = cached->status == "UNDONE";  // same bytes as a running job last time
+                } else {
+                    cache->find_checkpoint(entries[i], checkpoints[i]);
+                }
+            }
+        }
+
+        /// The log is byte-for-byte the one a previous run found running
+        bool is_unchanged(size_t index) const { return unchanged[index] != 0; }
+
+        /// Resume state for check_job_status(), or nullptr without the cache
+        GaussianScanCheckpoint* resume(size_t index) { return cache ? &checkpoints[index] : nullptr; }
+
+        void finish(size_t index, JobStatus status) { running[index] = status == JobStatus::RUNNING; }
+
+        void save(bool quiet) {
+            if (!cache) {
+                return;
+            }
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (running[i] && !unchanged[i] && checkpoints[i].offset > 0) {
+                    Result result;
+                    result.status = "UNDONE";
+                    cache->store(entries[i], result, &checkpoints[i]);
+                }
+            }
+            if (!cache->save() && !quiet) {
+                std::cerr << "Warning: could not write result cache " << cache->path().string() << std::endl;
+            }
+        }
+
+    private:
+        std::unique_ptr<ResultCache> cache;
+        std::vector<FileEntry> entries;
+        std::vector<GaussianScanCheckpoint> checkpoints;
+        std::vector<char> unchanged;
+        std::vector<char> running;
+    };
+}
 
 // JobChecker Implementation
 JobChecker::JobChecker(std::shared_ptr<ProcessingContext> ctx, bool quiet, bool show_details)
     : context(ctx), quiet_mode(quiet), show_error_details(show_details) {}
 
-CheckSummary JobChecker::check_completed_jobs(const std::vector<std::string>& log_files,
+CheckSummary JobChecker::check_completed_jobs(const std::vector<FileEntry>& log_entries,
                                              const std::string& target_dir_suffix) {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     CheckSummary summary;
     summary.total_files = log_files.size();
 
@@ -32,10 +131,6 @@ CheckSummary JobChecker::check_completed_jobs(const std::vector<std::string>& lo
         std::cout << "Checking for completed jobs..." << std::endl;
     }
 
-    // Thread-safe containers
-    std::vector<JobCheckResult> completed_jobs;
-    std::mutex results_mutex;
-    std::atomic<size_t> file_index{0};
 
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(context->requested_threads,
@@ -47,37 +142,43 @@ CheckSummary JobChecker::check_completed_jobs(const std::vector<std::string>& lo
     }
 
     // Process files in parallel
+    RunningJobCache running_jobs(log_entries, cache_mode);
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+    PerWorker<CheckBuffer> buffers(num_threads);  // one buffer per thread, no shared lock
+    ProgressCounter progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&]() {
+        threads.emplace_back([&, i]() {
+            CheckBuffer& local = buffers[i];
             size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size()) {
+            while (work_queue.next(i, index)) {
                 if (g_shutdown_requested.load()) break;
 
                 try {
                     auto file_guard = context->file_manager->acquire();
                     if (!file_guard.is_acquired()) continue;
 
-                    JobCheckResult result = check_job_status(log_files[index]);
-
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        summary.processed_files++;
+                    JobCheckResult result = running_jobs.is_unchanged(index)
+                                                ? JobCheckResult(log_files[index], JobStatus::RUNNING)
+                                                : check_job_status(log_files[index], running_jobs.resume(index));
+                    running_jobs.finish(index, result.status);
 
-                        if (result.status == JobStatus::COMPLETED) {
-                            completed_jobs.push_back(result);
-                            summary.matched_files++;
-                        }
+                    local.processed++;
+                    bool matched = result.status == JobStatus::COMPLETED;
+                    emit_row(index, result, matched);
+                    if (matched) {
+                        local.matched.emplace_back(index, std::move(result));
                     }
 
                     // Report progress
-                    if (!quiet_mode && summary.processed_files % 50 == 0) {
-                        report_progress(summary.processed_files, summary.total_files, "checking");
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0) {
+                        report_progress(done, summary.total_files, "checking");
                     }
 
                 } catch (const std::exception& e) {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    local.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    emit_failure(index, log_files[index], e.what());
                 }
             }
         });
@@ -87,6 +188,11 @@ CheckSummary JobChecker::check_completed_jobs(const std::vector<std::string>& lo
     for (auto& thread : threads) {
         thread.join();
     }
+    running_jobs.save(quiet_mode);
+
+    std::vector<JobCheckResult> completed_jobs = merge_check_buffers(buffers, summary);
+    summary.work_stats = work_queue.stats();
+    summary.matched_files = completed_jobs.size();
 
     if (!quiet_mode && summary.processed_files > 0) {
         report_progress(summary.processed_files, summary.total_files, "checking");
@@ -120,8 +226,9 @@ CheckSummary JobChecker::check_completed_jobs(const std::vector<std::string>& lo
     return summary;
 }
 
-CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_files,
+CheckSummary JobChecker::check_error_jobs(const std::vector<FileEntry>& log_entries,
                                          const std::string& target_dir) {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     CheckSummary summary;
     summary.total_files = log_files.size();
 
@@ -138,10 +245,6 @@ CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_fi
         std::cout << "Checking for error jobs..." << std::endl;
     }
 
-    // Thread-safe containers
-    std::vector<JobCheckResult> error_jobs;
-    std::mutex results_mutex;
-    std::atomic<size_t> file_index{0};
 
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(context->requested_threads,
@@ -153,11 +256,15 @@ CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_fi
     }
 
     // Process files in parallel
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+    PerWorker<CheckBuffer> buffers(num_threads);  // one buffer per thread, no shared lock
+    ProgressCounter progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&]() {
+        threads.emplace_back([&, i]() {
+            CheckBuffer& local = buffers[i];
             size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size()) {
+            while (work_queue.next(i, index)) {
                 if (g_shutdown_requested.load()) break;
 
                 try {
@@ -167,24 +274,22 @@ CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_fi
                     // Use direct error checking (independent of job status)
                     JobCheckResult result = check_error_directly(log_files[index]);
 
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        summary.processed_files++;
-
-                        if (result.status == JobStatus::ERROR) {
-                            error_jobs.push_back(result);
-                            summary.matched_files++;
-                        }
+                    local.processed++;
+                    bool matched = result.status == JobStatus::ERROR;
+                    emit_row(index, result, matched);
+                    if (matched) {
+                        local.matched.emplace_back(index, std::move(result));
                     }
 
                     // Report progress
-                    if (!quiet_mode && summary.processed_files % 50 == 0) {
-                        report_progress(summary.processed_files, summary.total_files, "checking");
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0) {
+                        report_progress(done, summary.total_files, "checking");
                     }
 
                 } catch (const std::exception& e) {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    local.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    emit_failure(index, log_files[index], e.what());
                 }
             }
         });
@@ -195,6 +300,10 @@ CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_fi
         thread.join();
     }
 
+    std::vector<JobCheckResult> error_jobs = merge_check_buffers(buffers, summary);
+    summary.work_stats = work_queue.stats();
+    summary.matched_files = error_jobs.size();
+
     if (!quiet_mode && summary.processed_files > 0) {
         report_progress(summary.processed_files, summary.total_files, "checking");
         std::cout << std::endl;
@@ -227,8 +336,9 @@ CheckSummary JobChecker::check_error_jobs(const std::vector<std::string>& log_fi
     return summary;
 }
 
-CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_files,
+CheckSummary JobChecker::check_pcm_failures(const std::vector<FileEntry>& log_entries,
                                            const std::string& target_dir) {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     CheckSummary summary;
     summary.total_files = log_files.size();
 
@@ -245,10 +355,6 @@ CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_
         std::cout << "Checking for PCM convergence failures..." << std::endl;
     }
 
-    // Thread-safe containers
-    std::vector<JobCheckResult> pcm_failed_jobs;
-    std::mutex results_mutex;
-    std::atomic<size_t> file_index{0};
 
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(context->requested_threads,
@@ -260,11 +366,15 @@ CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_
     }
 
     // Process files in parallel
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+    PerWorker<CheckBuffer> buffers(num_threads);  // one buffer per thread, no shared lock
+    ProgressCounter progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&]() {
+        threads.emplace_back([&, i]() {
+            CheckBuffer& local = buffers[i];
             size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size()) {
+            while (work_queue.next(i, index)) {
                 if (g_shutdown_requested.load()) break;
 
                 try {
@@ -274,24 +384,22 @@ CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_
                     // Use direct PCM checking (independent of job status)
                     JobCheckResult result = check_pcm_directly(log_files[index]);
 
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-                        summary.processed_files++;
-
-                        if (result.status == JobStatus::PCM_FAILED) {
-                            pcm_failed_jobs.push_back(result);
-                            summary.matched_files++;
-                        }
+                    local.processed++;
+                    bool matched = result.status == JobStatus::PCM_FAILED;
+                    emit_row(index, result, matched);
+                    if (matched) {
+                        local.matched.emplace_back(index, std::move(result));
                     }
 
                     // Report progress
-                    if (!quiet_mode && summary.processed_files % 50 == 0) {
-                        report_progress(summary.processed_files, summary.total_files, "checking");
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0) {
+                        report_progress(done, summary.total_files, "checking");
                     }
 
                 } catch (const std::exception& e) {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    local.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    emit_failure(index, log_files[index], e.what());
                 }
             }
         });
@@ -302,6 +410,10 @@ CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_
         thread.join();
     }
 
+    std::vector<JobCheckResult> pcm_failed_jobs = merge_check_buffers(buffers, summary);
+    summary.work_stats = work_queue.stats();
+    summary.matched_files = pcm_failed_jobs.size();
+
     if (!quiet_mode && summary.processed_files > 0) {
         report_progress(summary.processed_files, summary.total_files, "checking");
         std::cout << std::endl;
@@ -335,12 +447,13 @@ CheckSummary JobChecker::check_pcm_failures(const std::vector<std::string>& log_
     return summary;
 }
 
-CheckSummary JobChecker::check_all_job_types(const std::vector<std::string>& log_files) {
+CheckSummary JobChecker::check_all_job_types(const std::vector<FileEntry>& log_entries) {
     // Use optimized version for better performance
-    return check_all_job_types_optimized(log_files);
+    return check_all_job_types_optimized(log_entries);
 }
 
-CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::string>& log_files) {
+CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<FileEntry>& log_entries) {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     CheckSummary total_summary;
     total_summary.total_files = log_files.size();
 
@@ -365,14 +478,6 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
         return total_summary;
     }
 
-    // Thread-safe containers for classified jobs
-    std::vector<JobCheckResult> completed_jobs;
-    std::vector<JobCheckResult> error_jobs;
-    std::vector<JobCheckResult> pcm_failed_jobs;
-    std::mutex results_mutex;
-    std::atomic<size_t> file_index{0};
-    std::atomic<size_t> processed_count{0};
-
     // Calculate safe thread count
     unsigned int num_threads = calculateSafeThreadCount(context->requested_threads,
                                                        log_files.size(),
@@ -383,11 +488,16 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
     }
 
     // Process files in parallel with single-pass classification
+    RunningJobCache running_jobs(log_entries, cache_mode);
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+    PerWorker<CheckBuffer> buffers(num_threads);  // one buffer per thread, no shared lock
+    ProgressCounter progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&]() {
+        threads.emplace_back([&, i]() {
+            CheckBuffer& local = buffers[i];
             size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size()) {
+            while (work_queue.next(i, index)) {
                 if (g_shutdown_requested.load()) break;
 
                 try {
@@ -395,23 +505,21 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
                     if (!file_guard.is_acquired()) continue;
 
                     // Single comprehensive status check with priority-based classification
-                    JobCheckResult result = check_job_status(log_files[index]);
-
-                    {
-                        std::lock_guard<std::mutex> lock(results_mutex);
-
-                        // Classify based on priority: completed > error > PCM
-                        if (result.status == JobStatus::COMPLETED) {
-                            completed_jobs.push_back(result);
-                        } else if (result.status == JobStatus::ERROR) {
-                            error_jobs.push_back(result);
-                        } else if (result.status == JobStatus::PCM_FAILED) {
-                            pcm_failed_jobs.push_back(result);
-                        }
-                        // RUNNING and UNKNOWN jobs are not moved
+                    JobCheckResult result = running_jobs.is_unchanged(index)
+                                                ? JobCheckResult(log_files[index], JobStatus::RUNNING)
+                                                : check_job_status(log_files[index], running_jobs.resume(index));
+                    running_jobs.finish(index, result.status);
+
+                    // RUNNING and UNKNOWN jobs are not moved
+                    local.processed++;
+                    bool matched = result.status == JobStatus::COMPLETED || result.status == JobStatus::ERROR ||
+                                   result.status == JobStatus::PCM_FAILED;
+                    emit_row(index, result, matched);
+                    if (matched) {
+                        local.matched.emplace_back(index, std::move(result));
                     }
 
-                    size_t current = processed_count.fetch_add(1) + 1;
+                    size_t current = progress.increment();
 
                     // Report progress
                     if (!quiet_mode && current % 50 == 0) {
@@ -419,8 +527,8 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
                     }
 
                 } catch (const std::exception& e) {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    total_summary.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    local.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    emit_failure(index, log_files[index], e.what());
                 }
             }
         });
@@ -430,8 +538,22 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
     for (auto& thread : threads) {
         thread.join();
     }
+    running_jobs.save(quiet_mode);
 
-    total_summary.processed_files = processed_count.load();
+    // Classify based on priority: completed > error > PCM (check_job_status assigns one status)
+    std::vector<JobCheckResult> completed_jobs;
+    std::vector<JobCheckResult> error_jobs;
+    std::vector<JobCheckResult> pcm_failed_jobs;
+    total_summary.work_stats = work_queue.stats();
+    for (auto& result : merge_check_buffers(buffers, total_summary)) {
+        if (result.status == JobStatus::COMPLETED) {
+            completed_jobs.push_back(std::move(result));
+        } else if (result.status == JobStatus::ERROR) {
+            error_jobs.push_back(std::move(result));
+        } else {
+            pcm_failed_jobs.push_back(std::move(result));
+        }
+    }
     total_summary.matched_files = completed_jobs.size() + error_jobs.size() + pcm_failed_jobs.size();
 
     if (!quiet_mode && total_summary.processed_files > 0) {
@@ -518,8 +640,9 @@ CheckSummary JobChecker::check_all_job_types_optimized(const std::vector<std::st
     return total_summary;
 }
 
-CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::string>& log_files,
+CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<FileEntry>& log_entries,
                                                      const std::string& target_dir_suffix) {
+    const std::vector<std::string> log_files = file_paths(log_entries);
     CheckSummary summary;
     summary.total_files = log_files.size();
     auto start_time = std::chrono::high_resolution_clock::now();
@@ -536,10 +659,6 @@ CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::stri
         std::cout << "Checking for imaginary frequencies..." << std::endl;
     }
 
-    std::vector<JobCheckResult> imag_freq_jobs;
-    std::mutex results_mutex;
-    std::atomic<size_t> file_index{0};
-
     unsigned int num_threads = calculateSafeThreadCount(context->requested_threads,
                                                        log_files.size(),
                                                        context->job_resources);
@@ -547,18 +666,32 @@ CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::stri
         std::cout << "Using " << num_threads << " threads" << std::endl;
     }
 
+    WorkQueue work_queue(WorkQueue::file_costs(log_entries), num_threads);
+    PerWorker<CheckBuffer> buffers(num_threads);  // one buffer per thread, no shared lock
+    ProgressCounter progress;
     std::vector<std::thread> threads;
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back([&]() {
+        threads.emplace_back([&, i]() {
+            CheckBuffer& local = buffers[i];
             size_t index;
-            while ((index = file_index.fetch_add(1)) < log_files.size()) {
+            while (work_queue.next(i, index)) {
                 if (g_shutdown_requested.load()) break;
 
                 try {
+                    TraceSpan file_span("file", "file", log_files[index]);
+                    ProfileScope file_profile(ProfileStage::FILE);
+                    CCK_STAT_FILE(log_files[index]);
+                    std::optional<ProfileScope> stage(std::in_place, ProfileStage::OPEN);
                     auto file_guard = context->file_manager->acquire();
                     if (!file_guard.is_acquired()) continue;
 
+                    stage.reset();
+                    stage.emplace(ProfileStage::READ);
                     std::string content = read_file_unified(log_files[index], FileReadMode::FULL);
+                    file_profile.add_bytes(content.size());
+                    file_span.add_bytes(content.size());
+                    stage.reset();
+                    stage.emplace(ProfileStage::PARSE);
                     std::istringstream stream(content);
                     std::string line;
                     bool has_imag_freq = false;
@@ -578,23 +711,22 @@ CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::stri
                         if (has_imag_freq) break;
                     }
 
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.processed_files++;
-
+                    local.processed++;
+                    JobCheckResult result(log_files[index], JobStatus::UNKNOWN);
+                    emit_row(index, result, has_imag_freq);
                     if (has_imag_freq) {
-                        JobCheckResult result(log_files[index], JobStatus::UNKNOWN);
                         result.related_files = find_related_files(log_files[index]);
-                        imag_freq_jobs.push_back(result);
-                        summary.matched_files++;
+                        local.matched.emplace_back(index, std::move(result));
                     }
 
-                    if (!quiet_mode && summary.processed_files % 50 == 0) {
-                        report_progress(summary.processed_files, summary.total_files, "checking");
+                    size_t done = progress.increment();
+                    if (!quiet_mode && done % 50 == 0) {
+                        report_progress(done, summary.total_files, "checking");
                     }
 
                 } catch (const std::exception& e) {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    summary.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    local.errors.push_back("Error checking " + log_files[index] + ": " + e.what());
+                    emit_failure(index, log_files[index], e.what());
                 }
             }
         });
@@ -604,6 +736,10 @@ CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::stri
         thread.join();
     }
 
+    std::vector<JobCheckResult> imag_freq_jobs = merge_check_buffers(buffers, summary);
+    summary.work_stats = work_queue.stats();
+    summary.matched_files = imag_freq_jobs.size();
+
     if (!quiet_mode && summary.processed_files > 0) {
         report_progress(summary.processed_files, summary.total_files, "checking");
         std::cout << std::endl;
@@ -636,12 +772,25 @@ CheckSummary JobChecker::check_imaginary_frequencies(const std::vector<std::stri
 }
 
 
-JobCheckResult JobChecker::check_job_status(const std::string& log_file) {
+JobCheckResult JobChecker::check_job_status(const std::string& log_file, GaussianScanCheckpoint* resume) {
     JobCheckResult result(log_file, JobStatus::UNKNOWN);
+    GaussianScanCheckpoint previous;
+    if (resume != nullptr) {
+        previous = *resume;
+        *resume = GaussianScanCheckpoint{};  // only a running job keeps one
+    }
+    TraceSpan file_span("file", "file", log_file);
+    ProfileScope file_profile(ProfileStage::FILE);
+    CCK_STAT_FILE(log_file);
 
     try {
+        std::optional<ProfileScope> stage(std::in_place, ProfileStage::READ);
         // Use unified reading with TAIL mode for efficiency
         std::string tail_content = read_file_unified(log_file, FileReadMode::TAIL, 10);
+        file_profile.add_bytes(tail_content.size());
+        file_span.add_bytes(tail_content.size());
+        stage.reset();
+        stage.emplace(ProfileStage::PARSE);
 
         // Check for normal termination first
         if (check_normal_termination(tail_content)) {
@@ -659,9 +808,22 @@ JobCheckResult JobChecker::check_job_status(const std::string& log_file) {
             return result;
         }
 
-        // Check for PCM failure - use FULL mode since pattern can be anywhere
-        std::string full_content = read_file_unified(log_file, FileReadMode::FULL);
-        if (check_pcm_failure(full_content)) {
+        // Check for PCM failure - the pattern can be anywhere, so search the whole
+        // file in place; running jobs reach this point on every check, and
+        // copying a multi-GB log into a string each time dominated the check.
+        // Bytes an earlier check already searched are skipped while unchanged.
+        FileView log_view(log_file);
+        std::string_view text = log_view.view();
+        size_t from = 0;
+        if (previous.offset > 0 && previous.offset <= text.size() &&
+            GaussianScanner::checkpoint_fingerprint(text, previous.offset) == previous.fingerprint) {
+            from = previous.offset;
+        }
+        std::string_view unread = text.substr(from);
+        file_profile.add_bytes(unread.size());
+        file_span.add_bytes(unread.size());
+        CCK_STAT_BYTES(unread.size());
+        if (check_pcm_failure(unread)) {
             result.status = JobStatus::PCM_FAILED;
             result.error_message = "failed in PCMMkU";
             result.related_files = find_related_files(log_file);
@@ -671,6 +833,13 @@ JobCheckResult JobChecker::check_job_status(const std::string& log_file) {
         // If none of the above, assume still running
         result.status = JobStatus::RUNNING;
 
+        // The pattern never spans lines, so the next check can start after the last complete one
+        size_t last_line = text.rfind('\n');
+        if (resume != nullptr && last_line != std::string_view::npos) {
+            resume->offset = last_line + 1;
+            resume->fingerprint = GaussianScanner::checkpoint_fingerprint(text, resume->offset);
+        }
+
     } catch (const std::exception& e) {
         result.status = JobStatus::UNKNOWN;
         result.error_message = "Failed to read file: " + std::string(e.what());
@@ -749,18 +918,26 @@ bool JobChecker::check_error_termination(const std::string& content, std::string
     return false;
 }
 
-bool JobChecker::check_pcm_failure(const std::string& content) {
+bool JobChecker::check_pcm_failure(std::string_view content) {
     // Look for "failed in PCMMkU" - matches bash: grep "failed in PCMMkU"
-    return content.find("failed in PCMMkU") != std::string::npos;
+    return content.find("failed in PCMMkU") != std::string_view::npos;
 }
 
 // Independent error checking - matches bash script exactly
 JobCheckResult JobChecker::check_error_directly(const std::string& log_file) {
     JobCheckResult result(log_file, JobStatus::UNKNOWN);
+    TraceSpan file_span("file", "file", log_file);
+    ProfileScope file_profile(ProfileStage::FILE);
+    CCK_STAT_FILE(log_file);
 
     try {
+        std::optional<ProfileScope> stage(std::in_place, ProfileStage::READ);
         // Use unified reading with TAIL mode for efficiency
         std::string tail_content = read_file_unified(log_file, FileReadMode::TAIL, 10);
+        file_profile.add_bytes(tail_content.size());
+        file_span.add_bytes(tail_content.size());
+        stage.reset();
+        stage.emplace(ProfileStage::PARSE);
 
         // Check for normal termination first - if found, skip file
         if (check_normal_termination(tail_content)) {
@@ -795,11 +972,19 @@ JobCheckResult JobChecker::check_error_directly(const std::string& log_file) {
 // Independent PCM checking - looks only for PCM failures
 JobCheckResult JobChecker::check_pcm_directly(const std::string& log_file) {
     JobCheckResult result(log_file, JobStatus::UNKNOWN);
+    TraceSpan file_span("file", "file", log_file);
+    ProfileScope file_profile(ProfileStage::FILE);
+    CCK_STAT_FILE(log_file);
 
     try {
+        std::optional<ProfileScope> stage(std::in_place, ProfileStage::READ);
         // PCM failures often appear near the end, try tail first with SMART mode
         // This will read tail first, and only read full if pattern might be elsewhere
         std::string content = read_file_unified(log_file, FileReadMode::TAIL, 100);
+        file_profile.add_bytes(content.size());
+        file_span.add_bytes(content.size());
+        stage.reset();
+        stage.emplace(ProfileStage::PARSE);
 
         //// If not found in tail, check full file
         //if (!check_pcm_failure(content)) {
@@ -853,7 +1038,10 @@ std::string JobChecker::read_file_unified(const std::string& filename,
         file.seekg(0, std::ios::beg);
         std::ostringstream buffer;
         buffer << file.rdbuf();
-        return buffer.str();
+        std::string content = buffer.str();
+        CCK_STAT_BYTES(content.size());
+        CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(content.begin(), content.end(), '\n')));
+        return content;
     }
 
     // For TAIL or SMART mode
@@ -885,6 +1073,8 @@ std::string JobChecker::read_file_unified(const std::string& filename,
             // Count newlines in the accumulated string
             lines_found = std::count(accumulated.begin(), accumulated.end(), '\n');
         }
+        CCK_STAT_BYTES(accumulated.size());
+        CCK_STAT_LINES(lines_found);
 
         // Find the starting position of the desired lines
         size_t start_pos = accumulated.length();
@@ -1047,6 +1237,35 @@ void JobChecker::log_error(const std::string& error) {
     context->error_collector->add_error(error);
 }
 
+void JobChecker::emit_row(size_t seq, const JobCheckResult& result, bool matched) {
+    if (row_stream == nullptr) return;
+
+    const char* status = "unknown";
+    switch (result.status) {
+        case JobStatus::COMPLETED:  status = "completed"; break;
+        case JobStatus::ERROR:      status = "error"; break;
+        case JobStatus::PCM_FAILED: status = "pcm_failed"; break;
+        case JobStatus::RUNNING:    status = "running"; break;
+        case JobStatus::UNKNOWN:    break;
+    }
+
+    JsonLine line;
+    line.field("seq", static_cast<std::uint64_t>(seq))
+        .field("file", result.filename)
+        .field("status", status)
+        .field("matched", matched)
+        .field("message", result.error_message);
+    row_stream->write(line);
+}
+
+void JobChecker::emit_failure(size_t seq, const std::string& log_file, const std::string& error) {
+    if (row_stream == nullptr) return;
+
+    JsonLine line;
+    line.field("seq", static_cast<std::uint64_t>(seq)).field("file", log_file).field("error", error);
+    row_stream->write(line);
+}
+
 // JobCheckerUtils Implementation
 namespace JobCheckerUtils {
 
@@ -35,11 +35,16 @@
 #ifndef JOB_CHECKER_H
 #define JOB_CHECKER_H
 
+#include "extraction/gaussian_scanner.h"
 #include "extraction/qc_extractor.h"
+#include "job_management/work_queue.h"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
+class NdjsonStream;
+
 /**
  * @enum JobStatus
  * @brief Enumeration of possible Gaussian job completion states
@@ -118,6 +123,7 @@ struct CheckSummary
     size_t                   failed_moves;     ///< Number of file move operations that failed
     std::vector<std::string> errors;           ///< Collection of error messages encountered
     double                   execution_time;   ///< Total execution time in seconds
+    WorkQueueStats           work_stats;       ///< Load distribution over the worker threads (--resource-info)
 
     /**
      * @brief Default constructor initializing all counters to zero
@@ -166,6 +172,8 @@ private:
     std::shared_ptr<ProcessingContext> context;             ///< Shared processing context for resource management
     bool                               quiet_mode;          ///< Suppress non-essential output messages
     bool                               show_error_details;  ///< Display detailed error messages from log files
+    NdjsonStream*                      row_stream = nullptr;  ///< Per-file JSON lines (-f ndjson), nullptr when off
+    ResultCacheMode                    cache_mode = ResultCacheMode::USE;  ///< Search offsets of running jobs (.cck_cache)
 
 public:
     /**
@@ -180,6 +188,26 @@ public:
      */
     explicit JobChecker(std::shared_ptr<ProcessingContext> ctx, bool quiet = false, bool show_details = false);
 
+    /**
+     * @brief Write one JSON line per checked file as soon as its worker is done
+     * @param stream Row sink, or nullptr to turn streaming off; must outlive the checks
+     *
+     * Rows carry "seq" (index in log_files), "file", "status", "matched" (the
+     * file meets the criterion of the check and is moved) and "message".
+     * Files that could not be read get an "error" field instead.
+     */
+    void set_row_stream(NdjsonStream* stream) { row_stream = stream; }
+
+    /**
+     * @brief Choose whether check_completed_jobs() and check_all_job_types() use .cck_cache
+     *
+     * With the cache, the offset up to which the log of a running job was
+     * searched for "failed in PCMMkU" is kept, so the next check only reads the
+     * bytes appended since, and an unchanged log is reported running again
+     * without being read.
+     */
+    void set_cache_mode(ResultCacheMode mode) { cache_mode = mode; }
+
     /**
      * @defgroup MainChecking Main Job Checking Functions
      * @brief Primary functions that replicate bash script functionality
@@ -188,7 +216,7 @@ public:
 
     /**
      * @brief Check and organize completed job calculations
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @param target_dir_suffix Suffix for target directory name (default: "done")
      * @return CheckSummary with statistics and results
      *
@@ -204,12 +232,12 @@ public:
      * @note This function replicates the behavior of the original bash script
      *       for organizing completed calculations
      */
-    CheckSummary check_completed_jobs(const std::vector<std::string>& log_files,
-                                      const std::string&              target_dir_suffix = "done");
+    CheckSummary check_completed_jobs(const std::vector<FileEntry>& log_entries,
+                                      const std::string&            target_dir_suffix = "done");
 
     /**
      * @brief Check and organize jobs that terminated with errors
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @param target_dir Target directory name (default: "errorJobs")
      * @return CheckSummary with statistics and results
      *
@@ -223,12 +251,12 @@ public:
      * - Captures error messages for detailed reporting
      * - Identifies convergence failures and resource issues
      */
-    CheckSummary check_error_jobs(const std::vector<std::string>& log_files,
-                                  const std::string&              target_dir = "errorJobs");
+    CheckSummary check_error_jobs(const std::vector<FileEntry>& log_entries,
+                                  const std::string&            target_dir = "errorJobs");
 
     /**
      * @brief Check and organize jobs with PCM convergence failures
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @param target_dir Target directory name (default: "PCMMkU")
      * @return CheckSummary with statistics and results
      *
@@ -242,12 +270,12 @@ public:
      * - Detects self-consistent reaction field issues
      * - Captures PCM-related warnings and errors
      */
-    CheckSummary check_pcm_failures(const std::vector<std::string>& log_files,
-                                    const std::string&              target_dir = "PCMMkU");
+    CheckSummary check_pcm_failures(const std::vector<FileEntry>& log_entries,
+                                    const std::string&            target_dir = "PCMMkU");
 
     /**
      * @brief Run comprehensive checking of all job types
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @return CheckSummary with combined statistics from all checks
      *
      * Performs complete job status analysis by running all checking functions
@@ -260,11 +288,11 @@ public:
      * 3. Check for general errors (catch remaining failures)
      * 4. Report comprehensive statistics
      */
-    CheckSummary check_all_job_types(const std::vector<std::string>& log_files);
+    CheckSummary check_all_job_types(const std::vector<FileEntry>& log_entries);
 
     /**
      * @brief Optimized comprehensive job checking with single-pass processing
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @return CheckSummary with combined statistics from all checks
      *
      * Performs optimized job status analysis by processing each file once
@@ -277,11 +305,11 @@ public:
      * - Batch file movements after classification
      * - Unified resource management
      */
-    CheckSummary check_all_job_types_optimized(const std::vector<std::string>& log_files);
+    CheckSummary check_all_job_types_optimized(const std::vector<FileEntry>& log_entries);
 
     /**
      * @brief Check and organize jobs with imaginary frequencies
-     * @param log_files Vector of log file paths to check
+     * @param log_entries Log files to check, as found by findLogFileEntries()
      * @param target_dir Target directory name (default: "imaginary_freqs")
      * @return CheckSummary with statistics and results
      *
@@ -290,8 +318,8 @@ public:
      * inspection. This is useful for identifying transition states or failed
      * optimizations.
      */
-    CheckSummary check_imaginary_frequencies(const std::vector<std::string>& log_files,
-                                             const std::string&              target_dir = "imaginary_freqs");
+    CheckSummary check_imaginary_frequencies(const std::vector<FileEntry>& log_entries,
+                                             const std::string&            target_dir = "imaginary_freqs");
 
     /** @} */  // end of MainChecking group
 
@@ -304,6 +332,10 @@ public:
     /**
      * @brief Determine the status of a single Gaussian job
      * @param log_file Path to the log file to analyze
+     * @param resume [in,out] Optional; on input the state of an earlier check of this
+     *               file, whose PCM search is continued from its offset when the bytes
+     *               before it are unchanged; on output the state to resume from next
+     *               time for a running job, offset 0 otherwise
      * @return JobCheckResult with status and error information
      *
      * Analyzes a single Gaussian log file to determine its completion status.
@@ -317,7 +349,7 @@ public:
      * 4. Extract error messages for reporting
      * 5. Find related files for potential organization
      */
-    JobCheckResult check_job_status(const std::string& log_file);
+    JobCheckResult check_job_status(const std::string& log_file, GaussianScanCheckpoint* resume = nullptr);
 
     /** @} */  // end of IndividualChecking group
 
@@ -444,14 +476,14 @@ private:
 
     /**
      * @brief Check if log file shows PCM convergence failure
-     * @param content Complete content of the log file
+     * @param content Complete content of the log file (or a mapped view of it)
      * @return true if PCM failure detected, false otherwise
      *
      * Specifically searches for PCM (Polarizable Continuum Model) convergence
      * failures and related solvent calculation issues. These require different
      * handling strategies than general errors.
      */
-    bool check_pcm_failure(const std::string& content);
+    bool check_pcm_failure(std::string_view content);
 
     /** @} */  // end of ContentAnalysis group
 
@@ -576,6 +608,19 @@ private:
      */
     void log_error(const std::string& error);
 
+    /**
+     * @brief Write the JSON line of one checked file when a row stream is set
+     * @param seq Index of the file in log_files
+     * @param result Status found for the file
+     * @param matched Whether the file meets the criterion of the running check
+     */
+    void emit_row(size_t seq, const JobCheckResult& result, bool matched);
+
+    /**
+     * @brief Write the JSON line of a file that could not be checked
+     */
+    void emit_failure(size_t seq, const std::string& log_file, const std::string& error);
+
     /** @} */  // end of UtilityFunctions group
 };
 
@@ -0,0 +1,156 @@
+/**
+ * @file work_queue.cpp
+ * @brief Implementation of the size-aware work-stealing queue
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "job_management/work_queue.h"
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <utility>
+
+std::string WorkQueueStats::summary() const
+{
+    std::ostringstream oss;
+    oss << items << " files on " << workers << " workers, " << steals << " stolen, busy max "
+        << std::fixed << std::setprecision(3) << max_busy_seconds << " s / mean " << mean_busy_seconds
+        << " s, imbalance " << std::setprecision(2) << imbalance();
+    return oss.str();
+}
+
+void WorkQueueStats::add(const WorkQueueStats& batch)
+{
+    items += batch.items;
+    workers = batch.workers;
+    steals += batch.steals;
+    max_busy_seconds += batch.max_busy_seconds;
+    mean_busy_seconds += batch.mean_busy_seconds;
+}
+
+WorkQueue::WorkQueue(const std::vector<std::uint64_t>& costs, unsigned int num_workers)
+    : lanes(new Lane[std::max(1u, num_workers)]), num_lanes(std::max(1u, num_workers)), num_items(costs.size())
+{
+    std::vector<size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+    // Greedy LPT: the next largest item goes to the lane with the smallest total.
+    // Every item counts at least 1 so empty files are spread out as well.
+    using Load = std::pair<std::uint64_t, unsigned int>;
+    std::priority_queue<Load, std::vector<Load>, std::greater<Load>> loads;
+    for (unsigned int w = 0; w < num_lanes; ++w)
+    {
+        loads.emplace(0, w);
+    }
+    for (size_t index : order)
+    {
+        Load load = loads.top();
+        loads.pop();
+        lanes[load.second].items.push_back(index);
+        load.first += std::max<std::uint64_t>(costs[index], 1);
+        loads.push(load);
+    }
+}
+
+std::vector<std::uint64_t> WorkQueue::file_costs(const std::vector<std::string>& files)
+{
+    std::vector<std::uint64_t> costs;
+    costs.reserve(files.size());
+    for (const auto& file : files)
+    {
+        std::error_code ec;
+        auto            size = std::filesystem::file_size(file, ec);
+        costs.push_back(ec ? 0 : static_cast<std::uint64_t>(size));
+    }
+    return costs;
+}
+
+std::vector<std::uint64_t> WorkQueue::file_costs(const std::vector<FileEntry>& files)
+{
+    std::vector<std::uint64_t> costs;
+    costs.reserve(files.size());
+    for (const auto& file : files)
+    {
+        if (file.size_known)
+        {
+            costs.push_back(file.size);
+            continue;
+        }
+        std::error_code ec;
+        auto            size = std::filesystem::file_size(file.path, ec);
+        costs.push_back(ec ? 0 : static_cast<std::uint64_t>(size));
+    }
+    return costs;
+}
+
+bool WorkQueue::pop_own(Lane& lane, size_t& index)
+{
+    std::lock_guard<std::mutex> lock(lane.mutex);
+    if (lane.items.empty())
+    {
+        return false;
+    }
+    index = lane.items.front();
+    lane.items.pop_front();
+    return true;
+}
+
+bool WorkQueue::steal(unsigned int worker, size_t& index)
+{
+    for (unsigned int offset = 1; offset < num_lanes; ++offset)
+    {
+        Lane&                       victim = lanes[(worker + offset) % num_lanes];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty())
+        {
+            index = victim.items.back();
+            victim.items.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkQueue::next(unsigned int worker, size_t& index)
+{
+    Lane&             lane = lanes[worker % num_lanes];
+    Clock::time_point now  = Clock::now();
+    if (lane.running)
+    {
+        lane.busy += std::chrono::duration<double>(now - lane.started).count();
+    }
+
+    bool found = pop_own(lane, index);
+    if (!found && steal(worker % num_lanes, index))
+    {
+        found = true;
+        lane.steals++;
+    }
+
+    lane.running = found;
+    lane.started = now;
+    return found;
+}
+
+WorkQueueStats WorkQueue::stats() const
+{
+    WorkQueueStats stats;
+    stats.items   = num_items;
+    stats.workers = num_lanes;
+
+    double total = 0.0;
+    for (unsigned int w = 0; w < num_lanes; ++w)
+    {
+        stats.steals += lanes[w].steals;
+        stats.max_busy_seconds = std::max(stats.max_busy_seconds, lanes[w].busy);
+        total += lanes[w].busy;
+    }
+    stats.mean_busy_seconds = total / num_lanes;
+    return stats;
+}
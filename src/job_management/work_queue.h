@@ -0,0 +1,138 @@
+/**
+ * @file work_queue.h
+ * @brief Size-aware work-stealing queue shared by the per-file batch commands
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Batch commands (extract, the job checkers, xyz extraction and input
+ * creation) process one file per work item. Handing the files out in
+ * directory order through one shared counter lets a large log that happens to
+ * sort last keep one thread busy long after the others have finished.
+ *
+ * @section Scheduling
+ * - Items are ordered by cost (file size), largest first, and dealt to the
+ *   worker with the smallest assigned total (longest-processing-time first).
+ * - Each worker pops from the front of its own deque, so it starts with its
+ *   largest items.
+ * - A worker whose deque is empty steals from the back of another worker's
+ *   deque, taking the smallest remaining items.
+ * - Busy time is measured per worker so the remaining imbalance can be shown
+ *   with --resource-info (extract, the job checkers, xyz and ci).
+ */
+
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#include "utilities/file_discovery.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @struct WorkQueueStats
+ * @brief Load distribution measured over one run of a WorkQueue
+ */
+struct WorkQueueStats
+{
+    size_t       items             = 0;    ///< Number of work items
+    unsigned int workers           = 0;    ///< Number of worker lanes
+    size_t       steals            = 0;    ///< Items taken from another worker's deque
+    double       max_busy_seconds  = 0.0;  ///< Busy time of the slowest worker
+    double       mean_busy_seconds = 0.0;  ///< Average busy time over all workers
+
+    /**
+     * @brief Ratio of the slowest worker's busy time to the mean (1.0 = perfect balance)
+     */
+    double imbalance() const
+    {
+        return mean_busy_seconds > 0.0 ? max_busy_seconds / mean_busy_seconds : 1.0;
+    }
+
+    /**
+     * @brief Fold in the stats of a batch run after this one (busy times add up)
+     */
+    void add(const WorkQueueStats& batch);
+
+    /**
+     * @brief One-line human-readable summary for --resource-info output
+     */
+    std::string summary() const;
+};
+
+/**
+ * @class WorkQueue
+ * @brief Longest-processing-time-first work distribution with stealing
+ *
+ * Worker ids are 0 .. num_workers-1 and each id must be used by exactly one
+ * thread. next() is thread-safe; stats() must only be called once all
+ * workers have finished.
+ */
+class WorkQueue
+{
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Lane
+    {
+        std::mutex         mutex;
+        std::deque<size_t> items;
+        size_t             steals = 0;  ///< Written by the owner only
+        double             busy   = 0.0;
+        Clock::time_point  started;
+        bool               running = false;
+    };
+
+    std::unique_ptr<Lane[]> lanes;
+    unsigned int            num_lanes;
+    size_t                  num_items;
+
+    bool pop_own(Lane& lane, size_t& index);
+    bool steal(unsigned int worker, size_t& index);
+
+public:
+    /**
+     * @brief Distribute items over the workers
+     * @param costs Relative cost of every item (e.g. file size in bytes); item ids are the positions
+     * @param num_workers Number of worker lanes (at least 1 is used)
+     */
+    WorkQueue(const std::vector<std::uint64_t>& costs, unsigned int num_workers);
+
+    WorkQueue(const WorkQueue&)            = delete;
+    WorkQueue& operator=(const WorkQueue&) = delete;
+
+    /**
+     * @brief Size in bytes of each file, used as its cost (0 if it cannot be read)
+     *
+     * Stats every file; for lists that come from discover_files() use the
+     * FileEntry overload, which reuses the sizes discovery already read.
+     */
+    static std::vector<std::uint64_t> file_costs(const std::vector<std::string>& files);
+
+    /**
+     * @brief Costs of discovered files, reusing the sizes cached during discovery
+     *
+     * Only entries whose size is not known yet are looked up.
+     */
+    static std::vector<std::uint64_t> file_costs(const std::vector<FileEntry>& files);
+
+    /**
+     * @brief Fetch the next item for a worker
+     * @param worker Id of the calling worker
+     * @param index [out] Item id (position in the costs vector)
+     * @return false when no work is left anywhere
+     *
+     * The time between two calls is accounted as busy time of @p worker.
+     */
+    bool next(unsigned int worker, size_t& index);
+
+    /**
+     * @brief Load distribution of the finished run
+     */
+    WorkQueueStats stats() const;
+};
+
+#endif  // WORK_QUEUE_H
@@ -0,0 +1,113 @@
+/**
+ * @file worker_buffers.h
+ * @brief Per-worker result buffers and relaxed progress counters for batch commands
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Batch workers used to lock one shared mutex per file to append a result or
+ * bump a summary counter. With many threads and small files that lock is the
+ * bottleneck. Instead, each worker writes to its own slot (padded to a cache
+ * line so neighbouring slots do not share one) and the slots are merged once
+ * after all workers have joined. Progress is tracked with a relaxed atomic
+ * counter, which only orders increments among themselves.
+ */
+
+#ifndef WORKER_BUFFERS_H
+#define WORKER_BUFFERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * @class PerWorker
+ * @brief One value of type T per worker, each on its own cache line
+ *
+ * Worker @c w may only touch slot @c w while the workers run; the slots are
+ * read by one thread after they have been joined.
+ */
+template <typename T>
+class PerWorker
+{
+private:
+    struct alignas(64) Slot
+    {
+        T value{};
+    };
+
+    std::vector<Slot> slots;
+
+public:
+    explicit PerWorker(unsigned int num_workers) : slots(std::max(1u, num_workers)) {}
+
+    T& operator[](unsigned int worker)
+    {
+        return slots[worker].value;
+    }
+
+    size_t size() const
+    {
+        return slots.size();
+    }
+
+    /**
+     * @brief Call f(value) for every slot in worker order
+     */
+    template <typename Function>
+    void for_each(Function&& f)
+    {
+        for (auto& slot : slots)
+        {
+            f(slot.value);
+        }
+    }
+};
+
+/**
+ * @brief Move the per-worker vectors into one vector, in worker order
+ */
+template <typename T>
+std::vector<T> merge_worker_buffers(PerWorker<std::vector<T>>& buffers)
+{
+    size_t total = 0;
+    buffers.for_each([&total](std::vector<T>& items) { total += items.size(); });
+
+    std::vector<T> merged;
+    merged.reserve(total);
+    buffers.for_each([&merged](std::vector<T>& items) {
+        merged.insert(merged.end(), std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+        items.clear();
+    });
+    return merged;
+}
+
+/**
+ * @class ProgressCounter
+ * @brief Completed-item counter for progress reporting
+ *
+ * Uses relaxed atomics: the value is only used to decide when to print
+ * progress, never to publish results.
+ */
+class ProgressCounter
+{
+private:
+    std::atomic<size_t> count{0};
+
+public:
+    /**
+     * @brief Count one finished item and return the new total
+     */
+    size_t increment()
+    {
+        return count.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    size_t load() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+};
+
+#endif  // WORKER_BUFFERS_H
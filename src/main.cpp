@@ -32,8 +32,13 @@
 #include "commands/extract_coords_command.h"
 #include "commands/create_input_command.h"
 #include "commands/ivcoord_command.h"
+#include "commands/query_command.h"
+#include "utilities/parse_stats.h"
+#include "utilities/profiler.h"
+#include "utilities/trace_recorder.h"
 #include <atomic>
 #include <csignal>
+#include <fstream>
 #include <iostream>
 
 
@@ -64,6 +69,28 @@ void signalHandler(int signal)
     g_shutdown_requested.store(true);
 }
 
+/**
+ * @brief Print the --profile report, or write it as JSON to --profile-out
+ * @param context Parsed context of the run
+ * @param cmd_name Name of the command that ran
+ */
+static void write_profile_report(const CommandContext& context, const std::string& cmd_name)
+{
+    if (context.profile_out.empty())
+    {
+        Profiler::instance().write_text(std::cerr, cmd_name);
+        return;
+    }
+
+    std::ofstream out(context.profile_out);
+    if (!out)
+    {
+        std::cerr << "Warning: could not write profile report " << context.profile_out << std::endl;
+        Profiler::instance().write_text(std::cerr, cmd_name);
+        return;
+    }
+    Profiler::instance().write_json(out, cmd_name);
+}
 
 /**
  * @brief Main entry point for the ComChemKit application
@@ -139,6 +166,7 @@ int main(int argc, char* argv[])
     registry.register_command(std::make_unique<ExtractCoordsCommand>());
     registry.register_command(std::make_unique<CreateInputCommand>());
     registry.register_command(std::make_unique<IVCoordCommand>());
+    registry.register_command(std::make_unique<QueryCommand>());
 
     // Install signal handlers for graceful shutdown
     std::signal(SIGINT, signalHandler);
@@ -222,12 +250,43 @@ int main(int argc, char* argv[])
             std::string cmd_name = CommandParser::get_command_name(context.command);
             ICommand* cmd = CommandRegistry::get_instance().get_command(cmd_name);
             
+            if (context.profile)
+            {
+                Profiler::instance().enable();
+            }
+            if (!context.trace_out.empty())
+            {
+                TraceRecorder::instance().enable();
+            }
+            if (context.stats)
+            {
+#ifdef CCK_NO_STATS
+                std::cerr << "Warning: --stats is not available in this build (compiled with CCK_NO_STATS)"
+                          << std::endl;
+#else
+                ParseStats::instance().enable();
+#endif
+            }
+
             if (cmd) {
                 command_result = cmd->execute(context);
             } else {
                 std::cerr << "Error: Unknown or unregistered command type: " << cmd_name << std::endl;
             }
 
+            if (context.profile)
+            {
+                write_profile_report(context, cmd_name);
+            }
+            if (ParseStats::instance().enabled())
+            {
+                ParseStats::instance().write_text(std::cerr);
+            }
+            if (!context.trace_out.empty() && !TraceRecorder::instance().write(context.trace_out, cmd_name))
+            {
+                std::cerr << "Warning: could not write trace " << context.trace_out << std::endl;
+            }
+
             return command_result;
         }
     }
@@ -11,17 +11,21 @@
 
 #include "thermo/calc.h"
 #include "thermo/chemsys.h"
-#include "thermo/omp_config.h"
 #include "thermo/loadfile.h"
 #include "thermo/symmetry.h"
 #include "thermo/util.h"
+#include "thermo/vib_kernel.h"
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace util;
@@ -36,7 +40,16 @@ namespace calc
 
     // Forward declarations
     void elecontri(const SystemData& sys, double T, double& tmpq, double& tmpheat, double& tmpCV, double& tmpS);
+    void elecontri(const double* elevel, const int* edegen, int nelevel, double T, double& tmpq, double& tmpheat,
+                   double& tmpCV, double& tmpS);
+    void transcontri(const SystemData& sys, double T, double P, ThermoResult& r);
+    void transcontri(int ipmode, double totmass, double T, double P, ThermoResult& r);
+    void rotcontri(int ipmode, const double* inert, int ilinear, int rotsym, double T, ThermoResult& r);
+    void vibcontri(const VibSums& vib, ThermoResult& r);
+    void rotvibelecontri(const SystemData& sys, double T, ThermoResult& r);
+    void sumcontri(double T, ThermoResult& r);
     void getvibcontri(const SystemData& sys, int i, double T, double& tmpZPE, double& tmpheat, double& tmpCV, double& tmpS);
+    MemberThermo loadmember(EnsembleMember& member, size_t index, size_t nfile);
 
 
     /**
@@ -69,276 +82,533 @@ namespace calc
     }
 
 
-    /**
-     * @brief Perform ensemble averaging calculations across multiple input files
-     *
-     * This function processes multiple molecular geometry files and computes
-     * averaged thermodynamic properties using Boltzmann weighting. It loads
-     * each file, performs thermochemistry calculations, and accumulates results
-     * for ensemble averaging.
-     *
-     * @param sys SystemData structure containing calculation parameters
-     * @param filelist Vector of input file paths to process
-     * @param Elist [out] Electronic energies for each file
-     * @param Ulist [out] Internal energies for each file
-     * @param Hlist [out] Enthalpies for each file
-     * @param Glist [out] Gibbs energies for each file
-     * @param Slist [out] Entropies for each file
-     * @param CVlist [out] Constant volume heat capacities for each file
-     * @param CPlist [out] Constant pressure heat capacities for each file
-     * @param QVlist [out] Vibrational partition functions for each file
-     * @param Qbotlist [out] Bottom partition functions for each file
-     *
-     * @note Supports multiple file formats: .otm, Gaussian, ORCA, GAMESS, NWChem, CP2K, xTB
-     * @note Automatically detects file format and loads appropriate parser
-     */
-    void ensemble(SystemData&                     sys,
-                  const std::vector<std::string>& filelist,
-                  std::vector<double>&            Elist,
-                  std::vector<double>&            Ulist,
-                  std::vector<double>&            Hlist,
-                  std::vector<double>&            Glist,
-                  std::vector<double>&            Slist,
-                  std::vector<double>&            CVlist,
-                  std::vector<double>&            CPlist,
-                  std::vector<double>&            QVlist,
-                  std::vector<double>&            Qbotlist)
+    // Helper: load one ensemble member and compute its thermochemistry at the T and P of sys
+    //
+    // Notes are written to util::report(), which the caller redirects per member.
+    // The member keeps only what calcthermo needs; its atoms are dropped.
+    MemberThermo loadmember(EnsembleMember& member, size_t index, size_t nfile)
     {
-        int                 nfile = filelist.size();
-        std::vector<double> wei(nfile);
-        for (int ifile = 0; ifile < nfile; ++ifile)
+        SystemData& sys = member.sys;
+        sys.inputfile   = member.file;
+        if (!file_exists(sys.inputfile))
+        {
+            throw std::runtime_error("Unable to find " + sys.inputfile);
+        }
+
+        util::report() << "Processing " << sys.inputfile << "... (" << (index + 1) << " of " << nfile << " )" << "\n";
+
+        size_t otm_pos = sys.inputfile.find(".otm");
+        if (otm_pos != std::string::npos)
+        {
+            LoadFile::loadotm(sys);
+        }
+        else
         {
-            sys.inputfile = filelist[ifile];
-            if (!file_exists(sys.inputfile))
+            auto pcprog = deterprog(sys);
+            if (pcprog == QuantumChemistryProgram::Unknown)
             {
-                throw std::runtime_error("Unable to find " + sys.inputfile);
+                throw std::runtime_error("Invalid program type for file " + sys.inputfile);
             }
+            if (pcprog == QuantumChemistryProgram::Gaussian)
+                LoadFile::loadgau(sys);
+            else if (pcprog == QuantumChemistryProgram::Orca)
+                LoadFile::loadorca(sys);
+            else if (pcprog == QuantumChemistryProgram::Gamess)
+                LoadFile::loadgms(sys);
+            else if (pcprog == QuantumChemistryProgram::Nwchem)
+                LoadFile::loadnw(sys);
+            else if (pcprog == QuantumChemistryProgram::Cp2k)
+                LoadFile::loadCP2K(sys);
+            else if (pcprog == QuantumChemistryProgram::Xtb)
+                LoadFile::loadxtb(sys);
+            else if (pcprog == QuantumChemistryProgram::Vasp)
+                LoadFile::loadvasp(sys);
+
+            modmass(sys);
+            sys.nelevel = 1;
+            sys.elevel  = {0.0};
+            int deg     = std::max(sys.spinmult, 1);
+            sys.edegen  = {deg};
+            if (sys.outotm == 1)
+                outotmfile(sys);
+        }
 
-            std::cout << "Processing " << sys.inputfile << "... (" << (ifile + 1) << " of " << nfile << " )" << "\n";
+        if (sys.Eexter != 0.0)
+        {
+            sys.E = sys.Eexter;
+            util::report() << "Note: The electronic energy specified by Eexter will be used" << "\n";
+        }
+        else if (sys.E != 0.0)
+        {
+            util::report() << "Note: The electronic energy extracted from file will be used" << "\n";
+        }
 
-            size_t otm_pos = sys.inputfile.find(".otm");
-            if (otm_pos != std::string::npos)
+        sys.totmass = 0.0;
+        for (const auto& atom : sys.a)
+        {
+            sys.totmass += atom.mass;
+        }
+
+        calcinertia(sys);
+
+        sys.ilinear = 0;
+        for (double in : sys.inert)
+        {
+            if (in < 0.001)
             {
-                LoadFile::loadotm(sys);
+                sys.ilinear = 1;
+                break;
             }
-            else
+        }
+
+        // Symmetry detection
+        symmetry::SymmetryDetector symDetector;
+        symDetector.ncenter = sys.a.size();
+        symDetector.a       = sys.a;
+        symDetector.a_index.resize(sys.a.size());
+        for (size_t i = 0; i < sys.a.size(); ++i)
+        {
+            symDetector.a_index[i] = i;
+        }
+        symDetector.detectPG(sys.prtvib ? 1 : 0);
+        sys.rotsym = symDetector.rotsym;
+        sys.PGname = symDetector.PGname;
+
+        // Handle imaginary frequencies
+        if (sys.imagreal != 0.0)
+        {
+            for (int j = 0; j < sys.nfreq; ++j)
             {
-                auto pcprog = deterprog(sys);
-                if (pcprog == QuantumChemistryProgram::Unknown)
+                if (sys.wavenum[j] < 0 && std::abs(sys.wavenum[j]) < sys.imagreal)
                 {
-                    throw std::runtime_error("Invalid program type for file " + sys.inputfile);
+                    sys.wavenum[j] = std::abs(sys.wavenum[j]);
+                    util::report() << "Note: Imaginary frequency " << sys.wavenum[j] << " cm^-1 set to real frequency!"
+                                   << "\n";
                 }
-                if (pcprog == QuantumChemistryProgram::Gaussian)
-                    LoadFile::loadgau(sys);
-                else if (pcprog == QuantumChemistryProgram::Orca)
-                    LoadFile::loadorca(sys);
-                else if (pcprog == QuantumChemistryProgram::Gamess)
-                    LoadFile::loadgms(sys);
-                else if (pcprog == QuantumChemistryProgram::Nwchem)
-                    LoadFile::loadnw(sys);
-                else if (pcprog == QuantumChemistryProgram::Cp2k)
-                    LoadFile::loadCP2K(sys);
-                else if (pcprog == QuantumChemistryProgram::Xtb)
-                    LoadFile::loadxtb(sys);
-                else if (pcprog == QuantumChemistryProgram::Vasp)
-                    LoadFile::loadvasp(sys);
-
-                modmass(sys);
-                sys.nelevel = 1;
-                sys.elevel  = {0.0};
-                int deg     = std::max(sys.spinmult, 1);
-                sys.edegen  = {deg};
-                if (sys.outotm == 1)
-                    outotmfile(sys);
             }
+        }
 
-            if (sys.Eexter != 0.0)
-            {
-                sys.E = sys.Eexter;
-                std::cout << "Note: The electronic energy specified by Eexter will be used" << "\n";
-            }
-            else if (Elist[ifile] != 0.0)
-            {
-                sys.E = Elist[ifile];
-            }
-            else
+        sys.freq.resize(sys.nfreq);
+        for (int j = 0; j < sys.nfreq; ++j)
+        {
+            sys.freq[j] = sys.wavenum[j] * wave2freq;
+        }
+
+        sys.a.clear();
+        sys.a.shrink_to_fit();
+        sys.inputview = FileView();
+
+        return memberthermo(sys, sys.T, sys.P);
+    }
+
+
+    /**
+     * @brief Thermochemistry of one loaded ensemble member at (T, P)
+     */
+    MemberThermo memberthermo(const SystemData& sys, double T, double P)
+    {
+        ThermoResult r = calcthermo(sys, T, P);
+        MemberThermo m;
+        m.E  = sys.E;
+        m.U  = r.corrU / au2kJ_mol + sys.E;
+        m.H  = r.corrH / au2kJ_mol + sys.E;
+        m.G  = r.corrG / au2kJ_mol + sys.E;
+        m.S  = r.S_tot;
+        m.CV = r.CV_tot;
+        m.CP = r.CP_tot;
+        return m;
+    }
+
+
+    /**
+     * @brief Natural logarithm of the Boltzmann weight of every member
+     *
+     * Uses log-sum-exp around the lowest G, so no exponential under- or
+     * overflows however large the ensemble or the spread of G.
+     */
+    std::vector<double> boltzmannlogweights(const std::vector<double>& G, double T)
+    {
+        std::vector<double> logw(G.size());
+        if (G.empty())
+            return logw;
+
+        const double Gmin  = *std::min_element(G.begin(), G.end());
+        const double scale = au2kJ_mol * 1000.0 / (R * T);  // a.u. -> units of RT
+        double       sum   = 0.0;
+        for (size_t i = 0; i < G.size(); ++i)
+        {
+            logw[i] = -(G[i] - Gmin) * scale;  // <= 0, the lowest member is exactly 0
+            sum += std::exp(logw[i]);
+        }
+        const double logsum = std::log(sum);  // sum >= 1
+        for (double& lw : logw)
+        {
+            lw -= logsum;
+        }
+        return logw;
+    }
+
+
+    /**
+     * @brief Boltzmann-weight member properties computed at one (T, P)
+     */
+    EnsembleAverage weighensemble(const std::vector<MemberThermo>& thermo, double T, double P)
+    {
+        EnsembleAverage avg;
+        avg.T = T;
+        avg.P = P;
+
+        std::vector<double> G(thermo.size());
+        for (size_t i = 0; i < thermo.size(); ++i)
+        {
+            G[i] = thermo[i].G;
+        }
+        const std::vector<double> logw = boltzmannlogweights(G, T);
+
+        avg.weight.resize(thermo.size());
+        for (size_t i = 0; i < thermo.size(); ++i)
+        {
+            const double w = std::exp(logw[i]);
+            avg.weight[i]  = w;
+            avg.E += w * thermo[i].E;
+            avg.U += w * thermo[i].U;
+            avg.H += w * thermo[i].H;
+            avg.S += w * thermo[i].S;
+            avg.CV += w * thermo[i].CV;
+            avg.confS -= R * w * logw[i];
+        }
+        avg.S += avg.confS;
+        avg.G = avg.H - T * avg.S / 1000.0 / au2kJ_mol;
+        return avg;
+    }
+
+
+    /**
+     * @brief Load ensemble members concurrently and hand them back in list order
+     *
+     * Members are claimed in list order by up to num_threads workers. A worker
+     * does not start a member more than a few members ahead of the one the
+     * calling thread is waiting for, so the reports and results that are
+     * finished but not yet delivered stay bounded however long the list is.
+     * The calling thread prints each member's notes, adds the member to the
+     * returned MoleculeBatch and calls on_member in list order; nothing else
+     * of a member is kept. The first failing member's error is rethrown after
+     * the members before it were delivered.
+     */
+    MoleculeBatch loadensemble(const SystemData&               sys,
+                               const std::vector<std::string>& filelist,
+                               unsigned int                    num_threads,
+                               const MemberCallback&           on_member)
+    {
+        struct Finished
+        {
+            bool           done = false;
+            EnsembleMember member;
+            MemberThermo   thermo;
+            std::string  report;
+            std::string  error;
+        };
+
+        const size_t nfile = filelist.size();
+        num_threads        = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(num_threads, nfile)));
+        const size_t ahead = 4 * static_cast<size_t>(num_threads);  // members finished but not yet delivered
+
+        MoleculeBatch               members;
+        std::vector<Finished>       finished(nfile);
+        std::mutex                  mutex;
+        std::condition_variable     changed;
+        size_t                      next_claim   = 0;
+        size_t                      next_deliver = 0;
+        bool                        stop         = false;
+
+        std::ios report_format(nullptr);
+        report_format.copyfmt(util::report());
+
+        auto worker = [&]() {
+            for (;;)
             {
-                Elist[ifile] = sys.E;
-                if (sys.E != 0.0)
+                size_t index;
                 {
-                    std::cout << "Note: The electronic energy extracted from file will be used" << "\n";
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&] { return stop || next_claim >= nfile || next_claim < next_deliver + ahead; });
+                    if (stop || next_claim >= nfile)
+                        return;
+                    index = next_claim++;
                 }
-            }
 
-            sys.totmass = 0.0;
-            for (const auto& atom : sys.a)
-            {
-                sys.totmass += atom.mass;
+                EnsembleMember member;
+                member.file = filelist[index];
+                member.sys  = sys;
+
+                Finished           outcome;
+                std::ostringstream notes;
+                notes.copyfmt(report_format);
+                try
+                {
+                    util::ReportCapture capture(notes);
+                    outcome.thermo = loadmember(member, index, nfile);
+                }
+                catch (const std::exception& e)
+                {
+                    outcome.error = e.what();
+                }
+                outcome.report = notes.str();
+                outcome.done   = true;
+
+                outcome.member = std::move(member);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                finished[index] = std::move(outcome);
+                changed.notify_all();
             }
+        };
 
-            calcinertia(sys);
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            workers.emplace_back(worker);
+        }
 
-            sys.ilinear = 0;
-            for (double in : sys.inert)
+        std::string error;
+        for (size_t index = 0; index < nfile; ++index)
+        {
+            Finished outcome;
             {
-                if (in < 0.001)
-                {
-                    sys.ilinear = 1;
-                    break;
-                }
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return finished[index].done; });
+                outcome = std::move(finished[index]);
+                finished[index] = Finished();
             }
 
-            // Symmetry detection
-            symmetry::SymmetryDetector symDetector;
-            symDetector.ncenter = sys.a.size();
-            symDetector.a       = sys.a;
-            symDetector.a_index.resize(sys.a.size());
-            for (size_t i = 0; i < sys.a.size(); ++i)
+            util::report() << outcome.report;
+            if (!outcome.error.empty())
             {
-                symDetector.a_index[i] = i;
+                error = outcome.error;
+                break;
             }
-            symDetector.detectPG(sys.prtvib ? 1 : 0);
-            sys.rotsym  = symDetector.rotsym;
-            sys.PGname = symDetector.PGname;
+            members.add(outcome.member.sys);
+            if (on_member)
+                on_member(index, outcome.member, outcome.thermo);
 
-            // Handle imaginary frequencies
-            if (sys.imagreal != 0.0)
+            std::lock_guard<std::mutex> lock(mutex);
+            ++next_deliver;
+            changed.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+            changed.notify_all();
+        }
+        for (auto& t : workers)
+        {
+            t.join();
+        }
+
+        if (!error.empty())
+        {
+            throw std::runtime_error(error);
+        }
+        return members;
+    }
+
+
+    /**
+     * @brief Perform ensemble averaging calculations across multiple input files
+     *
+     * Members are loaded concurrently with loadensemble() on up to
+     * sys.exec.omp_threads_actual threads, their notes are printed in list
+     * order, and the table, Boltzmann weights and weighted data are printed
+     * at sys.T and sys.P. When a T/P scan is set, the loaded members are
+     * re-weighted at every scan point without reading the files again.
+     *
+     * @param sys SystemData structure containing calculation parameters
+     * @param filelist Vector of input file paths to process
+     * @param memberfile If not empty, per-member results are streamed to this file as members complete
+     *
+     * @note Supports multiple file formats: .otm, Gaussian, ORCA, GAMESS, NWChem, CP2K, xTB, VASP
+     * @throws std::runtime_error if a member cannot be found or loaded, or memberfile cannot be created
+     */
+    void ensemble(SystemData& sys, const std::vector<std::string>& filelist, const std::string& memberfile)
+    {
+        const size_t nfile = filelist.size();
+        if (nfile == 0)
+            return;
+
+        std::ofstream rows;
+        if (!memberfile.empty())
+        {
+            rows.open(memberfile, std::ios::out);
+            if (!rows.is_open())
             {
-                for (int j = 0; j < sys.nfreq; ++j)
-                {
-                    if (sys.wavenum[j] < 0 && std::abs(sys.wavenum[j]) < sys.imagreal)
-                    {
-                        sys.wavenum[j] = std::abs(sys.wavenum[j]);
-                        std::cout << "Note: Imaginary frequency " << sys.wavenum[j] << " cm^-1 set to real frequency!"
-                                  << "\n";
-                    }
-                }
+                throw std::runtime_error("Failed to create output file: " + memberfile);
             }
+            rows << "# T = " << std::fixed << std::setprecision(3) << sys.T << " K, P = " << sys.P << " atm"
+                 << "; E, U, H and G in a.u.; S, CV and CP in J/mol/K\n"
+                 << "#System            E                U                H                G           S          CV"
+                 << "          CP  File\n";
+        }
 
-            std::vector<double> freq(sys.nfreq);
-            for (int j = 0; j < sys.nfreq; ++j)
+        std::vector<MemberThermo> thermo;
+        thermo.reserve(nfile);
+        auto on_member = [&](size_t index, const EnsembleMember& member, const MemberThermo& m) {
+            thermo.push_back(m);
+            if (rows.is_open())
             {
-                freq[j] = sys.wavenum[j] * wave2freq;
+                rows << std::fixed << std::setprecision(6) << std::setw(7) << (index + 1) << std::setw(17) << m.E
+                     << std::setw(17) << m.U << std::setw(17) << m.H << std::setw(17) << m.G << std::setprecision(3)
+                     << std::setw(12) << m.S << std::setw(12) << m.CV << std::setw(12) << m.CP << "  " << member.file
+                     << "\n";
             }
-            sys.freq = freq;
-
-            double thermU, thermH, thermG, CP_tot, QV, Qbot;
-            calcthermo(sys, sys.T, sys.P, thermU, thermH, thermG, Slist[ifile], CVlist[ifile], CP_tot, QV, Qbot);
-            sys.thermG = thermG;
-
-            Glist[ifile] = thermG / au2kJ_mol + sys.E;
-
-            Ulist[ifile]    = thermU / au2kJ_mol + sys.E;
-            Hlist[ifile]    = thermH / au2kJ_mol + sys.E;
-            CPlist[ifile]   = CP_tot / au2kJ_mol;
-            QVlist[ifile]   = QV / NA;
-            Qbotlist[ifile] = Qbot / NA;
-
-            sys.a.clear();
-            sys.elevel.clear();
-            sys.edegen.clear();
-            sys.freq.clear();
-            sys.wavenum.clear();
-        }
-
-        std::cout << "\n";
-        double qall = 0.0;
-        double Gmin = *std::min_element(Glist.begin(), Glist.end());
-        std::cout << "#System       U               H               G             S          CV" << "\n";
-        std::cout << "             a.u.            a.u.            a.u.        J/mol/K     J/mol/K" << "\n";
-        for (int ifile = 0; ifile < nfile; ++ifile)
-        {
-            double dG = (Glist[ifile] - Gmin) * au2kJ_mol * 1000.0;  // Relative free energy in J/mol
-            qall += std::exp(-dG / (R * sys.T));
-            std::cout << std::fixed << std::setprecision(6) << std::setw(5) << (ifile + 1) << std::setw(16)
-                      << Ulist[ifile] << std::setw(16) << Hlist[ifile] << std::setw(16) << Glist[ifile]
-                      << std::setprecision(3) << std::setw(12) << Slist[ifile] << std::setw(12) << CVlist[ifile]
-                      << "\n";
-        }
-
-        std::cout << "\n";
-        for (int ifile = 0; ifile < nfile; ++ifile)
-        {
-            double dG  = (Glist[ifile] - Gmin) * au2kJ_mol * 1000.0;
-            wei[ifile] = std::exp(-dG / (R * sys.T)) / qall;
-            std::cout << " System" << std::setw(5) << (ifile + 1) << "     Relative G=" << std::fixed
-                      << std::setprecision(3) << std::setw(9) << (Glist[ifile] - Gmin) * au2kJ_mol
-                      << " kJ/mol     Boltzmann weight=" << std::setprecision(3) << std::setw(8) << wei[ifile] * 100.0
-                      << " %" << "\n";
-        }
-
-        double weiE = 0.0, weiU = 0.0, weiH = 0.0, weiS = 0.0, weiCV = 0.0;
-        for (int ifile = 0; ifile < nfile; ++ifile)
-        {
-            weiE += wei[ifile] * Elist[ifile];
-            weiU += wei[ifile] * Ulist[ifile];
-            weiH += wei[ifile] * Hlist[ifile];
-            weiS += wei[ifile] * Slist[ifile];
-            weiCV += wei[ifile] * CVlist[ifile];
-        }
-        double confS = 0.0;
-        for (int ifile = 0; ifile < nfile; ++ifile)
-        {
-            if (wei[ifile] > 0.0)
-                confS -= R * wei[ifile] * std::log(wei[ifile]);
-        }
-        weiS += confS;
-        double weiG = weiH - sys.T * weiS / 1000.0 / au2kJ_mol;
-        std::cout << "\n";
-        std::cout << "Conformation weighted data:" << "\n";
-        std::cout << " Electronic energy: " << std::fixed << std::setprecision(6) << std::setw(16) << weiE << " a.u."
-                  << "\n";
-        std::cout << " U: " << std::setw(16) << weiU << " a.u." << "\n";
-        std::cout << " H: " << std::setw(16) << weiH << " a.u." << "\n";
-        std::cout << " G: " << std::setw(16) << weiG << " a.u." << "\n";
-        std::cout << " S: " << std::fixed << std::setprecision(3) << std::setw(13) << weiS
-                  << " J/mol/K    Conformation entropy:" << std::setw(10) << confS << " J/mol/K" << "\n";
-        std::cout << " CV:" << std::setw(13) << weiCV << " J/mol/K" << "\n";
-        std::cout << " CP:" << std::setw(13) << weiCV + R << " J/mol/K" << "\n";
+        };
+        const unsigned int num_threads = static_cast<unsigned int>(std::max(1, sys.exec.omp_threads_actual));
+        const MoleculeBatch members = loadensemble(sys, filelist, num_threads, on_member);
+        rows.close();
+
+        const EnsembleAverage avg  = weighensemble(thermo, sys.T, sys.P);
+        double                Gmin = thermo[0].G;
+        for (const auto& m : thermo)
+        {
+            Gmin = std::min(Gmin, m.G);
+        }
+
+        util::report() << "\n";
+        util::report() << "#System       U               H               G             S          CV" << "\n";
+        util::report() << "             a.u.            a.u.            a.u.        J/mol/K     J/mol/K" << "\n";
+        for (size_t ifile = 0; ifile < nfile; ++ifile)
+        {
+            util::report() << std::fixed << std::setprecision(6) << std::setw(5) << (ifile + 1) << std::setw(16)
+                           << thermo[ifile].U << std::setw(16) << thermo[ifile].H << std::setw(16) << thermo[ifile].G
+                           << std::setprecision(3) << std::setw(12) << thermo[ifile].S << std::setw(12)
+                           << thermo[ifile].CV << "\n";
+        }
+
+        util::report() << "\n";
+        for (size_t ifile = 0; ifile < nfile; ++ifile)
+        {
+            util::report() << " System" << std::setw(5) << (ifile + 1) << "     Relative G=" << std::fixed
+                           << std::setprecision(3) << std::setw(9) << (thermo[ifile].G - Gmin) * au2kJ_mol
+                           << " kJ/mol     Boltzmann weight=" << std::setprecision(3) << std::setw(8)
+                           << avg.weight[ifile] * 100.0 << " %" << "\n";
+        }
+
+        util::report() << "\n";
+        util::report() << "Conformation weighted data:" << "\n";
+        util::report() << " Electronic energy: " << std::fixed << std::setprecision(6) << std::setw(16) << avg.E << " a.u."
+                       << "\n";
+        util::report() << " U: " << std::setw(16) << avg.U << " a.u." << "\n";
+        util::report() << " H: " << std::setw(16) << avg.H << " a.u." << "\n";
+        util::report() << " G: " << std::setw(16) << avg.G << " a.u." << "\n";
+        util::report() << " S: " << std::fixed << std::setprecision(3) << std::setw(13) << avg.S
+                       << " J/mol/K    Conformation entropy:" << std::setw(10) << avg.confS << " J/mol/K" << "\n";
+        util::report() << " CV:" << std::setw(13) << avg.CV << " J/mol/K" << "\n";
+        util::report() << " CP:" << std::setw(13) << avg.CV + R << " J/mol/K" << "\n";
 
         if (sys.concstr != "0")
         {
             double concnow = 0.0, concspec = std::stod(sys.concstr), Gconc;
             getGconc(sys, concnow, concspec, Gconc);
-            std::cout << "\n";
-            std::cout << " Present concentration (estimated by ideal gas model):" << std::fixed << std::setprecision(6)
-                      << std::setw(10) << concnow << " mol/L" << "\n";
-            std::cout << " Concentration specified by \"conc\" parameter:" << std::setw(12) << concspec << " mol/L"
-                      << "\n";
-            std::cout << " delta-G of conc. change:" << std::fixed << std::setprecision(3) << std::setw(11) << Gconc
-                      << " kJ/mol" << std::setw(11) << Gconc / cal2J << " kcal/mol" << std::setprecision(6)
-                      << std::setw(11) << Gconc / au2kJ_mol << " a.u." << "\n";
-            std::cout << " Weighted Gibbs free energy at specified concentration: " << std::fixed
-                      << std::setprecision(7) << std::setw(19) << (weiG + Gconc / au2kJ_mol) << " a.u." << "\n";
+            util::report() << "\n";
+            util::report() << " Present concentration (estimated by ideal gas model):" << std::fixed << std::setprecision(6)
+                           << std::setw(10) << concnow << " mol/L" << "\n";
+            util::report() << " Concentration specified by \"conc\" parameter:" << std::setw(12) << concspec << " mol/L"
+                           << "\n";
+            util::report() << " delta-G of conc. change:" << std::fixed << std::setprecision(3) << std::setw(11) << Gconc
+                           << " kJ/mol" << std::setw(11) << Gconc / cal2J << " kcal/mol" << std::setprecision(6)
+                           << std::setw(11) << Gconc / au2kJ_mol << " a.u." << "\n";
+            util::report() << " Weighted Gibbs free energy at specified concentration: " << std::fixed
+                           << std::setprecision(7) << std::setw(19) << (avg.G + Gconc / au2kJ_mol) << " a.u." << "\n";
+        }
+
+        if (sys.Tstep == 0.0 && sys.Pstep == 0.0)
+            return;
+
+        // Re-weight the loaded members at every point of the T/P scan
+        double P1 = sys.P, P2 = sys.P, Ps = 1.0;
+        double T1 = sys.T, T2 = sys.T, Ts = 1.0;
+        if (sys.Tstep != 0.0)
+        {
+            T1 = sys.Tlow;
+            T2 = sys.Thigh;
+            Ts = sys.Tstep;
+        }
+        if (sys.Pstep != 0.0)
+        {
+            P1 = sys.Plow;
+            P2 = sys.Phigh;
+            Ps = sys.Pstep;
+        }
+        if (Ts <= 0 || Ps <= 0)
+            return;
+
+        const int num_step_T = static_cast<int>((T2 - T1) / Ts) + 1;
+        const int num_step_P = static_cast<int>((P2 - P1) / Ps) + 1;
+        std::vector<double> temps(num_step_T);
+        for (int i = 0; i < num_step_T; ++i)
+        {
+            temps[i] = T1 + i * Ts;
+        }
+        // All members at all temperatures in one sweep per pressure
+        std::vector<BatchThermo> sweeps(num_step_P);
+        for (int j = 0; j < num_step_P; ++j)
+        {
+            sweeps[j] = calcthermo_batch(members, sys, temps, P1 + j * Ps);
+        }
+
+        util::report() << "\n";
+        util::report() << "Conformation weighted data at the temperatures/pressures of the scan:" << "\n";
+        util::report() << "     T(K)      P(atm)            U                H                G            S     Conf. S"
+                       << "          CV" << "\n";
+        util::report() << "                               a.u.             a.u.             a.u.      J/mol/K     J/mol/K"
+                       << "     J/mol/K" << "\n";
+        for (int i = 0; i < num_step_T; ++i)
+        {
+            const double T = temps[i];
+            for (int j = 0; j < num_step_P; ++j)
+            {
+                const double       P     = P1 + j * Ps;
+                const BatchThermo& sweep = sweeps[j];
+                for (size_t ifile = 0; ifile < nfile; ++ifile)
+                {
+                    const size_t k   = sweep.index(ifile, i);
+                    MemberThermo& m  = thermo[ifile];
+                    m.E              = members.E[ifile];
+                    m.U              = sweep.corrU[k] / au2kJ_mol + m.E;
+                    m.H              = sweep.corrH[k] / au2kJ_mol + m.E;
+                    m.G              = sweep.corrG[k] / au2kJ_mol + m.E;
+                    m.S              = sweep.S[k];
+                    m.CV             = sweep.CV[k];
+                    m.CP             = sweep.CP[k];
+                }
+                const EnsembleAverage point = weighensemble(thermo, T, P);
+                util::report() << std::fixed << std::setprecision(3) << std::setw(10) << T << std::setw(10) << P
+                               << std::setprecision(6) << std::setw(17) << point.U << std::setw(17) << point.H
+                               << std::setw(17) << point.G << std::setprecision(3) << std::setw(12) << point.S
+                               << std::setw(12) << point.confS << std::setw(12) << point.CV << "\n";
+            }
         }
     }
 
 
     /**
-     * @brief Calculate thermodynamic properties at given temperature and pressure
-     *
-     * Single source of truth for all thermodynamic computation.
-     * Returns a ThermoResult with per-contribution breakdown and totals.
-     *
-     * @param sys SystemData structure with molecular data (const, not modified)
-     * @param T Temperature in Kelvin
-     * @param P Pressure in atmospheres
-     * @return ThermoResult with per-contribution breakdown and totals
-     *
-     * @note Uses fused vibrational loop with precomputed invariants for performance
-     * @note Supports Harmonic, Truhlar, Grimme, and Minenkov low-frequency treatments
+     * @brief Translational contributions; the only part of calcthermo that depends on P
      */
-    ThermoResult calcthermo(const SystemData& sys, double T, double P)
+    void transcontri(const SystemData& sys, double T, double P, ThermoResult& r)
     {
-        ThermoResult r;
+        transcontri(sys.ipmode, sys.totmass, T, P, r);
+    }
 
-        const double b2m_sq = (b2a * 1e-10) * (b2a * 1e-10);
 
-        // --- Translation ---
-        if (sys.ipmode == 0)
+    /**
+     * @brief Translational contributions of a molecule of mass totmass (amu)
+     */
+    void transcontri(int ipmode, double totmass, double T, double P, ThermoResult& r)
+    {
+        if (ipmode == 0)
         {
             double P_Pa      = P * atm2Pa;
-            double trans_base = 2.0 * M_PI * (sys.totmass * amu2kg) * kb * T / (h * h);
+            double trans_base = 2.0 * M_PI * (totmass * amu2kg) * kb * T / (h * h);
             r.q_trans  = trans_base * std::sqrt(trans_base) * R * T / P_Pa;
             r.CV_trans = 1.5 * R;
             r.CP_trans = 2.5 * R;
@@ -346,7 +616,7 @@ namespace calc
             r.H_trans  = 2.5 * R * T / 1000.0;
             r.S_trans  = R * (std::log(r.q_trans / NA) + 2.5);
         }
-        else if (sys.ipmode == 1)
+        else if (ipmode == 1)
         {
             r.q_trans  = 1.0;
             r.CV_trans = 0.0;
@@ -355,11 +625,30 @@ namespace calc
             r.H_trans  = 0.0;
             r.S_trans  = 0.0;
         }
+    }
+
 
-        // --- Rotation ---
-        if (sys.ipmode == 0)
+    /**
+     * @brief Rotational, vibrational and electronic contributions at temperature T
+     */
+    void rotvibelecontri(const SystemData& sys, double T, ThermoResult& r)
+    {
+        rotcontri(sys.ipmode, sys.inert.data(), sys.ilinear, sys.rotsym, T, r);
+        vibcontri(vibsum(sys, T), r);
+        elecontri(sys, T, r.q_ele, r.U_ele, r.CV_ele, r.S_ele);
+    }
+
+
+    /**
+     * @brief Rotational contributions from the three principal moments of inertia (amu*Bohr^2)
+     */
+    void rotcontri(int ipmode, const double* inert, int ilinear, int rotsym, double T, ThermoResult& r)
+    {
+        const double b2m_sq = (b2a * 1e-10) * (b2a * 1e-10);
+
+        if (ipmode == 0)
         {
-            double sum_inert = sys.inert[0] + sys.inert[1] + sys.inert[2];
+            double sum_inert = inert[0] + inert[1] + inert[2];
             if (sum_inert < 1e-10)
             {
                 r.q_rot  = 1.0;
@@ -372,13 +661,13 @@ namespace calc
                 std::array<double, 3> inertkg;
                 for (int i = 0; i < 3; ++i)
                 {
-                    inertkg[i] = sys.inert[i] * amu2kg * b2m_sq;
+                    inertkg[i] = inert[i] * amu2kg * b2m_sq;
                 }
-                if (sys.ilinear == 1)
+                if (ilinear == 1)
                 {   // Linear molecule: use the largest moment of inertia
                     // (the near-zero moment is rotation about the molecular axis)
                     double largest_inertkg = *std::max_element(inertkg.begin(), inertkg.end());
-                    r.q_rot  = 8.0 * M_PI * M_PI * largest_inertkg * kb * T / sys.rotsym / (h * h);
+                    r.q_rot  = 8.0 * M_PI * M_PI * largest_inertkg * kb * T / rotsym / (h * h);
                     r.U_rot  = R * T / 1000.0;
                     r.CV_rot = R;
                     r.S_rot  = R * (std::log(r.q_rot) + 1.0);
@@ -386,7 +675,7 @@ namespace calc
                 else
                 {   // Non-linear molecule
                     double rot_base = 2.0 * M_PI * kb * T;
-                    r.q_rot = 8.0 * M_PI * M_PI / sys.rotsym / (h * h * h) *
+                    r.q_rot = 8.0 * M_PI * M_PI / rotsym / (h * h * h) *
                               rot_base * std::sqrt(rot_base) *
                               std::sqrt(inertkg[0] * inertkg[1] * inertkg[2]);
                     r.U_rot  = 1.5 * R * T / 1000.0;
@@ -395,173 +684,36 @@ namespace calc
                 }
             }
         }
-        else if (sys.ipmode == 1)
+        else if (ipmode == 1)
         {
             r.q_rot  = 1.0;
             r.U_rot  = 0.0;
             r.CV_rot = 0.0;
             r.S_rot  = 0.0;
         }
+    }
 
-        // --- Vibration (fused loop) ---
-        double log_qvib_v0 = 0.0, log_qvib_bot = 0.0;
-        double ZPE = 0.0, U_vib_heat = 0.0, CV_vib = 0.0, S_vib = 0.0;
-
-        const double h_over_kbT = h / (kb * T);
-        const double RT_1000    = R * T / 1000.0;
-        const double zpe_factor = sys.sclZPE / 2.0 / au2cm_1 * au2kJ_mol;
-        const int    nfreq      = sys.nfreq;
-        const auto   lowVib     = sys.lowVibTreatment;
-        const double ravib_freq = sys.ravib * wave2freq;
-        const double sclheat    = sys.sclheat;
-        const double sclCV      = sys.sclCV;
-        const double sclS       = sys.sclS;
-        const bool   uniform_scaling = (sclheat == 1.0 && sclCV == 1.0 && sclS == 1.0);
-        const double prefac_trunc    = (lowVib == LowVibTreatment::Truhlar) ? h_over_kbT * ravib_freq : 0.0;
-        const double term_trunc      = (lowVib == LowVibTreatment::Truhlar) ? std::exp(-prefac_trunc) : 0.0;
-        const bool   do_grimme_interp = (lowVib == LowVibTreatment::Grimme || lowVib == LowVibTreatment::Minenkov);
-        const bool   do_hg_energy_interp = (lowVib == LowVibTreatment::HeadGordon);
-        const bool   do_hg_entropy = (lowVib == LowVibTreatment::HeadGordon && sys.hgEntropy);
-        constexpr double eight_pi2    = 8.0 * M_PI * M_PI;
-        const double grimme_log_base  = 8.0 * M_PI * M_PI * M_PI * sys.Bav * kb * T / (h * h);
-
-#ifdef _OPENMP
-        // Only parallelize vibrational loop when Inner strategy is active
-        // and we are not already inside a parallel region (from outer T/P scan)
-#pragma omp parallel for reduction(+:log_qvib_v0,log_qvib_bot,ZPE,U_vib_heat,CV_vib,S_vib) \
-        if(sys.exec.omp_strategy == 1 && nfreq > 50 && omp_get_level() == 0)
-#endif
-        for (int i = 0; i < nfreq; ++i)
-        {
-            double fi = sys.freq[i];
-            if (fi <= 0.0)
-                continue;
-            double wi = sys.wavenum[i];
-            bool truhlar_active = (lowVib == LowVibTreatment::Truhlar && wi < sys.ravib);
-
-            double freqtmp = truhlar_active ? ravib_freq : fi;
-            double x = h_over_kbT * freqtmp;
-            double exp_neg_x = std::exp(-x);
-            double one_minus_exp = 1.0 - exp_neg_x;
-            log_qvib_v0  += -std::log(one_minus_exp);
-            log_qvib_bot += -x / 2.0 - std::log(one_minus_exp);
-
-            double local_ZPE = wi * zpe_factor;
-
-            double pf_base = 0.0, tm_base = 0.0;
-            if (uniform_scaling)
-            {
-                pf_base = h_over_kbT * fi;
-                tm_base = (truhlar_active) ? term_trunc : std::exp(-pf_base);
-                if (truhlar_active) pf_base = prefac_trunc;
-            }
-
-            double local_heat = 0.0;
-            if (T > 0.0)
-            {
-                double pf_h, tm_h;
-                if (uniform_scaling)
-                {
-                    pf_h = pf_base; tm_h = tm_base;
-                }
-                else
-                {
-                    pf_h = h_over_kbT * fi * sclheat;
-                    tm_h = std::exp(-pf_h);
-                    if (truhlar_active) { pf_h = prefac_trunc; tm_h = term_trunc; }
-                }
-
-                if (lowVib == LowVibTreatment::Minenkov)
-                {
-                    double UvRRHO = local_ZPE + RT_1000 * pf_h * tm_h / (1.0 - tm_h);
-                    local_ZPE = 0.0;
-                    double Ufree = RT_1000 * 0.5;
-                    double ra = sys.intpvib / wi;
-                    double r2 = ra * ra;
-                    double tmpval = 1.0 + r2 * r2;
-                    local_heat = (1.0 / tmpval) * UvRRHO + (1.0 - 1.0 / tmpval) * Ufree;
-                }
-                else if (do_hg_energy_interp)
-                {
-                    double UvRRHO = local_ZPE + RT_1000 * pf_h * tm_h / (1.0 - tm_h);
-                    local_ZPE = 0.0;
-                    double Ufree = RT_1000 * 0.5;
-                    double ra = sys.intpvib / wi;
-                    double r2 = ra * ra;
-                    double tmpval = 1.0 + r2 * r2;
-                    local_heat = (1.0 / tmpval) * UvRRHO + (1.0 - 1.0 / tmpval) * Ufree;
-                }
-                else
-                {
-                    local_heat = RT_1000 * pf_h * tm_h / (1.0 - tm_h);
-                }
-            }
-
-            double pf_cv, tm_cv;
-            if (uniform_scaling)
-            {
-                pf_cv = pf_base; tm_cv = tm_base;
-            }
-            else
-            {
-                pf_cv = h_over_kbT * fi * sclCV;
-                tm_cv = std::exp(-pf_cv);
-                if (truhlar_active) { pf_cv = prefac_trunc; tm_cv = term_trunc; }
-            }
-            double omt_cv   = 1.0 - tm_cv;
-            double local_CV  = R * pf_cv * pf_cv * tm_cv / (omt_cv * omt_cv);
-
-            if (do_hg_energy_interp)
-            {
-                double cv_free = R * 0.5;
-                double ra = sys.intpvib / wi;
-                double r2 = ra * ra;
-                double wei = 1.0 / (1.0 + r2 * r2);
-                local_CV = wei * local_CV + (1.0 - wei) * cv_free;
-            }
-
-            double pf_s, tm_s;
-            if (uniform_scaling)
-            {
-                pf_s = pf_base; tm_s = tm_base;
-            }
-            else
-            {
-                pf_s = h_over_kbT * fi * sclS;
-                tm_s = std::exp(-pf_s);
-                if (truhlar_active) { pf_s = prefac_trunc; tm_s = term_trunc; }
-            }
-            double local_S = R * (pf_s * tm_s / (1.0 - tm_s) - std::log(1.0 - tm_s));
-
-            if (do_grimme_interp || do_hg_entropy)
-            {
-                double miu  = h / (eight_pi2 * fi);
-                double miup = miu * sys.Bav / (miu + sys.Bav);
-                double Sfree = R * (0.5 + 0.5 * std::log(grimme_log_base * miup / sys.Bav));
-                double gr  = sys.intpvib / wi;
-                double gr2 = gr * gr;
-                double wei = 1.0 / (1.0 + gr2 * gr2);
-                local_S    = wei * local_S + (1.0 - wei) * Sfree;
-            }
-
-            ZPE        += local_ZPE;
-            U_vib_heat += local_heat;
-            CV_vib     += local_CV;
-            S_vib      += local_S;
-        }
 
-        r.ZPE        = ZPE;
-        r.U_vib_heat = U_vib_heat;
-        r.U_vib      = U_vib_heat + ZPE;
-        r.CV_vib     = CV_vib;
-        r.S_vib      = S_vib;
-        r.qvib_v0    = std::exp(log_qvib_v0);
-        r.qvib_bot   = std::exp(log_qvib_bot);
+    /**
+     * @brief Vibrational fields of r from the sums of the vectorized kernel (see vib_kernel.h)
+     */
+    void vibcontri(const VibSums& vib, ThermoResult& r)
+    {
+        r.ZPE        = vib.ZPE;
+        r.U_vib_heat = vib.U_vib_heat;
+        r.U_vib      = vib.U_vib_heat + vib.ZPE;
+        r.CV_vib     = vib.CV_vib;
+        r.S_vib      = vib.S_vib;
+        r.qvib_v0    = std::exp(vib.log_qvib_v0);
+        r.qvib_bot   = std::exp(vib.log_qvib_bot);
+    }
 
-        // --- Electronic ---
-        elecontri(sys, T, r.q_ele, r.U_ele, r.CV_ele, r.S_ele);
 
-        // --- Totals ---
+    /**
+     * @brief Totals, thermal corrections and full partition functions from the contributions in r
+     */
+    void sumcontri(double T, ThermoResult& r)
+    {
         r.CV_tot = r.CV_trans + r.CV_rot + r.CV_vib + r.CV_ele;
         r.CP_tot = r.CP_trans + r.CV_rot + r.CV_vib + r.CV_ele;
         r.S_tot  = r.S_trans  + r.S_rot  + r.S_vib  + r.S_ele;
@@ -581,11 +733,169 @@ namespace calc
 
         r.QV   = r.q_trans * r.q_rot * r.qvib_v0  * r.q_ele;
         r.Qbot = r.q_trans * r.q_rot * r.qvib_bot  * r.q_ele;
+    }
+
 
+    /**
+     * @brief Calculate thermodynamic properties at given temperature and pressure
+     *
+     * Single source of truth for all thermodynamic computation.
+     * Returns a ThermoResult with per-contribution breakdown and totals.
+     *
+     * @param sys SystemData structure with molecular data (const, not modified)
+     * @param T Temperature in Kelvin
+     * @param P Pressure in atmospheres
+     * @return ThermoResult with per-contribution breakdown and totals
+     *
+     * @note The vibrational sums come from vibsum(), vectorized for the CPU it runs on
+     * @note Supports Harmonic, Truhlar, Grimme, and Minenkov low-frequency treatments
+     */
+    ThermoResult calcthermo(const SystemData& sys, double T, double P)
+    {
+        ThermoResult r;
+        transcontri(sys, T, P, r);
+        rotvibelecontri(sys, T, r);
+        sumcontri(T, r);
         return r;
     }
 
 
+    /**
+     * @brief Calculate thermodynamic properties on a temperature x pressure grid
+     *
+     * Rotation, vibration and the electronic levels depend on T only, so they
+     * are evaluated once per temperature; each pressure then only redoes the
+     * translational term and the totals. Every point equals
+     * calcthermo(sys, T[i], P[j]) bit for bit.
+     */
+    std::vector<ThermoResult> calcthermo_grid(const SystemData&          sys,
+                                              const std::vector<double>& T,
+                                              const std::vector<double>& P)
+    {
+        const int    nT = static_cast<int>(T.size());
+        const size_t nP = P.size();
+        std::vector<ThermoResult> grid(T.size() * nP);
+
+#ifdef _OPENMP
+        // Outer strategy: temperatures over threads; Inner: the vibrational loop is split instead
+#pragma omp parallel for schedule(static) if(sys.exec.omp_strategy == 0 && nT > 1)
+#endif
+        for (int i = 0; i < nT; ++i)
+        {
+            ThermoResult at_T;
+            rotvibelecontri(sys, T[i], at_T);
+            for (size_t j = 0; j < nP; ++j)
+            {
+                ThermoResult& r = grid[static_cast<size_t>(i) * nP + j];
+                r               = at_T;
+                transcontri(sys, T[i], P[j], r);
+                sumcontri(T[i], r);
+            }
+        }
+        return grid;
+    }
+
+
+    void MoleculeBatch::reserve(size_t molecules, size_t modes)
+    {
+        offset.reserve(molecules + 1);
+        freq.reserve(molecules * modes);
+        wavenum.reserve(molecules * modes);
+        E.reserve(molecules);
+        totmass.reserve(molecules);
+        inert.reserve(3 * molecules);
+        ilinear.reserve(molecules);
+        rotsym.reserve(molecules);
+        level_offset.reserve(molecules + 1);
+        elevel.reserve(molecules);
+        edegen.reserve(molecules);
+    }
+
+
+    void MoleculeBatch::add(const SystemData& sys)
+    {
+        if (sys.nelevel <= 0 || sys.elevel.size() != static_cast<size_t>(sys.nelevel) ||
+            sys.edegen.size() != static_cast<size_t>(sys.nelevel))
+        {
+            throw std::runtime_error("elecontri: Invalid electron level data");
+        }
+
+        const size_t nfreq = static_cast<size_t>(std::max(sys.nfreq, 0));
+        freq.insert(freq.end(), sys.freq.begin(), sys.freq.begin() + nfreq);
+        wavenum.insert(wavenum.end(), sys.wavenum.begin(), sys.wavenum.begin() + nfreq);
+        offset.push_back(freq.size());
+
+        E.push_back(sys.E);
+        totmass.push_back(sys.totmass);
+        inert.insert(inert.end(), sys.inert.begin(), sys.inert.end());
+        ilinear.push_back(sys.ilinear);
+        rotsym.push_back(sys.rotsym);
+
+        elevel.insert(elevel.end(), sys.elevel.begin(), sys.elevel.end());
+        edegen.insert(edegen.end(), sys.edegen.begin(), sys.edegen.end());
+        level_offset.push_back(elevel.size());
+    }
+
+
+    /**
+     * @brief Calculate thermodynamic totals for many molecules and temperatures in one sweep
+     *
+     * Uses the same contribution functions as calcthermo, fed from the pooled
+     * arrays, so every value matches calcthermo bit for bit.
+     */
+    BatchThermo calcthermo_batch(const MoleculeBatch& batch, const SystemData& settings, const std::vector<double>& T,
+                                 double P)
+    {
+        BatchThermo out;
+        out.nmol           = batch.size();
+        out.nT             = T.size();
+        const size_t total = out.nmol * out.nT;
+        out.ZPE.resize(total);
+        out.corrU.resize(total);
+        out.corrH.resize(total);
+        out.corrG.resize(total);
+        out.S.resize(total);
+        out.CV.resize(total);
+        out.CP.resize(total);
+
+        const long long nmol = static_cast<long long>(out.nmol);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) if(nmol > 64)
+#endif
+        for (long long im = 0; im < nmol; ++im)
+        {
+            const size_t  m       = static_cast<size_t>(im);
+            const size_t  first   = batch.offset[m];
+            const int     nfreq   = static_cast<int>(batch.offset[m + 1] - first);
+            const size_t  level   = batch.level_offset[m];
+            const int     nelevel = static_cast<int>(batch.level_offset[m + 1] - level);
+            const double* freq    = batch.freq.data() + first;
+            const double* wavenum = batch.wavenum.data() + first;
+
+            for (size_t t = 0; t < out.nT; ++t)
+            {
+                ThermoResult r;
+                transcontri(settings.ipmode, batch.totmass[m], T[t], P, r);
+                rotcontri(settings.ipmode, batch.inert.data() + 3 * m, batch.ilinear[m], batch.rotsym[m], T[t], r);
+                vibcontri(vibsum(settings, freq, wavenum, nfreq, T[t]), r);
+                elecontri(batch.elevel.data() + level, batch.edegen.data() + level, nelevel, T[t], r.q_ele, r.U_ele,
+                          r.CV_ele, r.S_ele);
+                sumcontri(T[t], r);
+
+                const size_t i = out.index(m, t);
+                out.ZPE[i]     = r.ZPE;
+                out.corrU[i]   = r.corrU;
+                out.corrH[i]   = r.corrH;
+                out.corrG[i]   = r.corrG;
+                out.S[i]       = r.S_tot;
+                out.CV[i]      = r.CV_tot;
+                out.CP[i]      = r.CP_tot;
+            }
+        }
+        return out;
+    }
+
+
     /**
      * @brief Calculate thermodynamic properties (output-parameter overload)
      *
@@ -636,45 +946,45 @@ namespace calc
         // Translation contribution
         if (sys.ipmode == 0 && sys.prtlevel >= 2)
         {
-            std::cout << "\nNote: Only for translation, U is different to H, and CV is different to CP\n"
-                      << "\n";
-            std::cout << "                        ------- Translation -------\n"
-                      << "                        ---------------------------\n";
-            std::cout << std::scientific << std::setprecision(6) << " Translational q: " << std::setw(16) << r.q_trans
-                      << "     q/NA: " << std::setw(16) << r.q_trans / NA << "\n";
-            std::cout << std::fixed << std::setprecision(3) << " Translational U: " << std::setw(10) << r.U_trans
-                      << " kJ/mol " << std::setw(10) << r.U_trans / cal2J << " kcal/mol\n";
-            std::cout << " Translational H: " << std::setw(10) << r.H_trans << " kJ/mol " << std::setw(10)
-                      << r.H_trans / cal2J << " kcal/mol\n";
-            std::cout << " Translational S: " << std::setw(10) << r.S_trans << " J/mol/K" << std::setw(10)
-                      << r.S_trans / cal2J << " cal/mol/K  -TS:" << std::setw(8) << -r.S_trans / cal2J / 1000.0 * sys.T
-                      << " kcal/mol\n";
-            std::cout << " Translational CV:" << std::setw(10) << r.CV_trans << " J/mol/K" << std::setw(10)
-                      << r.CV_trans / cal2J << " cal/mol/K\n";
-            std::cout << " Translational CP:" << std::setw(10) << r.CP_trans << " J/mol/K" << std::setw(10)
-                      << r.CP_trans / cal2J << " cal/mol/K\n";
+            util::report() << "\nNote: Only for translation, U is different to H, and CV is different to CP\n"
+                           << "\n";
+            util::report() << "                        ------- Translation -------\n"
+                           << "                        ---------------------------\n";
+            util::report() << std::scientific << std::setprecision(6) << " Translational q: " << std::setw(16) << r.q_trans
+                           << "     q/NA: " << std::setw(16) << r.q_trans / NA << "\n";
+            util::report() << std::fixed << std::setprecision(3) << " Translational U: " << std::setw(10) << r.U_trans
+                           << " kJ/mol " << std::setw(10) << r.U_trans / cal2J << " kcal/mol\n";
+            util::report() << " Translational H: " << std::setw(10) << r.H_trans << " kJ/mol " << std::setw(10)
+                           << r.H_trans / cal2J << " kcal/mol\n";
+            util::report() << " Translational S: " << std::setw(10) << r.S_trans << " J/mol/K" << std::setw(10)
+                           << r.S_trans / cal2J << " cal/mol/K  -TS:" << std::setw(8) << -r.S_trans / cal2J / 1000.0 * sys.T
+                           << " kcal/mol\n";
+            util::report() << " Translational CV:" << std::setw(10) << r.CV_trans << " J/mol/K" << std::setw(10)
+                           << r.CV_trans / cal2J << " cal/mol/K\n";
+            util::report() << " Translational CP:" << std::setw(10) << r.CP_trans << " J/mol/K" << std::setw(10)
+                           << r.CP_trans / cal2J << " cal/mol/K\n";
         }
         else if (sys.ipmode == 1 && sys.prtlevel >= 2)
         {
-            std::cout << "\nTranslation contribution is ignored since ipmode=1\n";
+            util::report() << "\nTranslation contribution is ignored since ipmode=1\n";
         }
 
         // Rotation contribution
         if (sys.ipmode == 0 && sys.prtlevel >= 2)
         {
-            std::cout << "\n                        -------- Rotation --------\n"
-                      << "                        --------------------------\n";
-            std::cout << std::scientific << std::setprecision(6) << " Rotational q: " << std::setw(16) << r.q_rot << "\n";
-            std::cout << std::fixed << std::setprecision(3) << " Rotational U: " << std::setw(10) << r.U_rot << " kJ/mol "
-                      << std::setw(10) << r.U_rot / cal2J << " kcal/mol    =H\n";
-            std::cout << " Rotational S: " << std::setw(10) << r.S_rot << " J/mol/K" << std::setw(10) << r.S_rot / cal2J
-                      << " cal/mol/K   -TS:" << std::setw(8) << -r.S_rot / cal2J / 1000.0 * sys.T << " kcal/mol\n";
-            std::cout << " Rotational CV:" << std::setw(10) << r.CV_rot << " J/mol/K" << std::setw(10) << r.CV_rot / cal2J
-                      << " cal/mol/K   =CP\n";
+            util::report() << "\n                        -------- Rotation --------\n"
+                           << "                        --------------------------\n";
+            util::report() << std::scientific << std::setprecision(6) << " Rotational q: " << std::setw(16) << r.q_rot << "\n";
+            util::report() << std::fixed << std::setprecision(3) << " Rotational U: " << std::setw(10) << r.U_rot << " kJ/mol "
+                           << std::setw(10) << r.U_rot / cal2J << " kcal/mol    =H\n";
+            util::report() << " Rotational S: " << std::setw(10) << r.S_rot << " J/mol/K" << std::setw(10) << r.S_rot / cal2J
+                           << " cal/mol/K   -TS:" << std::setw(8) << -r.S_rot / cal2J / 1000.0 * sys.T << " kcal/mol\n";
+            util::report() << " Rotational CV:" << std::setw(10) << r.CV_rot << " J/mol/K" << std::setw(10) << r.CV_rot / cal2J
+                           << " cal/mol/K   =CP\n";
         }
         else if (sys.ipmode == 1 && sys.prtlevel >= 2)
         {
-            std::cout << "\nRotation contribution is ignored since ipmode=1\n";
+            util::report() << "\nRotation contribution is ignored since ipmode=1\n";
         }
 
         // Vibration contribution
@@ -690,8 +1000,8 @@ namespace calc
 
         if (sys.prtlevel >= 2)
         {
-        std::cout << "\n                        -------- Vibration --------\n"
-                  << "                        ---------------------------\n";
+        util::report() << "\n                        -------- Vibration --------\n"
+                       << "                        ---------------------------\n";
         if (sys.lowVibTreatment == LowVibTreatment::Truhlar)
         {
             int nlow = 0;
@@ -702,104 +1012,104 @@ namespace calc
             }
             if (nlow > 0)
             {
-                std::cout << "Note: " << nlow << " low frequencies are raised to " << std::fixed << std::setprecision(1)
-                          << sys.ravib << " cm^-1 during calculating S, U(T)-U(0), CV and q\n\n";
+                util::report() << "Note: " << nlow << " low frequencies are raised to " << std::fixed << std::setprecision(1)
+                               << sys.ravib << " cm^-1 during calculating S, U(T)-U(0), CV and q\n\n";
             }
         }
         else if (sys.lowVibTreatment == LowVibTreatment::Grimme)
         {
-            std::cout << "Note: Interpolation between harmonic oscillator model and free rotor model is \n"
-                         "      used to evaluate S, other terms are identical to harmonic oscillator model\n\n";
+            util::report() << "Note: Interpolation between harmonic oscillator model and free rotor model is \n"
+                              "      used to evaluate S, other terms are identical to harmonic oscillator model\n\n";
         }
         else if (sys.lowVibTreatment == LowVibTreatment::Minenkov)
         {
-            std::cout << "Note: Interpolation between harmonic oscillator model and free rotor model is \n"
-                         "      used to evaluate S and U(T). "
-                      << "In this case ZPE and U(T)-U(0) cannot be separated and thus not shown. \n"
-                         "Other terms are identical to harmonic oscillator model\n\n";
+            util::report() << "Note: Interpolation between harmonic oscillator model and free rotor model is \n"
+                              "      used to evaluate S and U(T). "
+                           << "In this case ZPE and U(T)-U(0) cannot be separated and thus not shown. \n"
+                              "Other terms are identical to harmonic oscillator model\n\n";
         }
         else if (sys.lowVibTreatment == LowVibTreatment::HeadGordon)
         {
-            std::cout << "Note: Head-Gordon's interpolation between harmonic oscillator model and free rotor\n"
-                         "      model is used to evaluate U(T). In this case ZPE and U(T)-U(0) cannot be\n"
-                         "      separated and thus not shown. ";
+            util::report() << "Note: Head-Gordon's interpolation between harmonic oscillator model and free rotor\n"
+                              "      model is used to evaluate U(T). In this case ZPE and U(T)-U(0) cannot be\n"
+                              "      separated and thus not shown. ";
             if (sys.hgEntropy)
-                std::cout << "Entropy is also interpolated.\n";
+                util::report() << "Entropy is also interpolated.\n";
             else
-                std::cout << "Entropy uses standard harmonic oscillator model.\n";
-            std::cout << "Other terms are identical to harmonic oscillator model\n\n";
+                util::report() << "Entropy uses standard harmonic oscillator model.\n";
+            util::report() << "Other terms are identical to harmonic oscillator model\n\n";
         }
         } // end if (sys.prtlevel >= 2) for vibration header
 
         // Per-mode vibrational detail (partition functions & contributions)
         if (std::abs(sys.prtvib) == 1)
         {
-            std::ostream& vibout = (sys.prtvib == -1) ? vibfile : std::cout;
+            std::ostream& vibout = (sys.prtvib == -1) ? vibfile : util::report();
             showvibdetail(sys, sys.T, vibout);
         }
 
         if (sys.prtvib == -1)
         {
             vibfile.close();
-            std::cout << "Contributions to thermochemistry quantities from every frequency mode have been exported to "
-                      << vibcon_filename << " in current folder\n\n";
+            util::report() << "Contributions to thermochemistry quantities from every frequency mode have been exported to "
+                           << vibcon_filename << " in current folder\n\n";
         }
 
         if (sys.prtlevel >= 2)
         {
-        std::cout << std::scientific << std::setprecision(6) << " Vibrational q(V=0): " << std::setw(16) << r.qvib_v0
-                  << "\n";
-        std::cout << " Vibrational q(bot): " << std::setw(16) << r.qvib_bot << "\n";
+        util::report() << std::scientific << std::setprecision(6) << " Vibrational q(V=0): " << std::setw(16) << r.qvib_v0
+                       << "\n";
+        util::report() << " Vibrational q(bot): " << std::setw(16) << r.qvib_bot << "\n";
         if (sys.lowVibTreatment != LowVibTreatment::Minenkov && sys.lowVibTreatment != LowVibTreatment::HeadGordon)
         {
-            std::cout << std::fixed << std::setprecision(3) << " Vibrational U(T)-U(0):" << std::setw(10) << r.U_vib_heat
-                      << " kJ/mol" << std::setw(10) << r.U_vib_heat / cal2J << " kcal/mol   =H(T)-H(0)\n";
+            util::report() << std::fixed << std::setprecision(3) << " Vibrational U(T)-U(0):" << std::setw(10) << r.U_vib_heat
+                           << " kJ/mol" << std::setw(10) << r.U_vib_heat / cal2J << " kcal/mol   =H(T)-H(0)\n";
         }
-        std::cout << " Vibrational U: " << std::setw(10) << r.U_vib << " kJ/mol " << std::setw(10) << r.U_vib / cal2J
-                  << " kcal/mol    =H\n";
-        std::cout << " Vibrational S: " << std::setw(10) << r.S_vib << " J/mol/K" << std::setw(10) << r.S_vib / cal2J
-                  << " cal/mol/K   -TS:" << std::setw(8) << -r.S_vib / cal2J / 1000.0 * sys.T << " kcal/mol\n";
-        std::cout << " Vibrational CV:" << std::setw(10) << r.CV_vib << " J/mol/K" << std::setw(10) << r.CV_vib / cal2J
-                  << " cal/mol/K   =CP\n";
+        util::report() << " Vibrational U: " << std::setw(10) << r.U_vib << " kJ/mol " << std::setw(10) << r.U_vib / cal2J
+                       << " kcal/mol    =H\n";
+        util::report() << " Vibrational S: " << std::setw(10) << r.S_vib << " J/mol/K" << std::setw(10) << r.S_vib / cal2J
+                       << " cal/mol/K   -TS:" << std::setw(8) << -r.S_vib / cal2J / 1000.0 * sys.T << " kcal/mol\n";
+        util::report() << " Vibrational CV:" << std::setw(10) << r.CV_vib << " J/mol/K" << std::setw(10) << r.CV_vib / cal2J
+                       << " cal/mol/K   =CP\n";
         if (sys.lowVibTreatment != LowVibTreatment::Minenkov && sys.lowVibTreatment != LowVibTreatment::HeadGordon)
         {
-            std::cout << std::setprecision(2) << " Zero-point energy (ZPE):" << std::setw(10) << r.ZPE << " kJ/mol,"
-                      << std::setw(10) << r.ZPE / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(12)
-                      << r.ZPE / au2kJ_mol << " a.u.\n";
+            util::report() << std::setprecision(2) << " Zero-point energy (ZPE):" << std::setw(10) << r.ZPE << " kJ/mol,"
+                           << std::setw(10) << r.ZPE / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(12)
+                           << r.ZPE / au2kJ_mol << " a.u.\n";
         }
         } // end if (sys.prtlevel >= 2) for vibration details
 
         // Electronic contribution
         if (sys.prtlevel >= 2)
         {
-        std::cout << "\n                 -------- Electronic excitation --------\n"
-                  << "                 ---------------------------------------\n";
-        std::cout << std::scientific << std::setprecision(6) << " Electronic q: " << std::setw(16) << r.q_ele << "\n";
-        std::cout << std::fixed << std::setprecision(3) << " Electronic U: " << std::setw(10) << r.U_ele << " kJ/mol "
-                  << std::setw(10) << r.U_ele / cal2J << " kcal/mol    =H\n";
-        std::cout << " Electronic S: " << std::setw(10) << r.S_ele << " J/mol/K" << std::setw(10) << r.S_ele / cal2J
-                  << " cal/mol/K   -TS:" << std::setw(8) << -r.S_ele / cal2J / 1000.0 * sys.T << " kcal/mol\n";
-        std::cout << " Electronic CV:" << std::setw(10) << r.CV_ele << " J/mol/K" << std::setw(10) << r.CV_ele / cal2J
-                  << " cal/mol/K   =CP\n";
+        util::report() << "\n                 -------- Electronic excitation --------\n"
+                       << "                 ---------------------------------------\n";
+        util::report() << std::scientific << std::setprecision(6) << " Electronic q: " << std::setw(16) << r.q_ele << "\n";
+        util::report() << std::fixed << std::setprecision(3) << " Electronic U: " << std::setw(10) << r.U_ele << " kJ/mol "
+                       << std::setw(10) << r.U_ele / cal2J << " kcal/mol    =H\n";
+        util::report() << " Electronic S: " << std::setw(10) << r.S_ele << " J/mol/K" << std::setw(10) << r.S_ele / cal2J
+                       << " cal/mol/K   -TS:" << std::setw(8) << -r.S_ele / cal2J / 1000.0 * sys.T << " kcal/mol\n";
+        util::report() << " Electronic CV:" << std::setw(10) << r.CV_ele << " J/mol/K" << std::setw(10) << r.CV_ele / cal2J
+                       << " cal/mol/K   =CP\n";
         } // end if (sys.prtlevel >= 2) for electronic
 
         // Final summary
-        std::cout << "\n\n"
-                  << "                       ----------------------------\n"
-                  << "                       -------- Final data --------\n"
-                  << "                       ----------------------------\n";
-        std::cout << std::scientific << std::setprecision(6) << " Total q(V=0):    " << std::setw(16)
-                  << r.QV << "\n";
-        std::cout << " Total q(bot):    " << std::setw(16) << r.Qbot << "\n";
-        std::cout << " Total q(V=0)/NA: " << std::setw(16) << r.QV / NA << "\n";
-        std::cout << " Total q(bot)/NA: " << std::setw(16) << r.Qbot / NA << "\n";
-
-        std::cout << std::fixed << std::setprecision(3) << " Total CV:" << std::setw(12) << r.CV_tot << " J/mol/K"
-                  << std::setw(12) << r.CV_tot / cal2J << " cal/mol/K\n";
-        std::cout << " Total CP:" << std::setw(12) << r.CP_tot << " J/mol/K" << std::setw(12) << r.CP_tot / cal2J
-                  << " cal/mol/K\n";
-        std::cout << " Total S: " << std::setw(12) << r.S_tot << " J/mol/K" << std::setw(12) << r.S_tot / cal2J
-                  << " cal/mol/K    -TS:" << std::setw(10) << -r.S_tot / cal2J / 1000.0 * sys.T << " kcal/mol\n";
+        util::report() << "\n\n"
+                       << "                       ----------------------------\n"
+                       << "                       -------- Final data --------\n"
+                       << "                       ----------------------------\n";
+        util::report() << std::scientific << std::setprecision(6) << " Total q(V=0):    " << std::setw(16)
+                       << r.QV << "\n";
+        util::report() << " Total q(bot):    " << std::setw(16) << r.Qbot << "\n";
+        util::report() << " Total q(V=0)/NA: " << std::setw(16) << r.QV / NA << "\n";
+        util::report() << " Total q(bot)/NA: " << std::setw(16) << r.Qbot / NA << "\n";
+
+        util::report() << std::fixed << std::setprecision(3) << " Total CV:" << std::setw(12) << r.CV_tot << " J/mol/K"
+                       << std::setw(12) << r.CV_tot / cal2J << " cal/mol/K\n";
+        util::report() << " Total CP:" << std::setw(12) << r.CP_tot << " J/mol/K" << std::setw(12) << r.CP_tot / cal2J
+                       << " cal/mol/K\n";
+        util::report() << " Total S: " << std::setw(12) << r.S_tot << " J/mol/K" << std::setw(12) << r.S_tot / cal2J
+                       << " cal/mol/K    -TS:" << std::setw(10) << -r.S_tot / cal2J / 1000.0 * sys.T << " kcal/mol\n";
 
         double thermU = r.corrU;
         double thermH = r.corrH;
@@ -808,47 +1118,47 @@ namespace calc
 
         if (sys.lowVibTreatment != LowVibTreatment::Minenkov && sys.lowVibTreatment != LowVibTreatment::HeadGordon)
         {
-            std::cout << std::setprecision(3) << " Zero point energy (ZPE):" << std::setw(11) << r.ZPE << " kJ/mol"
-                      << std::setw(11) << r.ZPE / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11)
-                      << r.ZPE / au2kJ_mol << " a.u.\n";
+            util::report() << std::setprecision(3) << " Zero point energy (ZPE):" << std::setw(11) << r.ZPE << " kJ/mol"
+                           << std::setw(11) << r.ZPE / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11)
+                           << r.ZPE / au2kJ_mol << " a.u.\n";
         }
-        std::cout << std::setprecision(3) << " Thermal correction to U:" << std::setw(11) << thermU << " kJ/mol"
-                  << std::setw(11) << thermU / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11)
-                  << thermU / au2kJ_mol << " a.u.\n";
-        std::cout << " Thermal correction to H:" << std::setw(11) << thermH << " kJ/mol" << std::setw(11)
-                  << thermH / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11) << thermH / au2kJ_mol
-                  << " a.u.\n";
-        std::cout << " Thermal correction to G:" << std::setw(11) << thermG << " kJ/mol" << std::setw(11)
-                  << thermG / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11) << thermG / au2kJ_mol
-                  << " a.u.\n";
+        util::report() << std::setprecision(3) << " Thermal correction to U:" << std::setw(11) << thermU << " kJ/mol"
+                       << std::setw(11) << thermU / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11)
+                       << thermU / au2kJ_mol << " a.u.\n";
+        util::report() << " Thermal correction to H:" << std::setw(11) << thermH << " kJ/mol" << std::setw(11)
+                       << thermH / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11) << thermH / au2kJ_mol
+                       << " a.u.\n";
+        util::report() << " Thermal correction to G:" << std::setw(11) << thermG << " kJ/mol" << std::setw(11)
+                       << thermG / cal2J << " kcal/mol" << std::setprecision(6) << std::setw(11) << thermG / au2kJ_mol
+                       << " a.u.\n";
 
         double U0      = sys.E + r.ZPE / au2kJ_mol;
         double U_final = sys.E + thermU / au2kJ_mol;
         double H_final = sys.E + thermH / au2kJ_mol;
         double G_final = sys.E + thermG / au2kJ_mol;
 
-        std::cout << std::fixed << std::setprecision(7) << " Electronic energy:" << std::setw(19) << sys.E << " a.u.\n";
+        util::report() << std::fixed << std::setprecision(7) << " Electronic energy:" << std::setw(19) << sys.E << " a.u.\n";
         if (sys.lowVibTreatment != LowVibTreatment::Minenkov && sys.lowVibTreatment != LowVibTreatment::HeadGordon)
         {
-            std::cout << " Sum of electronic energy and ZPE, namely U/H/G at 0 K:" << std::setw(19) << U0 << " a.u.\n";
+            util::report() << " Sum of electronic energy and ZPE, namely U/H/G at 0 K:" << std::setw(19) << U0 << " a.u.\n";
         }
-        std::cout << " Sum of electronic energy and thermal correction to U: " << std::setw(19) << U_final << " a.u.\n";
-        std::cout << " Sum of electronic energy and thermal correction to H: " << std::setw(19) << H_final << " a.u.\n";
-        std::cout << " Sum of electronic energy and thermal correction to G: " << std::setw(19) << G_final << " a.u.\n";
+        util::report() << " Sum of electronic energy and thermal correction to U: " << std::setw(19) << U_final << " a.u.\n";
+        util::report() << " Sum of electronic energy and thermal correction to H: " << std::setw(19) << H_final << " a.u.\n";
+        util::report() << " Sum of electronic energy and thermal correction to G: " << std::setw(19) << G_final << " a.u.\n";
 
         if (sys.concstr != "0")
         {
             double concnow = 0.0, concspec = std::stod(sys.concstr), Gconc;
             getGconc(sys, concnow, concspec, Gconc);
-            std::cout << "\n"
-                      << " Present concentration (estimated by ideal gas model):" << std::fixed << std::setprecision(6)
-                      << std::setw(10) << concnow << " mol/L\n";
-            std::cout << " Concentration specified by \"conc\" parameter:" << std::setw(12) << concspec << " mol/L\n";
-            std::cout << " delta-G of conc. change:" << std::fixed << std::setprecision(3) << std::setw(11) << Gconc
-                      << " kJ/mol" << std::setw(11) << Gconc / cal2J << " kcal/mol" << std::setprecision(6)
-                      << std::setw(11) << Gconc / au2kJ_mol << " a.u.\n";
-            std::cout << " Gibbs free energy at specified concentration: " << std::fixed << std::setprecision(7)
-                      << std::setw(19) << (G_final + Gconc / au2kJ_mol) << " a.u.\n";
+            util::report() << "\n"
+                           << " Present concentration (estimated by ideal gas model):" << std::fixed << std::setprecision(6)
+                           << std::setw(10) << concnow << " mol/L\n";
+            util::report() << " Concentration specified by \"conc\" parameter:" << std::setw(12) << concspec << " mol/L\n";
+            util::report() << " delta-G of conc. change:" << std::fixed << std::setprecision(3) << std::setw(11) << Gconc
+                           << " kJ/mol" << std::setw(11) << Gconc / cal2J << " kcal/mol" << std::setprecision(6)
+                           << std::setw(11) << Gconc / au2kJ_mol << " a.u.\n";
+            util::report() << " Gibbs free energy at specified concentration: " << std::fixed << std::setprecision(7)
+                           << std::setw(19) << (G_final + Gconc / au2kJ_mol) << " a.u.\n";
         }
     }
 
@@ -860,7 +1170,7 @@ namespace calc
     ///
     /// @param sys  System data (frequencies, scaling factors, low-vib treatment).
     /// @param T    Temperature in K.
-    /// @param out  Output stream (std::cout or a file stream).
+    /// @param out  Output stream (util::report() or a file stream).
     void showvibdetail(const SystemData& sys, double T, std::ostream& out)
     {
         // Partition function table header
@@ -948,20 +1258,28 @@ namespace calc
      */
     void elecontri(const SystemData& sys, double T, double& tmpq, double& tmpheat, double& tmpCV, double& tmpS)
     {
-        tmpq      = 0.0;
-        double t1 = 0.0, t2 = 0.0;
-
         if (sys.nelevel <= 0 || sys.elevel.size() != static_cast<size_t>(sys.nelevel) ||
             sys.edegen.size() != static_cast<size_t>(sys.nelevel))
         {
             throw std::runtime_error("elecontri: Invalid electron level data");
         }
+        elecontri(sys.elevel.data(), sys.edegen.data(), sys.nelevel, T, tmpq, tmpheat, tmpCV, tmpS);
+    }
+
+    /**
+     * @brief Electronic contributions from nelevel levels (eV) and their degeneracies
+     */
+    void elecontri(const double* elevel, const int* edegen, int nelevel, double T, double& tmpq, double& tmpheat,
+                   double& tmpCV, double& tmpS)
+    {
+        tmpq      = 0.0;
+        double t1 = 0.0, t2 = 0.0;
 
-        for (int ie = 0; ie < sys.nelevel; ++ie)
+        for (int ie = 0; ie < nelevel; ++ie)
         {
-            double exc = sys.elevel[ie] / au2eV * au2J;
+            double exc = elevel[ie] / au2eV * au2J;
             double ekt = (T > 0.0) ? exc / (kb * T) : 0.0;
-            double qi  = sys.edegen[ie] * std::exp(-ekt);
+            double qi  = edegen[ie] * std::exp(-ekt);
             tmpq += qi;
             t1 += ekt * qi;
             t2 += ekt * ekt * qi;
@@ -12,6 +12,7 @@
 #ifndef CALC_H
 #define CALC_H
 
+#include <functional>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -82,28 +83,162 @@ struct ThermoResult {
  */
 auto file_exists(const std::string& filename) -> bool;
 
+/**
+ * @brief Molecules for calcthermo_batch(), stored as a structure of arrays
+ *
+ * Only what calcthermo reads from a SystemData is kept, in flat arrays with
+ * one entry per molecule, so a sweep over thousands of small molecules walks
+ * memory linearly instead of chasing one SystemData per molecule. The modes
+ * of molecule m are freq[offset[m]] .. freq[offset[m + 1] - 1] (same range
+ * of wavenum); its electronic levels are indexed through level_offset the
+ * same way.
+ */
+struct MoleculeBatch {
+    std::vector<size_t> offset{0};        ///< Start of each molecule's modes, plus the end of the last
+    std::vector<double> freq;             ///< Frequencies of all molecules (Hz)
+    std::vector<double> wavenum;          ///< Wavenumbers of all molecules (cm^-1)
+    std::vector<double> E;                ///< Electronic energy (a.u.)
+    std::vector<double> totmass;          ///< Total mass (amu)
+    std::vector<double> inert;            ///< Principal moments of inertia, 3 per molecule (amu*Bohr^2)
+    std::vector<int>    ilinear;          ///< 1 for linear molecules
+    std::vector<int>    rotsym;           ///< Rotational symmetry number
+    std::vector<size_t> level_offset{0};  ///< Start of each molecule's electronic levels, plus the end
+    std::vector<double> elevel;           ///< Electronic excitation energies of all molecules (eV)
+    std::vector<int>    edegen;           ///< Degeneracies of those levels
+
+    /**
+     * @brief Number of molecules
+     */
+    size_t size() const { return totmass.size(); }
+
+    /**
+     * @brief Reserve room for a number of molecules with about modes frequencies each
+     */
+    void reserve(size_t molecules, size_t modes);
+
+    /**
+     * @brief Append the frequencies, inertia, symmetry and levels of a prepared SystemData
+     *
+     * @param sys Molecule as passed to calcthermo (freq, inert, ilinear and rotsym set)
+     * @throws std::runtime_error if its electronic level data is inconsistent
+     */
+    void add(const SystemData& sys);
+};
+
+/**
+ * @brief calcthermo totals of every molecule of a batch at every temperature
+ *
+ * Each array holds nmol * nT values; the value of
+ * molecule m at T[t] is at index(m, t).
+ */
+struct BatchThermo {
+    size_t              nmol = 0;  ///< Number of molecules
+    size_t              nT   = 0;  ///< Number of temperatures
+    std::vector<double> ZPE;       ///< Zero-point energy (kJ/mol)
+    std::vector<double> corrU;     ///< Thermal correction to U (kJ/mol)
+    std::vector<double> corrH;     ///< Thermal correction to H (kJ/mol)
+    std::vector<double> corrG;     ///< Thermal correction to G (kJ/mol)
+    std::vector<double> S;         ///< Entropy (J/mol/K)
+    std::vector<double> CV;        ///< Constant volume heat capacity (J/mol/K)
+    std::vector<double> CP;        ///< Constant pressure heat capacity (J/mol/K)
+
+    size_t index(size_t molecule, size_t t) const { return molecule * nT + t; }
+};
+
+/**
+ * @brief One conformer of an ensemble as loaded by loadensemble()
+ *
+ * The atoms are dropped once the inertia and point group are known. Only
+ * its MoleculeBatch entry is kept after the member was delivered.
+ */
+struct EnsembleMember {
+    std::string file;  ///< Path the member was loaded from
+    SystemData  sys;   ///< Loaded member data (no atoms)
+};
+
+/**
+ * @brief Thermochemistry of one ensemble member at one (T, P)
+ */
+struct MemberThermo {
+    double E  = 0.0;  ///< Electronic energy (a.u.)
+    double U  = 0.0;  ///< E + thermal correction to U (a.u.)
+    double H  = 0.0;  ///< E + thermal correction to H (a.u.)
+    double G  = 0.0;  ///< E + thermal correction to G (a.u.)
+    double S  = 0.0;  ///< Entropy (J/mol/K)
+    double CV = 0.0;  ///< Constant volume heat capacity (J/mol/K)
+    double CP = 0.0;  ///< Constant pressure heat capacity (J/mol/K)
+};
+
+/**
+ * @brief Boltzmann-weighted properties of an ensemble at one (T, P)
+ */
+struct EnsembleAverage {
+    double              T = 0.0;  ///< Temperature (K)
+    double              P = 0.0;  ///< Pressure (atm)
+    std::vector<double> weight;   ///< Boltzmann weight of each member, summing to 1
+    double              E     = 0.0;  ///< Weighted electronic energy (a.u.)
+    double              U     = 0.0;  ///< Weighted U (a.u.)
+    double              H     = 0.0;  ///< Weighted H (a.u.)
+    double              G     = 0.0;  ///< H - T*S, with the conformation entropy included (a.u.)
+    double              S     = 0.0;  ///< Weighted S plus confS (J/mol/K)
+    double              confS = 0.0;  ///< Conformation entropy -R sum(w ln w) (J/mol/K)
+    double              CV    = 0.0;  ///< Weighted CV (J/mol/K)
+};
+
+/**
+ * @brief Called in list order for every loaded ensemble member
+ */
+using MemberCallback = std::function<void(size_t index, const EnsembleMember& member, const MemberThermo& thermo)>;
+
+/**
+ * @brief Load the members of an ensemble concurrently
+ *
+ * Up to num_threads members are parsed at a time, and only a few members
+ * ahead of the next one to be delivered, so memory stays bounded for large
+ * ensembles. Each member's notes are printed and on_member is called on the
+ * calling thread in list order.
+ *
+ * @param sys Settings every member starts from
+ * @param filelist Member file paths
+ * @param num_threads Number of loader threads
+ * @param on_member Optional callback, receives each member with its thermochemistry at sys.T and sys.P
+ * @return Frequencies, inertia, symmetry, levels and E of the members in list order, for re-weighting
+ * @throws std::runtime_error with the error of the first member (in list order) that failed
+ */
+MoleculeBatch loadensemble(const SystemData& sys, const std::vector<std::string>& filelist, unsigned int num_threads,
+                           const MemberCallback& on_member = nullptr);
+
+/**
+ * @brief Thermochemistry of one loaded ensemble member at (T, P)
+ */
+MemberThermo memberthermo(const SystemData& sys, double T, double P);
+
+/**
+ * @brief Natural logarithm of the Boltzmann weight of each G, computed with log-sum-exp
+ *
+ * @param G Gibbs energies (a.u.)
+ * @param T Temperature in Kelvin
+ * @return ln(w_i), where the w_i sum to 1
+ */
+std::vector<double> boltzmannlogweights(const std::vector<double>& G, double T);
+
+/**
+ * @brief Boltzmann-weight member properties that were computed at (T, P)
+ */
+EnsembleAverage weighensemble(const std::vector<MemberThermo>& thermo, double T, double P);
+
 /**
  * @brief Perform ensemble averaging calculations across multiple input files
  *
- * This function processes multiple molecular geometry files and computes
- * averaged thermodynamic properties using Boltzmann weighting.
+ * Loads the members with loadensemble() and prints the member table,
+ * Boltzmann weights and weighted data at sys.T and sys.P. With a T/P scan
+ * set, the loaded members are also re-weighted at every scan point.
  *
  * @param sys SystemData structure containing calculation parameters
  * @param filelist Vector of input file paths
- * @param Elist Vector to store electronic energies for each file
- * @param Ulist Vector to store internal energies for each file
- * @param Hlist Vector to store enthalpies for each file
- * @param Glist Vector to store Gibbs energies for each file
- * @param Slist Vector to store entropies for each file
- * @param CVlist Vector to store constant volume heat capacities for each file
- * @param CPlist Vector to store constant pressure heat capacities for each file
- * @param QVlist Vector to store vibrational partition functions for each file
- * @param Qbotlist Vector to store bottom partition functions for each file
- */
-void ensemble(SystemData& sys, const std::vector<std::string>& filelist, std::vector<double>& Elist,
-              std::vector<double>& Ulist, std::vector<double>& Hlist, std::vector<double>& Glist,
-              std::vector<double>& Slist, std::vector<double>& CVlist, std::vector<double>& CPlist,
-              std::vector<double>& QVlist, std::vector<double>& Qbotlist);
+ * @param memberfile If not empty, per-member results are written to this file as members are loaded
+ */
+void ensemble(SystemData& sys, const std::vector<std::string>& filelist, const std::string& memberfile = "");
 
 /**
  * @brief Calculate moments of inertia for the molecular system
@@ -150,6 +285,39 @@ ThermoResult calcthermo(const SystemData& sys, double T, double P);
 void calcthermo(const SystemData& sys, double T, double P, double& corrU, double& corrH, double& corrG,
                 double& S, double& CV, double& CP, double& QV, double& Qbot);
 
+/**
+ * @brief Calculate thermodynamic properties on a temperature x pressure grid
+ *
+ * For T/P scans: the pressure-independent contributions (rotation, vibration,
+ * electronic) are computed once per temperature and only translation is
+ * redone per pressure, so an nT x nP grid costs about nT calcthermo calls.
+ *
+ * @param sys SystemData structure with molecular data and parameters
+ * @param T Temperatures in Kelvin
+ * @param P Pressures in atmospheres
+ * @return ThermoResult of (T[i], P[j]) at index i * P.size() + j, identical to calcthermo(sys, T[i], P[j])
+ */
+std::vector<ThermoResult> calcthermo_grid(const SystemData& sys, const std::vector<double>& T,
+                                          const std::vector<double>& P);
+
+/**
+ * @brief Calculate thermodynamic totals for many molecules and temperatures in one sweep
+ *
+ * The molecules are visited in order and each one's modes are summed at
+ * every temperature while they are in cache. The low-frequency treatment,
+ * scaling factors and ipmode come from @p settings and apply to all
+ * molecules. Every value equals the matching field of
+ * calcthermo(sys, T[t], P) for the SystemData the molecule was added from.
+ *
+ * @param batch Molecules
+ * @param settings Shared calculation settings (its molecular data is not read)
+ * @param T Temperatures in Kelvin
+ * @param P Pressure in atmospheres
+ * @return Totals of molecule m at T[t] at index(m, t)
+ */
+BatchThermo calcthermo_batch(const MoleculeBatch& batch, const SystemData& settings, const std::vector<double>& T,
+                             double P);
+
 /**
  * @brief Display detailed thermodynamic properties for a single (T, P) point
  *
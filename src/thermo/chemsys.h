@@ -12,7 +12,9 @@
 #ifndef CHEMSYS_H
 #define CHEMSYS_H
 
+#include "utilities/file_view.h"
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -174,6 +176,8 @@ struct ExecutionConfig
     int  omp_strategy            = 0;      ///< 0=outer (T/P scan), 1=inner (vibrational loop)
 };
 
+class MemoryMonitor;
+
 // Structure to hold system data
 struct SystemData
 {
@@ -232,6 +236,8 @@ struct SystemData
     // Others
     bool        alive = false;  // File existence flag
     std::string inputfile;      // Input file path
+    FileView    inputview;      // Mapped content of inputfile when the caller already opened it (optional)
+    std::shared_ptr<MemoryMonitor> memory_monitor;  // Budget the loaders charge their input mapping to (optional)
 
 #ifdef _WIN32
     int isys = 1;  // Windows
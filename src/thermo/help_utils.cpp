@@ -101,7 +101,15 @@ namespace ThermoHelpUtils
         std::cout << "  -prtlevel <level>    Output verbosity: 0=minimal, 1=default, 2=verbose, 3=full\n";
         std::cout << "  -outotm <mode>       Output .otm file: 0=no, 1=yes\n";
         std::cout << "  -omp-threads <N>     OpenMP thread count (default: half physical cores)\n";
+        std::cout << "  -nt <N>              Input files processed at the same time; they share the OpenMP threads\n";
         std::cout << "  -noset               Don't load settings from settings.ini\n";
+        std::cout << "  -f, --format <fmt>   text|ndjson; ndjson prints one JSON line of totals per file\n";
+        std::cout << "  --summary <file>     Write a table with one row of totals per input file to <file>\n";
+        std::cout << "  --ensemble-out <file> Write the results of every member of a .list ensemble to <file>\n";
+        std::cout << "  --profile            Report time per stage and per-file latency on stderr\n";
+        std::cout << "  --profile-out <file> Write the --profile report as JSON to <file>\n";
+        std::cout << "  --trace <file>       Write a Chrome/Perfetto trace of the run to <file>\n";
+        std::cout << "  --stats              Count bytes and lines read per file\n";
         std::cout << "  --help               Show this help message\n";
         std::cout << "  --version, -v        Show version, authors, and citation\n";
         std::cout << "  --create-config      Create a default settings.ini file\n";
@@ -121,6 +129,8 @@ namespace ThermoHelpUtils
         std::cout << "  " << program_name << " molecule.log\n";
         std::cout << "  " << program_name << " molecule.otm -T 300 -P 2.0\n";
         std::cout << "  " << program_name << " molecule.out -T 273 373 10 -lowvibmeth 2\n";
+        std::cout << "  " << program_name << " *.log -nt 8 --summary summary.txt\n";
+        std::cout << "  " << program_name << " conformers.list -T 200 400 50 --ensemble-out members.txt\n";
         std::cout << "  " << program_name << " --help-input\n";
         std::cout << "  " << program_name << " --help-T\n\n";
         std::cout << "For more detailed help on specific topics, use --help-<topic>\n";
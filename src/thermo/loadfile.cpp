@@ -13,6 +13,10 @@
 
 #include "thermo/loadfile.h"
 #include "thermo/chemsys.h"
+#include "thermo/util.h"
+#include "extraction/qc_extractor.h"  // MemoryReservation; after chemsys.h because of R
+#include "utilities/file_view.h"
+#include "utilities/numeric_parse.h"
 #include <algorithm>
 #include <array>
 #include <cctype>
@@ -27,6 +31,47 @@
 #include <vector>
 
 
+/**
+ * @brief Content of sys.inputfile, reusing the caller's view when it maps that file
+ * @param sys SystemData whose inputfile (and optional inputview) is read
+ * @return View over the whole file
+ * @throws std::runtime_error if the file cannot be opened
+ */
+auto LoadFile::open_input(const SystemData& sys) -> FileView
+{
+    if (sys.inputview.is_open(sys.inputfile))
+    {
+        return sys.inputview;
+    }
+    try
+    {
+        return FileView(sys.inputfile);
+    }
+    catch (const std::runtime_error&)
+    {
+        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
+    }
+}
+
+/**
+ * @brief Charge the mapping of sys.inputfile against sys.memory_monitor
+ * @param sys SystemData whose inputfile is about to be opened
+ * @return Reservation held while the file is parsed; waits while the budget is exhausted
+ *
+ * A view handed in through sys.inputview is charged by whoever mapped it, so
+ * only files open_input() maps itself are counted.
+ */
+auto LoadFile::reserve_input(const SystemData& sys) -> MemoryReservation
+{
+    if (!sys.memory_monitor || sys.inputview.is_open(sys.inputfile))
+    {
+        return MemoryReservation(nullptr, 0);
+    }
+    std::error_code ec;
+    auto            bytes = std::filesystem::file_size(sys.inputfile, ec);
+    return MemoryReservation(sys.memory_monitor, ec ? 0 : static_cast<size_t>(bytes));
+}
+
 /**
  * @brief Locate a label in an input stream, optionally skipping lines after match
  * @param file Input stream to search
@@ -117,23 +162,15 @@ double LoadFile::readaftersign(std::istream& file, const std::string& sign)
             throw std::runtime_error("Sign '" + sign + "' not found in line: " + line);
         }
     }
-    // Read from after the sign
-    std::istringstream iss(line.substr(pos + sign.length()));
-    std::string        token;
-    double             value = 0.0;
-    bool               found = false;
-    while (iss >> token)
+    // Read from after the sign: take the first field that starts with a number (safer)
+    std::string_view rest  = std::string_view(line).substr(pos + sign.length());
+    double           value = 0.0;
+    bool             found = false;
+    while (!found && !rest.empty())
     {
-        try
-        {
-            value = std::stod(token);
-            found = true;
-            break;  // Take first number after sign (safer)
-        }
-        catch (const std::invalid_argument&)
-        {
-            continue;
-        }
+        size_t consumed = 0;
+        found           = NumParse::parse_leading(rest, value, consumed);
+        rest            = NumParse::skip_fields(rest, 1);
     }
 
     if (!found)
@@ -155,23 +192,15 @@ double LoadFile::readaftersign_from_line(const std::string& line, const std::str
     size_t pos = line.rfind(sign);  // Find last occurrence to match Fortran behavior
     if (pos != std::string::npos)
     {
-        std::string value_str = line.substr(pos + sign.length());
-        // Remove leading whitespace
-        value_str.erase(0, value_str.find_first_not_of(" \t"));
-        try
-        {
-            return std::stod(value_str);
-        }
-        catch (const std::invalid_argument& e)
-        {
-            std::cerr << "ERROR: Invalid argument for stod on value_str: '" << value_str << "' - " << e.what() << '\n';
-            throw std::runtime_error("Failed to parse numeric value from: " + value_str);
-        }
-        catch (const std::out_of_range& e)
+        std::string_view value_str = std::string_view(line).substr(pos + sign.length());
+        double           value     = 0.0;
+        size_t           consumed  = 0;
+        if (!NumParse::parse_leading(value_str, value, consumed))
         {
-            std::cerr << "ERROR: Out of range for stod on value_str: '" << value_str << "' - " << e.what() << '\n';
-            throw std::runtime_error("Numeric value out of range: " + value_str);
+            std::cerr << "ERROR: Invalid numeric value after sign: '" << value_str << "'" << '\n';
+            throw std::runtime_error("Failed to parse numeric value from: " + std::string(value_str));
         }
+        return value;
     }
     throw std::runtime_error("Sign '" + sign + "' not found in line: " + line);
 }
@@ -280,15 +309,9 @@ void LoadFile::setatmmass(SystemData& sys)
  */
 void LoadFile::loadotm(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     std::string line, strtmp;
 
@@ -386,15 +409,9 @@ void LoadFile::loadotm(SystemData& sys)
 
 void LoadFile::loadgau(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Load energy
     if (loclabel(file, "Sum of electronic and zero-point Energies=", 0))
@@ -419,7 +436,7 @@ void LoadFile::loadgau(SystemData& sys)
     else
     {
         sys.spinmult = 1;
-        std::cout << "Note: \"Multiplicity =\" cannot be found, set spin multiplicity to 1" << '\n';
+        util::report() << "Note: \"Multiplicity =\" cannot be found, set spin multiplicity to 1" << '\n';
     }
 
     // Load geometry
@@ -545,10 +562,11 @@ void LoadFile::loadGaugeom(std::istream& file, SystemData& sys)
                     break;
                 if (!loadArgs.empty())
                 {
-                    std::istringstream iss(loadArgs);
-                    int                inouse1, index, inouse2;
-                    double             x, y, z;
-                    if (iss >> inouse1 >> index >> inouse2 >> x >> y >> z)
+                    std::string_view fields = loadArgs;
+                    int              inouse1, index, inouse2;
+                    double           xyz[3];
+                    if (NumParse::parse_int(fields, inouse1) && NumParse::parse_int(fields, index) &&
+                        NumParse::parse_int(fields, inouse2) && NumParse::parse_doubles(fields, xyz, 3) == 3)
                     {
                         sys.ncenter++;
                     }
@@ -588,10 +606,23 @@ void LoadFile::loadGaugeom(std::istream& file, SystemData& sys)
             // Read the geometry data - this matches: do iatm=1,ncenter
             for (int iatm = 0; iatm < sys.ncenter; ++iatm)
             {
-                int inouse1, inouse2;
+                int    inouse1, inouse2;
+                double xyz[3];
                 // This matches: read(ifileid,*) inouse,a(iatm)%index,inouse,a(iatm)%x,a(iatm)%y,a(iatm)%z
-                if (!(file >> inouse1 >> sys.a[iatm].index >> inouse2 >> sys.a[iatm].x >> sys.a[iatm].y >>
-                      sys.a[iatm].z))
+                std::string      atomLine;
+                std::string_view fields;
+                if (std::getline(file, atomLine))
+                {
+                    fields = atomLine;
+                }
+                if (NumParse::parse_int(fields, inouse1) && NumParse::parse_int(fields, sys.a[iatm].index) &&
+                    NumParse::parse_int(fields, inouse2) && NumParse::parse_doubles(fields, xyz, 3) == 3)
+                {
+                    sys.a[iatm].x = xyz[0];
+                    sys.a[iatm].y = xyz[1];
+                    sys.a[iatm].z = xyz[2];
+                }
+                else
                 {
                     std::cerr << "Error: Failed to read atom " << (iatm + 1) << " coordinates" << '\n';
                     exit(1);
@@ -627,16 +658,10 @@ void LoadFile::loadGaufreq(std::istream& file, SystemData& sys)
         size_t freqPos = line.find("Frequencies -- ");
         if (freqPos != std::string::npos)
         {
-            std::string        freqData = line.substr(freqPos + 15);  // Skip "Frequencies -- "
-            std::istringstream iss(freqData);
-            double             temp;
-            int                countOnThisLine = 0;
-
             // Count how many frequency values are on this line (max 3)
-            while (iss >> temp && countOnThisLine < 3)
-            {
-                countOnThisLine++;
-            }
+            double temp[3];
+            int    countOnThisLine = static_cast<int>(
+                NumParse::parse_doubles(std::string_view(line).substr(freqPos + 15), temp, 3));  // Skip "Frequencies -- "
 
             frequencyCount += countOnThisLine;
 
@@ -676,21 +701,7 @@ void LoadFile::loadGaufreq(std::istream& file, SystemData& sys)
         size_t freqPos = line.find("Frequencies -- ");
         if (freqPos != std::string::npos)
         {
-            std::string        freqData = line.substr(freqPos + 15);
-            std::istringstream iss(freqData);
-
-            if (iread == 1)
-            {
-                iss >> sys.wavenum[inow];
-            }
-            else if (iread == 2)
-            {
-                iss >> sys.wavenum[inow] >> sys.wavenum[inow + 1];
-            }
-            else if (iread == 3)
-            {
-                iss >> sys.wavenum[inow] >> sys.wavenum[inow + 1] >> sys.wavenum[inow + 2];
-            }
+            NumParse::parse_doubles(std::string_view(line).substr(freqPos + 15), &sys.wavenum[inow], iread);
         }
 
         ilackdata -= iread;
@@ -708,15 +719,9 @@ void LoadFile::loadGaufreq(std::istream& file, SystemData& sys)
 // CP2K
 void LoadFile::loadCP2K(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // ==================== Load Spin Multiplicity ====================
     file.clear();
@@ -733,14 +738,14 @@ void LoadFile::loadCP2K(SystemData& sys)
             }
             catch (...)
             {
-                std::cout << "Warning: Failed to parse spin multiplicity, defaulting to 1." << '\n';
+                util::report() << "Warning: Failed to parse spin multiplicity, defaulting to 1." << '\n';
                 sys.spinmult = 1;
             }
         }
     }
     else
     {
-        std::cout << "Note: Unable to find spin multiplicity information; assume to be singlet" << '\n';
+        util::report() << "Note: Unable to find spin multiplicity information; assume to be singlet" << '\n';
         sys.spinmult = 1;
     }
 
@@ -872,16 +877,8 @@ void LoadFile::loadCP2K(SystemData& sys)
             if (pos == std::string::npos)
                 continue;
 
-            // Extract substring after the label
-            std::string        freqPart = freqLine.substr(pos + 22);  // "VIB|Frequency (cm^-1)" is 22 chars
-            std::istringstream iss(freqPart);
-            double             freq;
-
-            // Read all frequencies on this line
-            while (iss >> freq)
-            {
-                allFreqs.push_back(freq);
-            }
+            // Read all frequencies on this line ("VIB|Frequency (cm^-1)" is 22 chars)
+            NumParse::parse_doubles(std::string_view(freqLine).substr(pos + 22), allFreqs);
         }
     }
 
@@ -909,7 +906,7 @@ void LoadFile::loadCP2K(SystemData& sys)
         if (sys.ipmode == 1)
         {
             sys.PGnameinit = "C1";
-            std::cout
+            util::report()
                 << "Note: When using CP2K to treat periodic systems or solid states (ipmode=1), OpenThermo does not "
                    "automatically detect point group and simply set it to C1."
                 << "You might want to use other point groups, and it can be set manually via \"PGname\" in settings.ini"
@@ -921,15 +918,9 @@ void LoadFile::loadCP2K(SystemData& sys)
 // ORCA
 void LoadFile::loadorca(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Load energy
     int ncount;
@@ -1168,10 +1159,8 @@ void LoadFile::loadORCAfreq(std::istream& file, SystemData& sys)
         if (loadArgs.find(" 0.00 cm") != std::string::npos)
             continue;
 
-        std::istringstream iss(loadArgs);
-        std::string        dummy_str;
-        double             freq_val;
-        if (!(iss >> dummy_str >> freq_val))
+        double freq_val;
+        if (NumParse::parse_doubles(NumParse::skip_fields(loadArgs, 1), &freq_val, 1) != 1)
         {
             std::cerr << "Error: Failed to parse frequency from line: " << loadArgs << '\n';
             throw std::runtime_error("Invalid frequency format");
@@ -1186,15 +1175,9 @@ void LoadFile::loadORCAfreq(std::istream& file, SystemData& sys)
 // GAMESS
 void LoadFile::loadgms(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Load energy - robust method: find last "FINAL" line, read next line, split and take last value
     file.clear();
@@ -1251,14 +1234,14 @@ void LoadFile::loadgms(SystemData& sys)
     method.erase(method.find_last_not_of(" \t") + 1);
     if (!method.empty())
     {
-        std::cout << "Note: " << method << " energy (" << std::fixed << std::setprecision(8) << sys.E
-                  << " a.u.) is loaded. If this is not the intended method, the final U, H, G may be misleading"
-                  << '\n';
+        util::report() << "Note: " << method << " energy (" << std::fixed << std::setprecision(8) << sys.E
+                       << " a.u.) is loaded. If this is not the intended method, the final U, H, G may be misleading"
+                       << '\n';
     }
     else
     {
-        std::cout << "Note: Energy (" << std::fixed << std::setprecision(8) << sys.E
-                  << " a.u.) is loaded from GAMESS file." << '\n';
+        util::report() << "Note: Energy (" << std::fixed << std::setprecision(8) << sys.E
+                       << " a.u.) is loaded from GAMESS file." << '\n';
     }
 
     // Load multiplicity
@@ -1576,10 +1559,10 @@ void LoadFile::loadGmsfreq(std::istream& file, SystemData& sys)
                 {
                     throw std::runtime_error("Failed to read frequency for mode " + std::to_string(idx));
                 }
-                std::istringstream iss(line);
-                int                inouse;
-                double             tmpval;
-                if (!(iss >> inouse >> tmpval))
+                std::string_view fields = line;
+                int              inouse;
+                double           tmpval;
+                if (!NumParse::parse_int(fields, inouse) || !NumParse::parse_double(fields, tmpval))
                 {
                     throw std::runtime_error("Failed to parse frequency for mode " + std::to_string(idx) +
                                              " from: " + line);
@@ -1606,15 +1589,9 @@ void LoadFile::loadGmsfreq(std::istream& file, SystemData& sys)
 // NWCHEM
 void LoadFile::loadnw(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Load energy
     int ncount;
@@ -1629,12 +1606,12 @@ void LoadFile::loadnw(SystemData& sys)
         if (loclabelfinal(file, "Total SCF energy =", ncount) && ncount > 0)
         {
             sys.E = readaftersign(file, "=");
-            std::cout << "Note: SCF energy is loaded. If the theoretical method presently used is other one, "
-                      << "the finally printed total U, H, G will be misleading" << '\n';
+            util::report() << "Note: SCF energy is loaded. If the theoretical method presently used is other one, "
+                           << "the finally printed total U, H, G will be misleading" << '\n';
         }
         else
         {
-            std::cout << "Warning: Unable to load electronic energy, thus it is set to zero" << '\n';
+            util::report() << "Warning: Unable to load electronic energy, thus it is set to zero" << '\n';
             sys.E = 0;
         }
     }
@@ -1825,24 +1802,16 @@ void LoadFile::loadNwfreq(std::istream& file, SystemData& sys)
             // We expect lines like:
             //    7       78.253 ||      -0.000               0.000             2.508
 
-            std::istringstream iss(line);
-            int                mode;
-            double             freq_cm;
-            std::string        sep;
+            std::string_view fields = line;
+            int              mode;
+            double           freq_cm;
 
-            // Read mode number and frequency
-            if (!(iss >> mode >> freq_cm))
+            // Read mode number and frequency; the "||" separator that follows is not needed
+            if (!NumParse::parse_int(fields, mode) || !NumParse::parse_double(fields, freq_cm))
             {
                 continue;  // Skip malformed lines
             }
 
-            // Optional: read "||" to ensure we're parsing correctly
-            iss >> sep;
-            if (sep != "||")
-            {
-                // Not a problem — maybe extra space, but we already have freq
-            }
-
             // Only store non-zero frequencies: (original logic)
             // But note: NWChem prints 0.000 for translations/rotations — you may want to SKIP them
             // Since you said "if (tmp != 0)" — skipping zeros.
@@ -1881,15 +1850,9 @@ void LoadFile::loadNwfreq(std::istream& file, SystemData& sys)
 // XTB
 void LoadFile::loadxtb(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Load multiplicity
     if (loclabel(file, "alpha electrons", 0))
@@ -1944,9 +1907,9 @@ void LoadFile::loadxtb(SystemData& sys)
 
     if (sys.massmod == 3)
     {
-        std::cout << "Note: massmod=3 is meaningless for present case because input file does not record atomic mass. "
-                     "Now set atomic masses to element mass (massmod=1)"
-                  << '\n';
+        util::report() << "Note: massmod=3 is meaningless for present case because input file does not record atomic mass. "
+                          "Now set atomic masses to element mass (massmod=1)"
+                       << '\n';
         sys.massmod = 1;
     }
     setatmmass(sys);
@@ -1957,15 +1920,9 @@ void LoadFile::loadxtb(SystemData& sys)
 // VASP
 void LoadFile::loadvasp(SystemData& sys)
 {
-    // Read entire file into memory for fast seeking
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-    {
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-    }
-    std::string filecontents((std::istreambuf_iterator<char>(rawfile)), std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // Parse straight from the shared mapped view (seekable, no copy)
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // Determine if it's CONTCAR or OUTCAR based on content
     // Check for OUTCAR-specific patterns first
@@ -2034,7 +1991,7 @@ void LoadFile::loadvasp(SystemData& sys)
         if (sys.ipmode == 1)
         {
             sys.PGnameinit = "C1";
-            std::cout
+            util::report()
                 << "Note: When using VASP to treat periodic systems or solid states (ipmode=1), OpenThermo does not "
                    "automatically detect point group and simply set it to C1."
                 << "You might want to use other point group, and it can be set manually via \"PGname\" in settings.ini"
@@ -2525,15 +2482,9 @@ void LoadFile::loadQChemfreq(std::istream& file, SystemData& sys)
         if (pos == std::string::npos)
             continue;
 
-        std::string        freqPart = line.substr(pos + 11);  // skip " Frequency:"
-        std::istringstream iss(freqPart);
-        double             val;
-        int                cnt = 0;
-        while (iss >> val && cnt < 3)
-        {
-            allFreqs.push_back(val);
-            ++cnt;
-        }
+        double vals[3];
+        size_t cnt = NumParse::parse_doubles(std::string_view(line).substr(pos + 11), vals, 3);  // skip " Frequency:"
+        allFreqs.insert(allFreqs.end(), vals, vals + cnt);
     }
 
     if (allFreqs.empty())
@@ -2573,16 +2524,9 @@ void LoadFile::loadQChemfreq(std::istream& file, SystemData& sys)
  */
 void LoadFile::loadqchem(SystemData& sys)
 {
-    // ── Read entire file into memory for fast multi-pass seeking ──────────
-    std::ifstream rawfile(sys.inputfile, std::ios::binary);
-    if (!rawfile.is_open())
-        throw std::runtime_error("Cannot open input file: " + sys.inputfile);
-
-    std::string filecontents(
-        (std::istreambuf_iterator<char>(rawfile)),
-        std::istreambuf_iterator<char>());
-    rawfile.close();
-    std::istringstream file(filecontents);
+    // ── Parse straight from the shared mapped view (multi-pass seeking) ───
+    MemoryReservation mapping = reserve_input(sys);
+    FileViewStream    file(open_input(sys));
 
     // ── Spin multiplicity ─────────────────────────────────────────────────
     // The "$molecule" section in the User input block contains the charge and
@@ -2624,8 +2568,8 @@ void LoadFile::loadqchem(SystemData& sys)
     }
     else
     {
-        std::cout << "Note: Q-Chem: Could not locate User input block; "
-                     "defaulting spin multiplicity to 1\n";
+        util::report() << "Note: Q-Chem: Could not locate User input block; "
+                          "defaulting spin multiplicity to 1\n";
     }
 
     // ── Electronic energy ─────────────────────────────────────────────────
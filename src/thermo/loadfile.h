@@ -14,9 +14,12 @@
 #define LOADFILE_H
 
 #include "thermo/chemsys.h"
+#include "utilities/file_view.h"
 #include <string>
 #include <istream>
 
+class MemoryReservation;
+
 
 /**
  * @brief Class for loading quantum chemistry output files
@@ -29,6 +32,8 @@ class LoadFile
 {
 private:
     // Utility functions
+    static auto open_input(const SystemData& sys) -> FileView;
+    static auto reserve_input(const SystemData& sys) -> MemoryReservation;
     static auto loclabel(std::istream& file, const std::string& label, int skip = 0) -> bool;
     static auto loclabelfinal(std::istream& file, const std::string& label, int& ncount) -> bool;
     static void skiplines(std::istream& file, int n);
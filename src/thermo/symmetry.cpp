@@ -13,6 +13,7 @@
 
 #include "thermo/symmetry.h"
 #include "thermo/omp_config.h"
+#include "thermo/util.h"
 #include <vector>
 #include <cmath>
 #include <stdexcept>
@@ -248,7 +249,7 @@ void add_perm(int natoms, const std::vector<int>& ntrans, int& nprm,
     for (int i = 0; i < nprm; ++i) {
         bool match = true;
         for (int j = 0; j < natoms; ++j) {
-            if (ntrans[j] != nper[j][i]) {
+            if (ntrans[j] + 1 != nper[j][i]) {
                 match = false;
                 break;
             }
@@ -262,7 +263,7 @@ void add_perm(int natoms, const std::vector<int>& ntrans, int& nprm,
     }
 
     for (int j = 0; j < natoms; ++j) {
-        nper[j][nprm] = ntrans[j];
+        nper[j][nprm] = ntrans[j] + 1; // Stored 1-based like the identity and inversion
     }
     nprm++;
 }
@@ -538,37 +539,37 @@ auto symm_point_group(int ngp, int ni, int nsg, int ncr, int nsr, int np, int no
             yesno = true;
             pgrp = SymmetryData::sg[i];
             if (nout >= 1) {
-                std::cout << "\n-- POINT GROUP --\n";
-                std::cout << "\n-- The structure should belong to the " << pgrp << " point group.\n";
-                std::cout << "\n   " << pgrp << " = " << SymmetryData::cg[i] << "\n";
-                std::cout << "\n       g       E       i      SG      Cn      Sn\n";
-                std::cout << "   -----------------------------------------------\n";
+                util::report() << "\n-- POINT GROUP --\n";
+                util::report() << "\n-- The structure should belong to the " << pgrp << " point group.\n";
+                util::report() << "\n   " << pgrp << " = " << SymmetryData::cg[i] << "\n";
+                util::report() << "\n       g       E       i      SG      Cn      Sn\n";
+                util::report() << "   -----------------------------------------------\n";
                 if (SymmetryData::ng[i][0] == -1) {
-                    std::cout << "         inf" << std::setw(8) << 1 << std::setw(8) << SymmetryData::ng[i][1]
-                              << std::setw(8) << "inf" << std::setw(8) << "inf";
+                    util::report() << "         inf" << std::setw(8) << 1 << std::setw(8) << SymmetryData::ng[i][1]
+                                   << std::setw(8) << "inf" << std::setw(8) << "inf";
                     if (SymmetryData::ng[i][4] == -1) {
-                        std::cout << std::setw(8) << "inf\n";
+                        util::report() << std::setw(8) << "inf\n";
                     } else {
-                        std::cout << std::setw(8) << SymmetryData::ng[i][4] << "\n";
+                        util::report() << std::setw(8) << SymmetryData::ng[i][4] << "\n";
                     }
                 } else {
-                    std::cout << std::setw(10) << SymmetryData::ng[i][0] << std::setw(8) << 1;
+                    util::report() << std::setw(10) << SymmetryData::ng[i][0] << std::setw(8) << 1;
                     for (int j = 1; j < 5; ++j) {
-                        std::cout << std::setw(8) << SymmetryData::ng[i][j];
+                        util::report() << std::setw(8) << SymmetryData::ng[i][j];
                     }
-                    std::cout << "\n";
+                    util::report() << "\n";
                 }
                 // Polarity and chirality
                 if ((i >= 3 && i <= 16) || i == 48 || i == 51 || i == 53) {
                     if (i >= 3 && i <= 9) {
-                        std::cout << "\n    The molecule is polar and chiral.\n";
+                        util::report() << "\n    The molecule is polar and chiral.\n";
                     } else {
-                        std::cout << "\n    The molecule is not polar and chiral.\n";
+                        util::report() << "\n    The molecule is not polar and chiral.\n";
                     }
                 } else if (i == 1 || (i >= 17 && i <= 23) || i == 55) {
-                    std::cout << "\n    The molecule is polar and not chiral.\n";
+                    util::report() << "\n    The molecule is polar and not chiral.\n";
                 } else {
-                    std::cout << "\n    The molecule is not polar and not chiral.\n";
+                    util::report() << "\n    The molecule is not polar and not chiral.\n";
                 }
             }
         }
@@ -579,9 +580,9 @@ auto symm_point_group(int ngp, int ni, int nsg, int ncr, int nsr, int np, int no
         if (ngp == 1) {
             pgrp = "C1";
             if (nout >= 1) {
-                std::cout << "\n-- POINT GROUP --\n";
-                std::cout << "\n-- The structure should belong to the C1 point group.\n";
-                std::cout << "\n    The molecule is polar and chiral.\n";
+                util::report() << "\n-- POINT GROUP --\n";
+                util::report() << "\n-- The structure should belong to the C1 point group.\n";
+                util::report() << "\n    The molecule is polar and chiral.\n";
             }
         }
     }
@@ -652,7 +653,7 @@ void SymmetryDetector::detectPG(int ishow) {
     std::string PGname3; // Used for input and output from PG_eqvatm
 
     if (this->PGnameinit == "?") { // Not directly specified
-        if (ishow == 1) std::cout << "Identifying point group..." << "\n";
+        if (ishow == 1) util::report() << "Identifying point group..." << "\n";
 
         for (int i = 0; i < this->ncenter; i++) {
             tmpmat[0][i] = this->a[i].x;
@@ -676,10 +677,10 @@ void SymmetryDetector::detectPG(int ishow) {
         }
 
         if (PGname3 == " " || PGname3.empty()) {
-            std::cout << "Warning: Failed to identify point group; C1 will be used " << "\n";
+            util::report() << "Warning: Failed to identify point group; C1 will be used " << "\n";
             this->PGname = "C1  ";
         } else {
-            if (ishow == 1) std::cout << "Point group has been successfully identified" << "\n";
+            if (ishow == 1) util::report() << "Point group has been successfully identified" << "\n";
             this->PGname = "    "; // Initialize with spaces
             this->PGname.replace(0, 3, PGname3);
         }
@@ -729,9 +730,9 @@ void SymmetryDetector::PGname2rotsym() {
     } else {
         // Although We can identify 'O' and 'I', rotsym is not available
         // For simplicity, we'll assume rotsym = 1 for unknown cases
-        std::cout << "Warning: Rotational symmetry number cannot be identified for this point group "
-                  << PGname_trimmed << "\n";
-        std::cout << "Assuming rotational symmetry number to be 1" << "\n";
+        util::report() << "Warning: Rotational symmetry number cannot be identified for this point group "
+                       << PGname_trimmed << "\n";
+        util::report() << "Assuming rotational symmetry number to be 1" << "\n";
         this->rotsym = 1;
     }
 }
@@ -1679,15 +1680,15 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     if (nout == 2) {
-        std::cout << "\n-- Equivalence classes of atoms: " << neq << "\n";
+        util::report() << "\n-- Equivalence classes of atoms: " << neq << "\n";
         for (int i = 0; i < neq; ++i) {
-            std::cout << "\n     #" << (i+1) << " (atom "
-                      << symb[nat[ieq[i][0] - 1] - 1] << ")" << "\n";
-            std::cout << "     ";
+            util::report() << "\n     #" << (i+1) << " (atom "
+                           << symb[nat[ieq[i][0] - 1] - 1] << ")" << "\n";
+            util::report() << "     ";
             for (int j = 0; j < meq[i]; ++j) {
-                std::cout << std::setw(4) << ieq[i][j];
+                util::report() << std::setw(4) << ieq[i][j];
             }
-            std::cout << "\n";
+            util::report() << "\n";
         }
     }
 
@@ -1712,7 +1713,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     if (symcen) {
-        if (nout >= 1) std::cout << "\n-- CENTRE OF SYMMETRY: {i}" << "\n";
+        if (nout >= 1) util::report() << "\n-- CENTRE OF SYMMETRY: {i}" << "\n";
         nsym[0][1] = 1;
     }
 
@@ -1729,8 +1730,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     if (icent != 0 && nout == 2) {
-        std::cout << "\n-- Atom " << symb[nat[icent - 1] - 1]
-                  << " (" << icent << ") in the COM" << "\n";
+        util::report() << "\n-- Atom " << symb[nat[icent - 1] - 1]
+                       << " (" << icent << ") in the COM" << "\n";
     }
     nsym[0][2] = icent;
     if (icent > 0) nsym[0][4] = 1;
@@ -1766,12 +1767,12 @@ void sym_elements(int natoms, const std::vector<int>& nat,
 
     bool is_linear = linear;
     if (is_linear) {
-        if (nout >= 1) std::cout << "\n-- LINEAR MOLECULE" << "\n";
+        if (nout >= 1) util::report() << "\n-- LINEAR MOLECULE" << "\n";
 
         if (symcen) {
             if (nout >= 1) {
-                std::cout << "\n-- The structure should belong to the Dinf_h point group." << "\n";
-                std::cout << "\n-- PLANES OF SYMMETRY --" << "\n";
+                util::report() << "\n-- The structure should belong to the Dinf_h point group." << "\n";
+                util::report() << "\n-- PLANES OF SYMMETRY --" << "\n";
             }
 
             nsg = 1;
@@ -1784,10 +1785,10 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                 symn[k][1] = 0.0;
             }
 
-            if (nout >= 1) std::cout << "\n-- Infinite planes" << "\n";
-            if (nout == 2) std::cout << "     All atoms included." << "\n";
+            if (nout >= 1) util::report() << "\n-- Infinite planes" << "\n";
+            if (nout == 2) util::report() << "     All atoms included." << "\n";
 
-            if (nout >= 1) std::cout << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
+            if (nout >= 1) util::report() << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
 
             ncr = 2;
             nsym[2][0] = 2; // C2
@@ -1815,28 +1816,28 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             }
 
             if (nout >= 1) {
-                std::cout << "\n-- Axis #1: C(" << std::fixed << std::setprecision(2) << 0.0 << ")" << "\n";
+                util::report() << "\n-- Axis #1: C(" << std::fixed << std::setprecision(2) << 0.0 << ")" << "\n";
             }
             if (nout == 2) {
-                std::cout << "  d: " << std::fixed << std::setprecision(5);
+                util::report() << "  d: " << std::fixed << std::setprecision(5);
                 for (int k = 0; k < 3; ++k) {
-                    std::cout << std::setw(12) << symn[k][2];
+                    util::report() << std::setw(12) << symn[k][2];
                 }
-                std::cout << "\n     All atoms included." << "\n";
+                util::report() << "\n     All atoms included." << "\n";
             }
 
             if (nout >= 1) {
-                std::cout << "\n-- Axis #2: C(" << std::fixed << std::setprecision(2) << 180.0 << ")" << "\n";
+                util::report() << "\n-- Axis #2: C(" << std::fixed << std::setprecision(2) << 180.0 << ")" << "\n";
             }
             if (nout == 2) {
-                std::cout << "  d: " << std::fixed << std::setprecision(5);
+                util::report() << "  d: " << std::fixed << std::setprecision(5);
                 for (int k = 0; k < 3; ++k) {
-                    std::cout << std::setw(12) << symn[k][3];
+                    util::report() << std::setw(12) << symn[k][3];
                 }
-                std::cout << "\n     Atoms included:" << "\n";
+                util::report() << "\n     Atoms included:" << "\n";
                 if (icent != 0) {
-                    std::cout << "          " << symb[nat[nsym[0][2] - 1] - 1]
-                              << " (" << nsym[0][2] << ")" << "\n";
+                    util::report() << "          " << symb[nat[nsym[0][2] - 1] - 1]
+                                   << " (" << nsym[0][2] << ")" << "\n";
                 }
             }
 
@@ -1855,12 +1856,12 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             norder = -1;
             np = -1;
 
-            if (nout >= 1) std::cout << "\n-- Number of symmetry operations = infinite" << "\n";
+            if (nout >= 1) util::report() << "\n-- Number of symmetry operations = infinite" << "\n";
 
         } else {
             if (nout >= 1) {
-                std::cout << "\n-- The structure should belong to the Cinf_v point group." << "\n";
-                std::cout << "\n-- PLANES OF SYMMETRY --" << "\n";
+                util::report() << "\n-- The structure should belong to the Cinf_v point group." << "\n";
+                util::report() << "\n-- PLANES OF SYMMETRY --" << "\n";
             }
 
             nsg = 1;
@@ -1873,10 +1874,10 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                 symn[k][1] = 0.0;
             }
 
-            if (nout >= 1) std::cout << "\n-- Infinite planes" << "\n";
-            if (nout == 2) std::cout << "     All atoms included." << "\n";
+            if (nout >= 1) util::report() << "\n-- Infinite planes" << "\n";
+            if (nout == 2) util::report() << "     All atoms included." << "\n";
 
-            if (nout >= 1) std::cout << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
+            if (nout >= 1) util::report() << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
 
             ncr = 1;
             nsym[2][0] = 2;
@@ -1894,14 +1895,14 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             }
 
             if (nout >= 1) {
-                std::cout << "\n-- Axis #1: C(" << std::fixed << std::setprecision(2) << 0.0 << ")" << "\n";
+                util::report() << "\n-- Axis #1: C(" << std::fixed << std::setprecision(2) << 0.0 << ")" << "\n";
             }
             if (nout == 2) {
-                std::cout << "  d: " << std::fixed << std::setprecision(5);
+                util::report() << "  d: " << std::fixed << std::setprecision(5);
                 for (int k = 0; k < 3; ++k) {
-                    std::cout << std::setw(12) << symn[k][2];
+                    util::report() << std::setw(12) << symn[k][2];
                 }
-                std::cout << "\n     All atoms included." << "\n";
+                util::report() << "\n     All atoms included." << "\n";
             }
 
             nsr = 0;
@@ -1909,7 +1910,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             ni = 0;
             np = -1;
 
-            if (nout >= 1) std::cout << "\n-- Number of symmetry operations = infinite" << "\n";
+            if (nout >= 1) util::report() << "\n-- Number of symmetry operations = infinite" << "\n";
         }
 
         // Skip the rest of the function for linear molecules
@@ -1936,13 +1937,13 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         sigman[nsg - 1][1] = v1[1];
         sigman[nsg - 1][2] = v1[2];
 
-        if (nout >= 1) std::cout << "\n-- PLANAR MOLECULE" << "\n";
+        if (nout >= 1) util::report() << "\n-- PLANAR MOLECULE" << "\n";
         if (nout == 2) {
-            std::cout << "  n: " << std::fixed << std::setprecision(5);
+            util::report() << "  n: " << std::fixed << std::setprecision(5);
             for (int k = 0; k < 3; ++k) {
-                std::cout << std::setw(12) << v1[k];
+                util::report() << std::setw(12) << v1[k];
             }
-            std::cout << "\n";
+            util::report() << "\n";
         }
 
         if (symcen && planar) {
@@ -2051,21 +2052,21 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     // Output planes of symmetry
-    if (nout >= 1) std::cout << "\n-- PLANES OF SYMMETRY --" << "\n";
+    if (nout >= 1) util::report() << "\n-- PLANES OF SYMMETRY --" << "\n";
 
     for (int i = 0; i < nsg; ++i) {
-        if (nout >= 1) std::cout << "\n-- Plane #" << (i + 1) << "\n";
+        if (nout >= 1) util::report() << "\n-- Plane #" << (i + 1) << "\n";
 
         v1[0] = sigman[i][0];
         v1[1] = sigman[i][1];
         v1[2] = sigman[i][2];
 
         if (nout == 2) {
-            std::cout << "  n: " << std::fixed << std::setprecision(5);
+            util::report() << "  n: " << std::fixed << std::setprecision(5);
             for (int k = 0; k < 3; ++k) {
-                std::cout << std::setw(12) << v1[k];
+                util::report() << std::setw(12) << v1[k];
             }
-            std::cout << "\n     Atoms included:" << "\n";
+            util::report() << "\n     Atoms included:" << "\n";
         }
 
         int m = 0;
@@ -2076,8 +2077,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             double sp = symm_dot(v1.data(), p3.data(), 3);
             if (std::abs(sp) <= delta) {
                 if (nout == 2) {
-                    std::cout << "          " << symb[nat[j] - 1]
-                              << " (" << (j + 1) << ")" << "\n";
+                    util::report() << "          " << symb[nat[j] - 1]
+                                   << " (" << (j + 1) << ")" << "\n";
                 }
                 m++;
                 if (std::abs(sp) > delta3) delta3 = std::abs(sp);
@@ -2096,7 +2097,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     // Proper rotations from plane intersections
-    if (nout >= 1) std::cout << "\n-- Proper rotations due to the centre and planes of symmetry --" << "\n";
+    if (nout >= 1) util::report() << "\n-- Proper rotations due to the centre and planes of symmetry --" << "\n";
 
     for (int i = 0; i < nsg - 1; ++i) {
         v1[0] = sigman[i][0];
@@ -2131,8 +2132,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         (void)m;
         double sp = rota[i];
         if (nout >= 1) {
-            std::cout << "\n-- Rotation #" << (i + 1) << ": C("
-                      << std::fixed << std::setprecision(2) << sp << ")" << "\n";
+            util::report() << "\n-- Rotation #" << (i + 1) << ": C("
+                           << std::fixed << std::setprecision(2) << sp << ")" << "\n";
         }
 
         v1[0] = rotn[i][0];
@@ -2140,11 +2141,11 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         v1[2] = rotn[i][2];
 
         if (nout == 2) {
-            std::cout << "  d: " << std::fixed << std::setprecision(5);
+            util::report() << "  d: " << std::fixed << std::setprecision(5);
             for (int k = 0; k < 3; ++k) {
-                std::cout << std::setw(12) << v1[k];
+                util::report() << std::setw(12) << v1[k];
             }
-            std::cout << "\n     Atoms included:" << "\n";
+            util::report() << "\n     Atoms included:" << "\n";
         }
 
         for (int j = 0; j < natoms; ++j) {
@@ -2160,8 +2161,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             double vn = std::sqrt(symm_dot(v0.data(), v0.data(), 3));
             if (std::abs(vn) <= delta) {
                 if (nout == 2) {
-                    std::cout << "          " << symb[nat[j] - 1]
-                              << " (" << (j + 1) << ")" << "\n";
+                    util::report() << "          " << symb[nat[j] - 1]
+                                   << " (" << (j + 1) << ")" << "\n";
                 }
                 m++;
                 if (std::abs(vn) > delta3) delta3 = std::abs(vn);
@@ -2170,7 +2171,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     // Proper rotational axes - single atoms
-    if (nout >= 1) std::cout << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
+    if (nout >= 1) util::report() << "\n-- Distinct PROPER ROTATIONAL AXES --" << "\n";
 
     // Cn (for each atom)
     for (int i = 0; i < neq; ++i) {
@@ -2333,8 +2334,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         (void)m;
         double sp = rota[i];
         if (nout >= 1) {
-            std::cout << "\n-- Axis #" << (i + 1) << ": C("
-                      << std::fixed << std::setprecision(2) << sp << ")" << "\n";
+            util::report() << "\n-- Axis #" << (i + 1) << ": C("
+                           << std::fixed << std::setprecision(2) << sp << ")" << "\n";
         }
 
         v1[0] = rotn[i][0];
@@ -2342,11 +2343,11 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         v1[2] = rotn[i][2];
 
         if (nout == 2) {
-            std::cout << "  d: " << std::fixed << std::setprecision(5);
+            util::report() << "  d: " << std::fixed << std::setprecision(5);
             for (int k = 0; k < 3; ++k) {
-                std::cout << std::setw(12) << v1[k];
+                util::report() << std::setw(12) << v1[k];
             }
-            std::cout << "\n     Atoms included:" << "\n";
+            util::report() << "\n     Atoms included:" << "\n";
         }
 
         for (int j = 0; j < natoms; ++j) {
@@ -2358,8 +2359,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             double vn = std::sqrt(symm_dot(v0.data(), v0.data(), 3));
             if (std::abs(vn) <= delta) {
                 if (nout == 2) {
-                    std::cout << "          " << symb[nat[j] - 1]
-                              << " (" << (j + 1) << ")" << "\n";
+                    util::report() << "          " << symb[nat[j] - 1]
+                                   << " (" << (j + 1) << ")" << "\n";
                 }
                 m++;
                 if (std::abs(vn) > delta3) delta3 = std::abs(vn);
@@ -2368,7 +2369,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     }
 
     // Generate all proper rotations
-    if (nout >= 1) std::cout << "\n-- PROPER ROTATIONAL AXES & ROTATIONS --" << "\n";
+    if (nout >= 1) util::report() << "\n-- PROPER ROTATIONAL AXES & ROTATIONS --" << "\n";
 
     int nsgi = nsg + 1;
     int ii = 0;
@@ -2419,7 +2420,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                 nsym[nsgi + ii - 1][4] = m;
 
                 if (nout >= 1) {
-                    std::cout << "-- #" << (i + 1) << "-" << ii << ": C(" << k << ")" << "\n";
+                    util::report() << "-- #" << (i + 1) << "-" << ii << ": C(" << k << ")" << "\n";
                 }
 
                 if (k > 2) {
@@ -2452,8 +2453,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                             nsym[nsgi + ii - 1][2] = kk / ngcd;
 
                             if (nout >= 1) {
-                                std::cout << "-- #" << (i + 1) << "-" << ii << ": C(" << k
-                                          << " ^" << kk << ")" << "\n";
+                                util::report() << "-- #" << (i + 1) << "-" << ii << ": C(" << k
+                                               << " ^" << kk << ")" << "\n";
                             }
                         }
                     }
@@ -2465,7 +2466,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     ncr = ii;
 
     // Improper rotational axes
-    if (nout >= 1) std::cout << "\n-- IMPROPER ROTATIONAL AXES & ROTATIONS --" << "\n";
+    if (nout >= 1) util::report() << "\n-- IMPROPER ROTATIONAL AXES & ROTATIONS --" << "\n";
 
     int nsgicn = nsgi + ncr;
     ii = 0;
@@ -2504,7 +2505,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                 nsym[nsgicn + ii - 1][4] = m;
 
                 if (nout >= 1) {
-                    std::cout << "-- #" << (i + 1) << "-" << ii << ": S(" << k << ")" << "\n";
+                    util::report() << "-- #" << (i + 1) << "-" << ii << ": S(" << k << ")" << "\n";
                 }
 
                 int kv = k - 1;
@@ -2532,8 +2533,8 @@ void sym_elements(int natoms, const std::vector<int>& nat,
                         nsym[nsgicn + ii - 1][2] = kk;
 
                         if (nout >= 1) {
-                            std::cout << "-- #" << (i + 1) << "-" << ii << ": S(" << k
-                                      << "^" << kk << ")" << "\n";
+                            util::report() << "-- #" << (i + 1) << "-" << ii << ": S(" << k
+                                           << "^" << kk << ")" << "\n";
                         }
                     }
                 }
@@ -2546,7 +2547,7 @@ void sym_elements(int natoms, const std::vector<int>& nat,
     norder = 1 + ni + nsg + ncr + nsr;
 
     if (nout >= 1) {
-        std::cout << "\n-- Number of symmetry operations (including E) = " << norder << "\n";
+        util::report() << "\n-- Number of symmetry operations (including E) = " << norder << "\n";
     }
 
     // Determination of the principal axis
@@ -2728,23 +2729,23 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         }
     } // end if (!is_linear)
 
-    if (nout >= 1) std::cout << "\n-- SYMMETRY OPERATIONS --" << "\n";
+    if (nout >= 1) util::report() << "\n-- SYMMETRY OPERATIONS --" << "\n";
 
     // COM and Inversion Center
     if (nout == 2) {
         if (nsym[0][1] == 0) {
             if (nsym[0][2] > 0) {
-                std::cout << "               #1: COM    -- with atom "
-                          << symb[nat[nsym[0][2] - 1] - 1] << " (#" << nsym[0][2] << ")" << "\n";
+                util::report() << "               #1: COM    -- with atom "
+                               << symb[nat[nsym[0][2] - 1] - 1] << " (#" << nsym[0][2] << ")" << "\n";
             } else {
-                std::cout << "               #1: COM" << "\n";
+                util::report() << "               #1: COM" << "\n";
             }
         } else if (nsym[0][1] == 1) {
             if (nsym[0][2] > 0) {
-                std::cout << "               #1: INVERSION CENTER  -- with atom "
-                          << symb[nat[nsym[0][2] - 1] - 1] << " (#" << nsym[0][2] << ")" << "\n";
+                util::report() << "               #1: INVERSION CENTER  -- with atom "
+                               << symb[nat[nsym[0][2] - 1] - 1] << " (#" << nsym[0][2] << ")" << "\n";
             } else {
-                std::cout << "               #1: INVERSION CENTER " << "\n";
+                util::report() << "               #1: INVERSION CENTER " << "\n";
             }
         }
 
@@ -2762,37 +2763,37 @@ void sym_elements(int natoms, const std::vector<int>& nat,
             }
 
             if (nsym[k][4] == 0) {
-                std::cout << "               #" << (k + 1) << ": " << symel << "\n";
+                util::report() << "               #" << (k + 1) << ": " << symel << "\n";
             } else {
-                std::cout << "               #" << (k + 1) << ": " << symel
-                          << "     -- with " << nsym[k][4] << " unmoved atoms" << "\n";
+                util::report() << "               #" << (k + 1) << ": " << symel
+                               << "     -- with " << nsym[k][4] << " unmoved atoms" << "\n";
             }
         }
 
         // C(n^k)
         for (int k = nsg + 1; k < nsg + ncr + 1; ++k) {
             if (nsym[k][2] > 1) {
-                std::cout << "               #" << (k + 1) << ": C(" << nsym[k][1]
-                          << "^" << nsym[k][2] << ")" << "\n";
+                util::report() << "               #" << (k + 1) << ": C(" << nsym[k][1]
+                               << "^" << nsym[k][2] << ")" << "\n";
             } else {
                 if (nsym[k][4] > 0) {
                     if (nsym[k][3] == 2) {
-                        std::cout << "               #" << (k + 1) << ": C'(" << nsym[k][1]
-                                  << ")  -- with " << nsym[k][4] << " unmoved atoms" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C'(" << nsym[k][1]
+                                       << ")  -- with " << nsym[k][4] << " unmoved atoms" << "\n";
                     } else if (nsym[k][3] == 3) {
-                        std::cout << "               #" << (k + 1) << ": C\"(" << nsym[k][1]
-                                  << ")  -- with " << nsym[k][4] << " unmoved atoms" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C\"(" << nsym[k][1]
+                                       << ")  -- with " << nsym[k][4] << " unmoved atoms" << "\n";
                     } else {
-                        std::cout << "               #" << (k + 1) << ": C(" << nsym[k][1]
-                                  << ")   -- with " << nsym[k][4] << " unmoved atoms" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C(" << nsym[k][1]
+                                       << ")   -- with " << nsym[k][4] << " unmoved atoms" << "\n";
                     }
                 } else {
                     if (nsym[k][3] == 2) {
-                        std::cout << "               #" << (k + 1) << ": C'(" << nsym[k][1] << ")" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C'(" << nsym[k][1] << ")" << "\n";
                     } else if (nsym[k][3] == 3) {
-                        std::cout << "               #" << (k + 1) << ": C\"(" << nsym[k][1] << ")" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C\"(" << nsym[k][1] << ")" << "\n";
                     } else {
-                        std::cout << "               #" << (k + 1) << ": C(" << nsym[k][1] << ")" << "\n";
+                        util::report() << "               #" << (k + 1) << ": C(" << nsym[k][1] << ")" << "\n";
                     }
                 }
             }
@@ -2801,14 +2802,14 @@ void sym_elements(int natoms, const std::vector<int>& nat,
         // S(n^k)
         for (int k = nsg + ncr + 1; k < nsg + ncr + nsr + 1; ++k) {
             if (nsym[k][2] > 1) {
-                std::cout << "               #" << (k + 1) << ": S(" << nsym[k][1]
-                          << "^" << nsym[k][2] << ")" << "\n";
+                util::report() << "               #" << (k + 1) << ": S(" << nsym[k][1]
+                               << "^" << nsym[k][2] << ")" << "\n";
             } else {
                 if (nsym[k][4] > 0) {
-                    std::cout << "               #" << (k + 1) << ": S(" << nsym[k][1]
-                              << ")   -- with " << nsym[k][4] << " unmoved atoms" << "\n";
+                    util::report() << "               #" << (k + 1) << ": S(" << nsym[k][1]
+                                   << ")   -- with " << nsym[k][4] << " unmoved atoms" << "\n";
                 } else {
-                    std::cout << "               #" << (k + 1) << ": S(" << nsym[k][1] << ")" << "\n";
+                    util::report() << "               #" << (k + 1) << ": S(" << nsym[k][1] << ")" << "\n";
                 }
             }
         }
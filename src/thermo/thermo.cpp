@@ -16,12 +16,26 @@
 #include "thermo/atommass.h"
 #include "thermo/symmetry.h"
 #include "thermo/omp_config.h"
+#include "utilities/ndjson_writer.h"
+#include "utilities/parse_stats.h"
+#include "utilities/profiler.h"
+#include "utilities/trace_recorder.h"
+#include "job_management/work_queue.h"
+#include "extraction/qc_extractor.h"  // calculateSafeThreadCount; after chemsys.h because of R
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
 
 using namespace std;
 
@@ -36,172 +50,201 @@ namespace ThermoInterface
         return (last_dot != std::string::npos) ? filename.substr(0, last_dot) : filename;
     }
 
-    ThermoResult process_file(const ThermoSettings& settings, const CommandContext& context) 
+    // Helper: display name of a detected program
+    static std::string program_name(util::QuantumChemistryProgram prog)
     {
-        ThermoResult result;
-        
-        try {
-            // Initialize thermo module
-            initialize_thermo_module();
-            
-            // Determine input file
-            std::string input_file;
-            if (!settings.input_file.empty()) {
-                input_file = settings.input_file;
-            } else if (!context.files.empty()) {
-                input_file = context.files[0];
-            } else {
-                result.error_message = "No input file specified for thermo analysis";
-                return result;
+        switch(prog) {
+            case util::QuantumChemistryProgram::Gaussian: return "Gaussian";
+            case util::QuantumChemistryProgram::Orca: return "ORCA";
+            case util::QuantumChemistryProgram::Gamess: return "GAMESS-US";
+            case util::QuantumChemistryProgram::Nwchem: return "NWChem";
+            case util::QuantumChemistryProgram::Cp2k: return "CP2K";
+            case util::QuantumChemistryProgram::Vasp: return "VASP";
+            case util::QuantumChemistryProgram::Xtb: return "xTB";
+            case util::QuantumChemistryProgram::QChem: return "Q-Chem";
+            default: return "Unknown";
+        }
+    }
+
+    // Helper: the std::ctime() text of t, without its shared static buffer so that
+    // concurrent files can call it
+    static std::string clock_text(std::time_t t)
+    {
+        static const char* const days[]   = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+        static const char* const months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                             "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        std::tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &t);
+#else
+        localtime_r(&t, &local);
+#endif
+        char text[80];
+        std::snprintf(text, sizeof(text), "%.3s %.3s%3d %.2d:%.2d:%.2d %d\n", days[local.tm_wday],
+                      months[local.tm_mon], local.tm_mday, local.tm_hour, local.tm_min, local.tm_sec,
+                      1900 + local.tm_year);
+        return text;
+    }
+
+    // Helper: SystemData with the isotope masses, settings.ini, CLI arguments, Bav and the
+    // OpenMP budget applied; file_args is what the echoed command line shows as input
+    static std::unique_ptr<SystemData> configure_system(const ThermoSettings& settings, const CommandContext& context,
+                                                        const std::string& input_file, const std::string& file_args,
+                                                        std::string& thread_notification)
+    {
+        std::unique_ptr<SystemData> sys(static_cast<SystemData*>(create_system_data(settings, context, input_file)));
+
+        // Initialize isotope mass table
+        atommass::initmass(*sys);
+
+        // Load settings unless disabled
+        if (!settings.no_settings) {
+            util::loadsettings(*sys);
+        } else if (sys->prtlevel >= 1) {
+            util::report() << "\"-noset\" is set: Setting parameters from settings.ini are ignored\n";
+        }
+
+        // Process CLI arguments via util::loadarguments so settings.ini overrides work
+        // util::loadarguments expects argv[0] = program name, argv[1] = input file, argv[2...] = options
+        std::vector<std::string> args = {"cck thermo", file_args};
+        if (!settings.cli_args.empty()) {
+            args.insert(args.end(), settings.cli_args.begin(), settings.cli_args.end());
+        }
+        util::loadarguments(*sys, static_cast<int>(args.size()), args);
+
+        // --- Apply method-dependent Bav ---
+        if (sys->lowVibTreatment == LowVibTreatment::HeadGordon) {
+            if (!sys->bavUserOverride) {
+                // HeadGordon defaults to Q-Chem's Bav
+                sys->bavPreset = BavPreset::QChem;
+                sys->Bav       = bavPresetValue(BavPreset::QChem);
             }
-            
-            // Check if file exists
-            if (!std::filesystem::exists(input_file)) {
-                result.error_message = "Input file not found: " + input_file;
-                return result;
+        } else {
+            // Grimme/Minenkov/Truhlar/Harmonic: always use Grimme's Bav; warn if user tried to override
+            if (sys->bavUserOverride && sys->bavPreset != BavPreset::Grimme) {
+                std::cerr << "Warning: -bav option is only applicable to HeadGordon method. "
+                          << "Ignoring -bav " << bavPresetName(sys->bavPreset)
+                          << "; using grimme (1e-44 kg m^2).\n";
             }
-            
-            // Create SystemData from context
-            SystemData* sys = static_cast<SystemData*>(create_system_data(settings, context, input_file));
-            if (!sys) {
-                result.error_message = "Failed to create system data";
-                return result;
+            sys->bavPreset = BavPreset::Grimme;
+            sys->Bav       = bavPresetValue(BavPreset::Grimme);
+        }
+
+        // --- OpenMP thread detection and configuration ---
+        sys->exec.physical_cores_detected = detect_physical_cores();
+        sys->exec.scheduler_cpus_detected = detect_scheduler_cpus();
+        thread_notification = validate_thread_count(
+            sys->exec.omp_threads_requested,
+            sys->exec.physical_cores_detected,
+            sys->exec.scheduler_cpus_detected,
+            sys->exec.omp_threads_actual,
+            sys->exec.omp_user_override
+        );
+        configure_openmp(sys->exec.omp_threads_actual);
+
+        // If prtlevel=3, auto-enable per-mode vibration output unless user explicitly set prtvib
+        if (sys->prtlevel >= 3 && sys->prtvib == 0) {
+            sys->prtvib = 1;
+        }
+
+        return sys;
+    }
+
+    // Helper: print the thread notification and the summary of running parameters
+    static void print_parameters(const SystemData& sys, const std::string& thread_notification)
+    {
+        if (sys.prtlevel >= 1 && !thread_notification.empty()) {
+            util::report() << "\n" << thread_notification << "\n";
+        }
+
+        // Print running parameters
+        if (sys.prtlevel >= 1) {
+            util::report() << "\n                   --- Summary of Current Parameters ---\n\nRunning parameters:\n";
+            util::report() << " Print level: " << sys.prtlevel << " (0=minimal, 1=default, 2=verbose, 3=full)\n";
+            if (sys.prtvib == 1) {
+                util::report() << "Printing individual contribution of vibration modes: Yes\n";
+            } else if (sys.prtvib == -1) {
+                util::report() << "Printing individual contribution of vibration modes: Yes, to <basename>.vibcon file\n";
+            } else {
+                util::report() << "Printing individual contribution of vibration modes: No\n";
             }
-            
-            // Initialize isotope mass table
-            atommass::initmass(*sys);
-            
-            // Load settings unless disabled
-            if (!settings.no_settings) {
-                util::loadsettings(*sys);
-            } else if (sys->prtlevel >= 1) {
-                std::cout << "\"-noset\" is set: Setting parameters from settings.ini are ignored\n";
-            }
-
-            // Process CLI arguments via util::loadarguments so settings.ini overrides work
-            // util::loadarguments expects argv[0] = program name, argv[1] = input file, argv[2...] = options
-            std::vector<std::string> args = {"cck thermo"};
-            if (!input_file.empty()) {
-                args.push_back(input_file);
+            if (sys.Tstep == 0.0) {
+                util::report() << " Temperature:     " << std::fixed << std::setprecision(3) << std::setw(12) << sys.T << " K\n";
             } else {
-                args.push_back("");
+                util::report() << " Temperature scan, from " << std::fixed << std::setprecision(3) << std::setw(10) << sys.Tlow
+                               << " to " << std::setw(10) << sys.Thigh << ", step: " << std::setw(8) << sys.Tstep << " K\n";
+            }
+            if (sys.Pstep == 0.0) {
+                util::report() << " Pressure:      " << std::fixed << std::setprecision(3) << std::setw(12) << sys.P << " atm\n";
+            } else {
+                util::report() << " Pressure scan, from " << std::fixed << std::setprecision(3) << std::setw(10) << sys.Plow
+                               << " to " << std::setw(10) << sys.Phigh << ", step: " << std::setw(8) << sys.Pstep << " atm\n";
+            }
+            if (sys.concstr != "0") {
+                util::report() << " Concentration: " << std::fixed << std::setprecision(3) << std::setw(12)
+                               << std::stod(sys.concstr) << " mol/L\n";
             }
-            if (!settings.cli_args.empty()) {
-                args.insert(args.end(), settings.cli_args.begin(), settings.cli_args.end());
+            util::report() << " Scaling factor of vibrational frequencies for ZPE:       " << std::fixed << std::setprecision(4)
+                           << std::setw(8) << sys.sclZPE << "\n"
+                           << " Scaling factor of vibrational frequencies for U(T)-U(0): " << std::setw(8) << sys.sclheat << "\n"
+                           << " Scaling factor of vibrational frequencies for S(T):      " << std::setw(8) << sys.sclS << "\n"
+                           << " Scaling factor of vibrational frequencies for CV:        " << std::setw(8) << sys.sclCV << "\n";
+            if (sys.lowVibTreatment == LowVibTreatment::Harmonic) {
+                util::report() << "Low frequencies treatment: Harmonic approximation\n";
+            } else if (sys.lowVibTreatment == LowVibTreatment::Truhlar) {
+                util::report() << " Low frequencies treatment: Raising low frequencies (Truhlar's treatment)\n"
+                               << " Lower frequencies will be raised to " << std::fixed << std::setprecision(2) << sys.ravib
+                               << " cm^-1 during calculating S, U(T)-U(0), CV and q\n";
+            } else if (sys.lowVibTreatment == LowVibTreatment::Grimme) {
+                util::report() << " Low frequencies treatment: Grimme's interpolation for entropy\n";
+            } else if (sys.lowVibTreatment == LowVibTreatment::Minenkov) {
+                util::report() << " Low frequencies treatment: Minenkov's interpolation for entropy and internal energy\n";
+            } else if (sys.lowVibTreatment == LowVibTreatment::HeadGordon) {
+                util::report() << " Low frequencies treatment: Head-Gordon's interpolation for energy";
+                if (sys.hgEntropy)
+                    util::report() << " and entropy";
+                util::report() << "\n";
             }
-            util::loadarguments(*sys, static_cast<int>(args.size()), args);
+            if (sys.lowVibTreatment == LowVibTreatment::Grimme
+                || sys.lowVibTreatment == LowVibTreatment::Minenkov
+                || sys.lowVibTreatment == LowVibTreatment::HeadGordon) {
+                util::report() << " Vibrational frequency threshold used in the interpolation is " << std::fixed
+                               << std::setprecision(2) << sys.intpvib << " cm^-1\n";
+            }
+            if (sys.lowVibTreatment == LowVibTreatment::HeadGordon) {
+                util::report() << " Average moment of inertia (Bav): " << bavPresetName(sys.bavPreset)
+                               << " (" << std::scientific << std::setprecision(2) << sys.Bav << " kg m^2)\n"
+                               << std::fixed;
+            }
+            if (sys.imagreal != 0.0) {
+                util::report() << " Imaginary frequencies with norm < " << std::fixed << std::setprecision(2) << sys.imagreal
+                               << " cm^-1 will be treated as real frequencies\n";
+            }
+            util::report() << "                      -------- End of Summary --------\n\n";
+        } // end prtlevel >= 1 summary block
+    }
 
-            // --- Apply method-dependent Bav ---
-            if (sys->lowVibTreatment == LowVibTreatment::HeadGordon) {
-                if (!sys->bavUserOverride) {
-                    // HeadGordon defaults to Q-Chem's Bav
-                    sys->bavPreset = BavPreset::QChem;
-                    sys->Bav       = bavPresetValue(BavPreset::QChem);
-                }
-            } else {
-                // Grimme/Minenkov/Truhlar/Harmonic: always use Grimme's Bav; warn if user tried to override
-                if (sys->bavUserOverride && sys->bavPreset != BavPreset::Grimme) {
-                    std::cerr << "Warning: -bav option is only applicable to HeadGordon method. "
-                              << "Ignoring -bav " << bavPresetName(sys->bavPreset)
-                              << "; using grimme (1e-44 kg m^2).\n";
-                }
-                sys->bavPreset = BavPreset::Grimme;
-                sys->Bav       = bavPresetValue(BavPreset::Grimme);
-            }
-
-            // --- OpenMP thread detection and configuration ---
-            sys->exec.physical_cores_detected = detect_physical_cores();
-            sys->exec.scheduler_cpus_detected = detect_scheduler_cpus();
-            std::string thread_notification = validate_thread_count(
-                sys->exec.omp_threads_requested,
-                sys->exec.physical_cores_detected,
-                sys->exec.scheduler_cpus_detected,
-                sys->exec.omp_threads_actual,
-                sys->exec.omp_user_override
-            );
-            configure_openmp(sys->exec.omp_threads_actual);
-
-            if (sys->prtlevel >= 1 && !thread_notification.empty()) {
-                std::cout << "\n" << thread_notification << "\n";
-            }
-
-            // If prtlevel=3, auto-enable per-mode vibration output unless user explicitly set prtvib
-            if (sys->prtlevel >= 3 && sys->prtvib == 0) {
-                sys->prtvib = 1;
-            }
-
-            // Print running parameters
-            if (sys->prtlevel >= 1) {
-                std::cout << "\n                   --- Summary of Current Parameters ---\n\nRunning parameters:\n";
-                std::cout << " Print level: " << sys->prtlevel << " (0=minimal, 1=default, 2=verbose, 3=full)\n";
-                if (sys->prtvib == 1) {
-                    std::cout << "Printing individual contribution of vibration modes: Yes\n";
-                } else if (sys->prtvib == -1) {
-                    std::cout << "Printing individual contribution of vibration modes: Yes, to <basename>.vibcon file\n";
-                } else {
-                    std::cout << "Printing individual contribution of vibration modes: No\n";
-                }
-                if (sys->Tstep == 0.0) {
-                    std::cout << " Temperature:     " << std::fixed << std::setprecision(3) << std::setw(12) << sys->T << " K\n";
-                } else {
-                    std::cout << " Temperature scan, from " << std::fixed << std::setprecision(3) << std::setw(10) << sys->Tlow
-                              << " to " << std::setw(10) << sys->Thigh << ", step: " << std::setw(8) << sys->Tstep << " K\n";
-                }
-                if (sys->Pstep == 0.0) {
-                    std::cout << " Pressure:      " << std::fixed << std::setprecision(3) << std::setw(12) << sys->P << " atm\n";
-                } else {
-                    std::cout << " Pressure scan, from " << std::fixed << std::setprecision(3) << std::setw(10) << sys->Plow
-                              << " to " << std::setw(10) << sys->Phigh << ", step: " << std::setw(8) << sys->Pstep << " atm\n";
-                }
-                if (sys->concstr != "0") {
-                    std::cout << " Concentration: " << std::fixed << std::setprecision(3) << std::setw(12)
-                              << std::stod(sys->concstr) << " mol/L\n";
-                }
-                std::cout << " Scaling factor of vibrational frequencies for ZPE:       " << std::fixed << std::setprecision(4)
-                          << std::setw(8) << sys->sclZPE << "\n"
-                          << " Scaling factor of vibrational frequencies for U(T)-U(0): " << std::setw(8) << sys->sclheat << "\n"
-                          << " Scaling factor of vibrational frequencies for S(T):      " << std::setw(8) << sys->sclS << "\n"
-                          << " Scaling factor of vibrational frequencies for CV:        " << std::setw(8) << sys->sclCV << "\n";
-                if (sys->lowVibTreatment == LowVibTreatment::Harmonic) {
-                    std::cout << "Low frequencies treatment: Harmonic approximation\n";
-                } else if (sys->lowVibTreatment == LowVibTreatment::Truhlar) {
-                    std::cout << " Low frequencies treatment: Raising low frequencies (Truhlar's treatment)\n"
-                              << " Lower frequencies will be raised to " << std::fixed << std::setprecision(2) << sys->ravib
-                              << " cm^-1 during calculating S, U(T)-U(0), CV and q\n";
-                } else if (sys->lowVibTreatment == LowVibTreatment::Grimme) {
-                    std::cout << " Low frequencies treatment: Grimme's interpolation for entropy\n";
-                } else if (sys->lowVibTreatment == LowVibTreatment::Minenkov) {
-                    std::cout << " Low frequencies treatment: Minenkov's interpolation for entropy and internal energy\n";
-                } else if (sys->lowVibTreatment == LowVibTreatment::HeadGordon) {
-                    std::cout << " Low frequencies treatment: Head-Gordon's interpolation for energy";
-                    if (sys->hgEntropy)
-                        std::cout << " and entropy";
-                    std::cout << "\n";
-                }
-                if (sys->lowVibTreatment == LowVibTreatment::Grimme
-                    || sys->lowVibTreatment == LowVibTreatment::Minenkov
-                    || sys->lowVibTreatment == LowVibTreatment::HeadGordon) {
-                    std::cout << " Vibrational frequency threshold used in the interpolation is " << std::fixed
-                              << std::setprecision(2) << sys->intpvib << " cm^-1\n";
-                }
-                if (sys->lowVibTreatment == LowVibTreatment::HeadGordon) {
-                    std::cout << " Average moment of inertia (Bav): " << bavPresetName(sys->bavPreset)
-                              << " (" << std::scientific << std::setprecision(2) << sys->Bav << " kg m^2)\n"
-                              << std::fixed;
-                }
-                if (sys->imagreal != 0.0) {
-                    std::cout << " Imaginary frequencies with norm < " << std::fixed << std::setprecision(2) << sys->imagreal
-                              << " cm^-1 will be treated as real frequencies\n";
-                }
-            } // end prtlevel >= 1 summary block
+    // Helper: load, analyse and report one input file with an already configured SystemData
+    static ThermoResult analyse_file(SystemData& sys, const ThermoSettings& settings, const std::string& input_file)
+    {
+        ThermoResult result;
+
+        try {
+            ProfileScope                file_profile(ProfileStage::FILE);
+            TraceSpan                   file_span("file", "file", input_file);
+            CCK_STAT_FILE(input_file);
+            std::optional<ProfileScope> stage(std::in_place, ProfileStage::PARSE);
+
+            std::error_code size_error;
+            std::uintmax_t  file_size = std::filesystem::file_size(input_file, size_error);
+            file_profile.add_bytes(size_error ? 0 : static_cast<std::uint64_t>(file_size));
+            file_span.add_bytes(size_error ? 0 : static_cast<std::uint64_t>(file_size));
 
             // Print start processing message
-            if (sys->prtlevel >= 1) {
+            if (sys.prtlevel >= 1) {
                 auto start_now = std::chrono::system_clock::now();
-                std::time_t start_now_time = std::chrono::system_clock::to_time_t(start_now);
-                std::cout << "                      -------- End of Summary --------\n\n";
-                std::cout << "OpenThermo started to process " << input_file << " at "
-                          << std::ctime(&start_now_time);
+                util::report() << "OpenThermo started to process " << input_file << " at "
+                               << clock_text(std::chrono::system_clock::to_time_t(start_now));
             }
             
             // Check if input file is a list file (.list or .txt)
@@ -209,12 +252,11 @@ namespace ThermoInterface
                                (input_file.find(".txt") != std::string::npos);
             
             if (is_list_file) {
-                std::cout << "Processing list file...\n";
+                util::report() << "Processing list file...\n";
                 std::vector<std::string> filelist;
                 std::ifstream listfile(input_file);
                 if (!listfile.is_open()) {
                     result.error_message = "Unable to open list file: " + input_file;
-                    delete sys;
                     return result;
                 }
                 std::string line;
@@ -232,93 +274,91 @@ namespace ThermoInterface
                 listfile.close();
                 if (filelist.empty()) {
                     result.error_message = "List file is empty or contains no valid file paths";
-                    delete sys;
                     return result;
                 }
-                size_t nfile = filelist.size();
-                std::vector<double> Elist(nfile), Ulist(nfile), Hlist(nfile), Glist(nfile), 
-                                   Slist(nfile), CVlist(nfile), CPlist(nfile), QVlist(nfile), Qbotlist(nfile);
-                calc::ensemble(*sys, filelist, Elist, Ulist, Hlist, Glist, Slist, CVlist, CPlist, QVlist, Qbotlist);
+                calc::ensemble(sys, filelist, settings.ensemble_file);
+                if (!settings.ensemble_file.empty()) {
+                    result.output_files.push_back(settings.ensemble_file);
+                }
                 result.success = true;
-                delete sys;
-                cleanup_thermo_module();
                 return result;
             }
             
             // Process input file: OTM or quantum chemistry output
+            std::string program = "OTM";
             if (input_file.find(".otm") != std::string::npos) {
-                if (sys->prtlevel >= 2) {
-                    std::cout << "\n Processing data from " << input_file << "\n";
-                    std::cout << " Atomic masses used: Read from OTM file\n";
+                if (sys.prtlevel >= 2) {
+                    util::report() << "\n Processing data from " << input_file << "\n";
+                    util::report() << " Atomic masses used: Read from OTM file\n";
                 }
-                LoadFile::loadotm(*sys);
+                LoadFile::loadotm(sys);
             } else {
-                util::QuantumChemistryProgram prog = util::deterprog(*sys);
-                sys->isys = static_cast<int>(prog);
+                util::QuantumChemistryProgram prog = util::deterprog(sys);
+                sys.isys = static_cast<int>(prog);
+                program   = program_name(prog);
+                file_span.set_program(program);
 
                 if (prog != util::QuantumChemistryProgram::Unknown) {
-                    if (sys->prtlevel >= 2) {
-                        std::cout << "\n";
-                        if (sys->massmod == 1)
-                            std::cout << " Atomic masses used: Element\n";
-                        if (sys->massmod == 2)
-                            std::cout << " Atomic masses used: Most abundant isotope\n";
-                        if (sys->massmod == 3)
-                            std::cout << " Atomic masses used: Read from quantum chemical output\n";
+                    if (sys.prtlevel >= 2) {
+                        util::report() << "\n";
+                        if (sys.massmod == 1)
+                            util::report() << " Atomic masses used: Element\n";
+                        if (sys.massmod == 2)
+                            util::report() << " Atomic masses used: Most abundant isotope\n";
+                        if (sys.massmod == 3)
+                            util::report() << " Atomic masses used: Read from quantum chemical output\n";
                     }
 
                     try {
                         if (prog == util::QuantumChemistryProgram::Gaussian) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing Gaussian output file...\n";
-                            LoadFile::loadgau(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing Gaussian output file...\n";
+                            LoadFile::loadgau(sys);
                         } else if (prog == util::QuantumChemistryProgram::Orca) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing ORCA output file...\n";
-                            LoadFile::loadorca(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing ORCA output file...\n";
+                            LoadFile::loadorca(sys);
                         } else if (prog == util::QuantumChemistryProgram::Gamess) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing GAMESS-US output file...\n";
-                            LoadFile::loadgms(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing GAMESS-US output file...\n";
+                            LoadFile::loadgms(sys);
                         } else if (prog == util::QuantumChemistryProgram::Nwchem) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing NWChem output file...\n";
-                            LoadFile::loadnw(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing NWChem output file...\n";
+                            LoadFile::loadnw(sys);
                         } else if (prog == util::QuantumChemistryProgram::Cp2k) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing CP2K output file...\n";
-                            LoadFile::loadCP2K(*sys);
-                            if (sys->ipmode == 0) {
-                                std::cout << " Note: If your system is not isolated (periodic crystals, slabs or adsorbate on "
-                                             "surface), \nyou may want to set"
-                                             "\"ipmode\" = 1 settings.ini in order to ignore translation and rotation "
-                                             "contributions. \n"
-                                          << "This is typical for condensed materials calculations with CP2K and VASP \n\n";
+                            if (sys.prtlevel >= 2) util::report() << "Processing CP2K output file...\n";
+                            LoadFile::loadCP2K(sys);
+                            if (sys.ipmode == 0) {
+                                util::report() << " Note: If your system is not isolated (periodic crystals, slabs or adsorbate on "
+                                                  "surface), \nyou may want to set"
+                                                  "\"ipmode\" = 1 settings.ini in order to ignore translation and rotation "
+                                                  "contributions. \n"
+                                               << "This is typical for condensed materials calculations with CP2K and VASP \n\n";
                             }
                         } else if (prog == util::QuantumChemistryProgram::Vasp) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing VASP output file...\n";
-                            LoadFile::loadvasp(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing VASP output file...\n";
+                            LoadFile::loadvasp(sys);
                         } else if (prog == util::QuantumChemistryProgram::Xtb) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing xtb g98.out file...\n";
-                            LoadFile::loadxtb(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing xtb g98.out file...\n";
+                            LoadFile::loadxtb(sys);
                         } else if (prog == util::QuantumChemistryProgram::QChem) {
-                            if (sys->prtlevel >= 2) std::cout << "Processing Q-Chem output file...\n";
-                            LoadFile::loadqchem(*sys);
+                            if (sys.prtlevel >= 2) util::report() << "Processing Q-Chem output file...\n";
+                            LoadFile::loadqchem(sys);
                         } else {
                             result.error_message = "Unknown program type";
-                            delete sys;
                             return result;
                         }
                     } catch (const std::exception& e) {
                         result.error_message = "Failed to load data from input file: " + std::string(e.what());
-                        delete sys;
                         return result;
                     }
 
-                    util::modmass(*sys);
-                    sys->nelevel = 1;
-                    sys->elevel  = {0.0};
-                    sys->edegen  = {sys->spinmult};
-                    if (!sys->edegen.empty() && sys->edegen[0] <= 0) {
-                        sys->edegen[0] = 1;
+                    util::modmass(sys);
+                    sys.nelevel = 1;
+                    sys.elevel  = {0.0};
+                    sys.edegen  = {sys.spinmult};
+                    if (!sys.edegen.empty() && sys.edegen[0] <= 0) {
+                        sys.edegen[0] = 1;
                     }
-                    if (sys->outotm == 1) {
-                        util::outotmfile(*sys);
+                    if (sys.outotm == 1) {
+                        util::outotmfile(sys);
                     }
                 } else {
                     // Unknown program — not a batch file either
@@ -327,224 +367,254 @@ namespace ThermoInterface
                                  "OpenThermo (.otm)\n";
                     std::cerr << "For batch processing, use a list file with .list or .txt extension containing file paths.\n";
                     result.error_message = "Unknown file format";
-                    delete sys;
                     return result;
                 }
             }
 
             // Handle external energy override
-            if (sys->Eexter != 0.0) {
-                sys->E = sys->Eexter;
-                if (sys->prtlevel >= 1)
-                    std::cout << "Note: The electronic energy specified by \"E\" parameter will be used\n";
-            } else if (sys->E != 0.0) {
-                if (sys->prtlevel >= 2)
-                    std::cout << "Note: The electronic energy extracted from input file will be used\n";
+            if (sys.Eexter != 0.0) {
+                sys.E = sys.Eexter;
+                if (sys.prtlevel >= 1)
+                    util::report() << "Note: The electronic energy specified by \"E\" parameter will be used\n";
+            } else if (sys.E != 0.0) {
+                if (sys.prtlevel >= 2)
+                    util::report() << "Note: The electronic energy extracted from input file will be used\n";
             }
 
             // Handle imaginary frequency treatment
-            if (sys->imagreal != 0.0) {
-                for (int ifreq = 0; ifreq < sys->nfreq; ++ifreq) {
-                    if (sys->wavenum[ifreq] < 0 && std::abs(sys->wavenum[ifreq]) < sys->imagreal) {
-                        sys->wavenum[ifreq] = std::abs(sys->wavenum[ifreq]);
-                        std::cout << " Note: Imaginary frequency " << std::fixed << std::setprecision(2)
-                                  << sys->wavenum[ifreq] << " cm^-1 has been set to real frequency!\n";
+            if (sys.imagreal != 0.0) {
+                for (int ifreq = 0; ifreq < sys.nfreq; ++ifreq) {
+                    if (sys.wavenum[ifreq] < 0 && std::abs(sys.wavenum[ifreq]) < sys.imagreal) {
+                        sys.wavenum[ifreq] = std::abs(sys.wavenum[ifreq]);
+                        util::report() << " Note: Imaginary frequency " << std::fixed << std::setprecision(2)
+                                       << sys.wavenum[ifreq] << " cm^-1 has been set to real frequency!\n";
                     }
                 }
             }
 
+            stage.reset();
+            stage.emplace(ProfileStage::THERMO);
+
             // Calculate total mass
-            sys->totmass = 0.0;
-            for (const auto& atom : sys->a) {
-                sys->totmass += atom.mass;
+            sys.totmass = 0.0;
+            for (const auto& atom : sys.a) {
+                sys.totmass += atom.mass;
             }
 
             // Calculate inertia and detect linearity
-            calc::calcinertia(*sys);
-            sys->ilinear = 0;
-            for (double in : sys->inert) {
+            calc::calcinertia(sys);
+            sys.ilinear = 0;
+            for (double in : sys.inert) {
                 if (in < 0.001) {
-                    sys->ilinear = 1;
+                    sys.ilinear = 1;
                     break;
                 }
             }
 
             // Update atom count
-            sys->ncenter = static_cast<int>(sys->a.size());
+            sys.ncenter = static_cast<int>(sys.a.size());
 
             // Symmetry detection
-            if (sys->prtlevel >= 2)
-                std::cout << "Number of atoms loaded: " << sys->a.size() << "\n";
-            if (sys->a.empty()) {
+            if (sys.prtlevel >= 2)
+                util::report() << "Number of atoms loaded: " << sys.a.size() << "\n";
+            if (sys.a.empty()) {
                 std::cerr << "Error: No atoms loaded from input file!\n";
                 result.error_message = "No atoms loaded from input file!";
-                delete sys;
                 return result;
             }
 
             symmetry::SymmetryDetector symDetector;
-            symDetector.PGnameinit = sys->PGnameinit;  // Use PGnameinit for detection
-            symDetector.ncenter    = sys->a.size();
-            symDetector.a          = sys->a;
-            symDetector.a_index.resize(sys->a.size());
-            for (size_t i = 0; i < sys->a.size(); ++i) {
+            symDetector.PGnameinit = sys.PGnameinit;  // Use PGnameinit for detection
+            symDetector.ncenter    = sys.a.size();
+            symDetector.a          = sys.a;
+            symDetector.a_index.resize(sys.a.size());
+            for (size_t i = 0; i < sys.a.size(); ++i) {
                 symDetector.a_index[i] = i;
             }
-            symDetector.detectPG((sys->prtlevel >= 2) ? 1 : 0);
-            sys->rotsym = symDetector.rotsym;
-            sys->PGname = symDetector.PGname;
+            symDetector.detectPG((sys.prtlevel >= 2) ? 1 : 0);
+            sys.rotsym = symDetector.rotsym;
+            sys.PGname = symDetector.PGname;
 
             // Convert wavenumbers to frequencies
-            sys->freq.resize(sys->nfreq);
-            for (int i = 0; i < sys->nfreq; ++i) {
-                sys->freq[i] = sys->wavenum[i] * wave2freq;
+            sys.freq.resize(sys.nfreq);
+            for (int i = 0; i < sys.nfreq; ++i) {
+                sys.freq[i] = sys.wavenum[i] * wave2freq;
             }
 
             // Count imaginary frequencies
             int nimag = 0;
-            for (double f : sys->freq) {
+            for (double f : sys.freq) {
                 if (f < 0) ++nimag;
             }
             if (nimag > 0) {
-                std::cout << " Note: There are " << nimag
-                          << " imaginary frequencies, they will be ignored in the calculation\n";
+                util::report() << " Note: There are " << nimag
+                               << " imaginary frequencies, they will be ignored in the calculation\n";
             }
 
             // Print molecular information (tiered by prtlevel)
-            if (sys->prtlevel >= 1) {
-                std::cout << "\n"
-                          << "                      -------- Chemical System Data -------\n"
-                          << "                      -------------------------------------\n"
-                          << " Electronic energy: " << std::fixed << std::setprecision(8) << std::setw(18) << sys->E
-                          << " a.u.\n";
-                if (sys->spinmult != 0) {
-                    std::cout << " Spin multiplicity: " << std::setw(3) << sys->spinmult << "\n";
+            if (sys.prtlevel >= 1) {
+                util::report() << "\n"
+                               << "                      -------- Chemical System Data -------\n"
+                               << "                      -------------------------------------\n"
+                               << " Electronic energy: " << std::fixed << std::setprecision(8) << std::setw(18) << sys.E
+                               << " a.u.\n";
+                if (sys.spinmult != 0) {
+                    util::report() << " Spin multiplicity: " << std::setw(3) << sys.spinmult << "\n";
                 } else {
-                    for (int ie = 0; ie < sys->nelevel; ++ie) {
-                        std::cout << " Electronic energy level " << ie + 1 << "     E = " << std::fixed
-                                  << std::setprecision(6) << std::setw(12) << sys->elevel[ie]
-                                  << " eV     Degeneracy = " << std::setw(3) << sys->edegen[ie] << "\n";
+                    for (int ie = 0; ie < sys.nelevel; ++ie) {
+                        util::report() << " Electronic energy level " << ie + 1 << "     E = " << std::fixed
+                                       << std::setprecision(6) << std::setw(12) << sys.elevel[ie]
+                                       << " eV     Degeneracy = " << std::setw(3) << sys.edegen[ie] << "\n";
                     }
                 }
             }
 
-            if (sys->prtlevel >= 2) {
+            if (sys.prtlevel >= 2) {
                 // Level 2+: full per-atom listing
-                for (int iatm = 0; iatm < sys->ncenter; ++iatm) {
-                    std::cout << " Atom " << std::setw(5) << iatm + 1 << " (" << ind2name[sys->a[iatm].index]
-                              << ")   Mass: " << std::fixed << std::setprecision(6) << std::setw(12) << sys->a[iatm].mass
-                              << " amu\n";
+                for (int iatm = 0; iatm < sys.ncenter; ++iatm) {
+                    util::report() << " Atom " << std::setw(5) << iatm + 1 << " (" << ind2name[sys.a[iatm].index]
+                                   << ")   Mass: " << std::fixed << std::setprecision(6) << std::setw(12) << sys.a[iatm].mass
+                                   << " amu\n";
                 }
-                std::cout << " Total mass: " << std::fixed << std::setprecision(6) << std::setw(16) << sys->totmass
-                          << " amu\n\n";
-            } else if (sys->prtlevel == 1) {
+                util::report() << " Total mass: " << std::fixed << std::setprecision(6) << std::setw(16) << sys.totmass
+                               << " amu\n\n";
+            } else if (sys.prtlevel == 1) {
                 // Level 1: compact element-count summary
                 std::map<int, int> elem_count;
-                for (int iatm = 0; iatm < sys->ncenter; ++iatm) {
-                    elem_count[sys->a[iatm].index]++;
+                for (int iatm = 0; iatm < sys.ncenter; ++iatm) {
+                    elem_count[sys.a[iatm].index]++;
                 }
-                std::cout << " Atoms: " << sys->ncenter << " (";
+                util::report() << " Atoms: " << sys.ncenter << " (";
                 bool first = true;
                 for (const auto& [idx, count] : elem_count) {
-                    if (!first) std::cout << ", ";
-                    std::cout << count << " " << ind2name[idx];
+                    if (!first) util::report() << ", ";
+                    util::report() << count << " " << ind2name[idx];
                     first = false;
                 }
-                std::cout << ")  Total mass: " << std::fixed << std::setprecision(6) << sys->totmass << " amu\n";
+                util::report() << ")  Total mass: " << std::fixed << std::setprecision(6) << sys.totmass << " amu\n";
             }
 
-            if (sys->prtlevel >= 1) {
-                std::cout << " Point group: " << sys->PGname;
-                if (sys->ipmode == 0)
-                    std::cout << "   Rotational symmetry number: " << std::setw(3) << sys->rotsym;
-                std::cout << "\n";
+            if (sys.prtlevel >= 1) {
+                util::report() << " Point group: " << sys.PGname;
+                if (sys.ipmode == 0)
+                    util::report() << "   Rotational symmetry number: " << std::setw(3) << sys.rotsym;
+                util::report() << "\n";
             }
 
-            if (sys->prtlevel >= 2 && sys->ipmode == 0) {
-                std::array<double, 3> sorted_inert = sys->inert;
+            if (sys.prtlevel >= 2 && sys.ipmode == 0) {
+                std::array<double, 3> sorted_inert = sys.inert;
                 std::sort(sorted_inert.begin(), sorted_inert.end());
 
-                std::cout << " Principal moments of inertia (amu*Bohr^2):\n";
+                util::report() << " Principal moments of inertia (amu*Bohr^2):\n";
                 for (double inval : sorted_inert) {
-                    std::cout << std::fixed << std::setprecision(6) << std::setw(16) << inval << "\n";
+                    util::report() << std::fixed << std::setprecision(6) << std::setw(16) << inval << "\n";
                 }
 
                 double inert_sum = sorted_inert[0] + sorted_inert[1] + sorted_inert[2];
                 if (inert_sum < 1e-10) {
-                    std::cout << "This is a single atom system, rotational constant is zero\n";
-                } else if (sys->ilinear == 1) {
+                    util::report() << "This is a single atom system, rotational constant is zero\n";
+                } else if (sys.ilinear == 1) {
                     double largest_inert = sorted_inert[2];
                     double rotcst1 = h / (8.0 * pi * pi * largest_inert * amu2kg * (b2a * 1e-10) * (b2a * 1e-10));
-                    std::cout << " Rotational constant (GHz): " << std::fixed << std::setprecision(6) << std::setw(14)
-                              << rotcst1 / 1e9 << "\n"
-                              << " Rotational temperature (K): " << std::fixed << std::setprecision(6) << std::setw(12)
-                              << rotcst1 * h / kb << "\n"
-                              << "This is a linear molecule\n";
+                    util::report() << " Rotational constant (GHz): " << std::fixed << std::setprecision(6) << std::setw(14)
+                                   << rotcst1 / 1e9 << "\n"
+                                   << " Rotational temperature (K): " << std::fixed << std::setprecision(6) << std::setw(12)
+                                   << rotcst1 * h / kb << "\n"
+                                   << "This is a linear molecule\n";
                 } else {
                     std::array<double, 3> rotcst;
                     for (int i = 0; i < 3; ++i) {
-                        rotcst[i] = h / (8.0 * pi * pi * sys->inert[i] * amu2kg * (b2a * 1e-10) * (b2a * 1e-10));
+                        rotcst[i] = h / (8.0 * pi * pi * sys.inert[i] * amu2kg * (b2a * 1e-10) * (b2a * 1e-10));
                     }
-                    std::cout << " Rotational constants relative to principal axes (GHz):\n";
+                    util::report() << " Rotational constants relative to principal axes (GHz):\n";
                     for (double r : rotcst) {
-                        std::cout << std::fixed << std::setprecision(6) << std::setw(14) << r / 1e9 << "\n";
+                        util::report() << std::fixed << std::setprecision(6) << std::setw(14) << r / 1e9 << "\n";
                     }
-                    std::cout << " Rotational temperatures (K):";
+                    util::report() << " Rotational temperatures (K):";
                     for (double r : rotcst) {
-                        std::cout << std::fixed << std::setprecision(6) << std::setw(12) << r * h / kb;
+                        util::report() << std::fixed << std::setprecision(6) << std::setw(12) << r * h / kb;
                     }
-                    std::cout << "\nThis is not a linear molecule\n";
+                    util::report() << "\nThis is not a linear molecule\n";
                 }
-            } else if (sys->prtlevel >= 2 && sys->ipmode == 1) {
-                std::cout << "Rotation information is not shown here since ipmode=1\n";
+            } else if (sys.prtlevel >= 2 && sys.ipmode == 1) {
+                util::report() << "Rotation information is not shown here since ipmode=1\n";
             }
 
-            if (sys->nfreq > 0) {
-                if (sys->prtlevel >= 2) {
-                    std::cout << "\n There are " << sys->nfreq << " frequencies (cm^-1):\n";
-                    for (int ifreq = 0; ifreq < sys->nfreq; ++ifreq) {
-                        std::cout << std::fixed << std::setprecision(1) << std::setw(8) << sys->wavenum[ifreq];
-                        if ((ifreq + 1) % 9 == 0 || ifreq == sys->nfreq - 1)
-                            std::cout << "\n";
+            if (sys.nfreq > 0) {
+                if (sys.prtlevel >= 2) {
+                    util::report() << "\n There are " << sys.nfreq << " frequencies (cm^-1):\n";
+                    for (int ifreq = 0; ifreq < sys.nfreq; ++ifreq) {
+                        util::report() << std::fixed << std::setprecision(1) << std::setw(8) << sys.wavenum[ifreq];
+                        if ((ifreq + 1) % 9 == 0 || ifreq == sys.nfreq - 1)
+                            util::report() << "\n";
                     }
-                } else if (sys->prtlevel == 1) {
-                    double wmin = sys->wavenum[0], wmax = sys->wavenum[0];
-                    for (int ifreq = 1; ifreq < sys->nfreq; ++ifreq) {
-                        if (sys->wavenum[ifreq] < wmin) wmin = sys->wavenum[ifreq];
-                        if (sys->wavenum[ifreq] > wmax) wmax = sys->wavenum[ifreq];
+                } else if (sys.prtlevel == 1) {
+                    double wmin = sys.wavenum[0], wmax = sys.wavenum[0];
+                    for (int ifreq = 1; ifreq < sys.nfreq; ++ifreq) {
+                        if (sys.wavenum[ifreq] < wmin) wmin = sys.wavenum[ifreq];
+                        if (sys.wavenum[ifreq] > wmax) wmax = sys.wavenum[ifreq];
                     }
-                    std::cout << " Frequencies: " << sys->nfreq << " (range: " << std::fixed << std::setprecision(1)
-                              << wmin << " -- " << wmax << " cm^-1)\n";
+                    util::report() << " Frequencies: " << sys.nfreq << " (range: " << std::fixed << std::setprecision(1)
+                                   << wmin << " -- " << wmax << " cm^-1)\n";
                 }
             }
 
             if (nimag > 0) {
-                std::cout << " Note: There are " << nimag
-                          << " imaginary frequencies, they will be ignored in the calculation\n";
+                util::report() << " Note: There are " << nimag
+                               << " imaginary frequencies, they will be ignored in the calculation\n";
             }
 
             // Check for scanning mode
-            bool is_scanning = (sys->Tstep != 0.0) || (sys->Pstep != 0.0);
+            bool is_scanning = (sys.Tstep != 0.0) || (sys.Pstep != 0.0);
+            bool ndjson      = (settings.output_format == "ndjson");
+            if (ndjson && is_scanning) {
+                std::cerr << "Warning: T/P scans are not written as NDJSON; using T = " << sys.T
+                          << " K, P = " << sys.P << " atm for " << input_file << "\n";
+                is_scanning = false;
+            }
 
-            if (!is_scanning) {
+            if (ndjson || !settings.summary_file.empty()) {
+                // Totals of the single T/P point for the NDJSON line or the summary table
+                calc::MoleculeBatch batch;
+                batch.add(sys);
+                const calc::BatchThermo tr = calc::calcthermo_batch(batch, sys, {sys.T}, sys.P);
+                result.has_totals  = true;
+                result.program     = program;
+                result.point_group = sys.PGname.substr(0, sys.PGname.find_last_not_of(' ') + 1);
+                result.nfreq       = sys.nfreq;
+                result.T           = sys.T;
+                result.P           = sys.P;
+                result.E           = sys.E;
+                result.ZPE         = tr.ZPE[0];
+                result.corrU       = tr.corrU[0];
+                result.corrH       = tr.corrH[0];
+                result.corrG       = tr.corrG[0];
+                result.S           = tr.S[0];
+                result.CV          = tr.CV[0];
+                result.CP          = tr.CP[0];
+            }
+
+            if (ndjson) {
+                // Totals only, the report is not printed
+            } else if (!is_scanning) {
                 // Single T/P point
-                sys->exec.omp_strategy = static_cast<int>(
-                    select_strategy(1, sys->nfreq, sys->exec.omp_threads_actual));
-                if (sys->prtlevel >= 2) {
-                    std::cout << strategy_description(
-                        static_cast<OMPStrategy>(sys->exec.omp_strategy), 1, sys->nfreq) << "\n";
+                sys.exec.omp_strategy = static_cast<int>(
+                    select_strategy(1, sys.nfreq, sys.exec.omp_threads_actual));
+                if (sys.prtlevel >= 2) {
+                    util::report() << strategy_description(
+                        static_cast<OMPStrategy>(sys.exec.omp_strategy), 1, sys.nfreq) << "\n";
                 }
-                calc::showthermo(*sys);
+                calc::showthermo(sys);
             } else {
                 // Temperature / pressure scanning
-                std::cout << "\nPerforming scan of temperature/pressure...\n";
-                double P1 = sys->P, P2 = sys->P, Ps = 1.0;
-                double T1 = sys->T, T2 = sys->T, Ts = 1.0;
-                if (sys->Tstep != 0.0) {
-                    T1 = sys->Tlow;  T2 = sys->Thigh;  Ts = sys->Tstep;
+                util::report() << "\nPerforming scan of temperature/pressure...\n";
+                double P1 = sys.P, P2 = sys.P, Ps = 1.0;
+                double T1 = sys.T, T2 = sys.T, Ts = 1.0;
+                if (sys.Tstep != 0.0) {
+                    T1 = sys.Tlow;  T2 = sys.Thigh;  Ts = sys.Tstep;
                 }
-                if (sys->Pstep != 0.0) {
-                    P1 = sys->Plow;  P2 = sys->Phigh;  Ps = sys->Pstep;
+                if (sys.Pstep != 0.0) {
+                    P1 = sys.Plow;  P2 = sys.Phigh;  Ps = sys.Pstep;
                 }
 
                 std::string basename     = get_basename_without_extension(input_file);
@@ -554,7 +624,6 @@ namespace ThermoInterface
                 std::ofstream file_UHG(uhg_filename, std::ios::out);
                 if (!file_UHG.is_open()) {
                     result.error_message = "Failed to create output file: " + uhg_filename;
-                    delete sys;
                     return result;
                 }
                 file_UHG << "Ucorr, Hcorr and Gcorr are in kcal/mol; U, H and G are in a.u.\n\n"
@@ -564,7 +633,6 @@ namespace ThermoInterface
                 if (!file_SCq.is_open()) {
                     file_UHG.close();
                     result.error_message = "Failed to create output file: " + scq_filename;
-                    delete sys;
                     return result;
                 }
                 file_SCq << "S, CV and CP are in cal/mol/K; q(V=0)/NA and q(bot)/NA are unitless\n\n"
@@ -576,56 +644,31 @@ namespace ThermoInterface
                     const int total_points = num_step_T * num_step_P;
 
                     // Auto-select parallelization strategy
-                    OMPStrategy strategy = select_strategy(total_points, sys->nfreq, sys->exec.omp_threads_actual);
-                    sys->exec.omp_strategy = static_cast<int>(strategy);
-                    if (sys->prtlevel >= 2) {
-                        std::cout << strategy_description(strategy, total_points, sys->nfreq) << "\n";
+                    OMPStrategy strategy = select_strategy(total_points, sys.nfreq, sys.exec.omp_threads_actual);
+                    sys.exec.omp_strategy = static_cast<int>(strategy);
+                    if (sys.prtlevel >= 2) {
+                        util::report() << strategy_description(strategy, total_points, sys.nfreq) << "\n";
                     }
 
-                    struct ScanResult {
-                        double T, P;
-                        double corrU, corrH, corrG, S, CV, CP, QV, Qbot;
-                    };
-                    std::vector<ScanResult> scan_results(total_points);
-
-                    if (strategy == OMPStrategy::Outer) {
-                        // Outer: parallelize T/P scan
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-                        for (int idx = 0; idx < total_points; ++idx) {
-                            int i = idx / num_step_P;
-                            int j = idx % num_step_P;
-                            auto& r = scan_results[idx];
-                            r.T = T1 + i * Ts;
-                            r.P = P1 + j * Ps;
-                            calc::calcthermo(*sys, r.T, r.P, r.corrU, r.corrH, r.corrG,
-                                             r.S, r.CV, r.CP, r.QV, r.Qbot);
-                        }
-                    } else {
-                        // Inner: serial T/P, vibrational loop parallelized in calc.cpp
-                        for (int idx = 0; idx < total_points; ++idx) {
-                            int i = idx / num_step_P;
-                            int j = idx % num_step_P;
-                            auto& r = scan_results[idx];
-                            r.T = T1 + i * Ts;
-                            r.P = P1 + j * Ps;
-                            calc::calcthermo(*sys, r.T, r.P, r.corrU, r.corrH, r.corrG,
-                                             r.S, r.CV, r.CP, r.QV, r.Qbot);
-                        }
-                    }
+                    // Rotation, vibration and electronic terms once per T; only translation per P
+                    std::vector<double> temps(num_step_T), pressures(num_step_P);
+                    for (int i = 0; i < num_step_T; ++i) temps[i] = T1 + i * Ts;
+                    for (int j = 0; j < num_step_P; ++j) pressures[j] = P1 + j * Ps;
+                    const std::vector<calc::ThermoResult> scan_results = calc::calcthermo_grid(sys, temps, pressures);
 
                     // Write results sequentially
                     for (int idx = 0; idx < total_points; ++idx) {
-                        const auto& r = scan_results[idx];
-                        file_UHG << std::fixed << std::setprecision(3) << std::setw(10) << r.T << std::setw(10) << r.P
+                        const auto&  r = scan_results[idx];
+                        const double T = temps[idx / num_step_P];
+                        const double P = pressures[idx % num_step_P];
+                        file_UHG << std::fixed << std::setprecision(3) << std::setw(10) << T << std::setw(10) << P
                                  << std::setprecision(3) << std::setw(10) << r.corrU / cal2J << std::setw(10)
                                  << r.corrH / cal2J << std::setw(10) << r.corrG / cal2J << std::setprecision(6)
-                                 << std::setw(17) << r.corrU / au2kJ_mol + sys->E << std::setw(17)
-                                 << r.corrH / au2kJ_mol + sys->E << std::setw(17) << r.corrG / au2kJ_mol + sys->E << "\n";
-                        file_SCq << std::fixed << std::setprecision(3) << std::setw(10) << r.T << std::setw(10) << r.P
-                                 << std::setprecision(3) << std::setw(10) << r.S / cal2J << std::setw(10)
-                                 << r.CV / cal2J << std::setw(10) << r.CP / cal2J << std::scientific
+                                 << std::setw(17) << r.corrU / au2kJ_mol + sys.E << std::setw(17)
+                                 << r.corrH / au2kJ_mol + sys.E << std::setw(17) << r.corrG / au2kJ_mol + sys.E << "\n";
+                        file_SCq << std::fixed << std::setprecision(3) << std::setw(10) << T << std::setw(10) << P
+                                 << std::setprecision(3) << std::setw(10) << r.S_tot / cal2J << std::setw(10)
+                                 << r.CV_tot / cal2J << std::setw(10) << r.CP_tot / cal2J << std::scientific
                                  << std::setprecision(6) << std::setw(16) << r.QV / NA << std::setw(16) << r.Qbot / NA
                                  << "\n";
                     }
@@ -634,18 +677,18 @@ namespace ThermoInterface
                 file_UHG.close();
                 file_SCq.close();
 
-                std::cout << "\n Congratulation! Thermochemical properties at various temperatures/pressures were calculated\n"
-                          << " All data were exported to " << uhg_filename << " and " << scq_filename << "\n"
-                          << " " << uhg_filename << " contains thermal correction to U, H and G, and sum of electronic energy and corresponding corrections\n"
-                          << " " << scq_filename << " contains S, CV, CP, q(V=0) and q(bot)\n";
+                util::report() << "\n Congratulation! Thermochemical properties at various temperatures/pressures were calculated\n"
+                               << " All data were exported to " << uhg_filename << " and " << scq_filename << "\n"
+                               << " " << uhg_filename << " contains thermal correction to U, H and G, and sum of electronic energy and corresponding corrections\n"
+                               << " " << scq_filename << " contains S, CV, CP, q(V=0) and q(bot)\n";
 
                 result.output_files.push_back(uhg_filename);
                 result.output_files.push_back(scq_filename);
             }
             
             // Generate .otm file if requested
-            if (sys->outotm && input_file.find(".otm") == std::string::npos) {
-                util::outotmfile(*sys);
+            if (sys.outotm && input_file.find(".otm") == std::string::npos) {
+                util::outotmfile(sys);
                 std::string otm_filename = get_basename_without_extension(input_file) + ".otm";
                 result.output_files.push_back(otm_filename);
             }
@@ -654,16 +697,92 @@ namespace ThermoInterface
             result.exit_code = 0;
             
             // Print completion message
-            if (sys->prtlevel >= 1) {
+            if (sys.prtlevel >= 1) {
                 auto now = std::chrono::system_clock::now();
-                std::time_t now_time = std::chrono::system_clock::to_time_t(now);
-                std::cout << "\nCalculation completed at: " << std::ctime(&now_time);
-                std::cout << "\n"
-                          << "                    ---------- Happy calculation ----------" << "\n"
-                          << "                    ---- OpenThermo normally terminated ---" << "\n";
+                util::report() << "\nCalculation completed at: " << clock_text(std::chrono::system_clock::to_time_t(now));
+                util::report() << "\n"
+                               << "                    ---------- Happy calculation ----------" << "\n"
+                               << "                    ---- OpenThermo normally terminated ---" << "\n";
+            }
+        } catch (const std::exception& e) {
+            result.error_message = "Exception in thermo processing: " + std::string(e.what());
+            result.success = false;
+        }
+
+        return result;
+    }
+
+    // Helper: write the one-row-per-file table of a batch
+    static bool write_summary_table(const std::string& path, const std::vector<std::string>& files,
+                                    const std::vector<ThermoResult>& results)
+    {
+        std::ofstream table(path);
+        if (!table.is_open()) {
+            return false;
+        }
+
+        size_t file_width = 4;
+        for (const auto& file : files) {
+            file_width = std::max(file_width, file.size());
+        }
+
+        table << "# E and G = E + Gcorr in a.u.; ZPE, Ucorr, Hcorr and Gcorr in kJ/mol; S, CV and CP in J/mol/K\n";
+        table << std::left << std::setw(static_cast<int>(file_width)) << "File" << "  " << std::setw(9) << "Program"
+              << std::setw(5) << "PG" << std::right << std::setw(6) << "nfreq" << std::setw(10) << "T(K)"
+              << std::setw(10) << "P(atm)" << std::setw(17) << "E" << std::setw(11) << "ZPE" << std::setw(11)
+              << "Ucorr" << std::setw(11) << "Hcorr" << std::setw(11) << "Gcorr" << std::setw(17) << "G"
+              << std::setw(10) << "S" << std::setw(10) << "CV" << std::setw(10) << "CP" << "\n";
+
+        for (size_t i = 0; i < files.size(); ++i) {
+            const ThermoResult& r = results[i];
+            table << std::left << std::setw(static_cast<int>(file_width)) << files[i] << "  ";
+            if (!r.success || !r.has_totals) {
+                table << "error: " << (r.success ? std::string("no thermochemistry for this input") : r.error_message)
+                      << "\n";
+                continue;
             }
+            table << std::setw(9) << r.program << std::setw(5) << r.point_group << std::right << std::setw(6)
+                  << r.nfreq << std::fixed << std::setprecision(3) << std::setw(10) << r.T << std::setw(10) << r.P
+                  << std::setprecision(8) << std::setw(17) << r.E << std::setprecision(3) << std::setw(11) << r.ZPE
+                  << std::setw(11) << r.corrU << std::setw(11) << r.corrH << std::setw(11) << r.corrG
+                  << std::setprecision(8) << std::setw(17) << r.E + r.corrG / au2kJ_mol << std::setprecision(3)
+                  << std::setw(10) << r.S << std::setw(10) << r.CV << std::setw(10) << r.CP << "\n";
+        }
+
+        return table.good();
+    }
+
+    ThermoResult process_file(const ThermoSettings& settings, const CommandContext& context) 
+    {
+        ThermoResult result;
+        
+        try {
+            // Initialize thermo module
+            initialize_thermo_module();
             
-            delete sys;
+            // Determine input file
+            std::string input_file;
+            if (!settings.input_file.empty()) {
+                input_file = settings.input_file;
+            } else if (!context.files.empty()) {
+                input_file = context.files[0];
+            } else {
+                result.error_message = "No input file specified for thermo analysis";
+                return result;
+            }
+            
+            // Check if file exists
+            if (!std::filesystem::exists(input_file)) {
+                result.error_message = "Input file not found: " + input_file;
+                return result;
+            }
+
+            std::string                 thread_notification;
+            std::unique_ptr<SystemData> sys =
+                configure_system(settings, context, input_file, input_file, thread_notification);
+            print_parameters(*sys, thread_notification);
+
+            result = analyse_file(*sys, settings, input_file);
             cleanup_thermo_module();
             
         } catch (const std::exception& e) {
@@ -686,13 +805,147 @@ namespace ThermoInterface
             return result;
         }
 
+        // NDJSON rows are the only thing written to stdout; the reports are captured and dropped
+        bool                               ndjson = (settings.output_format == "ndjson");
+        std::ostringstream                 discarded;
+        std::optional<util::ReportCapture> discard_report;
+        if (ndjson) {
+            discard_report.emplace(discarded);
+        }
+
+        // Isotope masses, settings.ini, the CLI arguments and the OpenMP budget are set up once
+        // and every file starts from a copy of the result
+        initialize_thermo_module();
+        std::string file_args;
         for (const auto& file : files) {
-            ThermoSettings file_settings = settings;
-            file_settings.input_file = file;
-            
-            ThermoResult file_result = process_file(file_settings, context);
+            file_args += (file_args.empty() ? "" : " ") + file;
+        }
+        std::unique_ptr<SystemData> base;
+        try {
+            std::string thread_notification;
+            base = configure_system(settings, context, files.front(), file_args, thread_notification);
+            print_parameters(*base, thread_notification);
+        } catch (const std::exception& e) {
+            result.success       = false;
+            result.error_message = "Exception in thermo processing: " + std::string(e.what());
+            return result;
+        }
+
+        // Files run concurrently on the -nt workers, which share the OpenMP threads between them
+        unsigned int num_workers = calculateSafeThreadCount(
+            context.requested_threads, static_cast<unsigned int>(files.size()), context.job_resources);
+        const int omp_per_file = std::max(1, base->exec.omp_threads_actual / static_cast<int>(num_workers));
+        base->exec.omp_threads_actual = omp_per_file;
+        // Workers wait for their input mapping while the memory budget is exhausted
+        base->memory_monitor = std::make_shared<MemoryMonitor>(MemoryMonitor::calculate_optimal_memory_limit(num_workers));
+        if (base->prtlevel >= 1 && files.size() > 1) {
+            util::report() << "Processing " << files.size() << " files on " << num_workers
+                           << " workers with " << omp_per_file << " OpenMP thread(s) each\n\n";
+        }
+
+        // Each report starts from the stream state the parameter summary left behind,
+        // as it did when the files were printed straight to std::cout one after another
+        std::ios report_format(nullptr);
+        report_format.copyfmt(util::report());
+        discard_report.reset();
+
+        struct FileOutcome
+        {
+            ThermoResult result;
+            std::string  report;
+            bool         done = false;
+        };
+        std::vector<FileOutcome> outcomes(files.size());
+        std::mutex               outcome_mutex;
+        std::condition_variable  outcome_ready;
+        unsigned int             running = num_workers;
+
+        WorkQueue                work_queue(WorkQueue::file_costs(files), num_workers);
+        std::vector<std::thread> workers;
+        for (unsigned int w = 0; w < num_workers; ++w) {
+            workers.emplace_back([&, w]() {
+                configure_openmp(omp_per_file);
+                size_t index;
+                while (!g_shutdown_requested.load() && work_queue.next(w, index)) {
+                    FileOutcome        outcome;
+                    std::ostringstream report;
+                    report.copyfmt(report_format);
+                    {
+                        util::ReportCapture capture(report);
+                        if (!std::filesystem::exists(files[index])) {
+                            outcome.result.error_message = "Input file not found: " + files[index];
+                        } else {
+                            SystemData sys = *base;
+                            sys.inputfile  = files[index];
+                            outcome.result = analyse_file(sys, settings, files[index]);
+                        }
+                    }
+                    if (!ndjson) {
+                        outcome.report = report.str();
+                    }
+                    outcome.done = true;
+
+                    {
+                        std::lock_guard<std::mutex> lock(outcome_mutex);
+                        outcomes[index] = std::move(outcome);
+                    }
+                    outcome_ready.notify_one();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(outcome_mutex);
+                    --running;
+                }
+                outcome_ready.notify_one();
+            });
+        }
+
+        // Reports and NDJSON rows are written in input order as soon as the next file is done
+        NdjsonStream              rows(std::cout);
+        std::vector<ThermoResult> summary_rows(settings.summary_file.empty() ? 0 : files.size());
+        size_t                    failed = 0;
+
+        for (size_t seq = 0; seq < files.size(); ++seq) {
+            const std::string& file = files[seq];
+            FileOutcome        outcome;
+            {
+                std::unique_lock<std::mutex> lock(outcome_mutex);
+                outcome_ready.wait(lock, [&]() { return outcomes[seq].done || running == 0; });
+                outcome = std::move(outcomes[seq]);
+            }
+            ThermoResult& file_result = outcome.result;
+            if (!outcome.done) {
+                file_result.error_message = "Interrupted before the file was processed";
+            }
+
+            if (ndjson) {
+                JsonLine line;
+                line.field("seq", static_cast<std::uint64_t>(seq)).field("file", file);
+                if (file_result.success && file_result.has_totals) {
+                    line.field("program", file_result.program)
+                        .field("point_group", file_result.point_group)
+                        .field("nfreq", file_result.nfreq)
+                        .field("T", file_result.T)
+                        .field("P", file_result.P)
+                        .field("E", file_result.E)
+                        .field("zpe", file_result.ZPE)
+                        .field("corr_u", file_result.corrU)
+                        .field("corr_h", file_result.corrH)
+                        .field("corr_g", file_result.corrG)
+                        .field("s", file_result.S)
+                        .field("cv", file_result.CV)
+                        .field("cp", file_result.CP);
+                } else {
+                    line.field("error", file_result.success ? std::string("no thermochemistry for this input")
+                                                            : file_result.error_message);
+                }
+                rows.write(line);
+            } else {
+                std::cout << outcome.report << std::flush;
+            }
             
             if (!file_result.success) {
+                ++failed;
                 result.success = false;
                 result.error_message += "File " + file + ": " + file_result.error_message + "\n";
             } else {
@@ -700,6 +953,31 @@ namespace ThermoInterface
                                          file_result.output_files.begin(), 
                                          file_result.output_files.end());
             }
+            if (!summary_rows.empty()) {
+                summary_rows[seq] = std::move(file_result);
+            }
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        cleanup_thermo_module();
+
+        if (ndjson) {
+            JsonLine summary;
+            summary.field("files", static_cast<std::uint64_t>(files.size()))
+                .field("errors", static_cast<std::uint64_t>(failed))
+                .field("units", "E a.u.; zpe, corr_* kJ/mol; s, cv, cp J/mol/K");
+            rows.write_summary(summary);
+        }
+
+        if (!settings.summary_file.empty()) {
+            if (write_summary_table(settings.summary_file, files, summary_rows)) {
+                result.output_files.push_back(settings.summary_file);
+            } else {
+                result.success = false;
+                result.error_message += "Failed to write summary table: " + settings.summary_file + "\n";
+            }
         }
         
         return result;
@@ -709,27 +987,21 @@ namespace ThermoInterface
     {
         SystemData sys;
         sys.inputfile = file;
-        util::QuantumChemistryProgram prog = util::deterprog(sys);
-        
-        switch(prog) {
-            case util::QuantumChemistryProgram::Gaussian: return "Gaussian";
-            case util::QuantumChemistryProgram::Orca: return "ORCA";
-            case util::QuantumChemistryProgram::Gamess: return "GAMESS-US";
-            case util::QuantumChemistryProgram::Nwchem: return "NWChem";
-            case util::QuantumChemistryProgram::Cp2k: return "CP2K";
-            case util::QuantumChemistryProgram::Vasp: return "VASP";
-            case util::QuantumChemistryProgram::Xtb: return "xTB";
-            case util::QuantumChemistryProgram::QChem: return "Q-Chem";
-            default: return "Unknown";
-        }
+        return program_name(util::deterprog(sys));
+    }
+
+    std::string identify_program(const FileView& view)
+    {
+        return program_name(util::deterprog(view.view()));
     }
 
     bool extract_basic_properties(const std::string& file, double T, double P, 
                                   double& scf_au, double& corrG_au, double& corrH_au, double& zpe_au, double& lf_cm, int& nfreq, std::string& prog_name,
-                                  const std::string& low_vib_method, double ravib)
+                                  const std::string& low_vib_method, double ravib, const FileView& view)
     {
         SystemData* sys = new SystemData();
         sys->inputfile = file;
+        sys->inputview = view;
         sys->T = T;
         sys->P = P;
         sys->prtlevel = 0; // Quiet parsing
@@ -738,18 +1010,7 @@ namespace ThermoInterface
         
         util::QuantumChemistryProgram prog = util::deterprog(*sys);
         sys->isys = static_cast<int>(prog);
-        
-        switch(prog) {
-            case util::QuantumChemistryProgram::Gaussian: prog_name = "Gaussian"; break;
-            case util::QuantumChemistryProgram::Orca: prog_name = "ORCA"; break;
-            case util::QuantumChemistryProgram::Gamess: prog_name = "GAMESS-US"; break;
-            case util::QuantumChemistryProgram::Nwchem: prog_name = "NWChem"; break;
-            case util::QuantumChemistryProgram::Cp2k: prog_name = "CP2K"; break;
-            case util::QuantumChemistryProgram::Vasp: prog_name = "VASP"; break;
-            case util::QuantumChemistryProgram::Xtb: prog_name = "xTB"; break;
-            case util::QuantumChemistryProgram::QChem: prog_name = "Q-Chem"; break;
-            default: prog_name = "Unknown"; break;
-        }
+        prog_name = program_name(prog);
 
         if (prog == util::QuantumChemistryProgram::Unknown) {
             delete sys;
@@ -789,8 +1050,9 @@ namespace ThermoInterface
                     // keep the last occurrence (same logic as loadorca internally).
                     // This avoids calling any private LoadFile members.
                     const std::string energy_label = "FINAL SINGLE POINT ENERGY";
-                    std::ifstream ef(sys->inputfile);
-                    if (ef.is_open()) {
+                    FileViewStream ef(sys->inputview.is_open(sys->inputfile) ? sys->inputview
+                                                                             : FileView(sys->inputfile));
+                    {
                         std::string eline;
                         std::string last_energy_line;
                         while (std::getline(ef, eline)) {
@@ -798,7 +1060,6 @@ namespace ThermoInterface
                                 last_energy_line = eline;
                             }
                         }
-                        ef.close();
                         if (!last_energy_line.empty()) {
                             // Energy value is the last whitespace-separated token on the line
                             std::istringstream eiss(last_energy_line);
@@ -834,6 +1095,7 @@ namespace ThermoInterface
             }
 
             if (nfreq > 0) {
+                ProfileScope profile(ProfileStage::THERMO);
                 try {
                     sys->totmass = 0.0;
                     for (const auto& atom : sys->a) {
@@ -873,10 +1135,12 @@ namespace ThermoInterface
                         sys->elevel  = { 0.0 };                       // ground state, 0 eV excitation
                         sys->edegen  = { std::max(1, sys->spinmult) }; // degeneracy from spinmult
                     }
-                    calc::ThermoResult tr = calc::calcthermo(*sys, T, P);
-                    corrG_au = tr.corrG / au2kJ_mol;
-                    corrH_au = tr.corrH / au2kJ_mol;
-                    zpe_au   = tr.ZPE / au2kJ_mol;
+                    calc::MoleculeBatch batch;
+                    batch.add(*sys);
+                    const calc::BatchThermo tr = calc::calcthermo_batch(batch, *sys, {T}, P);
+                    corrG_au = tr.corrG[0] / au2kJ_mol;
+                    corrH_au = tr.corrH[0] / au2kJ_mol;
+                    zpe_au   = tr.ZPE[0] / au2kJ_mol;
                 } catch (...) {
                     // Thermal property calculation failed (e.g. insufficient electronic
                     // level data for partition function).  Fall back to SCF-energy only.
@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include "commands/command_system.h"
+#include "utilities/file_view.h"
 
 // Forward declarations
 struct SystemData;
@@ -51,6 +52,9 @@ namespace ThermoInterface
         bool hg_entropy = false;
         std::string bav_preset = "";
         int omp_threads = 0;
+        std::string output_format = "text";  ///< text, or ndjson (one JSON line per file, single T/P point)
+        std::string summary_file;            ///< Batch table with one row of totals per file; empty = none
+        std::string ensemble_file;           ///< Per-member results of a .list ensemble; empty = none
         std::vector<std::string> cli_args;
     };
 
@@ -63,6 +67,27 @@ namespace ThermoInterface
         std::string error_message;
         std::vector<std::string> output_files;
         int exit_code = 0;
+
+        /**
+         * @name Totals of a single T/P point
+         * Filled by process_file() when output_format is "ndjson" or a summary_file is set.
+         * @{
+         */
+        bool has_totals = false;
+        std::string program;
+        std::string point_group;
+        int nfreq = 0;
+        double T = 0.0;       ///< K
+        double P = 0.0;       ///< atm
+        double E = 0.0;       ///< Electronic energy (a.u.)
+        double ZPE = 0.0;     ///< kJ/mol
+        double corrU = 0.0;   ///< kJ/mol
+        double corrH = 0.0;   ///< kJ/mol
+        double corrG = 0.0;   ///< kJ/mol
+        double S = 0.0;       ///< J/mol/K
+        double CV = 0.0;      ///< J/mol/K
+        double CP = 0.0;      ///< J/mol/K
+        /** @} */
     };
 
     /**
@@ -77,6 +102,17 @@ namespace ThermoInterface
      * @param context Command context containing thermo parameters
      * @param files List of input files to process
      * @return ThermoResult with operation status and results
+     *
+     * Settings, isotope masses and the OpenMP budget are set up once. The files
+     * are then processed concurrently by context.requested_threads (-nt)
+     * workers, which split the OpenMP threads between them. Each file's report
+     * is buffered and printed in input order once that file and all files
+     * before it are done.
+     *
+     * With output_format "ndjson" the usual report is suppressed and one JSON
+     * line with "seq", "file" and the totals is written to stdout per file in
+     * input order, followed by a summary line. With a summary_file, a table
+     * with one row of totals per file is written there as well.
      */
     ThermoResult process_batch(const ThermoSettings& settings, const CommandContext& context, 
                               const std::vector<std::string>& files);
@@ -106,11 +142,13 @@ namespace ThermoInterface
      * @param zpe_au [out] Calculated Zero Point Energy in au
      * @param nfreq [out] Number of parsed vibrational frequencies
      * @param prog_name [out] Name of detected program
+     * @param view Already opened content of @p file; when empty the file is opened here
      * @return true if successful
      */
     bool extract_basic_properties(const std::string& file, double T, double P, 
                                   double& scf_au, double& corrG_au, double& corrH_au, double& zpe_au, double& lf_cm, int& nfreq, std::string& prog_name,
-                                  const std::string& low_vib_method = "grimme", double ravib = 100.0);
+                                  const std::string& low_vib_method = "grimme", double ravib = 100.0,
+                                  const FileView& view = FileView());
 
     /**
      * @brief Identify the quantum chemistry program that generated the output file
@@ -119,6 +157,13 @@ namespace ThermoInterface
      */
     std::string identify_program(const std::string& file);
 
+    /**
+     * @brief Identify the program from an already opened output file
+     * @param view Mapped content of the file
+     * @return String representation of the program (e.g. "Gaussian", "ORCA", etc.)
+     */
+    std::string identify_program(const FileView& view);
+
     /**
      * @brief Convert CommandContext to SystemData for thermo module
      * @param context ComChemKit command context
@@ -442,13 +442,13 @@ namespace util
             {
                 command += " " + std::string(argv[i]);
             }
-            std::cout << "Command of invoking OpenThermo:\n " << command << "\n";
+            util::report() << "Command of invoking OpenThermo:\n " << command << "\n";
         }
 
         // Check if additional arguments override parameters
         if (argc > 2 && sys.prtlevel >= 2)
         {  // argv[0] = program, argv[1] = inputfile
-            std::cout << "Note: One or more running parameters are overridden by arguments\n";
+            util::report() << "Note: One or more running parameters are overridden by arguments\n";
         }
 
         // Parse arguments starting from index 2
@@ -744,7 +744,7 @@ namespace util
         if (file.is_open())
         {
             if (sys.prtlevel >= 2)
-                std::cout << "\nLoading running parameters from settings.ini...\n";
+                util::report() << "\nLoading running parameters from settings.ini...\n";
             std::string inputArgs;
             get_option_str(file, "E", inputArgs);
             if (!inputArgs.empty())
@@ -1167,9 +1167,9 @@ namespace util
         }
         else
         {
-            std::cout << "\nWarning: settings.ini could not be found in either current directory or the directory defined by "
-                         "openthermopath environment, "
-                      << "thus default parameters are used!\n";
+            util::report() << "\nWarning: settings.ini could not be found in either current directory or the directory defined by "
+                              "openthermopath environment, "
+                           << "thus default parameters are used!\n";
         }
     }
 
@@ -1356,9 +1356,9 @@ namespace util
                             throw std::runtime_error("Error: Invalid mass for atom " + std::to_string(iatm));
                         }
                     }
-                    std::cout << "Mass of atom " << iatm << " (" << ind2name[sys.a[iatm - 1].index]
-                              << ") has been modified to " << std::fixed << std::setprecision(6) << sys.a[iatm - 1].mass
-                              << " amu\n";
+                    util::report() << "Mass of atom " << iatm << " (" << ind2name[sys.a[iatm - 1].index]
+                                   << ") has been modified to " << std::fixed << std::setprecision(6) << sys.a[iatm - 1].mass
+                                   << " amu\n";
                 }
             }
             file.close();
@@ -1368,55 +1368,67 @@ namespace util
     // Determine the program that generated the input file
     auto deterprog(SystemData& sys) -> QuantumChemistryProgram
     {
-        std::ifstream file(sys.inputfile);
-        if (!file.is_open())
+        if (sys.inputview.is_open(sys.inputfile))
+        {
+            return deterprog(sys.inputview.view());
+        }
+
+        FileView view;
+        try
+        {
+            view = FileView(sys.inputfile);
+        }
+        catch (const std::runtime_error&)
         {
             throw std::runtime_error("Error: Could not open file " + sys.inputfile);
         }
+        return deterprog(view.view());
+    }
+
+    auto deterprog(std::string_view head) -> QuantumChemistryProgram
+    {
+        // Only the first 200 lines are searched, as the stream-based detection did
+        size_t end = 0;
+        for (int iline = 0; iline < 200 && end < head.size(); ++iline)
+        {
+            size_t eol = head.find('\n', end);
+            end        = eol == std::string_view::npos ? head.size() : eol + 1;
+        }
+        head = head.substr(0, end);
+        auto has = [head](std::string_view label) { return head.find(label) != std::string_view::npos; };
 
-        int nskip;
-        if (loclabel(file, "generated by the xtb code", nskip, true, false, 200))
+        if (has("generated by the xtb code"))
         {
-            file.close();
             return QuantumChemistryProgram::Xtb;  // xtb g98.out
         }
-        if (loclabel(file, "Gaussian, Inc", nskip, true, false, 200) ||
-            loclabel(file, "Entering Gaussian System", nskip, true, false, 200))
+        if (has("Gaussian, Inc") || has("Entering Gaussian System"))
         {
-            file.close();
             return QuantumChemistryProgram::Gaussian;  // Gaussian
         }
-        if (loclabel(file, "O   R   C   A", nskip, true, false, 200))
+        if (has("O   R   C   A"))
         {
-            file.close();
             return QuantumChemistryProgram::Orca;  // ORCA
         }
-        if (loclabel(file, "GAMESS", nskip, true, false, 200))
+        if (has("GAMESS"))
         {
-            file.close();
             return QuantumChemistryProgram::Gamess;  // GAMESS-US
         }
-        if (loclabel(file, "Northwest Computational Chemistry Package", nskip, true, false, 200))
+        if (has("Northwest Computational Chemistry Package"))
         {
-            file.close();
             return QuantumChemistryProgram::Nwchem;  // NWChem
         }
-        if (loclabel(file, "CP2K|", nskip, true, false, 200))
+        if (has("CP2K|"))
         {
-            file.close();
             return QuantumChemistryProgram::Cp2k;  // CP2K
         }
-        if (loclabel(file, "vasp", nskip, true, false, 200))
+        if (has("vasp"))
         {
-            file.close();
             return QuantumChemistryProgram::Vasp;  // VASP
         }
-        if (loclabel(file, "Welcome to Q-Chem", nskip, true, false, 200))
+        if (has("Welcome to Q-Chem"))
         {
-            file.close();
             return QuantumChemistryProgram::QChem;  // Q-Chem
         }
-        file.close();
         return QuantumChemistryProgram::Unknown;  // Undetermined
     }
 
@@ -1433,7 +1445,7 @@ namespace util
             throw std::runtime_error("Error: inputfile has no extension");
         }
         std::string otmpath = sys.inputfile.substr(0, itmp) + ".otm";
-        std::cout << "Outputting data to " << otmpath << "\n";
+        util::report() << "Outputting data to " << otmpath << "\n";
 
         std::ofstream file(otmpath, std::ios::out);
         if (!file.is_open())
@@ -1490,7 +1502,7 @@ namespace util
         }
 
         file.close();
-        std::cout << " " << otmpath << " has been successfully generated!\n";
+        util::report() << " " << otmpath << " has been successfully generated!\n";
     }
 
     // Create default settings.ini file with all default parameters
@@ -1641,9 +1653,29 @@ namespace util
         file << "\n";
 
         file.close();
-        std::cout << "Default settings.ini file created successfully!" << "\n";
-        std::cout << "File location: " << filename << "\n";
-        std::cout << "You can now edit this file to customize your default parameters." << "\n";
+        util::report() << "Default settings.ini file created successfully!" << "\n";
+        util::report() << "File location: " << filename << "\n";
+        util::report() << "You can now edit this file to customize your default parameters." << "\n";
+    }
+
+    namespace
+    {
+        thread_local std::ostream* report_stream = nullptr;  ///< Set by ReportCapture
+    }
+
+    auto report() -> std::ostream&
+    {
+        return report_stream ? *report_stream : std::cout;
+    }
+
+    ReportCapture::ReportCapture(std::ostream& stream) : previous(report_stream)
+    {
+        report_stream = &stream;
+    }
+
+    ReportCapture::~ReportCapture()
+    {
+        report_stream = previous;
     }
 
 }  // namespace util
\ No newline at end of file
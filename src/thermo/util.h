@@ -18,6 +18,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -149,6 +150,12 @@ namespace util
      */
     auto deterprog(SystemData& sys) -> QuantumChemistryProgram;
 
+    /**
+     * @brief Determine the program from the leading lines of an output already in memory
+     * @param head File content; only the first 200 lines are inspected
+     */
+    auto deterprog(std::string_view head) -> QuantumChemistryProgram;
+
     /**
      * @brief Output molecular data to .otm format file
      */
@@ -159,6 +166,34 @@ namespace util
      */
     void create_default_settings_file();
 
+    /**
+     * @brief Stream the calling thread writes its thermo report to
+     *
+     * This is std::cout unless a ReportCapture is active on the thread. The
+     * batch driver captures the report of each file so that files can be
+     * processed concurrently and still be printed in input order.
+     */
+    auto report() -> std::ostream&;
+
+    /**
+     * @brief Send report() of the calling thread to another stream while in scope
+     *
+     * Captures nest; the previous stream is restored on destruction. Each thread
+     * must use its own stream, since formatting flags live in the stream.
+     */
+    class ReportCapture
+    {
+    public:
+        explicit ReportCapture(std::ostream& stream);
+        ~ReportCapture();
+
+        ReportCapture(const ReportCapture&)            = delete;
+        ReportCapture& operator=(const ReportCapture&) = delete;
+
+    private:
+        std::ostream* previous;
+    };
+
 }  // namespace util
 
 #endif  // UTIL_H
\ No newline at end of file
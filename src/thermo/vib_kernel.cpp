@@ -0,0 +1,354 @@
+/**
+ * @file vib_kernel.cpp
+ * @brief Scalar and SSE2 vibrational kernels and the run-time dispatch between all of them
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "thermo/chemsys.h"
+#include "thermo/omp_config.h"
+#include "thermo/vib_kernel.h"
+#include "thermo/vib_kernel_simd.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define CCK_VIB_KERNEL_SSE2 1
+#endif
+
+#ifndef M_PI
+    #define M_PI 3.141592653589793 /**< Define π if not already defined */
+#endif
+
+namespace calc {
+
+namespace {
+
+#ifdef CCK_VIB_KERNEL_SSE2
+    struct Sse2Ops {
+        using V                    = __m128d;
+        using M                    = __m128d;
+        static constexpr int width = 2;
+
+        static V set1(double x) { return _mm_set1_pd(x); }
+        static V load(const double* p) { return _mm_loadu_pd(p); }
+        static V add(V a, V b) { return _mm_add_pd(a, b); }
+        static V sub(V a, V b) { return _mm_sub_pd(a, b); }
+        static V mul(V a, V b) { return _mm_mul_pd(a, b); }
+        static V div(V a, V b) { return _mm_div_pd(a, b); }
+        static V fmadd(V a, V b, V c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+        static V min(V a, V b) { return _mm_min_pd(a, b); }
+        static M lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+        static V select(M m, V a, V b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+
+        static V pow2(V kd)
+        {
+            __m128i bits = _mm_add_epi64(_mm_castpd_si128(kd), _mm_set1_epi64x(1023));
+            return _mm_castsi128_pd(_mm_slli_epi64(bits, 52));
+        }
+
+        static V exponent(V y)
+        {
+            __m128i e = _mm_srli_epi64(_mm_castpd_si128(y), 52);
+            e         = _mm_or_si128(e, _mm_set1_epi64x(0x4330000000000000LL));
+            return _mm_sub_pd(_mm_castsi128_pd(e), _mm_set1_pd(4503599627370496.0));
+        }
+
+        static V mantissa(V y)
+        {
+            __m128i m = _mm_and_si128(_mm_castpd_si128(y), _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+            return _mm_castsi128_pd(_mm_or_si128(m, _mm_set1_epi64x(0x3FF0000000000000LL)));
+        }
+
+        static double hsum(V v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+    };
+#endif
+
+    /**
+     * @brief The reference loop: one mode at a time with std::exp and std::log
+     */
+    VibSums vibsum_scalar(const SystemData& sys, const double* freq, const double* wavenum, int nfreq, double T)
+    {
+        double log_qvib_v0 = 0.0, log_qvib_bot = 0.0;
+        double ZPE = 0.0, U_vib_heat = 0.0, CV_vib = 0.0, S_vib = 0.0;
+
+        const double h_over_kbT = h / (kb * T);
+        const double RT_1000    = R * T / 1000.0;
+        const double zpe_factor = sys.sclZPE / 2.0 / au2cm_1 * au2kJ_mol;
+        const auto   lowVib     = sys.lowVibTreatment;
+        const double ravib_freq = sys.ravib * wave2freq;
+        const double sclheat    = sys.sclheat;
+        const double sclCV      = sys.sclCV;
+        const double sclS       = sys.sclS;
+        const bool   uniform_scaling = (sclheat == 1.0 && sclCV == 1.0 && sclS == 1.0);
+        const double prefac_trunc    = (lowVib == LowVibTreatment::Truhlar) ? h_over_kbT * ravib_freq : 0.0;
+        const double term_trunc      = (lowVib == LowVibTreatment::Truhlar) ? std::exp(-prefac_trunc) : 0.0;
+        const bool   do_grimme_interp = (lowVib == LowVibTreatment::Grimme || lowVib == LowVibTreatment::Minenkov);
+        const bool   do_hg_energy_interp = (lowVib == LowVibTreatment::HeadGordon);
+        const bool   do_hg_entropy = (lowVib == LowVibTreatment::HeadGordon && sys.hgEntropy);
+        constexpr double eight_pi2    = 8.0 * M_PI * M_PI;
+        const double grimme_log_base  = 8.0 * M_PI * M_PI * M_PI * sys.Bav * kb * T / (h * h);
+
+#ifdef _OPENMP
+        // Only parallelize vibrational loop when Inner strategy is active
+        // and we are not already inside a parallel region (from outer T/P scan)
+#pragma omp parallel for reduction(+:log_qvib_v0,log_qvib_bot,ZPE,U_vib_heat,CV_vib,S_vib) \
+        if(sys.exec.omp_strategy == 1 && nfreq > 50 && omp_get_level() == 0)
+#endif
+        for (int i = 0; i < nfreq; ++i)
+        {
+            double fi = freq[i];
+            if (fi <= 0.0)
+                continue;
+            double wi = wavenum[i];
+            bool truhlar_active = (lowVib == LowVibTreatment::Truhlar && wi < sys.ravib);
+
+            double freqtmp = truhlar_active ? ravib_freq : fi;
+            double x = h_over_kbT * freqtmp;
+            double exp_neg_x = std::exp(-x);
+            double one_minus_exp = 1.0 - exp_neg_x;
+            log_qvib_v0  += -std::log(one_minus_exp);
+            log_qvib_bot += -x / 2.0 - std::log(one_minus_exp);
+
+            double local_ZPE = wi * zpe_factor;
+
+            double pf_base = 0.0, tm_base = 0.0;
+            if (uniform_scaling)
+            {
+                pf_base = h_over_kbT * fi;
+                tm_base = (truhlar_active) ? term_trunc : std::exp(-pf_base);
+                if (truhlar_active) pf_base = prefac_trunc;
+            }
+
+            double local_heat = 0.0;
+            if (T > 0.0)
+            {
+                double pf_h, tm_h;
+                if (uniform_scaling)
+                {
+                    pf_h = pf_base; tm_h = tm_base;
+                }
+                else
+                {
+                    pf_h = h_over_kbT * fi * sclheat;
+                    tm_h = std::exp(-pf_h);
+                    if (truhlar_active) { pf_h = prefac_trunc; tm_h = term_trunc; }
+                }
+
+                if (lowVib == LowVibTreatment::Minenkov)
+                {
+                    double UvRRHO = local_ZPE + RT_1000 * pf_h * tm_h / (1.0 - tm_h);
+                    local_ZPE = 0.0;
+                    double Ufree = RT_1000 * 0.5;
+                    double ra = sys.intpvib / wi;
+                    double r2 = ra * ra;
+                    double tmpval = 1.0 + r2 * r2;
+                    local_heat = (1.0 / tmpval) * UvRRHO + (1.0 - 1.0 / tmpval) * Ufree;
+                }
+                else if (do_hg_energy_interp)
+                {
+                    double UvRRHO = local_ZPE + RT_1000 * pf_h * tm_h / (1.0 - tm_h);
+                    local_ZPE = 0.0;
+                    double Ufree = RT_1000 * 0.5;
+                    double ra = sys.intpvib / wi;
+                    double r2 = ra * ra;
+                    double tmpval = 1.0 + r2 * r2;
+                    local_heat = (1.0 / tmpval) * UvRRHO + (1.0 - 1.0 / tmpval) * Ufree;
+                }
+                else
+                {
+                    local_heat = RT_1000 * pf_h * tm_h / (1.0 - tm_h);
+                }
+            }
+
+            double pf_cv, tm_cv;
+            if (uniform_scaling)
+            {
+                pf_cv = pf_base; tm_cv = tm_base;
+            }
+            else
+            {
+                pf_cv = h_over_kbT * fi * sclCV;
+                tm_cv = std::exp(-pf_cv);
+                if (truhlar_active) { pf_cv = prefac_trunc; tm_cv = term_trunc; }
+            }
+            double omt_cv   = 1.0 - tm_cv;
+            double local_CV  = R * pf_cv * pf_cv * tm_cv / (omt_cv * omt_cv);
+
+            if (do_hg_energy_interp)
+            {
+                double cv_free = R * 0.5;
+                double ra = sys.intpvib / wi;
+                double r2 = ra * ra;
+                double wei = 1.0 / (1.0 + r2 * r2);
+                local_CV = wei * local_CV + (1.0 - wei) * cv_free;
+            }
+
+            double pf_s, tm_s;
+            if (uniform_scaling)
+            {
+                pf_s = pf_base; tm_s = tm_base;
+            }
+            else
+            {
+                pf_s = h_over_kbT * fi * sclS;
+                tm_s = std::exp(-pf_s);
+                if (truhlar_active) { pf_s = prefac_trunc; tm_s = term_trunc; }
+            }
+            double local_S = R * (pf_s * tm_s / (1.0 - tm_s) - std::log(1.0 - tm_s));
+
+            if (do_grimme_interp || do_hg_entropy)
+            {
+                double miu  = h / (eight_pi2 * fi);
+                double miup = miu * sys.Bav / (miu + sys.Bav);
+                double Sfree = R * (0.5 + 0.5 * std::log(grimme_log_base * miup / sys.Bav));
+                double gr  = sys.intpvib / wi;
+                double gr2 = gr * gr;
+                double wei = 1.0 / (1.0 + gr2 * gr2);
+                local_S    = wei * local_S + (1.0 - wei) * Sfree;
+            }
+
+            ZPE        += local_ZPE;
+            U_vib_heat += local_heat;
+            CV_vib     += local_CV;
+            S_vib      += local_S;
+        }
+
+        return VibSums{log_qvib_v0, log_qvib_bot, ZPE, U_vib_heat, CV_vib, S_vib};
+    }
+
+    /**
+     * @brief Gather the loop invariants of the scalar loop for the SIMD kernels
+     */
+    VibKernelArgs kernel_args(const SystemData& sys, const double* freq, const double* wavenum, int nfreq, double T)
+    {
+        const auto lowVib = sys.lowVibTreatment;
+        const bool truhlar = (lowVib == LowVibTreatment::Truhlar);
+
+        VibKernelArgs a;
+        a.freq            = freq;
+        a.wavenum         = wavenum;
+        a.nfreq           = nfreq;
+        a.R               = R;
+        a.h               = h;
+        a.h_over_kbT      = h / (kb * T);
+        a.RT_1000         = R * T / 1000.0;
+        a.zpe_factor      = sys.sclZPE / 2.0 / au2cm_1 * au2kJ_mol;
+        a.truhlar_below   = truhlar ? sys.ravib : -1.0;
+        a.ravib_freq      = sys.ravib * wave2freq;
+        a.term_trunc      = truhlar ? std::exp(-(a.h_over_kbT * a.ravib_freq)) : 0.0;
+        a.sclheat         = sys.sclheat;
+        a.sclCV           = sys.sclCV;
+        a.sclS            = sys.sclS;
+        a.uniform_scaling = (sys.sclheat == 1.0 && sys.sclCV == 1.0 && sys.sclS == 1.0);
+        a.blend_energy    = (lowVib == LowVibTreatment::Minenkov || lowVib == LowVibTreatment::HeadGordon);
+        a.blend_cv        = (lowVib == LowVibTreatment::HeadGordon);
+        a.blend_entropy   = (lowVib == LowVibTreatment::Grimme || lowVib == LowVibTreatment::Minenkov ||
+                             (lowVib == LowVibTreatment::HeadGordon && sys.hgEntropy));
+        a.intpvib         = sys.intpvib;
+        a.eight_pi2       = 8.0 * M_PI * M_PI;
+        a.Bav             = sys.Bav;
+        a.grimme_log_base = 8.0 * M_PI * M_PI * M_PI * sys.Bav * kb * T / (h * h);
+        return a;
+    }
+
+    VibKernel detect_vib_kernel()
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+        if (vib_kernel_avx512_built && __builtin_cpu_supports("avx512f"))
+        {
+            return VibKernel::AVX512;
+        }
+        if (vib_kernel_avx2_built && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return VibKernel::AVX2;
+        }
+#endif
+#ifdef CCK_VIB_KERNEL_SSE2
+        return VibKernel::SSE2;
+#else
+        return VibKernel::Scalar;
+#endif
+    }
+
+} // namespace
+
+VibKernel best_vib_kernel()
+{
+    static const VibKernel best = detect_vib_kernel();
+    return best;
+}
+
+const char* vib_kernel_name(VibKernel kernel)
+{
+    switch (kernel)
+    {
+        case VibKernel::SSE2:   return "sse2";
+        case VibKernel::AVX2:   return "avx2";
+        case VibKernel::AVX512: return "avx512";
+        default:                return "scalar";
+    }
+}
+
+VibSums vibsum(const SystemData& settings, const double* freq, const double* wavenum, int nfreq, double T,
+               VibKernel kernel)
+{
+    // T = 0 divides by kT; the scalar loop has its own handling of it
+    if (!(T > 0.0) || nfreq <= 0 || kernel == VibKernel::Scalar ||
+        static_cast<int>(kernel) > static_cast<int>(best_vib_kernel()))
+    {
+        return vibsum_scalar(settings, freq, wavenum, nfreq, T);
+    }
+
+    const VibKernelArgs args = kernel_args(settings, freq, wavenum, nfreq, T);
+    VibSums             sums{};
+    switch (kernel)
+    {
+        case VibKernel::AVX512:
+            if (vibsum_avx512(args, sums))
+            {
+                return sums;
+            }
+            break;
+        case VibKernel::AVX2:
+            if (vibsum_avx2(args, sums))
+            {
+                return sums;
+            }
+            break;
+        case VibKernel::SSE2:
+#ifdef CCK_VIB_KERNEL_SSE2
+            vib_kernel<Sse2Ops>(args, sums);
+            return sums;
+#endif
+            break;
+        default:
+            break;
+    }
+    return vibsum_scalar(settings, freq, wavenum, nfreq, T);
+}
+
+VibSums vibsum(const SystemData& settings, const double* freq, const double* wavenum, int nfreq, double T)
+{
+#ifdef _OPENMP
+    // The inner OpenMP strategy splits the scalar loop over threads instead
+    if (settings.exec.omp_strategy == 1 && nfreq > 50 && omp_get_level() == 0)
+    {
+        return vibsum_scalar(settings, freq, wavenum, nfreq, T);
+    }
+#endif
+    return vibsum(settings, freq, wavenum, nfreq, T, best_vib_kernel());
+}
+
+VibSums vibsum(const SystemData& sys, double T, VibKernel kernel)
+{
+    return vibsum(sys, sys.freq.data(), sys.wavenum.data(), sys.nfreq, T, kernel);
+}
+
+VibSums vibsum(const SystemData& sys, double T)
+{
+    return vibsum(sys, sys.freq.data(), sys.wavenum.data(), sys.nfreq, T);
+}
+
+} // namespace calc
@@ -0,0 +1,99 @@
+/**
+ * @file vib_kernel.h
+ * @brief Vectorized vibrational partition-function kernel used by calc::calcthermo
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * The vibrational part of calcthermo is a sum over modes of a few
+ * exponentials and logarithms. This kernel evaluates it several modes at a
+ * time with SSE2, AVX2+FMA or AVX-512F, picking the widest instruction set
+ * the CPU supports at run time; the plain loop remains as the scalar path.
+ *
+ * The SIMD exp and log are polynomial approximations whose error stays
+ * within 2 ulp of std::exp and std::log on the arguments the kernel passes
+ * them (see vib_kernel_simd.h), so every sum agrees with the scalar path to
+ * about 1e-14 relative, well inside the 1e-10 the thermo output needs.
+ */
+
+#ifndef VIB_KERNEL_H
+#define VIB_KERNEL_H
+
+#include <cstdint>
+
+struct SystemData;
+
+namespace calc {
+
+/**
+ * @brief Instruction set a vibrational kernel is written for
+ */
+enum class VibKernel : std::uint8_t
+{
+    Scalar,  ///< The reference loop, one mode at a time (also the OpenMP inner-loop path)
+    SSE2,    ///< 2 modes per step
+    AVX2,    ///< 4 modes per step, needs AVX2 and FMA
+    AVX512   ///< 8 modes per step, needs AVX-512F
+};
+
+/**
+ * @brief Sums over the vibrational modes that calcthermo turns into ThermoResult fields
+ */
+struct VibSums {
+    double log_qvib_v0;  ///< ln q_vib with the energy zero at the first level
+    double log_qvib_bot; ///< ln q_vib with the energy zero at the bottom of the well
+    double ZPE;          ///< Zero-point energy (kJ/mol)
+    double U_vib_heat;   ///< Thermal part of U_vib (kJ/mol)
+    double CV_vib;       ///< J/mol/K
+    double S_vib;        ///< J/mol/K
+};
+
+/**
+ * @brief Sum the vibrational contributions of @p sys at temperature @p T
+ *
+ * Uses the widest kernel the CPU supports. T <= 0, and the OpenMP inner
+ * strategy, go through the scalar loop.
+ */
+VibSums vibsum(const SystemData& sys, double T);
+
+/**
+ * @brief Sum the vibrational contributions with a given kernel
+ *
+ * Falls back to the scalar loop when @p kernel is not available on this
+ * CPU or in this build; the benchmarks use it to compare the paths.
+ */
+VibSums vibsum(const SystemData& sys, double T, VibKernel kernel);
+
+/**
+ * @brief Sum the vibrational contributions of modes stored outside a SystemData
+ *
+ * For calcthermo_batch, whose frequencies live in one pool for all molecules.
+ * The treatment of low modes and the scaling factors are taken from
+ * @p settings; its own freq and wavenum are not read.
+ *
+ * @param settings Low-frequency treatment, scaling factors, ravib, intpvib, Bav and hgEntropy
+ * @param freq Frequencies (Hz) of the nfreq modes
+ * @param wavenum Wavenumbers (cm^-1) of the same modes
+ * @param nfreq Number of modes
+ * @param T Temperature in Kelvin
+ */
+VibSums vibsum(const SystemData& settings, const double* freq, const double* wavenum, int nfreq, double T);
+
+/**
+ * @brief Pooled-mode variant of vibsum() with a given kernel
+ */
+VibSums vibsum(const SystemData& settings, const double* freq, const double* wavenum, int nfreq, double T,
+               VibKernel kernel);
+
+/**
+ * @brief Widest kernel supported by both this build and the running CPU
+ */
+VibKernel best_vib_kernel();
+
+/**
+ * @brief Lower-case name of a kernel ("scalar", "sse2", "avx2", "avx512")
+ */
+const char* vib_kernel_name(VibKernel kernel);
+
+} // namespace calc
+
+#endif // VIB_KERNEL_H
@@ -0,0 +1,88 @@
+/**
+ * @file vib_kernel_avx2.cpp
+ * @brief AVX2+FMA build of the vibrational kernel
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Compiled with -mavx2 -mfma on x86 (see the Makefile and CMakeLists.txt)
+ * and only called after vibsum() has checked the CPU for both.
+ */
+
+#include "thermo/vib_kernel_simd.h"
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace calc {
+
+namespace {
+
+    struct Avx2Ops {
+        using V                    = __m256d;
+        using M                    = __m256d;
+        static constexpr int width = 4;
+
+        static V set1(double x) { return _mm256_set1_pd(x); }
+        static V load(const double* p) { return _mm256_loadu_pd(p); }
+        static V add(V a, V b) { return _mm256_add_pd(a, b); }
+        static V sub(V a, V b) { return _mm256_sub_pd(a, b); }
+        static V mul(V a, V b) { return _mm256_mul_pd(a, b); }
+        static V div(V a, V b) { return _mm256_div_pd(a, b); }
+        static V fmadd(V a, V b, V c) { return _mm256_fmadd_pd(a, b, c); }
+        static V min(V a, V b) { return _mm256_min_pd(a, b); }
+        static M lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static V select(M m, V a, V b) { return _mm256_blendv_pd(b, a, m); }
+
+        static V pow2(V kd)
+        {
+            __m256i bits = _mm256_add_epi64(_mm256_castpd_si256(kd), _mm256_set1_epi64x(1023));
+            return _mm256_castsi256_pd(_mm256_slli_epi64(bits, 52));
+        }
+
+        static V exponent(V y)
+        {
+            __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(y), 52);
+            e         = _mm256_or_si256(e, _mm256_set1_epi64x(0x4330000000000000LL));
+            return _mm256_sub_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0));
+        }
+
+        static V mantissa(V y)
+        {
+            __m256i m = _mm256_and_si256(_mm256_castpd_si256(y), _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+            return _mm256_castsi256_pd(_mm256_or_si256(m, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+        }
+
+        static double hsum(V v)
+        {
+            __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+    };
+
+} // namespace
+
+const bool vib_kernel_avx2_built = true;
+
+bool vibsum_avx2(const VibKernelArgs& args, VibSums& sums)
+{
+    vib_kernel<Avx2Ops>(args, sums);
+    return true;
+}
+
+} // namespace calc
+
+#else
+
+namespace calc {
+
+const bool vib_kernel_avx2_built = false;
+
+bool vibsum_avx2(const VibKernelArgs&, VibSums&)
+{
+    return false;
+}
+
+} // namespace calc
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file vib_kernel_avx512.cpp
+ * @brief AVX-512F build of the vibrational kernel
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Compiled with -mavx512f on x86 (see the Makefile and CMakeLists.txt) and
+ * only called after vibsum() has checked the CPU for it.
+ */
+
+#include "thermo/vib_kernel_simd.h"
+
+#if defined(__AVX512F__)
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC 12's avx512fintrin.h self-initialises _mm512_undefined_pd() (GCC bug 105593)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <immintrin.h>
+
+namespace calc {
+
+namespace {
+
+    struct Avx512Ops {
+        using V                    = __m512d;
+        using M                    = __mmask8;
+        static constexpr int width = 8;
+
+        static V set1(double x) { return _mm512_set1_pd(x); }
+        static V load(const double* p) { return _mm512_loadu_pd(p); }
+        static V add(V a, V b) { return _mm512_add_pd(a, b); }
+        static V sub(V a, V b) { return _mm512_sub_pd(a, b); }
+        static V mul(V a, V b) { return _mm512_mul_pd(a, b); }
+        static V div(V a, V b) { return _mm512_div_pd(a, b); }
+        static V fmadd(V a, V b, V c) { return _mm512_fmadd_pd(a, b, c); }
+        static V min(V a, V b) { return _mm512_min_pd(a, b); }
+        static M lt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+        static V select(M m, V a, V b) { return _mm512_mask_blend_pd(m, b, a); }
+
+        static V pow2(V kd)
+        {
+            __m512i bits = _mm512_add_epi64(_mm512_castpd_si512(kd), _mm512_set1_epi64(1023));
+            return _mm512_castsi512_pd(_mm512_slli_epi64(bits, 52));
+        }
+
+        static V exponent(V y)
+        {
+            __m512i e = _mm512_srli_epi64(_mm512_castpd_si512(y), 52);
+            e         = _mm512_or_si512(e, _mm512_set1_epi64(0x4330000000000000LL));
+            return _mm512_sub_pd(_mm512_castsi512_pd(e), _mm512_set1_pd(4503599627370496.0));
+        }
+
+        static V mantissa(V y)
+        {
+            __m512i m = _mm512_and_si512(_mm512_castpd_si512(y), _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL));
+            return _mm512_castsi512_pd(_mm512_or_si512(m, _mm512_set1_epi64(0x3FF0000000000000LL)));
+        }
+
+        static double hsum(V v) { return _mm512_reduce_add_pd(v); }
+    };
+
+} // namespace
+
+const bool vib_kernel_avx512_built = true;
+
+bool vibsum_avx512(const VibKernelArgs& args, VibSums& sums)
+{
+    vib_kernel<Avx512Ops>(args, sums);
+    return true;
+}
+
+} // namespace calc
+
+#else
+
+namespace calc {
+
+const bool vib_kernel_avx512_built = false;
+
+bool vibsum_avx512(const VibKernelArgs&, VibSums&)
+{
+    return false;
+}
+
+} // namespace calc
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ * @file vib_kernel_simd.h
+ * @brief Instruction-set independent body of the vectorized vibrational kernel
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Included only by the kernel translation units (vib_kernel.cpp for SSE2,
+ * vib_kernel_avx2.cpp and vib_kernel_avx512.cpp, which are compiled with
+ * their own -m flags). Each of them supplies an Ops struct of intrinsics
+ * in an anonymous namespace and instantiates vib_kernel<Ops> with it, so
+ * no code built for a wider instruction set can leak into the rest of the
+ * program through a shared inline symbol. For the same reason this header
+ * uses nothing from the standard library.
+ *
+ * An Ops struct provides:
+ * - V, M, width: vector of doubles, comparison mask, lanes per vector
+ * - set1, load, add, sub, mul, div, fmadd (a*b+c), min
+ * - lt (a < b as a mask), select (mask ? a : b)
+ * - pow2 (2^n from a double holding n + 0x1.8p52), exponent (biased exponent as a double),
+ *   mantissa (the significand scaled to [1, 2))
+ * - hsum (horizontal sum)
+ *
+ * Accuracy of the approximations, measured against glibc over 10^8 random
+ * arguments of the ranges the kernel uses:
+ * - exp_neg(x) = exp(-x) for 0 <= x <= 708: at most 1 ulp. Range reduction
+ *   by Cody-Waite with ln2 split in two, then a degree-13 Taylor polynomial
+ *   on |r| <= ln2/2 whose truncation error is below 5e-18. Beyond x = 708.39
+ *   the result is 0 where libm would return a subnormal.
+ * - log(y) for positive normal y: at most 2 ulp. y = m 2^k with
+ *   m in [sqrt(1/2), sqrt(2)), log(m) = 2 atanh(s) with s = (m-1)/(m+1),
+ *   the series stopped after s^19 (truncation below 3e-17 relative).
+ */
+
+#ifndef VIB_KERNEL_SIMD_H
+#define VIB_KERNEL_SIMD_H
+
+#include "thermo/vib_kernel.h"
+
+namespace calc {
+
+/**
+ * @brief Everything the kernel needs from SystemData and T, precomputed by vibsum()
+ */
+struct VibKernelArgs {
+    const double* freq;        ///< Frequencies (Hz), nfreq of them
+    const double* wavenum;     ///< Wavenumbers (cm^-1)
+    int           nfreq;
+    double R;                  ///< Gas constant (J/mol/K)
+    double h;                  ///< Planck constant (J s)
+    double h_over_kbT;
+    double RT_1000;            ///< RT in kJ/mol
+    double zpe_factor;         ///< ZPE (kJ/mol) per cm^-1
+    double truhlar_below;      ///< Modes under this wavenumber are raised to ravib; -1 without Truhlar
+    double ravib_freq;         ///< ravib in Hz
+    double term_trunc;         ///< exp(-h ravib_freq / kT), as the scalar loop computes it
+    double sclheat;
+    double sclCV;
+    double sclS;
+    bool   uniform_scaling;    ///< sclheat, sclCV and sclS are all 1
+    bool   blend_energy;       ///< Minenkov and Head-Gordon interpolate U with the free rotor
+    bool   blend_cv;           ///< Head-Gordon also interpolates CV
+    bool   blend_entropy;      ///< Grimme, Minenkov and Head-Gordon with hgEntropy interpolate S
+    double intpvib;            ///< Interpolation wavenumber of the blends
+    double eight_pi2;
+    double Bav;
+    double grimme_log_base;    ///< 8 pi^3 Bav kT / h^2
+};
+
+/// @name Kernels built into other translation units; they return false when compiled without their ISA
+/// @{
+bool vibsum_avx2(const VibKernelArgs& args, VibSums& sums);
+bool vibsum_avx512(const VibKernelArgs& args, VibSums& sums);
+extern const bool vib_kernel_avx2_built;
+extern const bool vib_kernel_avx512_built;
+/// @}
+
+namespace simd {
+
+    /**
+     * @brief exp(-x) for x >= 0; 0 beyond x = 708.39
+     */
+    template <class Ops>
+    inline typename Ops::V exp_neg(typename Ops::V x)
+    {
+        using V = typename Ops::V;
+        const V shifter = Ops::set1(6755399441055744.0); // 0x1.8p52: adding it rounds to an integer
+        const V a       = Ops::sub(Ops::set1(0.0), Ops::min(x, Ops::set1(708.0)));
+        const V kd      = Ops::fmadd(a, Ops::set1(1.4426950408889634), shifter);
+        const V n       = Ops::sub(kd, shifter);
+        V r = Ops::fmadd(n, Ops::set1(-6.93147180369123816490e-01), a);
+        r   = Ops::fmadd(n, Ops::set1(-1.90821492927058770002e-10), r);
+
+        V p = Ops::set1(1.0 / 6227020800.0);
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 479001600.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 39916800.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 3628800.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 362880.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 40320.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 5040.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 720.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 120.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 24.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0 / 6.0));
+        p   = Ops::fmadd(p, r, Ops::set1(0.5));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0));
+        p   = Ops::fmadd(p, r, Ops::set1(1.0));
+
+        const V result = Ops::mul(p, Ops::pow2(kd));
+        return Ops::select(Ops::lt(Ops::set1(708.39), x), Ops::set1(0.0), result);
+    }
+
+    /**
+     * @brief Natural logarithm of a positive normal number
+     */
+    template <class Ops>
+    inline typename Ops::V log(typename Ops::V y)
+    {
+        using V = typename Ops::V;
+        V m = Ops::mantissa(y);
+        V k = Ops::sub(Ops::exponent(y), Ops::set1(1023.0));
+
+        const auto big = Ops::lt(Ops::set1(1.4142135623730951), m);
+        m              = Ops::select(big, Ops::mul(m, Ops::set1(0.5)), m);
+        k              = Ops::select(big, Ops::add(k, Ops::set1(1.0)), k);
+
+        const V f = Ops::sub(m, Ops::set1(1.0));
+        const V s = Ops::div(f, Ops::add(f, Ops::set1(2.0)));
+        const V z = Ops::mul(s, s);
+
+        V p = Ops::set1(1.0 / 19.0);
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 17.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 15.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 13.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 11.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 9.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 7.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 5.0));
+        p   = Ops::fmadd(p, z, Ops::set1(1.0 / 3.0));
+        p   = Ops::mul(p, z);
+
+        // log(m) = 2s + 2s z p, added to k ln2 with ln2 split in two
+        const V two_s = Ops::add(s, s);
+        const V log_m = Ops::fmadd(two_s, p, two_s);
+        return Ops::fmadd(k, Ops::set1(6.93147180369123816490e-01),
+                          Ops::fmadd(k, Ops::set1(1.90821492927058770002e-10), log_m));
+    }
+
+} // namespace simd
+
+/**
+ * @brief Vibrational sums of calcthermo, Ops::width modes at a time
+ *
+ * Follows the scalar loop term by term. The per-mode choices (skipped
+ * imaginary modes, Truhlar's raised frequencies) are masks and blends, the
+ * treatment-wide ones are tested once per block. The sums are kept per
+ * lane and added up at the end.
+ */
+template <class Ops>
+void vib_kernel(const VibKernelArgs& a, VibSums& sums)
+{
+    using V = typename Ops::V;
+    constexpr int width = Ops::width;
+
+    const V zero       = Ops::set1(0.0);
+    const V one        = Ops::set1(1.0);
+    const V half       = Ops::set1(0.5);
+    const V Rgas       = Ops::set1(a.R);
+    const V h_over_kbT = Ops::set1(a.h_over_kbT);
+    const V RT_1000    = Ops::set1(a.RT_1000);
+
+    V log_qvib_v0 = zero, log_qvib_bot = zero, ZPE = zero, U_vib_heat = zero, CV_vib = zero, S_vib = zero;
+
+    auto block = [&](const double* freq, const double* wavenum) {
+        V fi = Ops::load(freq);
+        V wi = Ops::load(wavenum);
+
+        // Modes with fi <= 0 are skipped; give them harmless values and drop them when summing
+        const auto valid = Ops::lt(zero, fi);
+        fi               = Ops::select(valid, fi, one);
+        wi               = Ops::select(valid, wi, one);
+
+        const auto truhlar = Ops::lt(wi, Ops::set1(a.truhlar_below));
+        const V    x       = Ops::mul(h_over_kbT, Ops::select(truhlar, Ops::set1(a.ravib_freq), fi));
+        const V    tm      = simd::exp_neg<Ops>(x);
+        const V    omt     = Ops::sub(one, tm);
+        const V    log_omt = simd::log<Ops>(omt);
+
+        V local_ZPE = Ops::mul(wi, Ops::set1(a.zpe_factor));
+
+        // Each property uses h nu/kT scaled by its own factor, and the exponential of it
+        V pf_h = x, tm_h = tm, pf_cv = x, tm_cv = tm, pf_s = x, tm_s = tm, log_omt_s = log_omt;
+        if (!a.uniform_scaling)
+        {
+            const V pf_trunc = Ops::set1(a.h_over_kbT * a.ravib_freq);
+            const V tm_trunc = Ops::set1(a.term_trunc);
+            const V base     = Ops::mul(h_over_kbT, fi);
+            pf_h             = Ops::select(truhlar, pf_trunc, Ops::mul(base, Ops::set1(a.sclheat)));
+            tm_h             = Ops::select(truhlar, tm_trunc, simd::exp_neg<Ops>(pf_h));
+            pf_cv            = Ops::select(truhlar, pf_trunc, Ops::mul(base, Ops::set1(a.sclCV)));
+            tm_cv            = Ops::select(truhlar, tm_trunc, simd::exp_neg<Ops>(pf_cv));
+            pf_s             = Ops::select(truhlar, pf_trunc, Ops::mul(base, Ops::set1(a.sclS)));
+            tm_s             = Ops::select(truhlar, tm_trunc, simd::exp_neg<Ops>(pf_s));
+            log_omt_s        = simd::log<Ops>(Ops::sub(one, tm_s));
+        }
+        else
+        {
+            // The scalar loop takes exp(-x) for the Truhlar modes from the precomputed term_trunc
+            tm_h = tm_cv = tm_s = Ops::select(truhlar, Ops::set1(a.term_trunc), tm);
+        }
+
+        // Free-rotor weight 1/(1 + (intpvib/wi)^4) shared by the interpolating treatments
+        V weight = one;
+        if (a.blend_energy || a.blend_cv || a.blend_entropy)
+        {
+            const V ra = Ops::div(Ops::set1(a.intpvib), wi);
+            const V r2 = Ops::mul(ra, ra);
+            weight     = Ops::div(one, Ops::fmadd(r2, r2, one));
+        }
+
+        V local_heat = Ops::div(Ops::mul(Ops::mul(RT_1000, pf_h), tm_h), Ops::sub(one, tm_h));
+        if (a.blend_energy)
+        {
+            const V UvRRHO = Ops::add(local_ZPE, local_heat);
+            const V Ufree  = Ops::mul(RT_1000, half);
+            local_heat     = Ops::add(Ops::mul(weight, UvRRHO), Ops::mul(Ops::sub(one, weight), Ufree));
+            local_ZPE      = zero;
+        }
+
+        const V omt_cv   = Ops::sub(one, tm_cv);
+        V       local_CV = Ops::div(Ops::mul(Ops::mul(Ops::mul(Rgas, pf_cv), pf_cv), tm_cv), Ops::mul(omt_cv, omt_cv));
+        if (a.blend_cv)
+        {
+            const V cv_free = Ops::mul(Rgas, half);
+            local_CV        = Ops::add(Ops::mul(weight, local_CV), Ops::mul(Ops::sub(one, weight), cv_free));
+        }
+
+        V local_S =
+            Ops::mul(Rgas, Ops::sub(Ops::div(Ops::mul(pf_s, tm_s), Ops::sub(one, tm_s)), log_omt_s));
+        if (a.blend_entropy)
+        {
+            const V Bav   = Ops::set1(a.Bav);
+            const V miu   = Ops::div(Ops::set1(a.h), Ops::mul(Ops::set1(a.eight_pi2), fi));
+            const V miup  = Ops::div(Ops::mul(miu, Bav), Ops::add(miu, Bav));
+            const V arg   = Ops::div(Ops::mul(Ops::set1(a.grimme_log_base), miup), Bav);
+            const V Sfree = Ops::mul(Rgas, Ops::add(half, Ops::mul(half, simd::log<Ops>(arg))));
+            local_S       = Ops::add(Ops::mul(weight, local_S), Ops::mul(Ops::sub(one, weight), Sfree));
+        }
+
+        log_qvib_v0  = Ops::sub(log_qvib_v0, Ops::select(valid, log_omt, zero));
+        log_qvib_bot = Ops::add(log_qvib_bot,
+                                Ops::select(valid, Ops::sub(Ops::mul(x, Ops::set1(-0.5)), log_omt), zero));
+        ZPE          = Ops::add(ZPE, Ops::select(valid, local_ZPE, zero));
+        U_vib_heat   = Ops::add(U_vib_heat, Ops::select(valid, local_heat, zero));
+        CV_vib       = Ops::add(CV_vib, Ops::select(valid, local_CV, zero));
+        S_vib        = Ops::add(S_vib, Ops::select(valid, local_S, zero));
+    };
+
+    int i = 0;
+    for (; i + width <= a.nfreq; i += width)
+    {
+        block(a.freq + i, a.wavenum + i);
+    }
+    if (i < a.nfreq)
+    {
+        // The tail goes through the same block, padded with modes of zero frequency
+        double freq[width]    = {};
+        double wavenum[width] = {};
+        for (int j = 0; i + j < a.nfreq; ++j)
+        {
+            freq[j]    = a.freq[i + j];
+            wavenum[j] = a.wavenum[i + j];
+        }
+        block(freq, wavenum);
+    }
+
+    sums.log_qvib_v0  = Ops::hsum(log_qvib_v0);
+    sums.log_qvib_bot = Ops::hsum(log_qvib_bot);
+    sums.ZPE          = Ops::hsum(ZPE);
+    sums.U_vib_heat   = Ops::hsum(U_vib_heat);
+    sums.CV_vib       = Ops::hsum(CV_vib);
+    sums.S_vib        = Ops::hsum(S_vib);
+}
+
+} // namespace calc
+
+#endif // VIB_KERNEL_SIMD_H
@@ -38,6 +38,7 @@ namespace HelpUtils
         std::cout << "  ci                Create inputs from xyz coordinate files\n";
         std::cout << "  ivcoord           Displace geometry along imaginary normal modes\n";
         std::cout << "  thermo            Advanced thermodynamic analysis for multiple quantum chemistry programs\n";
+        std::cout << "  query             Filter and sort a binary result file (extract -f cckb)\n";
         std::cout << "\nOptions:\n";
         std::cout << "  -h, --help        Show this help message\n";
         std::cout << "  -v, --version     Show version information\n";
@@ -64,7 +65,9 @@ namespace HelpUtils
                 std::cout << "Additional Options:\n";
                 std::cout << "  -t, --temp <K>          Temperature in Kelvin (default: 298.15)\n";
                 std::cout << "  -c, -C, --cm, --conc <M> Concentration for PCorr (default: 1.0)\n";
-                std::cout << "  -f, --format <fmt>      Output format: text|csv (default: text)\n";
+                std::cout << "  -f, --format <fmt>      Output format: text|csv|cckb|ndjson (default: text)\n";
+                std::cout << "                          cckb writes a binary columnar file for 'query'\n";
+                std::cout << "                          ndjson streams one JSON line per file to stdout\n";
                 std::cout << "  -col, --column <N>      Sort column 1-7 (default: 2)\n";
                 std::cout
                     << "                        1=Name, 2=G kJ/mol, 3=G a.u, 4=G eV, 5=LowFQ, 6=Status, 7=PhCorr\n";
@@ -75,6 +78,15 @@ namespace HelpUtils
                 std::cout << "  -ravib <cm-1>           Crossover frequency for quasi-RRHO (default: 100.0)\n";
                 std::cout << "  --show-resources        Show system resource information\n";
                 std::cout << "  --memory-limit <MB>     Maximum memory usage in MB (default: auto)\n";
+                std::cout << "  --engine <name>         Gaussian log parser: scanner|legacy|reverse|archive (default: scanner)\n";
+                std::cout << "                          reverse reads the last job step from the end, earlier steps forwards\n";
+                std::cout << "                          archive reads only the archive entry of completed single-step jobs\n";
+                std::cout << "  -r, --recursive         Also search subdirectories (e.g. one directory per job)\n";
+                std::cout << "  --no-cache              Parse every file; do not read or write .cck_cache\n";
+                std::cout << "  --rebuild-cache         Parse every file and rewrite .cck_cache\n";
+                std::cout << "                          By default results of unchanged files are reused from\n";
+                std::cout << "                          .cck_cache (not used with --batch-size); logs of running\n";
+                std::cout << "                          Gaussian jobs are only parsed from where the last run stopped\n";
                 break;
 
             case CommandType::CHECK_DONE:
@@ -116,14 +128,15 @@ namespace HelpUtils
                 std::cout << "Additional Options:\n";
                 std::cout << "  -t, --temp <K>          Temperature in Kelvin (default: from input or 298.15)\n";
                 std::cout << "  -c, -C, --cm, --conc <M> Concentration for PCorr (default: 1.0)\n";
-                std::cout << "  -f, --format <fmt>      Output format: text|csv (default: text)\n";
+                std::cout << "  -f, --format <fmt>      Output format: text|csv|ndjson (default: text)\n";
                 std::cout << "  -col, --column <N>      Sort column 1-7 (default: 2)\n";
                 std::cout
                     << "                        1=Name, 2=G kJ/mol, 3=G a.u, 4=G eV, 5=LowFQ, 6=Status, 7=PhCorr\n";
                 std::cout << "  -lowvibmeth <method>    Low-freq vibrational treatment (default: grimme)\n";
                 std::cout << "                          Options: harmonic|truhlar|grimme|minenkov|headgordon\n";
                 std::cout << "                          Applied when -t or -c is specified\n";
-                std::cout << "  -ravib <cm-1>           Crossover frequency for quasi-RRHO (default: 100.0)\n\n";
+                std::cout << "  -ravib <cm-1>           Crossover frequency for quasi-RRHO (default: 100.0)\n";
+                std::cout << "  --archive               Read high-level energies from the Gaussian archive entry\n\n";
                 break;
 
             case CommandType::HIGH_LEVEL_AU:
@@ -136,7 +149,7 @@ namespace HelpUtils
                 std::cout << "Additional Options:\n";
                 std::cout << "  -t, --temp <K>          Temperature in Kelvin (default: from input or 298.15)\n";
                 std::cout << "  -c, -C, --cm, --conc <M> Concentration for PCorr (default: 1.0)\n";
-                std::cout << "  -f, --format <fmt>      Output format: text|csv (default: text)\n";
+                std::cout << "  -f, --format <fmt>      Output format: text|csv|ndjson (default: text)\n";
                 std::cout << "  -col, --column <N>      Sort column 1-10 (default: 2)\n";
                 std::cout
                     << "                          1=Name, 2=E high, 3=E low, 4=ZPE, 5=TC, 6=TS, 7=H, 8=G, 9=LowFQ, "
@@ -144,7 +157,8 @@ namespace HelpUtils
                 std::cout << "  -lowvibmeth <method>    Low-freq vibrational treatment (default: grimme)\n";
                 std::cout << "                          Options: harmonic|truhlar|grimme|minenkov|headgordon\n";
                 std::cout << "                          Applied when -t or -c is specified\n";
-                std::cout << "  -ravib <cm-1>           Crossover frequency for quasi-RRHO (default: 100.0)\n\n";
+                std::cout << "  -ravib <cm-1>           Crossover frequency for quasi-RRHO (default: 100.0)\n";
+                std::cout << "  --archive               Read high-level energies from the Gaussian archive entry\n\n";
                 break;
 
             case CommandType::EXTRACT_COORDS:
@@ -255,6 +269,25 @@ namespace HelpUtils
                 std::cout << "  " << program_name << " ivcoord --idirection 0 --iamp 0.5 ts.log\n";
                 std::cout << "  " << program_name << " ivcoord --param-file ivcoord_parameters.params *.log\n";
                 break;
+            case CommandType::QUERY:
+                std::cout << "Usage: " << program_name << " query [file.cckb] [options]\n\n";
+                std::cout << "Filter, sort and print rows of a binary result file written by 'extract -f cckb'.\n";
+                std::cout << "Without a file, <current_dir>.cckb is read. The file is memory-mapped, so\n";
+                std::cout << "queries on large result sets do not parse or load the whole file.\n\n";
+                std::cout << "Options:\n";
+                std::cout << "  --where <col><op><value>  Keep matching rows; repeat to combine with AND\n";
+                std::cout << "                            op: = == != < <= > >=\n";
+                std::cout << "  --sort <col>              Sort by a column (ascending)\n";
+                std::cout << "  --desc                    Sort descending\n";
+                std::cout << "  --top <k>                 Print only the first k rows\n";
+                std::cout << "  -f, --format <fmt>        Output format: text|csv (default: text)\n";
+                std::cout << "  --info                    Print the row count and run parameters\n";
+                std::cout << "Columns: name, etgkj, lf, gibbs, nucleare, scf, zpe, round, status, pcorr\n\n";
+                std::cout << "Examples:\n";
+                std::cout << "  " << program_name << " query --where status=DONE --sort gibbs --top 10\n";
+                std::cout << "  " << program_name << " query run.cckb --where 'lf<0' -f csv\n\n";
+                // query reads one result file: none of the file-discovery options below apply
+                return;
         }
 
         std::cout << "Options:\n";
@@ -262,7 +295,15 @@ namespace HelpUtils
         std::cout << "  -nt, --threads <N>    Thread count: number|max|half (default: half)\n";
         std::cout << "  -q, --quiet           Quiet mode (minimal output)\n";
         std::cout << "  --max-file-size <MB>  Maximum file size in MB (default: 100)\n";
-        std::cout << "  --batch-size <N>      Batch size for large directories (default: auto)\n";
+        if (command == CommandType::EXTRACT || command == CommandType::CREATE_INPUT)
+        {
+            std::cout << "  --batch-size <N>      Batch size for large directories (default: auto)\n";
+        }
+        if (command == CommandType::EXTRACT)
+        {
+            std::cout << "                        Streams files in batches and merges sorted results from disk,\n";
+            std::cout << "                        so memory stays bounded for millions of files\n";
+        }
 
         if (command == CommandType::CHECK_DONE)
         {
@@ -280,6 +321,33 @@ namespace HelpUtils
             std::cout << "  --show-details        Show actual error messages found\n";
         }
 
+        if (command == CommandType::CHECK_DONE || command == CommandType::CHECK_ERRORS ||
+            command == CommandType::CHECK_PCM || command == CommandType::CHECK_IMAGINARY ||
+            command == CommandType::CHECK_ALL)
+        {
+            std::cout << "  -f, --format <fmt>    text|ndjson; ndjson prints one JSON line per checked file\n";
+        }
+
+        if (command == CommandType::CHECK_DONE || command == CommandType::CHECK_ERRORS ||
+            command == CommandType::CHECK_PCM || command == CommandType::CHECK_IMAGINARY ||
+            command == CommandType::CHECK_ALL || command == CommandType::EXTRACT_COORDS ||
+            command == CommandType::CREATE_INPUT)
+        {
+            std::cout << "  --resource-info       Show how the files were spread over the worker threads\n";
+        }
+
+        if (command == CommandType::CHECK_DONE || command == CommandType::CHECK_ALL)
+        {
+            std::cout << "  --no-cache            Search every running job from the start; do not use .cck_cache\n";
+            std::cout << "  --rebuild-cache       Search every running job from the start and rewrite .cck_cache\n";
+            std::cout << "                        By default unchanged running jobs are not read again and\n";
+            std::cout << "                        growing ones are only searched from where the last run stopped\n";
+        }
+
+        std::cout << "  --profile             Report time per stage and per-file latency on stderr\n";
+        std::cout << "  --profile-out <file>  Write the --profile report as JSON to <file>\n";
+        std::cout << "  --trace <file>        Write a Chrome/Perfetto trace of the worker threads to <file>\n";
+        std::cout << "  --stats               Count bytes, lines, regex evaluations and marker hits per file\n";
         std::cout << "  -h, --help            Show this help message\n";
         std::cout << "  -v, --version         Show version information\n\n";
 
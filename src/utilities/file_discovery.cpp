@@ -0,0 +1,401 @@
+/**
+ * @file file_discovery.cpp
+ * @brief Implementation of single-pass output file discovery
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/file_discovery.h"
+#include "utilities/profiler.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+#ifdef _WIN32
+    #include <filesystem>
+#else
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+#endif
+
+namespace
+{
+    bool extension_matches(std::string_view name, const std::vector<std::string>& extensions)
+    {
+        // Same rule as std::filesystem::path::extension(): a leading dot does not start an extension
+        size_t dot = name.rfind('.');
+        if (dot == std::string_view::npos || dot == 0)
+            return false;
+
+        std::string_view ext = name.substr(dot);
+        for (const auto& candidate : extensions)
+        {
+            if (candidate.size() == ext.size() &&
+                std::equal(ext.begin(), ext.end(), candidate.begin(), [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                }))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string join_path(const std::string& root, const std::string& relative)
+    {
+        if (relative.empty())
+            return root;
+        if (root.empty() || root == ".")
+            return relative;
+        return root.back() == '/' ? root + relative : root + "/" + relative;
+    }
+
+#ifndef _WIN32
+    std::int64_t mtime_ns(const struct stat& st)
+    {
+    #ifdef __APPLE__
+        return static_cast<std::int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+    #else
+        return static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    #endif
+    }
+#endif
+
+    bool cancelled(const DiscoveryOptions& options)
+    {
+        return options.cancel != nullptr && options.cancel->load();
+    }
+
+    /// Optional hook that empties the output vector once it holds a full batch
+    struct BatchSink
+    {
+        size_t                                               batch_size;
+        const std::function<bool(std::vector<FileEntry>&)>& flush;
+        bool                                                 stopped = false;  ///< flush() asked to end the walk
+
+        /// @return false once the consumer no longer wants batches
+        bool check(std::vector<FileEntry>& files)
+        {
+            if (files.size() >= batch_size && !flush(files))
+                stopped = true;
+            return !stopped;
+        }
+    };
+
+    /**
+     * @brief Read one directory
+     * @param root Search root
+     * @param relative Directory relative to @p root ("" for the root itself)
+     * @param options Discovery options
+     * @param files [out] Matching files are appended
+     * @param subdirs [out] Subdirectories to visit (recursive mode only) are appended
+     * @param sink Flushes @p files whenever a batch is full (streaming mode), may be null;
+     *             reading stops early once it reports that the consumer is gone
+     * @return false if the directory could not be opened
+     */
+    bool scan_directory(const std::string&        root,
+                        const std::string&        relative,
+                        const DiscoveryOptions&   options,
+                        std::vector<FileEntry>&   files,
+                        std::vector<std::string>& subdirs,
+                        BatchSink*                sink = nullptr)
+    {
+        const std::string prefix = relative.empty() ? std::string() : relative + "/";
+
+#ifdef _WIN32
+        std::error_code                     ec;
+        std::filesystem::directory_iterator it(join_path(root, relative), ec);
+        if (ec)
+            return false;
+
+        for (const auto& entry : it)
+        {
+            if (cancelled(options))
+                break;
+
+            std::string name      = entry.path().filename().string();
+            bool        match     = extension_matches(name, options.extensions);
+            bool        want_dir  = options.recursive && name[0] != '.';
+            if (!match && !want_dir)
+                continue;
+
+            if (want_dir && entry.is_directory(ec) && !entry.is_symlink(ec))
+            {
+                subdirs.push_back(prefix + name);
+                continue;
+            }
+            if (!match || !entry.is_regular_file(ec))
+                continue;
+
+            FileEntry file;
+            file.path = prefix + name;
+            if (options.max_size_bytes > 0)
+            {
+                file.size = entry.file_size(ec);
+                if (ec)
+                    continue;
+                file.size_known = true;
+                file.mtime_ns   = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    entry.last_write_time(ec).time_since_epoch())
+                                    .count();
+                if (file.size > options.max_size_bytes)
+                    continue;
+            }
+            files.push_back(std::move(file));
+            if (sink && !sink->check(files))
+                break;
+        }
+        return true;
+#else
+        DIR* dir = opendir(join_path(root, relative).c_str());
+        if (dir == nullptr)
+            return false;
+        int fd = dirfd(dir);
+
+        while (const dirent* entry = readdir(dir))
+        {
+            if (cancelled(options))
+                break;
+
+            const char* name = entry->d_name;
+            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+                continue;
+
+            bool match    = extension_matches(name, options.extensions);
+            bool want_dir = options.recursive && name[0] != '.';
+            if (!match && !want_dir)
+                continue;  // Not a candidate: no metadata lookup at all
+
+            // d_type avoids a stat for almost every entry. Symlinks are followed
+            // for files only, so a linked directory cannot create a cycle.
+            unsigned char type      = entry->d_type;
+            struct stat   st        = {};
+            bool          have_stat = false;
+            if (type == DT_UNKNOWN)
+            {
+                if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+                    continue;
+                type = S_ISREG(st.st_mode) ? DT_REG : S_ISDIR(st.st_mode) ? DT_DIR : S_ISLNK(st.st_mode) ? DT_LNK : 0;
+                have_stat = type == DT_REG;
+            }
+            if (type == DT_LNK)
+            {
+                if (!match || fstatat(fd, name, &st, 0) != 0 || !S_ISREG(st.st_mode))
+                    continue;
+                type      = DT_REG;
+                have_stat = true;
+            }
+
+            if (type == DT_DIR)
+            {
+                if (want_dir)
+                    subdirs.push_back(prefix + name);
+                continue;
+            }
+            if (type != DT_REG || !match)
+                continue;
+
+            if (options.max_size_bytes > 0 && !have_stat)
+            {
+                if (fstatat(fd, name, &st, 0) != 0)
+                    continue;
+                have_stat = true;
+            }
+
+            FileEntry file;
+            file.path  = prefix + name;
+            file.inode = static_cast<std::uint64_t>(entry->d_ino);
+            if (have_stat)
+            {
+                file.size       = static_cast<std::uint64_t>(st.st_size);
+                file.size_known = true;
+                file.inode      = static_cast<std::uint64_t>(st.st_ino);
+                file.mtime_ns   = mtime_ns(st);
+                if (options.max_size_bytes > 0 && file.size > options.max_size_bytes)
+                    continue;
+            }
+            files.push_back(std::move(file));
+            if (sink && !sink->check(files))
+                break;
+        }
+
+        closedir(dir);
+        return true;
+#endif
+    }
+
+    /// Walk the subdirectories in @p pending with a pool of threads
+    void walk_parallel(const std::string&        root,
+                       const DiscoveryOptions&   options,
+                       std::vector<std::string>  pending,
+                       std::vector<FileEntry>&   files)
+    {
+        std::mutex              mutex;
+        std::condition_variable changed;
+        size_t                  active = 0;
+
+        auto worker = [&]() {
+            std::vector<FileEntry>   local_files;
+            std::vector<std::string> subdirs;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true)
+            {
+                changed.wait(lock, [&]() { return !pending.empty() || active == 0 || cancelled(options); });
+                if (pending.empty() || cancelled(options))
+                    break;
+
+                std::string relative = std::move(pending.back());
+                pending.pop_back();
+                active++;
+                lock.unlock();
+
+                subdirs.clear();
+                scan_directory(root, relative, options, local_files, subdirs);
+
+                lock.lock();
+                active--;
+                pending.insert(pending.end(), subdirs.begin(), subdirs.end());
+                changed.notify_all();
+            }
+            changed.notify_all();
+            files.insert(files.end(), std::make_move_iterator(local_files.begin()),
+                         std::make_move_iterator(local_files.end()));
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < options.threads; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}  // namespace
+
+std::vector<FileEntry> discover_files(const std::string& root, const DiscoveryOptions& options)
+{
+    ProfileScope             profile(ProfileStage::DISCOVERY);
+    std::vector<FileEntry>   files;
+    std::vector<std::string> subdirs;
+
+    if (!scan_directory(root, "", options, files, subdirs))
+    {
+        throw std::runtime_error("Error accessing directory: " + root + ": " + std::strerror(errno));
+    }
+
+    if (options.recursive && !subdirs.empty())
+    {
+        if (options.threads > 1)
+        {
+            walk_parallel(root, options, std::move(subdirs), files);
+        }
+        else
+        {
+            while (!subdirs.empty() && !cancelled(options))
+            {
+                std::string relative = std::move(subdirs.back());
+                subdirs.pop_back();
+                scan_directory(root, relative, options, files, subdirs);
+            }
+        }
+    }
+
+    std::sort(files.begin(), files.end(), [](const FileEntry& a, const FileEntry& b) { return a.path < b.path; });
+    return files;
+}
+
+void discover_files_batched(const std::string&                                   root,
+                            const DiscoveryOptions&                              options,
+                            size_t                                               batch_size,
+                            const std::function<bool(std::vector<FileEntry>&)>& on_batch)
+{
+    // Batches are processed while the walk goes on; only the walk counts as discovery
+    const auto               started = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds in_batches{0};
+
+    std::function<bool(std::vector<FileEntry>&)> flush = [&on_batch, &in_batches](std::vector<FileEntry>& files) {
+        std::sort(files.begin(), files.end(), [](const FileEntry& a, const FileEntry& b) { return a.path < b.path; });
+        const auto batch_start = std::chrono::steady_clock::now();
+        bool       more        = on_batch(files);
+        in_batches += std::chrono::steady_clock::now() - batch_start;
+        files.clear();
+        return more;
+    };
+    BatchSink sink{std::max<size_t>(batch_size, 1), flush};
+
+    std::vector<FileEntry>   files;
+    std::vector<std::string> subdirs;
+    files.reserve(sink.batch_size);
+
+    if (!scan_directory(root, "", options, files, subdirs, &sink))
+    {
+        throw std::runtime_error("Error accessing directory: " + root + ": " + std::strerror(errno));
+    }
+    while (options.recursive && !subdirs.empty() && !cancelled(options) && !sink.stopped)
+    {
+        std::string relative = std::move(subdirs.back());
+        subdirs.pop_back();
+        scan_directory(root, relative, options, files, subdirs, &sink);
+    }
+
+    if (!files.empty() && !sink.stopped)
+    {
+        flush(files);
+    }
+
+    if (Profiler::instance().enabled())
+    {
+        auto walk = std::chrono::steady_clock::now() - started - in_batches;
+        Profiler::instance().record(ProfileStage::DISCOVERY,
+                                    static_cast<std::uint64_t>(std::max<std::int64_t>(
+                                        0, std::chrono::duration_cast<std::chrono::nanoseconds>(walk).count())));
+    }
+}
+
+bool stat_file_entry(FileEntry& entry)
+{
+    if (entry.size_known)
+    {
+        return true;
+    }
+#ifdef _WIN32
+    std::error_code ec;
+    auto            size  = std::filesystem::file_size(entry.path, ec);
+    auto            mtime = std::filesystem::last_write_time(entry.path, ec);
+    if (ec)
+        return false;
+    entry.size     = static_cast<std::uint64_t>(size);
+    entry.mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+#else
+    struct stat st = {};
+    if (stat(entry.path.c_str(), &st) != 0)
+        return false;
+    entry.size     = static_cast<std::uint64_t>(st.st_size);
+    entry.inode    = static_cast<std::uint64_t>(st.st_ino);
+    entry.mtime_ns = mtime_ns(st);
+#endif
+    entry.size_known = true;
+    return true;
+}
+
+std::vector<std::string> file_paths(const std::vector<FileEntry>& entries)
+{
+    std::vector<std::string> paths;
+    paths.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        paths.push_back(entry.path);
+    }
+    return paths;
+}
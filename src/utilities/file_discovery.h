@@ -0,0 +1,102 @@
+/**
+ * @file file_discovery.h
+ * @brief Single-pass output file discovery with a per-file size cache
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Listing a directory through std::filesystem::directory_iterator once per
+ * extension, then calling is_regular_file(), file_size() and exists() on
+ * every entry, costs several metadata lookups per file. On network and
+ * parallel file systems (NFS, Lustre) each lookup is a round trip to the
+ * metadata server.
+ *
+ * @section Strategy
+ * - Each directory is read once with readdir (getdents64 underneath) and all
+ *   extensions are matched in that pass.
+ * - The entry type comes from d_type; a stat is only issued for entries
+ *   whose type the file system does not report (DT_UNKNOWN) or symlinks.
+ * - The size of a matching file is only queried when a size filter is
+ *   active, and whatever size was learned is kept in its FileEntry so that
+ *   later stages (work distribution) do not have to ask again.
+ * - In recursive mode subdirectories are walked by a small pool of threads,
+ *   which hides metadata latency on trees of job directories.
+ */
+
+#ifndef FILE_DISCOVERY_H
+#define FILE_DISCOVERY_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @struct FileEntry
+ * @brief One discovered file
+ */
+struct FileEntry
+{
+    std::string   path;                ///< Path relative to the search root ("a.log", "sub/a.log")
+    std::uint64_t size       = 0;      ///< Size in bytes, valid when size_known is true
+    bool          size_known = false;  ///< true if discovery already had to stat the file
+    std::uint64_t inode      = 0;      ///< Inode number from the directory entry (0 if unknown)
+    std::int64_t  mtime_ns   = 0;      ///< Modification time in ns since the epoch, valid when size_known
+};
+
+/**
+ * @struct DiscoveryOptions
+ * @brief What discover_files() matches and how it walks the tree
+ */
+struct DiscoveryOptions
+{
+    std::vector<std::string> extensions;               ///< Extensions to match, case-insensitive (e.g. ".log")
+    std::uint64_t            max_size_bytes = 0;       ///< Skip larger files; 0 disables the filter (no stat)
+    bool                     recursive      = false;   ///< Descend into subdirectories (not following symlinks)
+    unsigned int             threads        = 1;       ///< Directory-walking threads in recursive mode
+    const std::atomic<bool>* cancel         = nullptr; ///< Stop early when this flag becomes true
+};
+
+/**
+ * @brief Find the regular files below @p root whose extension matches
+ * @param root Directory to search ("." for the current directory)
+ * @param options Extensions, size filter and recursion settings
+ * @return Matching files sorted by path; paths are relative to @p root
+ * @throws std::runtime_error if @p root cannot be opened
+ *
+ * Unreadable subdirectories are skipped. Hidden subdirectories (starting
+ * with '.') are not descended into.
+ */
+std::vector<FileEntry> discover_files(const std::string& root, const DiscoveryOptions& options);
+
+/**
+ * @brief Streaming variant of discover_files() for very large directories
+ * @param root Directory to search
+ * @param options Extensions, size filter and recursion settings (the walk is sequential)
+ * @param batch_size Number of files per batch
+ * @param on_batch Called with each full batch (sorted by path) and once with the remainder;
+ *                 it may move the entries out of the vector, and returns false to end the walk
+ * @throws std::runtime_error if @p root cannot be opened
+ *
+ * At most one batch of entries is held at a time, so memory does not grow
+ * with the directory size. There is no global order across batches.
+ */
+void discover_files_batched(const std::string&                                   root,
+                            const DiscoveryOptions&                              options,
+                            size_t                                               batch_size,
+                            const std::function<bool(std::vector<FileEntry>&)>& on_batch);
+
+/**
+ * @brief Fill in size, inode and mtime of @p entry with one stat call
+ * @return false if the file cannot be stat'ed (the entry is left unchanged)
+ *
+ * Entries whose size is already known are returned as they are.
+ */
+bool stat_file_entry(FileEntry& entry);
+
+/**
+ * @brief Paths of @p entries, in the same order
+ */
+std::vector<std::string> file_paths(const std::vector<FileEntry>& entries);
+
+#endif  // FILE_DISCOVERY_H
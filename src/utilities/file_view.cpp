@@ -0,0 +1,69 @@
+/**
+ * @file file_view.cpp
+ * @brief Implementation of FileView and its stream adapter
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/file_view.h"
+#include "utilities/parse_stats.h"
+#include <algorithm>
+#include <utility>
+
+FileView::FileView(const std::string& path) : file_(std::make_shared<const MappedFile>(path)), path_(path) {}
+
+FileViewStreamBuf::FileViewStreamBuf(FileView file) : file_(std::move(file))
+{
+    std::string_view text  = file_.view();
+    char*            begin = const_cast<char*>(text.data());  // get area is never written to
+    setg(begin, begin, begin + text.size());
+    pass_start_ = begin;
+}
+
+FileViewStreamBuf::~FileViewStreamBuf()
+{
+    count_pass();
+}
+
+void FileViewStreamBuf::count_pass()
+{
+    if (CCK_STATS_ON() && gptr() > pass_start_)
+    {
+        CCK_STAT_BYTES(static_cast<std::uint64_t>(gptr() - pass_start_));
+        CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(pass_start_, static_cast<const char*>(gptr()), '\n')));
+    }
+}
+
+FileViewStreamBuf::pos_type FileViewStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                       std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = gptr() - eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = egptr() - eback();
+    }
+
+    off_type target = base + off;
+    if (target < 0 || target > egptr() - eback())
+    {
+        return pos_type(off_type(-1));
+    }
+    count_pass();
+    setg(eback(), eback() + target, egptr());
+    pass_start_ = gptr();
+    return pos_type(target);
+}
+
+FileViewStreamBuf::pos_type FileViewStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file file_view.h
+ * @brief Shared, reference-counted read-only view of an output file
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * A FileView maps a file once (see MappedFile) and can then be copied freely:
+ * every copy refers to the same mapping, which is released when the last copy
+ * goes away. extract() opens one view per file and hands it to program
+ * detection, the thermo loaders and the termination check, so each file is
+ * opened and read only once.
+ *
+ * FileViewStream adapts a view to std::istream for parsers written against
+ * streams, without copying the content into a string first.
+ */
+
+#ifndef FILE_VIEW_H
+#define FILE_VIEW_H
+
+#include "utilities/mapped_file.h"
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+/**
+ * @class FileView
+ * @brief Copyable handle to the mapped content of one file
+ *
+ * A default-constructed FileView is empty (no file); use the path
+ * constructor to open one. The path is kept so that consumers can check that
+ * a view they were handed belongs to the file they are about to read.
+ */
+class FileView
+{
+private:
+    std::shared_ptr<const MappedFile> file_;  ///< Shared mapping, null for an empty handle
+    std::string                       path_;  ///< Path the view was opened from
+
+public:
+    FileView() = default;
+
+    /**
+     * @brief Map a file for reading
+     * @param path Path to the file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit FileView(const std::string& path);
+
+    /**
+     * @brief true if the handle refers to an opened file
+     */
+    explicit operator bool() const
+    {
+        return file_ != nullptr;
+    }
+
+    /**
+     * @brief true if the handle refers to an opened @p path
+     */
+    bool is_open(const std::string& path) const
+    {
+        return file_ && path_ == path;
+    }
+
+    const std::string& path() const
+    {
+        return path_;
+    }
+
+    size_t size() const
+    {
+        return file_ ? file_->size() : 0;
+    }
+
+    /**
+     * @brief Whole content as a string_view (empty for an empty handle)
+     */
+    std::string_view view() const
+    {
+        return file_ ? file_->view() : std::string_view();
+    }
+
+    /**
+     * @brief Last @p bytes of the content (or everything if the file is smaller)
+     */
+    std::string_view tail(size_t bytes) const
+    {
+        return file_ ? file_->tail(bytes) : std::string_view();
+    }
+};
+
+/**
+ * @class FileViewStreamBuf
+ * @brief Read-only, seekable stream buffer over a FileView
+ *
+ * The whole content is exposed as the get area, so getline() and seekg()
+ * work directly on the mapped bytes. The buffer holds a copy of the view,
+ * keeping the mapping alive for as long as the stream exists.
+ *
+ * For --stats the bytes and lines a reader has gone through are counted
+ * when it seeks and when the stream is destroyed; a seek back starts a new
+ * pass, so re-reading shows up as more bytes than the file has.
+ */
+class FileViewStreamBuf : public std::streambuf
+{
+private:
+    FileView    file_;
+    const char* pass_start_;  ///< Where reading resumed after the last seek
+
+    /// Count the range read since pass_start_ (up to gptr())
+    void count_pass();
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+public:
+    explicit FileViewStreamBuf(FileView file);
+    ~FileViewStreamBuf() override;
+};
+
+/**
+ * @class FileViewStream
+ * @brief std::istream reading from a FileView
+ */
+class FileViewStream : public std::istream
+{
+private:
+    FileViewStreamBuf buffer_;
+
+public:
+    explicit FileViewStream(FileView file) : std::istream(nullptr), buffer_(std::move(file))
+    {
+        rdbuf(&buffer_);
+    }
+};
+
+#endif  // FILE_VIEW_H
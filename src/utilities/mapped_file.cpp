@@ -0,0 +1,112 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation of the read-only MappedFile wrapper
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/mapped_file.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path)
+{
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("Could not stat file: " + path);
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0)
+    {
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("Could not map file: " + path);
+        }
+    #ifdef MADV_SEQUENTIAL
+        ::madvise(addr, size_, MADV_SEQUENTIAL);
+    #endif
+        data_   = static_cast<const char*>(addr);
+        mapped_ = true;
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    std::streamsize file_size = file.tellg();
+    if (file_size > 0)
+    {
+        buffer_.resize(static_cast<size_t>(file_size));
+        file.seekg(0, std::ios::beg);
+        file.read(buffer_.data(), file_size);
+        size_ = static_cast<size_t>(file.gcount());
+        data_ = buffer_.data();
+    }
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_), mapped_(other.mapped_), buffer_(std::move(other.buffer_))
+{
+    other.data_   = nullptr;
+    other.size_   = 0;
+    other.mapped_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        data_         = other.data_;
+        size_         = other.size_;
+        mapped_       = other.mapped_;
+        buffer_       = std::move(other.buffer_);
+        other.data_   = nullptr;
+        other.size_   = 0;
+        other.mapped_ = false;
+    }
+    return *this;
+}
+
+void MappedFile::release() noexcept
+{
+#ifndef _WIN32
+    if (mapped_ && data_)
+    {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_   = nullptr;
+    size_   = 0;
+    mapped_ = false;
+    buffer_.clear();
+}
@@ -0,0 +1,88 @@
+/**
+ * @file mapped_file.h
+ * @brief Read-only memory mapping of output files
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * This header declares MappedFile, a small RAII wrapper that exposes the raw
+ * bytes of a file as a contiguous read-only range. On POSIX systems the file
+ * is mapped with mmap(); on other platforms the content is read once into an
+ * owned buffer so that callers can use the same interface everywhere.
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief RAII read-only view over the complete content of a file
+ *
+ * The mapping is established in the constructor and released in the
+ * destructor. MappedFile is movable but not copyable, so the ownership of
+ * the mapping is always unique.
+ *
+ * @note Empty files are valid and produce an empty view without mapping
+ */
+class MappedFile
+{
+private:
+    const char*       data_   = nullptr;  ///< First byte of the mapped (or buffered) content
+    size_t            size_   = 0;        ///< Number of bytes in the view
+    bool              mapped_ = false;    ///< true if data_ points into an mmap() region
+    std::vector<char> buffer_;            ///< Owned content when mmap() is not available
+
+    void release() noexcept;
+
+public:
+    /**
+     * @brief Map a file for reading
+     * @param path Path to the file
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const char* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Whole content as a string_view
+     */
+    std::string_view view() const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    /**
+     * @brief Last @p bytes of the content (or everything if the file is smaller)
+     */
+    std::string_view tail(size_t bytes) const
+    {
+        return bytes >= size_ ? view() : std::string_view(data_ + size_ - bytes, bytes);
+    }
+};
+
+#endif  // MAPPED_FILE_H
@@ -0,0 +1,222 @@
+/**
+ * @file ndjson_writer.cpp
+ * @brief Implementation of the JSON line writer
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/ndjson_writer.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+
+JsonLine::JsonLine()
+{
+    buffer[length++] = '{';
+}
+
+void JsonLine::append(std::string_view text)
+{
+    std::memcpy(buffer + length, text.data(), text.size());
+    length += text.size();
+}
+
+bool JsonLine::begin_field(std::string_view key, size_t value_bytes)
+{
+    size_t needed = (length > 1 ? 1 : 0) + key.size() + 3 + value_bytes;
+    if (finished || truncated || length + needed + RESERVE > CAPACITY)
+    {
+        truncated = !finished;
+        return false;
+    }
+    if (length > 1)
+    {
+        buffer[length++] = ',';
+    }
+    buffer[length++] = '"';
+    append(key);
+    buffer[length++] = '"';
+    buffer[length++] = ':';
+    return true;
+}
+
+void JsonLine::append_escaped(std::string_view text)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    buffer[length++] = '"';
+    for (char c : text)
+    {
+        char   escape[6];
+        size_t size = 0;
+        switch (c)
+        {
+            case '"':
+                escape[size++] = '\\';
+                escape[size++] = '"';
+                break;
+            case '\\':
+                escape[size++] = '\\';
+                escape[size++] = '\\';
+                break;
+            case '\n':
+                escape[size++] = '\\';
+                escape[size++] = 'n';
+                break;
+            case '\r':
+                escape[size++] = '\\';
+                escape[size++] = 'r';
+                break;
+            case '\t':
+                escape[size++] = '\\';
+                escape[size++] = 't';
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    escape[size++] = '\\';
+                    escape[size++] = 'u';
+                    escape[size++] = '0';
+                    escape[size++] = '0';
+                    escape[size++] = hex[(c >> 4) & 0xf];
+                    escape[size++] = hex[c & 0xf];
+                }
+                else
+                {
+                    escape[size++] = c;
+                }
+        }
+
+        // Keep room for the closing quote
+        if (length + size + 1 + RESERVE > CAPACITY)
+        {
+            truncated = true;
+            break;
+        }
+        append(std::string_view(escape, size));
+    }
+    buffer[length++] = '"';
+}
+
+JsonLine& JsonLine::field(std::string_view key, std::string_view value)
+{
+    if (begin_field(key, 2))
+    {
+        append_escaped(value);
+    }
+    return *this;
+}
+
+JsonLine& JsonLine::field(std::string_view key, double value)
+{
+    char   number[32];
+    size_t size = 0;
+    if (!std::isfinite(value))
+    {
+        std::memcpy(number, "null", 4);
+        size = 4;
+    }
+    else
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        size = static_cast<size_t>(std::to_chars(number, number + sizeof(number), value).ptr - number);
+#else
+        size = static_cast<size_t>(std::snprintf(number, sizeof(number), "%.17g", value));
+#endif
+    }
+
+    if (begin_field(key, size))
+    {
+        append(std::string_view(number, size));
+    }
+    return *this;
+}
+
+JsonLine& JsonLine::field(std::string_view key, std::int64_t value)
+{
+    char   number[24];
+    size_t size = static_cast<size_t>(std::to_chars(number, number + sizeof(number), value).ptr - number);
+    if (begin_field(key, size))
+    {
+        append(std::string_view(number, size));
+    }
+    return *this;
+}
+
+JsonLine& JsonLine::field(std::string_view key, std::uint64_t value)
+{
+    char   number[24];
+    size_t size = static_cast<size_t>(std::to_chars(number, number + sizeof(number), value).ptr - number);
+    if (begin_field(key, size))
+    {
+        append(std::string_view(number, size));
+    }
+    return *this;
+}
+
+JsonLine& JsonLine::field(std::string_view key, bool value)
+{
+    std::string_view text = value ? "true" : "false";
+    if (begin_field(key, text.size()))
+    {
+        append(text);
+    }
+    return *this;
+}
+
+std::string_view JsonLine::finish()
+{
+    if (!finished)
+    {
+        if (truncated)
+        {
+            append(length > 1 ? ",\"truncated\":true" : "\"truncated\":true");
+        }
+        append("}\n");
+        finished = true;
+    }
+    return std::string_view(buffer, length);
+}
+
+void NdjsonStream::write(JsonLine& line)
+{
+    std::string_view text = line.finish();
+    std::lock_guard<std::mutex> lock(mutex);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out.flush();
+    lines++;
+}
+
+void NdjsonStream::write_summary(JsonLine& line)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string_view text = line.field("summary", true).field("rows", lines).finish();
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out.flush();
+}
+
+void write_json_string(std::ostream& out, std::string_view text)
+{
+    out << '"';
+    for (char c : text)
+    {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+        {
+            out << '\\' << c;
+        }
+        else if (byte < 0x20)
+        {
+            char escape[8];
+            std::snprintf(escape, sizeof(escape), "\\u%04x", byte);
+            out << escape;
+        }
+        else
+        {
+            out << c;
+        }
+    }
+    out << '"';
+}
@@ -0,0 +1,121 @@
+/**
+ * @file ndjson_writer.h
+ * @brief Allocation-free JSON lines for streaming output (-f ndjson)
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * Commands that take `-f ndjson` write one JSON object per input file as
+ * soon as a worker has finished that file, so that a consumer can ingest
+ * results while the rest of the directory is still being parsed.
+ *
+ * @section Ordering
+ * Workers finish in any order. Every row therefore carries "seq", the
+ * position of the file in the list the command discovered (0-based), and
+ * "file". The last line of a run is a summary object with "summary": true
+ * and the row count, so a consumer knows the stream is complete and can
+ * reorder by seq if it needs the discovery order.
+ *
+ * @section Allocation
+ * JsonLine formats into a fixed buffer on the stack: no heap allocation,
+ * no iostream formatting and no locale. Numbers use std::to_chars (shortest
+ * representation that reads back to the same double); NaN and infinity are
+ * written as null. A line that would not fit is cut at the last complete
+ * field and gets "truncated": true.
+ */
+
+#ifndef NDJSON_WRITER_H
+#define NDJSON_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string_view>
+
+/**
+ * @class JsonLine
+ * @brief One JSON object built in a fixed-size buffer
+ */
+class JsonLine
+{
+public:
+    static constexpr size_t CAPACITY = 8192;
+
+    JsonLine();
+
+    JsonLine& field(std::string_view key, std::string_view value);
+    JsonLine& field(std::string_view key, const char* value)
+    {
+        return field(key, std::string_view(value));
+    }
+    JsonLine& field(std::string_view key, double value);
+    JsonLine& field(std::string_view key, std::int64_t value);
+    JsonLine& field(std::string_view key, std::uint64_t value);
+    JsonLine& field(std::string_view key, int value)
+    {
+        return field(key, static_cast<std::int64_t>(value));
+    }
+    JsonLine& field(std::string_view key, bool value);
+
+    /**
+     * @brief Close the object and return the line, including the trailing newline
+     */
+    std::string_view finish();
+
+private:
+    /// Room kept for the "truncated" marker, the closing brace and the newline
+    static constexpr size_t RESERVE = 20;
+
+    char   buffer[CAPACITY];
+    size_t length    = 0;
+    bool   truncated = false;
+    bool   finished  = false;
+
+    bool begin_field(std::string_view key, size_t value_bytes);
+    void append(std::string_view text);
+    void append_escaped(std::string_view text);
+};
+
+/**
+ * @class NdjsonStream
+ * @brief Thread-safe sink of JSON lines
+ *
+ * Each line is written and flushed under a lock, so lines from different
+ * workers never interleave and reach a reading pipe without delay.
+ */
+class NdjsonStream
+{
+private:
+    std::ostream& out;
+    std::mutex    mutex;
+    std::uint64_t lines = 0;
+
+public:
+    explicit NdjsonStream(std::ostream& stream) : out(stream) {}
+
+    NdjsonStream(const NdjsonStream&)            = delete;
+    NdjsonStream& operator=(const NdjsonStream&) = delete;
+
+    /**
+     * @brief Finish @p line and write it
+     */
+    void write(JsonLine& line);
+
+    /**
+     * @brief Write the closing summary object with "summary": true and "rows"
+     * @param line Further summary fields (files, errors, ...) already added by the caller
+     *
+     * "rows" counts the lines written before this one.
+     */
+    void write_summary(JsonLine& line);
+};
+
+/**
+ * @brief Write @p text as a quoted, escaped JSON string
+ *
+ * For the reports that are written with an ostream rather than a JsonLine
+ * (--profile-out, --trace, --stats).
+ */
+void write_json_string(std::ostream& out, std::string_view text);
+
+#endif  // NDJSON_WRITER_H
@@ -0,0 +1,272 @@
+/**
+ * @file numeric_parse.cpp
+ * @brief Implementation of the locale-free number parsing helpers
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/numeric_parse.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <system_error>
+
+namespace
+{
+    bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    bool is_digit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    size_t skip_space(std::string_view text, size_t pos)
+    {
+        while (pos < text.size() && is_space(text[pos]))
+            ++pos;
+        return pos;
+    }
+
+    /// Convert [first, last) with C-locale semantics; returns the end of the number or nullptr
+    const char* convert(const char* first, const char* last, double& value)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        auto result = std::from_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+        // from_chars(double) is missing from this standard library: fall back to strtod
+        char   buffer[64];
+        size_t n = std::min(static_cast<size_t>(last - first), sizeof(buffer) - 1);
+        std::memcpy(buffer, first, n);
+        buffer[n] = '\0';
+        if (n == 0 || is_space(buffer[0]) || buffer[0] == '+')
+            return nullptr;  // match from_chars, which rejects both
+        char* endptr = nullptr;
+        value        = std::strtod(buffer, &endptr);
+        return endptr == buffer ? nullptr : first + (endptr - buffer);
+#endif
+    }
+
+    /// Parse one number starting exactly at @p pos; returns the end position or npos
+    size_t parse_at(std::string_view text, size_t pos, double& value)
+    {
+        const char* first = text.data() + pos;
+        const char* last  = text.data() + text.size();
+
+        // from_chars does not accept a leading '+'
+        if (first < last && *first == '+')
+        {
+            ++first;
+            if (first == last || *first == '-' || *first == '+')
+                return std::string_view::npos;
+        }
+
+        double      v   = 0.0;
+        const char* end = convert(first, last, v);
+        if (end == nullptr)
+            return std::string_view::npos;
+
+        // Fortran double precision exponent: mantissa ends at 'D' or 'd'
+        if (end < last && (*end == 'D' || *end == 'd'))
+        {
+            const char* exp = end + 1;
+            if (exp < last && (*exp == '+' || *exp == '-'))
+                ++exp;
+            if (exp < last && is_digit(*exp))
+            {
+                while (exp < last && is_digit(*exp))
+                    ++exp;
+
+                char   buffer[64];
+                size_t n = static_cast<size_t>(exp - first);
+                if (n < sizeof(buffer))
+                {
+                    std::memcpy(buffer, first, n);
+                    buffer[end - first] = 'e';
+                    const char* converted = convert(buffer, buffer + n, v);
+                    if (converted == buffer + n)
+                        end = exp;
+                }
+            }
+        }
+
+        value = v;
+        return static_cast<size_t>(end - text.data());
+    }
+
+    template <typename Int>
+    bool parse_integer(std::string_view text, Int& value)
+    {
+        size_t pos = skip_space(text, 0);
+        if (pos < text.size() && text[pos] == '+')
+        {
+            ++pos;
+            if (pos < text.size() && text[pos] == '-')
+                return false;
+        }
+        const char* first = text.data() + pos;
+        const char* last  = text.data() + text.size();
+        if (first == last)
+            return false;
+
+        Int  parsed = 0;
+        auto result = std::from_chars(first, last, parsed);
+        if (result.ec != std::errc() || result.ptr != last)
+            return false;
+        value = parsed;
+        return true;
+    }
+
+    /// Consume a leading overflow field ("****"); returns false if @p text does not start with one
+    bool skip_overflow_field(std::string_view& text)
+    {
+        size_t pos = skip_space(text, 0);
+        size_t end = pos;
+        while (end < text.size() && text[end] == '*')
+            ++end;
+        if (end == pos || (end < text.size() && !is_space(text[end])))
+            return false;
+        text.remove_prefix(end);
+        return true;
+    }
+}  // namespace
+
+namespace NumParse
+{
+
+    bool parse_double(std::string_view& text, double& value)
+    {
+        size_t pos = skip_space(text, 0);
+        size_t end = parse_at(text, pos, value);
+        if (end == std::string_view::npos)
+            return false;
+        text.remove_prefix(end);
+        return true;
+    }
+
+    bool parse_int(std::string_view& text, int& value)
+    {
+        size_t pos = skip_space(text, 0);
+        if (pos < text.size() && text[pos] == '+')
+        {
+            ++pos;
+            if (pos < text.size() && (text[pos] == '-' || text[pos] == '+'))
+                return false;
+        }
+        const char* first = text.data() + pos;
+        const char* last  = text.data() + text.size();
+
+        int  parsed = 0;
+        auto result = std::from_chars(first, last, parsed);
+        if (result.ec != std::errc())
+            return false;
+        value = parsed;
+        text.remove_prefix(static_cast<size_t>(result.ptr - text.data()));
+        return true;
+    }
+
+    std::string_view skip_fields(std::string_view text, size_t count)
+    {
+        size_t pos = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            pos = skip_space(text, pos);
+            while (pos < text.size() && !is_space(text[pos]))
+                ++pos;
+        }
+        return text.substr(pos);
+    }
+
+    bool parse_leading(std::string_view text, double& value, size_t& consumed)
+    {
+        size_t end = parse_at(text, skip_space(text, 0), value);
+        if (end == std::string_view::npos)
+            return false;
+        consumed = end;
+        return true;
+    }
+
+    bool to_double(std::string_view text, double& value)
+    {
+        double parsed = 0.0;
+        size_t end    = parse_at(text, skip_space(text, 0), parsed);
+        if (end != text.size())
+            return false;
+        value = parsed;
+        return true;
+    }
+
+    bool to_int(std::string_view text, int& value)
+    {
+        return parse_integer(text, value);
+    }
+
+    bool to_ulong(std::string_view text, unsigned long& value)
+    {
+        // std::stoul accepts a leading '-' and wraps; keep that behaviour
+        size_t pos = skip_space(text, 0);
+        if (pos < text.size() && text[pos] == '-')
+        {
+            unsigned long magnitude = 0;
+            if (!parse_integer(text.substr(pos + 1), magnitude))
+                return false;
+            value = 0UL - magnitude;
+            return true;
+        }
+        return parse_integer(text, value);
+    }
+
+    bool is_overflow_field(std::string_view text)
+    {
+        return skip_overflow_field(text);
+    }
+
+    size_t parse_doubles(std::string_view text, double* out, size_t count)
+    {
+        size_t n = 0;
+        while (n < count)
+        {
+            if (skip_overflow_field(text))
+            {
+                out[n++] = std::numeric_limits<double>::quiet_NaN();
+            }
+            else if (parse_double(text, out[n]))
+            {
+                ++n;
+            }
+            else
+            {
+                break;
+            }
+        }
+        return n;
+    }
+
+    size_t parse_doubles(std::string_view text, std::vector<double>& out)
+    {
+        size_t start = out.size();
+        double value = 0.0;
+        while (true)
+        {
+            if (skip_overflow_field(text))
+            {
+                out.push_back(std::numeric_limits<double>::quiet_NaN());
+            }
+            else if (parse_double(text, value))
+            {
+                out.push_back(value);
+            }
+            else
+            {
+                break;
+            }
+        }
+        return out.size() - start;
+    }
+
+}  // namespace NumParse
@@ -0,0 +1,122 @@
+/**
+ * @file numeric_parse.h
+ * @brief Locale-free number parsing straight from string_views
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * All output parsers convert their numbers through these functions instead
+ * of std::stod on substr() copies or istringstream extraction. Conversion is
+ * done with std::from_chars (correctly rounded, independent of the global
+ * locale, no allocation) where the standard library supports it for double.
+ *
+ * @section Accepted Syntax
+ * - Optional leading whitespace and an optional '+' or '-' sign
+ * - Fixed and scientific notation: 12, -0.5, 1.5e-3, 2.0E+02
+ * - Fortran double precision exponents: 1.5D-03, 2.0d+02
+ * - "inf" and "nan" as accepted by from_chars
+ *
+ * Fields made only of '*' are what Fortran prints when a value overflows its
+ * format width. They never convert to a number; parse_doubles() stores NaN
+ * for them so that column positions are preserved.
+ */
+
+#ifndef NUMERIC_PARSE_H
+#define NUMERIC_PARSE_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace NumParse
+ * @brief Locale-free numeric conversion helpers shared by all parsers
+ */
+namespace NumParse
+{
+
+    /**
+     * @brief Parse the number at the start of @p text
+     * @param text [in,out] Text to read; on success advanced past the number
+     * @param value [out] Parsed value
+     * @return true if a number was found (leading whitespace is skipped)
+     *
+     * Trailing characters after the number are left in @p text.
+     */
+    bool parse_double(std::string_view& text, double& value);
+
+    /**
+     * @brief Parse the integer at the start of @p text
+     * @param text [in,out] Text to read; on success advanced past the digits
+     * @param value [out] Parsed value
+     * @return true if an integer in range was found (leading whitespace is skipped)
+     */
+    bool parse_int(std::string_view& text, int& value);
+
+    /**
+     * @brief Drop the first @p count whitespace-delimited fields of @p text
+     * @return The remaining text, starting at the whitespace after the last dropped field
+     */
+    std::string_view skip_fields(std::string_view text, size_t count);
+
+    /**
+     * @brief Parse a leading number without consuming the view
+     * @param text Text to read
+     * @param value [out] Parsed value
+     * @param consumed [out] Number of bytes used, including skipped leading whitespace
+     * @return true if a number was found
+     */
+    bool parse_leading(std::string_view text, double& value, size_t& consumed);
+
+    /**
+     * @brief Convert a complete field to double
+     * @param text Field; leading whitespace is allowed, anything after the number is not
+     * @param value [out] Parsed value, untouched on failure
+     * @return true if the whole field is one number
+     *
+     * Equivalent to std::stod with a check that every character was consumed.
+     */
+    bool to_double(std::string_view text, double& value);
+
+    /**
+     * @brief Convert a complete field to int
+     * @param text Field; leading whitespace and a '+' sign are allowed, anything after the digits is not
+     * @param value [out] Parsed value, untouched on failure or overflow
+     * @return true if the whole field is one integer in range
+     */
+    bool to_int(std::string_view text, int& value);
+
+    /**
+     * @brief Convert a complete field to unsigned long
+     * @param text Field; leading whitespace and a '+' sign are allowed, anything after the digits is not
+     * @param value [out] Parsed value, untouched on failure or overflow
+     * @return true if the whole field is one unsigned integer in range
+     */
+    bool to_ulong(std::string_view text, unsigned long& value);
+
+    /**
+     * @brief true if the next whitespace-delimited field of @p text is a Fortran overflow field ("****")
+     */
+    bool is_overflow_field(std::string_view text);
+
+    /**
+     * @brief Parse up to @p count whitespace-separated numbers
+     * @param text Text to read
+     * @param out Destination array with room for @p count values
+     * @param count Maximum number of values to read
+     * @return Number of values stored; stops early at the first field that is not a number
+     *
+     * Overflow fields ("****") are stored as NaN and counted.
+     */
+    size_t parse_doubles(std::string_view text, double* out, size_t count);
+
+    /**
+     * @brief Append every leading whitespace-separated number of @p text to @p out
+     * @return Number of values appended; stops at the first field that is not a number
+     *
+     * Overflow fields ("****") are appended as NaN.
+     */
+    size_t parse_doubles(std::string_view text, std::vector<double>& out);
+
+}  // namespace NumParse
+
+#endif  // NUMERIC_PARSE_H
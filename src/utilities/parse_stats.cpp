@@ -0,0 +1,219 @@
+/**
+ * @file parse_stats.cpp
+ * @brief Implementation of the --stats counters
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/parse_stats.h"
+#include "utilities/ndjson_writer.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+
+ParseStats& ParseStats::instance()
+{
+    static ParseStats stats;
+    return stats;
+}
+
+ParseStats::ThreadState& ParseStats::state()
+{
+    thread_local ThreadState thread_state;
+    return thread_state;
+}
+
+void ParseStats::add_bytes(std::uint64_t bytes)
+{
+    ThreadState& local = state();
+    if (local.depth > 0)
+    {
+        local.counters.bytes += bytes;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    totals_.bytes += bytes;
+}
+
+void ParseStats::add_lines(std::uint64_t lines)
+{
+    ThreadState& local = state();
+    if (local.depth > 0)
+    {
+        local.counters.lines += lines;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    totals_.lines += lines;
+}
+
+void ParseStats::add_regex(std::uint64_t evaluations)
+{
+    ThreadState& local = state();
+    if (local.depth > 0)
+    {
+        local.counters.regex += evaluations;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    totals_.regex += evaluations;
+}
+
+void ParseStats::add_hit(std::string_view marker, std::uint64_t hits)
+{
+    ThreadState& local = state();
+    if (local.depth > 0)
+    {
+        marker = marker.substr(0, sizeof(MarkerCount::name) - 1);
+        for (size_t m = 0; m < local.marker_count; ++m)
+        {
+            if (marker == local.markers[m].name)
+            {
+                local.markers[m].count += hits;
+                return;
+            }
+        }
+        if (local.marker_count < FILE_MARKERS)
+        {
+            MarkerCount& slot = local.markers[local.marker_count++];
+            std::memcpy(slot.name, marker.data(), marker.size());
+            slot.name[marker.size()] = '\0';
+            slot.count               = hits;
+            return;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    total_hits_[std::string(marker)] += hits;
+}
+
+void ParseStats::begin_file(std::string_view file)
+{
+    ThreadState& local = state();
+    if (local.depth++ > 0)
+    {
+        return;
+    }
+    local.counters.file.assign(file.data(), file.size());
+    local.counters.bytes = 0;
+    local.counters.lines = 0;
+    local.counters.regex = 0;
+    local.counters.hits.clear();
+    local.marker_count = 0;
+}
+
+void ParseStats::end_file()
+{
+    ThreadState& local = state();
+    if (local.depth == 0 || --local.depth > 0)
+    {
+        return;
+    }
+
+    FileCounters& file = local.counters;
+    for (size_t m = 0; m < local.marker_count; ++m)
+    {
+        file.hits.emplace_back(local.markers[m].name, local.markers[m].count);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    totals_.bytes += file.bytes;
+    totals_.lines += file.lines;
+    totals_.regex += file.regex;
+    for (const auto& [marker, count] : file.hits)
+    {
+        total_hits_[marker] += count;
+    }
+    files_.push_back(file);
+}
+
+void ParseStats::write_text(std::ostream& out, size_t max_files) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::ios_base::fmtflags flags(out.flags());
+    out << std::fixed << std::setprecision(3);
+    out << "\nStats: " << files_.size() << " files, " << static_cast<double>(totals_.bytes) / (1024.0 * 1024.0)
+        << " MB read, " << totals_.lines << " lines, " << totals_.regex << " regex evaluations\n";
+
+    if (!total_hits_.empty())
+    {
+        out << "  " << std::left << std::setw(44) << "Marker" << std::right << std::setw(12) << "Hits" << "\n";
+        for (const auto& [marker, count] : total_hits_)
+        {
+            out << "  " << std::left << std::setw(44) << marker << std::right << std::setw(12) << count << "\n";
+        }
+    }
+
+    if (!files_.empty())
+    {
+        std::vector<const FileCounters*> order;
+        order.reserve(files_.size());
+        for (const auto& file : files_)
+        {
+            order.push_back(&file);
+        }
+        size_t shown = std::min(max_files, order.size());
+        std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(shown), order.end(),
+                          [](const FileCounters* a, const FileCounters* b) { return a->bytes > b->bytes; });
+
+        out << "  " << std::left << std::setw(44) << "File (most bytes read)" << std::right << std::setw(12)
+            << "MB" << std::setw(12) << "Lines" << std::setw(10) << "Regex" << std::setw(10) << "Hits" << "\n";
+        for (size_t f = 0; f < shown; ++f)
+        {
+            const FileCounters& file = *order[f];
+            std::string         name = file.file;
+            if (name.size() > 43)
+            {
+                name = "..." + name.substr(name.size() - 40);
+            }
+            std::uint64_t hits = 0;
+            for (const auto& hit : file.hits)
+            {
+                hits += hit.second;
+            }
+            out << "  " << std::left << std::setw(44) << name << std::right << std::setw(12)
+                << static_cast<double>(file.bytes) / (1024.0 * 1024.0) << std::setw(12) << file.lines
+                << std::setw(10) << file.regex << std::setw(10) << hits << "\n";
+        }
+        if (shown < files_.size())
+        {
+            out << "  ... " << files_.size() - shown << " more files (all files are in the --profile-out JSON)\n";
+        }
+    }
+    out.flags(flags);
+}
+
+void ParseStats::write_json(std::ostream& out) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto write_hits = [&out](const auto& hits) {
+        out << "{";
+        bool first = true;
+        for (const auto& [marker, count] : hits)
+        {
+            out << (first ? "" : ", ");
+            write_json_string(out, marker);
+            out << ": " << count;
+            first = false;
+        }
+        out << "}";
+    };
+
+    out << "{\"bytes\": " << totals_.bytes << ", \"lines\": " << totals_.lines << ", \"regex\": " << totals_.regex
+        << ", \"hits\": ";
+    write_hits(total_hits_);
+    out << ",\n    \"files\": [";
+    for (size_t f = 0; f < files_.size(); ++f)
+    {
+        const FileCounters& file = files_[f];
+        out << (f == 0 ? "\n      " : ",\n      ") << "{\"file\": ";
+        write_json_string(out, file.file);
+        out << ", \"bytes\": " << file.bytes << ", \"lines\": " << file.lines << ", \"regex\": " << file.regex
+            << ", \"hits\": ";
+        write_hits(file.hits);
+        out << "}";
+    }
+    out << (files_.empty() ? "]}" : "\n    ]}");
+}
@@ -0,0 +1,180 @@
+/**
+ * @file parse_stats.h
+ * @brief Hot-path counters of the parsers: bytes, lines, regex evaluations, marker hits (--stats)
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * With --stats the readers and parsers count, per file and in total, the
+ * bytes they read, the lines they scan, the std::regex evaluations they run
+ * and how often each marker ("SCF Done", "Frequencies", ...) is hit. The
+ * table goes to stderr; together with --profile-out the counters are also
+ * part of the profile JSON. A file whose bytes read exceed its size, or a tail
+ * reader with as many bytes as the file, shows a path that reads more than
+ * it should.
+ *
+ * @section Usage
+ * Instrumented code only uses the CCK_STAT_* macros:
+ * - CCK_STAT_FILE(name) at the top of the per-file function opens the file
+ *   record for the rest of the block (nested scopes on one thread join the
+ *   outer file)
+ * - CCK_STAT_BYTES(n), CCK_STAT_LINES(n), CCK_STAT_REGEX(n) add to it
+ * - CCK_STAT_HIT(marker, n) counts a marker
+ * - CCK_STATS_ON() guards a counting loop that has no single macro
+ *
+ * The macros are void expressions, so one can sit in front of the call it
+ * counts: `cond && (CCK_STAT_REGEX(1), std::regex_search(...))`. Arguments
+ * are evaluated only while the counters are on, so a count that needs a
+ * pass over the data costs nothing otherwise. Counters outside of a
+ * file record go to the totals only.
+ *
+ * @section Build
+ * Built with -DCCK_NO_STATS (CMake: -DENABLE_PARSE_STATS=OFF, make:
+ * NO_STATS=1) the macros expand to nothing and --stats only warns.
+ */
+
+#ifndef PARSE_STATS_H
+#define PARSE_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class ParseStats
+ * @brief Process-wide collector of the counters
+ */
+class ParseStats
+{
+public:
+    /// Distinct markers counted per file; further markers go to the totals only
+    static constexpr size_t FILE_MARKERS = 24;
+
+    static ParseStats& instance();
+
+    void enable()
+    {
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void add_bytes(std::uint64_t bytes);
+    void add_lines(std::uint64_t lines);
+    void add_regex(std::uint64_t evaluations);
+    void add_hit(std::string_view marker, std::uint64_t hits);
+
+    /**
+     * @brief Open the calling thread's file record (or join the open one)
+     */
+    void begin_file(std::string_view file);
+
+    /**
+     * @brief Close the record opened by the matching begin_file()
+     */
+    void end_file();
+
+    /**
+     * @brief Print the totals, the marker hits and the files that read the most
+     * @param max_files Number of files listed (by bytes read)
+     */
+    void write_text(std::ostream& out, size_t max_files = 20) const;
+
+    /**
+     * @brief Write the counters as one JSON object (totals, markers and every file)
+     */
+    void write_json(std::ostream& out) const;
+
+private:
+    struct MarkerCount
+    {
+        char          name[48] = {};
+        std::uint64_t count    = 0;
+    };
+
+    /// Counters of the file a thread is working on
+    struct FileCounters
+    {
+        std::string                                        file;
+        std::uint64_t                                      bytes = 0;
+        std::uint64_t                                      lines = 0;
+        std::uint64_t                                      regex = 0;
+        std::vector<std::pair<std::string, std::uint64_t>> hits;
+    };
+
+    /// Open file record of one thread; markers stay in a fixed array until the file ends
+    struct ThreadState
+    {
+        int          depth = 0;
+        FileCounters counters;
+        MarkerCount  markers[FILE_MARKERS];
+        size_t       marker_count = 0;
+    };
+
+    std::atomic<bool>                    enabled_{false};
+    mutable std::mutex                   mutex_;
+    FileCounters                         totals_;
+    std::map<std::string, std::uint64_t> total_hits_;
+    std::vector<FileCounters>            files_;
+
+    ParseStats() = default;
+
+    static ThreadState& state();
+};
+
+/**
+ * @class ParseStatsFile
+ * @brief RAII form of begin_file()/end_file(); used through CCK_STAT_FILE
+ */
+class ParseStatsFile
+{
+public:
+    explicit ParseStatsFile(std::string_view file) : active_(ParseStats::instance().enabled())
+    {
+        if (active_)
+        {
+            ParseStats::instance().begin_file(file);
+        }
+    }
+
+    ~ParseStatsFile()
+    {
+        if (active_)
+        {
+            ParseStats::instance().end_file();
+        }
+    }
+
+    ParseStatsFile(const ParseStatsFile&)            = delete;
+    ParseStatsFile& operator=(const ParseStatsFile&) = delete;
+
+private:
+    bool active_;
+};
+
+#ifndef CCK_NO_STATS
+    #define CCK_STAT_CALL(call)      (ParseStats::instance().enabled() ? ParseStats::instance().call : (void)0)
+    #define CCK_STATS_ON()           (ParseStats::instance().enabled())
+    #define CCK_STAT_FILE(file)      ParseStatsFile cck_stat_file_scope_(file)
+    #define CCK_STAT_BYTES(n)        CCK_STAT_CALL(add_bytes(n))
+    #define CCK_STAT_LINES(n)        CCK_STAT_CALL(add_lines(n))
+    #define CCK_STAT_REGEX(n)        CCK_STAT_CALL(add_regex(n))
+    #define CCK_STAT_HIT(marker, n)  CCK_STAT_CALL(add_hit(marker, n))
+#else
+    #define CCK_STATS_ON()           false
+    #define CCK_STAT_FILE(file)      ((void)0)
+    #define CCK_STAT_BYTES(n)        ((void)0)
+    #define CCK_STAT_LINES(n)        ((void)0)
+    #define CCK_STAT_REGEX(n)        ((void)0)
+    #define CCK_STAT_HIT(marker, n)  ((void)0)
+#endif
+
+#endif  // PARSE_STATS_H
@@ -0,0 +1,254 @@
+/**
+ * @file profiler.cpp
+ * @brief Implementation of the --profile stage timings
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/profiler.h"
+#include "utilities/parse_stats.h"
+#include "utilities/trace_recorder.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+namespace
+{
+    const char* const STAGE_NAMES[] = {"discovery", "open", "read", "parse", "thermo", "sort", "write", "file"};
+
+    std::uint64_t elapsed_ns(std::chrono::steady_clock::time_point since)
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count());
+    }
+}  // namespace
+
+thread_local ProfileScope* ProfileScope::current_ = nullptr;
+
+const char* profile_stage_name(ProfileStage stage)
+{
+    return STAGE_NAMES[static_cast<size_t>(stage)];
+}
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::enable()
+{
+    start_ = std::chrono::steady_clock::now();
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+size_t Profiler::bucket_of(std::uint64_t nanoseconds)
+{
+    if (nanoseconds < 4)
+    {
+        return static_cast<size_t>(nanoseconds);
+    }
+    // Highest set bit picks the power of two, the next two bits the quarter within it
+    int msb = 63;
+    while ((nanoseconds >> msb) == 0)
+    {
+        --msb;
+    }
+    size_t quarter = static_cast<size_t>((nanoseconds >> (msb - 2)) & 3);
+    return static_cast<size_t>(msb) * 4 + quarter;
+}
+
+double Profiler::bucket_value(size_t bucket)
+{
+    if (bucket < 8)
+    {
+        return static_cast<double>(bucket);
+    }
+    // Middle of the bucket [(4 + quarter) * 2^(msb-2), (5 + quarter) * 2^(msb-2))
+    int    msb     = static_cast<int>(bucket / 4);
+    double quarter = static_cast<double>(bucket % 4);
+    return (4.5 + quarter) * std::ldexp(1.0, msb - 2);
+}
+
+void Profiler::record(ProfileStage stage, std::uint64_t nanoseconds, std::uint64_t bytes)
+{
+    StageStats& stats = stages_[static_cast<size_t>(stage)];
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.total_ns.fetch_add(nanoseconds, std::memory_order_relaxed);
+    stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stats.buckets[bucket_of(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t previous = stats.max_ns.load(std::memory_order_relaxed);
+    while (nanoseconds > previous &&
+           !stats.max_ns.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+double Profiler::percentile_ns(const StageStats& stats, double fraction) const
+{
+    std::uint64_t count = stats.count.load(std::memory_order_relaxed);
+    if (count == 0)
+    {
+        return 0.0;
+    }
+
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(fraction * count)));
+    std::uint64_t seen = 0;
+    for (size_t b = 0; b < BUCKETS; ++b)
+    {
+        seen += stats.buckets[b].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return std::min(bucket_value(b), static_cast<double>(stats.max_ns.load(std::memory_order_relaxed)));
+        }
+    }
+    return static_cast<double>(stats.max_ns.load(std::memory_order_relaxed));
+}
+
+double Profiler::wall_seconds() const
+{
+    return static_cast<double>(elapsed_ns(start_)) * 1e-9;
+}
+
+void Profiler::write_text(std::ostream& out, const std::string& command) const
+{
+    const StageStats& files = stages_[static_cast<size_t>(ProfileStage::FILE)];
+    double            wall  = wall_seconds();
+    double            mb    = static_cast<double>(files.bytes.load()) / (1024.0 * 1024.0);
+
+    std::ios_base::fmtflags flags(out.flags());
+    out << std::fixed << std::setprecision(3);
+    out << "\nProfile (" << command << "): wall " << wall << " s, " << files.count.load() << " files, " << mb
+        << " MB";
+    if (wall > 0.0 && mb > 0.0)
+    {
+        out << ", " << mb / wall << " MB/s";
+    }
+    out << "\n";
+    out << "  " << std::left << std::setw(10) << "Stage" << std::right << std::setw(10) << "Count" << std::setw(11)
+        << "Total s" << std::setw(11) << "p50 ms" << std::setw(11) << "p95 ms" << std::setw(11) << "p99 ms"
+        << std::setw(11) << "Max ms" << std::setw(11) << "MB/s" << "\n";
+
+    for (size_t s = 0; s < stages_.size(); ++s)
+    {
+        const StageStats& stats = stages_[s];
+        std::uint64_t     count = stats.count.load();
+        if (count == 0)
+        {
+            continue;
+        }
+        double total = static_cast<double>(stats.total_ns.load()) * 1e-9;
+        out << "  " << std::left << std::setw(10) << STAGE_NAMES[s] << std::right << std::setw(10) << count
+            << std::setw(11) << total << std::setw(11) << percentile_ns(stats, 0.50) * 1e-6 << std::setw(11)
+            << percentile_ns(stats, 0.95) * 1e-6 << std::setw(11) << percentile_ns(stats, 0.99) * 1e-6
+            << std::setw(11) << static_cast<double>(stats.max_ns.load()) * 1e-6;
+        std::uint64_t bytes = stats.bytes.load();
+        if (bytes > 0 && total > 0.0)
+        {
+            out << std::setw(11) << static_cast<double>(bytes) / (1024.0 * 1024.0) / total;
+        }
+        else
+        {
+            out << std::setw(11) << "-";
+        }
+        out << "\n";
+    }
+    out << "  Stage totals are summed over threads; MB/s of a stage is per thread.\n";
+    out.flags(flags);
+}
+
+void Profiler::write_json(std::ostream& out, const std::string& command) const
+{
+    const StageStats& files = stages_[static_cast<size_t>(ProfileStage::FILE)];
+    double            wall  = wall_seconds();
+
+    std::ios_base::fmtflags flags(out.flags());
+    out << std::setprecision(9);
+    out << "{\n  \"command\": \"" << command << "\",\n  \"wall_seconds\": " << wall
+        << ",\n  \"files\": " << files.count.load() << ",\n  \"bytes\": " << files.bytes.load()
+        << ",\n  \"bytes_per_second\": " << (wall > 0.0 ? static_cast<double>(files.bytes.load()) / wall : 0.0)
+        << ",\n  \"stages\": {";
+
+    bool first = true;
+    for (size_t s = 0; s < stages_.size(); ++s)
+    {
+        const StageStats& stats = stages_[s];
+        std::uint64_t     count = stats.count.load();
+        if (count == 0)
+        {
+            continue;
+        }
+        double        total = static_cast<double>(stats.total_ns.load()) * 1e-9;
+        std::uint64_t bytes = stats.bytes.load();
+        out << (first ? "\n" : ",\n") << "    \"" << STAGE_NAMES[s] << "\": {\"count\": " << count
+            << ", \"total_seconds\": " << total << ", \"p50_ms\": " << percentile_ns(stats, 0.50) * 1e-6
+            << ", \"p95_ms\": " << percentile_ns(stats, 0.95) * 1e-6
+            << ", \"p99_ms\": " << percentile_ns(stats, 0.99) * 1e-6
+            << ", \"max_ms\": " << static_cast<double>(stats.max_ns.load()) * 1e-6 << ", \"bytes\": " << bytes
+            << ", \"bytes_per_second\": " << (total > 0.0 ? static_cast<double>(bytes) / total : 0.0) << "}";
+        first = false;
+    }
+    out << "\n  }";
+    if (ParseStats::instance().enabled())
+    {
+        out << ",\n  \"stats\": ";
+        ParseStats::instance().write_json(out);
+    }
+    out << "\n}\n";
+    out.flags(flags);
+}
+
+ProfileScope::ProfileScope(ProfileStage stage, std::uint64_t bytes)
+    : stage_(stage),
+      bytes_(bytes),
+      profile_(Profiler::instance().enabled()),
+      trace_(TraceRecorder::instance().enabled() && stage != ProfileStage::FILE)
+{
+    if (trace_)
+    {
+        trace_start_ns_ = TraceRecorder::instance().now_ns();
+    }
+    if (!profile_)
+    {
+        return;
+    }
+    if (stage_ != ProfileStage::FILE)
+    {
+        parent_  = current_;
+        current_ = this;
+    }
+    start_ = std::chrono::steady_clock::now();
+}
+
+ProfileScope::~ProfileScope()
+{
+    if (trace_)
+    {
+        // The file span itself comes from a TraceSpan that knows the file name
+        TraceEvent event;
+        event.category    = "stage";
+        event.name        = profile_stage_name(stage_);
+        event.bytes       = bytes_;
+        event.start_ns    = trace_start_ns_;
+        std::uint64_t now = TraceRecorder::instance().now_ns();
+        event.duration_ns = now > trace_start_ns_ ? now - trace_start_ns_ : 0;
+        TraceRecorder::instance().record(event);
+    }
+    if (!profile_)
+    {
+        return;
+    }
+
+    std::uint64_t elapsed = elapsed_ns(start_);
+    if (stage_ != ProfileStage::FILE)
+    {
+        current_ = parent_;
+        if (parent_ != nullptr)
+        {
+            parent_->child_ns_ += elapsed;
+        }
+    }
+    Profiler::instance().record(stage_, elapsed > child_ns_ ? elapsed - child_ns_ : 0, bytes_);
+}
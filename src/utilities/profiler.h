@@ -0,0 +1,175 @@
+/**
+ * @file profiler.h
+ * @brief Stage timings and per-file latency percentiles for --profile
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * With the common option --profile, batch commands time the stages of a run
+ * on the monotonic clock: file discovery, per-file open, read, parse and
+ * thermo work, sorting and writing the output. At exit a report with the
+ * total time of each stage, p50/p95/p99 of the per-file latency and the
+ * throughput in bytes/s goes to stderr, or as JSON to --profile-out.
+ *
+ * @section Stages
+ * - discovery: listing the directory (and stat of candidates)
+ * - open: acquiring a file handle and mapping the file
+ * - read: waiting for the memory budget and paging the mapped file in
+ * - parse: program detection and the log parsers
+ * - thermo: partition functions and thermal corrections
+ * - sort, write: ordering and formatting the results
+ * - file: the whole processing of one file, the envelope of the stages above
+ *
+ * Stage times are exclusive: a stage that runs inside another (thermo inside
+ * a parser) is subtracted from the enclosing one, so the stage totals add up.
+ * Totals are summed over worker threads and can exceed the wall time.
+ *
+ * With --trace the same scopes also become "stage" spans of the thread's
+ * track in the trace timeline (see trace_recorder.h).
+ *
+ * @section Cost
+ * When profiling and tracing are off a ProfileScope is two relaxed atomic loads. When on,
+ * recording is lock-free: each stage keeps atomic counters and a histogram
+ * with four buckets per power of two of nanoseconds, so percentiles are
+ * exact to within about 12% and memory does not grow with the file count.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @enum ProfileStage
+ * @brief Stages reported by --profile
+ */
+enum class ProfileStage
+{
+    DISCOVERY,
+    OPEN,
+    READ,
+    PARSE,
+    THERMO,
+    SORT,
+    WRITE,
+    FILE,  ///< Whole file; not subtracted from, and not subtracted by, the other stages
+    COUNT
+};
+
+/**
+ * @brief Lower-case name of @p stage as used in the reports
+ */
+const char* profile_stage_name(ProfileStage stage);
+
+/**
+ * @class Profiler
+ * @brief Process-wide collector of stage timings
+ */
+class Profiler
+{
+public:
+    static Profiler& instance();
+
+    /**
+     * @brief Start collecting; the wall time of the report is measured from here
+     */
+    void enable();
+
+    bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add one occurrence of @p stage
+     * @param stage Stage to account to
+     * @param nanoseconds Duration of this occurrence
+     * @param bytes Bytes handled by this occurrence (0 if not meaningful)
+     */
+    void record(ProfileStage stage, std::uint64_t nanoseconds, std::uint64_t bytes = 0);
+
+    /**
+     * @brief Print the stage table to @p out (stderr in normal use)
+     * @param command Name of the command that ran
+     */
+    void write_text(std::ostream& out, const std::string& command) const;
+
+    /**
+     * @brief Write the report as one JSON object
+     * @param command Name of the command that ran
+     */
+    void write_json(std::ostream& out, const std::string& command) const;
+
+private:
+    static constexpr size_t BUCKETS = 256;  ///< 4 per power of two up to 2^64 ns
+
+    struct StageStats
+    {
+        std::atomic<std::uint64_t>                    count{0};
+        std::atomic<std::uint64_t>                    total_ns{0};
+        std::atomic<std::uint64_t>                    max_ns{0};
+        std::atomic<std::uint64_t>                    bytes{0};
+        std::array<std::atomic<std::uint64_t>, BUCKETS> buckets{};
+    };
+
+    std::atomic<bool>                                             enabled_{false};
+    std::chrono::steady_clock::time_point                         start_;
+    std::array<StageStats, static_cast<size_t>(ProfileStage::COUNT)> stages_;
+
+    Profiler() = default;
+
+    static size_t bucket_of(std::uint64_t nanoseconds);
+    static double bucket_value(size_t bucket);
+    double        percentile_ns(const StageStats& stats, double fraction) const;
+    double        wall_seconds() const;
+};
+
+/**
+ * @class ProfileScope
+ * @brief Times the enclosing block as one occurrence of a stage
+ *
+ * Does nothing unless the Profiler or the TraceRecorder is enabled. Scopes
+ * of different stages may nest on one thread; the inner time is then removed
+ * from the outer in the profile (the trace shows them nested).
+ */
+class ProfileScope
+{
+public:
+    explicit ProfileScope(ProfileStage stage, std::uint64_t bytes = 0);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    /**
+     * @brief Account bytes learned after the scope was opened (e.g. the file size)
+     */
+    void add_bytes(std::uint64_t bytes)
+    {
+        bytes_ += bytes;
+    }
+
+    bool active() const
+    {
+        return profile_ || trace_;
+    }
+
+private:
+    ProfileStage                          stage_;
+    std::uint64_t                         bytes_;
+    bool                                  profile_;
+    bool                                  trace_;
+    std::chrono::steady_clock::time_point start_;
+    std::uint64_t                         child_ns_       = 0;
+    std::uint64_t                         trace_start_ns_ = 0;
+    ProfileScope*                         parent_         = nullptr;
+
+    static thread_local ProfileScope* current_;
+};
+
+#endif  // PROFILER_H
@@ -0,0 +1,171 @@
+/**
+ * @file trace_recorder.cpp
+ * @brief Implementation of the --trace timeline
+ * @author Le Nhan Pham
+ * @date 2026
+ */
+
+#include "utilities/trace_recorder.h"
+#include "utilities/ndjson_writer.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+    /// Copy the tail of @p text into a fixed field (the end of a path is the informative part)
+    template <size_t N>
+    void copy_tail(char (&field)[N], std::string_view text)
+    {
+        if (text.size() >= N)
+        {
+            text.remove_prefix(text.size() - (N - 1));
+        }
+        std::memcpy(field, text.data(), text.size());
+        field[text.size()] = '\0';
+    }
+}  // namespace
+
+thread_local TraceRecorder::ThreadRing* TraceRecorder::ring_ = nullptr;
+
+TraceRecorder& TraceRecorder::instance()
+{
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::enable()
+{
+    start_       = std::chrono::steady_clock::now();
+    main_thread_ = std::this_thread::get_id();
+    enabled_.store(true, std::memory_order_release);
+}
+
+std::uint64_t TraceRecorder::now_ns() const
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+}
+
+TraceRecorder::ThreadRing& TraceRecorder::thread_ring()
+{
+    if (ring_ == nullptr)
+    {
+        auto ring = std::make_unique<ThreadRing>();
+        ring->events.resize(RING_EVENTS);
+        ring->main = (std::this_thread::get_id() == main_thread_);
+
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        ring->tid = static_cast<std::uint32_t>(rings_.size() + 1);
+        ring_     = ring.get();
+        rings_.push_back(std::move(ring));
+    }
+    return *ring_;
+}
+
+void TraceRecorder::record(const TraceEvent& event)
+{
+    ThreadRing&   ring  = thread_ring();
+    std::uint64_t index = ring.recorded.load(std::memory_order_relaxed);
+    ring.events[index % RING_EVENTS] = event;
+    ring.recorded.store(index + 1, std::memory_order_release);
+}
+
+bool TraceRecorder::write(const std::string& path, const std::string& command) const
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    std::uint64_t               dropped = 0;
+    bool                        first   = true;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const auto& ring : rings_)
+    {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ring->tid
+            << ",\"args\":{\"name\":\"" << (ring->main ? "main" : "worker ");
+        if (!ring->main)
+        {
+            out << ring->tid;
+        }
+        out << "\"}}";
+        first = false;
+
+        std::uint64_t recorded = ring->recorded.load(std::memory_order_acquire);
+        std::uint64_t kept     = std::min<std::uint64_t>(recorded, RING_EVENTS);
+        dropped += recorded - kept;
+
+        for (std::uint64_t n = recorded - kept; n < recorded; ++n)
+        {
+            const TraceEvent& event = ring->events[n % RING_EVENTS];
+            out << ",\n{\"name\":";
+            write_json_string(out, event.file[0] != '\0' ? event.file : event.name);
+            out << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":"
+                << static_cast<double>(event.start_ns) * 1e-3
+                << ",\"dur\":" << static_cast<double>(event.duration_ns) * 1e-3 << ",\"pid\":1,\"tid\":" << ring->tid
+                << ",\"args\":{\"stage\":\"" << event.name << "\"";
+            if (event.bytes > 0)
+            {
+                out << ",\"bytes\":" << event.bytes;
+            }
+            if (event.program[0] != '\0')
+            {
+                out << ",\"program\":";
+                write_json_string(out, event.program);
+            }
+            out << "}}";
+        }
+    }
+    out << "\n],\"otherData\":{\"command\":";
+    write_json_string(out, command);
+    out << ",\"threads\":" << rings_.size() << ",\"dropped_events\":" << dropped << "}}\n";
+    return static_cast<bool>(out);
+}
+
+TraceSpan::TraceSpan(const char* category, const char* name, std::string_view file)
+    : active_(TraceRecorder::instance().enabled())
+{
+    if (!active_)
+    {
+        return;
+    }
+    event_.category = category;
+    event_.name     = name;
+    if (!file.empty())
+    {
+        copy_tail(event_.file, file);
+    }
+    event_.start_ns = TraceRecorder::instance().now_ns();
+}
+
+TraceSpan::~TraceSpan()
+{
+    end();
+}
+
+void TraceSpan::set_program(std::string_view program)
+{
+    if (active_)
+    {
+        copy_tail(event_.program, program);
+    }
+}
+
+void TraceSpan::end()
+{
+    if (!active_)
+    {
+        return;
+    }
+    active_ = false;
+
+    std::uint64_t now  = TraceRecorder::instance().now_ns();
+    event_.duration_ns = now > event_.start_ns ? now - event_.start_ns : 0;
+    TraceRecorder::instance().record(event_);
+}
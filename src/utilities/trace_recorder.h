@@ -0,0 +1,152 @@
+/**
+ * @file trace_recorder.h
+ * @brief Chrome/Perfetto trace-event timeline of the worker threads (--trace)
+ * @author Le Nhan Pham
+ * @date 2026
+ *
+ * With the common option --trace out.json, every thread that does work gets
+ * its own track in the timeline: one span per file (with file name, bytes
+ * and program), the --profile stages inside it, and the time spent waiting
+ * for a file handle, the memory budget or a results lock. The file opens in
+ * chrome://tracing or https://ui.perfetto.dev and shows straggler files and
+ * starved threads at a glance.
+ *
+ * @section Recording
+ * Each thread appends to its own ring buffer, registered once under a lock
+ * on the first event of that thread. Appending is a plain store into the
+ * ring and a release store of the count: no lock, no allocation, no
+ * formatting. A thread that records more than RING_EVENTS events keeps the
+ * most recent ones; the number overwritten is reported in the trace's
+ * "otherData". The rings are read only after the command has finished and
+ * all workers have joined.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct TraceEvent
+ * @brief One complete span ("ph":"X") of a thread's track
+ */
+struct TraceEvent
+{
+    std::uint64_t start_ns    = 0;        ///< Since the recorder was enabled
+    std::uint64_t duration_ns = 0;
+    std::uint64_t bytes       = 0;        ///< 0 = not written
+    const char*   name        = nullptr;  ///< Static string; the file name is used when set
+    const char*   category    = nullptr;  ///< "file", "stage" or "wait"
+    char          file[56]    = {};       ///< Tail of the file name, NUL-terminated
+    char          program[16] = {};       ///< Program that wrote the file, if known
+};
+
+/**
+ * @class TraceRecorder
+ * @brief Process-wide owner of the per-thread rings
+ */
+class TraceRecorder
+{
+public:
+    static constexpr size_t RING_EVENTS = 16384;  ///< Events kept per thread
+
+    static TraceRecorder& instance();
+
+    /**
+     * @brief Start recording; timestamps are relative to this call and the calling thread is "main"
+     */
+    void enable();
+
+    bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Nanoseconds since enable() on the monotonic clock
+     */
+    std::uint64_t now_ns() const;
+
+    /**
+     * @brief Append @p event to the calling thread's ring
+     */
+    void record(const TraceEvent& event);
+
+    /**
+     * @brief Write all rings as a Chrome trace-event JSON file
+     * @param path Output file
+     * @param command Name of the command, stored in "otherData"
+     * @return false if the file could not be written
+     *
+     * Call only once the worker threads have finished.
+     */
+    bool write(const std::string& path, const std::string& command) const;
+
+private:
+    struct ThreadRing
+    {
+        std::vector<TraceEvent>    events;
+        std::atomic<std::uint64_t> recorded{0};  ///< Total appended; the ring holds the last RING_EVENTS
+        std::uint32_t              tid  = 0;
+        bool                       main = false;
+    };
+
+    std::atomic<bool>                        enabled_{false};
+    std::chrono::steady_clock::time_point    start_;
+    std::thread::id                          main_thread_;
+    mutable std::mutex                       registry_mutex_;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+
+    static thread_local ThreadRing* ring_;
+
+    TraceRecorder() = default;
+
+    ThreadRing& thread_ring();
+};
+
+/**
+ * @class TraceSpan
+ * @brief Records the enclosing block (or up to end()) as one span
+ *
+ * Does nothing unless the recorder is enabled.
+ */
+class TraceSpan
+{
+public:
+    /**
+     * @param category "file", "stage" or "wait"
+     * @param name Static label of the span
+     * @param file File the span works on; shown as the span name when given
+     */
+    TraceSpan(const char* category, const char* name, std::string_view file = {});
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&)            = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    void add_bytes(std::uint64_t bytes)
+    {
+        event_.bytes += bytes;
+    }
+
+    void set_program(std::string_view program);
+
+    /**
+     * @brief Close the span before the end of the block (e.g. once a lock is held)
+     */
+    void end();
+
+private:
+    TraceEvent event_;
+    bool       active_;
+};
+
+#endif  // TRACE_RECORDER_H
@@ -1,4 +1,5 @@
 #include "utilities/utils.h"
+#include "utilities/parse_stats.h"
 #include <algorithm>
 #include <chrono>
 #include <filesystem>
@@ -29,7 +30,10 @@ namespace Utils
             std::ostringstream buffer;
             buffer << file.rdbuf();
             file.close();
-            return buffer.str();
+            std::string content = buffer.str();
+            CCK_STAT_BYTES(content.size());
+            CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(content.begin(), content.end(), '\n')));
+            return content;
         }
 
         // For TAIL or SMART mode
@@ -72,6 +76,8 @@ namespace Utils
                 accumulated.insert(0, buffer.data(), chunk_to_read);
                 lines_found += chunk_lines;
             }
+            CCK_STAT_BYTES(accumulated.size());
+            CCK_STAT_LINES(lines_found);
 
             // Trim to desired number of lines
             size_t start_pos        = accumulated.length();
@@ -97,6 +103,8 @@ namespace Utils
                 std::ostringstream buffer;
                 buffer << file.rdbuf();
                 result = buffer.str();
+                CCK_STAT_BYTES(result.size());
+                CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(result.begin(), result.end(), '\n')));
             }
 
             file.close();
@@ -108,7 +116,10 @@ namespace Utils
         std::ostringstream buffer;
         buffer << file.rdbuf();
         file.close();
-        return buffer.str();
+        std::string content = buffer.str();
+        CCK_STAT_BYTES(content.size());
+        CCK_STAT_LINES(static_cast<std::uint64_t>(std::count(content.begin(), content.end(), '\n')));
+        return content;
     }
 
     std::filesystem::path generate_unique_filename(const std::filesystem::path& base_path)
@@ -0,0 +1,242 @@
+/**
+ * @file gaussian_engines_test.cpp
+ * @brief Compare the Gaussian scanner engines on real logs
+ *
+ * scan_reverse() must give the same GaussianScanData as scan() on every log,
+ * including logs made of several --link1-- sections with internal job steps,
+ * where the earlier steps hold the lowest frequency and part of the counters.
+ * tests/engines/multi-link1.log is such a log: two opt+freq jobs trimmed to
+ * their banners, routes, marker lines and archive entries. A padded copy is
+ * written to a temporary directory so that lines cross the block boundaries
+ * of the backward reader and the earlier steps span several forward chunks.
+ *
+ * scan_archive_tail() must agree with scan() on single-step logs, up to the
+ * precision of the archive entry, and refuse every multi-step log.
+ * tests/engines/single-step-freq.log and single-step-opt.log are the freq and
+ * the opt step of BIH-conformers-1.log, each under its own banner.
+ */
+
+#include "extraction/gaussian_scanner.h"
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Defined in main.cpp for cck; the library objects linked in here refer to it
+std::atomic<bool> g_shutdown_requested{false};
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    int failures = 0;
+
+    std::string read_file(const fs::path& path)
+    {
+        std::ifstream      in(path, std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    GaussianScanData preset()
+    {
+        GaussianScanData data;
+        data.temp     = 298.15;
+        data.pressure = 1.0;
+        return data;
+    }
+
+    std::string join(const std::vector<std::string>& lines)
+    {
+        std::string joined;
+        for (const auto& line : lines)
+        {
+            joined += line + "\n";
+        }
+        return joined;
+    }
+
+    template <typename T>
+    void expect_equal(const std::string& name, const char* field, const T& expected, const T& actual)
+    {
+        if (!(expected == actual))
+        {
+            std::cerr << name << ": " << field << " differs from scan(): expected " << expected << ", got " << actual
+                      << "\n";
+            ++failures;
+        }
+    }
+
+    void expect_same(const std::string& name, const GaussianScanData& expected, const GaussianScanData& actual)
+    {
+        expect_equal(name, "copyright_count", expected.copyright_count, actual.copyright_count);
+        expect_equal(name, "normal_count", expected.normal_count, actual.normal_count);
+        expect_equal(name, "error_count", expected.error_count, actual.error_count);
+        expect_equal(name, "has_scf", expected.has_scf, actual.has_scf);
+        expect_equal(name, "scf", expected.scf, actual.scf);
+        expect_equal(name, "scftd", expected.scftd, actual.scftd);
+        expect_equal(name, "scfEqui", expected.scfEqui, actual.scfEqui);
+        expect_equal(name, "zpe", expected.zpe, actual.zpe);
+        expect_equal(name, "tcg", expected.tcg, actual.tcg);
+        expect_equal(name, "etg", expected.etg, actual.etg);
+        expect_equal(name, "ezpe", expected.ezpe, actual.ezpe);
+        expect_equal(name, "nucleare", expected.nucleare, actual.nucleare);
+        expect_equal(name, "temp", expected.temp, actual.temp);
+        expect_equal(name, "pressure", expected.pressure, actual.pressure);
+        expect_equal(name, "scrf_seen", expected.scrf_seen, actual.scrf_seen);
+        expect_equal(name, "has_negative_freq", expected.has_negative_freq, actual.has_negative_freq);
+        expect_equal(name, "last_negative_freq", expected.last_negative_freq, actual.last_negative_freq);
+        expect_equal(name, "has_positive_freq", expected.has_positive_freq, actual.has_positive_freq);
+        expect_equal(name, "min_positive_freq", expected.min_positive_freq, actual.min_positive_freq);
+        expect_equal(name, "tail_normal_termination", expected.tail_normal_termination,
+                     actual.tail_normal_termination);
+        expect_equal(name, "seen", expected.seen, actual.seen);
+        expect_equal(name, "warnings", join(expected.warnings), join(actual.warnings));
+    }
+
+    void check_reverse(const fs::path& path)
+    {
+        const GaussianScanner& scanner = GaussianScanner::instance();
+        const std::string      name    = path.filename().string();
+        const std::string      text    = read_file(path);
+
+        GaussianScanData forward = preset();
+        scanner.scan(text, name, forward);
+
+        GaussianScanData backward = preset();
+        scanner.scan_reverse(path.string(), name, backward);
+        expect_same(name + " (reverse)", forward, backward);
+    }
+
+    void expect_near(const std::string& name, const char* field, double expected, double actual, double tolerance)
+    {
+        if (!(std::abs(expected - actual) <= tolerance))
+        {
+            std::cerr << name << ": " << field << " differs from scan(): expected " << expected << ", got " << actual
+                      << "\n";
+            ++failures;
+        }
+    }
+
+    void check_archive(const fs::path& path, bool single_step)
+    {
+        const GaussianScanner& scanner = GaussianScanner::instance();
+        const std::string      name    = path.filename().string() + " (archive)";
+        const std::string      text    = read_file(path);
+
+        GaussianScanData forward = preset();
+        scanner.scan(text, name, forward);
+
+        GaussianScanData archive = preset();
+        if (scanner.scan_archive_tail(text, name, archive) != single_step)
+        {
+            std::cerr << name << ": scan_archive_tail() "
+                      << (single_step ? "refused a single-step log" : "accepted a multi-step log") << "\n";
+            ++failures;
+            return;
+        }
+        if (!single_step)
+        {
+            return;
+        }
+
+        expect_equal(name, "copyright_count", forward.copyright_count, archive.copyright_count);
+        expect_equal(name, "normal_count", forward.normal_count, archive.normal_count);
+        expect_equal(name, "error_count", forward.error_count, archive.error_count);
+        expect_equal(name, "tail_normal_termination", forward.tail_normal_termination,
+                     archive.tail_normal_termination);
+        expect_equal(name, "has_scf", forward.has_scf, archive.has_scf);
+        expect_equal(name, "scrf_seen", forward.scrf_seen, archive.scrf_seen);
+        expect_equal(name, "temp", forward.temp, archive.temp);
+        expect_equal(name, "pressure", forward.pressure, archive.pressure);
+        expect_equal(name, "has_negative_freq", forward.has_negative_freq, archive.has_negative_freq);
+        expect_equal(name, "has_positive_freq", forward.has_positive_freq, archive.has_positive_freq);
+
+        // HF= has 7 decimals, the thermochemistry lines 6; frequencies are recomputed
+        expect_near(name, "scf", forward.scf, archive.scf, 5e-8);
+        expect_near(name, "nucleare", forward.nucleare, archive.nucleare, 1e-6);
+        expect_near(name, "zpe", forward.zpe, archive.zpe, 1e-9);
+        expect_near(name, "tcg", forward.tcg, archive.tcg, 1e-6);
+        expect_near(name, "etg", forward.etg, archive.etg, 1e-9);
+        expect_near(name, "ezpe", forward.ezpe, archive.ezpe, 1e-6);
+        expect_near(name, "last_negative_freq", forward.last_negative_freq, archive.last_negative_freq, 0.005);
+        expect_near(name, "min_positive_freq", forward.min_positive_freq, archive.min_positive_freq, 0.005);
+    }
+
+    /// @p source with filler lines inserted before the first line containing @p before, written to @p path
+    void write_padded(const fs::path& source, const fs::path& path, const std::string& before)
+    {
+        std::string text  = read_file(source);
+        size_t      first = text.find(before);
+        size_t      at    = text.rfind('\n', first) + 1;
+
+        std::string filler;
+        filler += " " + std::string(300 * 1024, 'x') + "\n";  // Longer than one backward block
+        while (filler.size() < 9 * 1024 * 1024)
+        {
+            filler += " Iteration filler line without any marker, 0.123456789 -0.987654321\n";
+        }
+        text.insert(at, filler);
+
+        std::ofstream out(path, std::ios::binary);
+        out << text;
+    }
+}  // namespace
+
+int main()
+{
+    const fs::path fixture = "tests/engines/multi-link1.log";
+    if (!fs::exists(fixture))
+    {
+        std::cerr << "gaussian_engines_test: run from the top of the source tree (" << fixture << " not found)\n";
+        return 1;
+    }
+
+    const fs::path single_freq = "tests/engines/single-step-freq.log";
+    const fs::path single_opt  = "tests/engines/single-step-opt.log";
+
+    check_reverse(fixture);
+    check_archive(fixture, false);
+    check_archive(single_freq, true);
+    check_archive(single_opt, true);
+    for (const auto& entry : fs::directory_iterator("tests/gaussian"))
+    {
+        if (entry.path().extension() == ".log")
+        {
+            check_reverse(entry.path());
+            check_archive(entry.path(), false);
+        }
+    }
+
+    const fs::path scratch = fs::temp_directory_path() / "cck_gaussian_engines_test";
+    fs::create_directories(scratch);
+    const fs::path padded = scratch / "multi-link1-padded.log";
+    write_padded(fixture, padded, "Normal termination");
+    check_reverse(padded);
+    check_archive(padded, false);
+
+    // Only the head and the tail of a large single-step log are read
+    const fs::path padded_freq = scratch / "single-step-freq-padded.log";
+    write_padded(single_freq, padded_freq, "Frequencies --");
+    check_archive(padded_freq, true);
+
+    // No archive entry: a job that is still running
+    const std::string freq_text = read_file(single_freq);
+    const fs::path    running   = scratch / "single-step-freq-running.log";
+    std::ofstream(running, std::ios::binary) << freq_text.substr(0, freq_text.find("\n 1\\1\\") + 1);
+    check_archive(running, false);
+    fs::remove_all(scratch);
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " engine check(s) failed\n";
+        return 1;
+    }
+    std::cout << "gaussian_engines_test: scan_reverse() and scan_archive_tail() match scan() on every log\n";
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file symmetry_test.cpp
+ * @brief Point group detection on small molecules of known symmetry
+ *
+ * add_perm used to store atom permutations 0-based next to the 1-based
+ * identity and inversion, so on a molecule with more permutations than atoms
+ * symclass built a class with natoms + 1 members and wrote past nscl. Four
+ * atoms on a rectangle, the smallest molecule built from the C2v operations
+ * applied to one general position, crashed that way.
+ */
+
+#include "thermo/chemsys.h"
+#include "thermo/symmetry.h"
+#include <atomic>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Defined in main.cpp for cck; the library objects linked in here refer to it
+std::atomic<bool> g_shutdown_requested{false};
+
+namespace
+{
+    int failures = 0;
+
+    std::string trim(const std::string& text)
+    {
+        size_t begin = text.find_first_not_of(' ');
+        size_t end   = text.find_last_not_of(' ');
+        return begin == std::string::npos ? std::string() : text.substr(begin, end - begin + 1);
+    }
+
+    void expect_group(const std::string& name, const std::vector<Atom>& atoms, const std::string& group, int rotsym)
+    {
+        symmetry::SymmetryDetector detector;
+        detector.ncenter = static_cast<int>(atoms.size());
+        detector.a       = atoms;
+        detector.a_index.resize(atoms.size());
+        std::iota(detector.a_index.begin(), detector.a_index.end(), 0);
+        detector.detectPG(0);
+
+        std::string found = trim(detector.PGname);
+        if (found != group || detector.rotsym != rotsym)
+        {
+            std::cerr << name << ": expected " << group << " (rotsym " << rotsym << "), got " << found << " (rotsym "
+                      << detector.rotsym << ")\n";
+            ++failures;
+        }
+    }
+}  // namespace
+
+int main()
+{
+    expect_group("water",
+                 {{8, 0.0, 0.0, 0.1173, 15.9949}, {1, 0.0, 0.7572, -0.4692, 1.0078}, {1, 0.0, -0.7572, -0.4692, 1.0078}},
+                 "C2v", 2);
+    // Four atoms on a rectangle, each the C2v image of one general position:
+    // eight permutations for four atoms, the case that overflowed nscl
+    expect_group("rectangular C4",
+                 {{6, 0.9, 0.7, 0.5, 12.0}, {6, -0.9, -0.7, 0.5, 12.0}, {6, 0.9, -0.7, 0.5, 12.0}, {6, -0.9, 0.7, 0.5, 12.0}},
+                 "D2h", 4);
+    expect_group("ammonia",
+                 {{7, 0.0, 0.0, 0.1162, 14.0031},
+                  {1, 0.0, 0.9397, -0.2711, 1.0078},
+                  {1, 0.8138, -0.4699, -0.2711, 1.0078},
+                  {1, -0.8138, -0.4699, -0.2711, 1.0078}},
+                 "C3v", 3);
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " point group check(s) failed\n";
+        return 1;
+    }
+    std::cout << "symmetry_test: all point group checks passed\n";
+    return 0;
+}